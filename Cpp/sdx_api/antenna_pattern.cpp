@@ -0,0 +1,144 @@
+#include "antenna_pattern.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace Sdx
+{
+
+namespace
+{
+const double PI = 3.14159265358979323846;
+
+inline double interpolate(const double* values,
+                          std::size_t rows,
+                          std::size_t columns,
+                          double rowsPerRadian,
+                          double columnsPerRadian,
+                          double elevation,
+                          double azimuth)
+{
+  // A non-finite angle is looked up as 0 so the indices stay in range, and its gain is NaN
+  const bool isFinite = std::isfinite(elevation) && std::isfinite(azimuth);
+  elevation = isFinite ? elevation : 0.0;
+  azimuth = isFinite ? azimuth : 0.0;
+
+  // The first row of the pair stops one before the last row, the fraction reaches 1 on the last row
+  const double rowPosition = std::clamp((elevation + PI / 2.0) * rowsPerRadian, 0.0, static_cast<double>(rows - 1));
+  const std::size_t row0 = std::min(static_cast<std::size_t>(rowPosition), rows > 1 ? rows - 2 : 0);
+  const std::size_t row1 = std::min(row0 + 1, rows - 1);
+  const double rowFraction = rowPosition - static_cast<double>(row0);
+
+  double columnPosition = azimuth * columnsPerRadian;
+  columnPosition -= std::floor(columnPosition / static_cast<double>(columns)) * static_cast<double>(columns);
+  const std::size_t column0 = std::min(static_cast<std::size_t>(columnPosition), columns - 1);
+  const std::size_t column1 = (column0 + 1) * static_cast<std::size_t>(column0 + 1 < columns);
+  const double columnFraction = columnPosition - static_cast<double>(column0);
+
+  const double* first = values + row0 * columns;
+  const double* second = values + row1 * columns;
+  const double top = first[column0] + columnFraction * (first[column1] - first[column0]);
+  const double bottom = second[column0] + columnFraction * (second[column1] - second[column0]);
+  const double gain = top + rowFraction * (bottom - top);
+  return isFinite ? gain : std::numeric_limits<double>::quiet_NaN();
+}
+} // namespace
+
+AntennaPattern::AntennaPattern() : m_rows(0), m_columns(0), m_rowsPerRadian(0.0), m_columnsPerRadian(0.0)
+{
+}
+
+AntennaPattern::AntennaPattern(std::size_t rows, std::size_t columns, double value) :
+  m_rows(rows),
+  m_columns(columns),
+  m_values(rows * columns, value)
+{
+  updateScales();
+}
+
+AntennaPattern::AntennaPattern(const std::vector<std::vector<double>>& matrix) :
+  m_rows(matrix.size()),
+  m_columns(matrix.empty() ? 0 : matrix.front().size())
+{
+  if (m_rows == 0 || m_columns == 0)
+    throw std::invalid_argument("Antenna pattern is empty");
+
+  m_values.reserve(m_rows * m_columns);
+  for (const std::vector<double>& row : matrix)
+  {
+    if (row.size() != m_columns)
+      throw std::invalid_argument("Antenna pattern rows must have the same size");
+    m_values.insert(m_values.end(), row.begin(), row.end());
+  }
+  updateScales();
+}
+
+std::vector<std::vector<double>> AntennaPattern::toMatrix() const
+{
+  std::vector<std::vector<double>> matrix;
+  matrix.reserve(m_rows);
+  for (std::size_t i = 0; i < m_rows; ++i)
+    matrix.emplace_back(m_values.begin() + i * m_columns, m_values.begin() + (i + 1) * m_columns);
+  return matrix;
+}
+
+double AntennaPattern::gainAt(double elevation, double azimuth) const
+{
+  if (empty())
+    throw std::logic_error("Antenna pattern is empty");
+  return interpolate(m_values.data(), m_rows, m_columns, m_rowsPerRadian, m_columnsPerRadian, elevation, azimuth);
+}
+
+void AntennaPattern::gainAt(std::span<const double> elevations,
+                            std::span<const double> azimuths,
+                            std::span<double> gains) const
+{
+  if (empty())
+    throw std::logic_error("Antenna pattern is empty");
+  if (elevations.size() != azimuths.size() || gains.size() < elevations.size())
+    throw std::invalid_argument("Antenna pattern lookup sizes don't match");
+
+  const double* values = m_values.data();
+  for (std::size_t i = 0; i < elevations.size(); ++i)
+    gains[i] = interpolate(values, m_rows, m_columns, m_rowsPerRadian, m_columnsPerRadian, elevations[i], azimuths[i]);
+}
+
+void AntennaPattern::gainAt(std::span<const Sdx::ElevationAzimuth> directions, std::span<double> gains) const
+{
+  if (empty())
+    throw std::logic_error("Antenna pattern is empty");
+  if (gains.size() < directions.size())
+    throw std::invalid_argument("Antenna pattern lookup sizes don't match");
+
+  const double* values = m_values.data();
+  for (std::size_t i = 0; i < directions.size(); ++i)
+  {
+    gains[i] = interpolate(values,
+                           m_rows,
+                           m_columns,
+                           m_rowsPerRadian,
+                           m_columnsPerRadian,
+                           directions[i].Elevation,
+                           directions[i].Azimuth);
+  }
+}
+
+bool AntennaPattern::operator==(const AntennaPattern& other) const
+{
+  return m_rows == other.m_rows && m_columns == other.m_columns && m_values == other.m_values;
+}
+
+bool AntennaPattern::operator!=(const AntennaPattern& other) const
+{
+  return !(*this == other);
+}
+
+void AntennaPattern::updateScales()
+{
+  m_rowsPerRadian = m_rows > 1 ? static_cast<double>(m_rows - 1) / PI : 0.0;
+  m_columnsPerRadian = static_cast<double>(m_columns) / (2.0 * PI);
+}
+
+} // namespace Sdx
@@ -0,0 +1,115 @@
+#ifndef ANTENNA_PATTERN_H
+#define ANTENNA_PATTERN_H
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+#include "gen/ElevationAzimuth.h"
+#include "parse_json.hpp"
+
+namespace Sdx
+{
+
+//
+// Antenna gain or phase offset pattern, stored contiguously in row-major order.
+//
+// Rows are mapped to elevation [-90, 90] (first and last rows included) and columns to azimuth [0, 360[ (the last
+// column wraps around to the first one), like the matrices of the antenna commands. Angles are in radians.
+//
+class AntennaPattern
+{
+public:
+  AntennaPattern();
+  AntennaPattern(std::size_t rows, std::size_t columns, double value = 0.0);
+  // Throws std::invalid_argument if the matrix is empty or if its rows don't have the same size
+  explicit AntennaPattern(const std::vector<std::vector<double>>& matrix);
+
+  std::vector<std::vector<double>> toMatrix() const;
+
+  inline std::size_t rows() const { return m_rows; }
+  inline std::size_t columns() const { return m_columns; }
+  inline bool empty() const { return m_values.empty(); }
+  inline const double* data() const { return m_values.data(); }
+  inline double* data() { return m_values.data(); }
+  inline double operator()(std::size_t row, std::size_t column) const { return m_values[row * m_columns + column]; }
+  inline double& operator()(std::size_t row, std::size_t column) { return m_values[row * m_columns + column]; }
+  inline std::span<const double> row(std::size_t row) const { return {m_values.data() + row * m_columns, m_columns}; }
+
+  // Bilinear interpolation of the pattern in a direction. Elevations outside of [-pi/2, pi/2] are clamped and
+  // azimuths are wrapped. The gain is NaN if an angle isn't finite.
+  double gainAt(double elevation, double azimuth) const;
+
+  // Same as gainAt for many directions at once, the pattern is checked once for all of them
+  void gainAt(std::span<const double> elevations, std::span<const double> azimuths, std::span<double> gains) const;
+  void gainAt(std::span<const Sdx::ElevationAzimuth> directions, std::span<double> gains) const;
+
+  bool operator==(const AntennaPattern& other) const;
+  bool operator!=(const AntennaPattern& other) const;
+
+private:
+  void updateScales();
+
+  std::size_t m_rows;
+  std::size_t m_columns;
+  std::vector<double> m_values;
+  double m_rowsPerRadian;
+  double m_columnsPerRadian;
+};
+
+} // namespace Sdx
+
+// Reads and writes the JSON matrix form without going through nested vectors
+template<>
+struct parse_json<Sdx::AntennaPattern>
+{
+  static bool is_valid(const rapidjson::Value& value)
+  {
+    if (!value.IsArray() || value.Empty() || !value[0].IsArray())
+      return false;
+    const rapidjson::SizeType columns = value[0].Size();
+    for (const rapidjson::Value& row : value.GetArray())
+    {
+      if (!row.IsArray() || row.Size() != columns)
+        return false;
+      for (const rapidjson::Value& element : row.GetArray())
+        if (!parse_json<double>::is_valid(element))
+          return false;
+    }
+    return columns > 0;
+  }
+
+  static Sdx::AntennaPattern parse(const rapidjson::Value& value)
+  {
+    if (!value.IsArray() || value.Empty() || !value[0].IsArray() || value[0].Empty())
+      throw std::runtime_error("Unexpected value");
+
+    Sdx::AntennaPattern sent(value.Size(), value[0].Size());
+    double* element = sent.data();
+    for (const rapidjson::Value& row : value.GetArray())
+    {
+      if (!row.IsArray() || row.Size() != sent.columns())
+        throw std::runtime_error("Unexpected value");
+      for (const rapidjson::Value& v : row.GetArray())
+        *element++ = parse_json<double>::parse(v);
+    }
+    return sent;
+  }
+
+  static rapidjson::Value format(const Sdx::AntennaPattern& value, rapidjson::Value::AllocatorType& alloc)
+  {
+    rapidjson::Value sent(rapidjson::kArrayType);
+    sent.Reserve(static_cast<rapidjson::SizeType>(value.rows()), alloc);
+    for (std::size_t i = 0; i < value.rows(); ++i)
+    {
+      rapidjson::Value row(rapidjson::kArrayType);
+      row.Reserve(static_cast<rapidjson::SizeType>(value.columns()), alloc);
+      for (double v : value.row(i))
+        row.PushBack(v, alloc);
+      sent.PushBack(row, alloc);
+    }
+    return sent;
+  }
+};
+
+#endif // ANTENNA_PATTERN_H
@@ -13,12 +13,25 @@
 #include <netdb.h>
 #include <netinet/in.h>
 #include <sys/socket.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
 #include <sys/types.h>
 #include <unistd.h>
 #endif
 
+#include <rapidjson/writer.h>
+
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <iostream>
+#include <list>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
 #include "all_commands.h"
 #include "command_base.h"
@@ -26,34 +39,180 @@
 #include "command_result.h"
 
 #define CMD_BLOCK_SIZE 65535
+#define CMD_HEADER_SIZE 3
+#define CMD_RESULT_HEADER_SIZE 7
+#define CMD_READ_BUFFER_SIZE 262144
+#define CMD_MAX_PENDING_RESULTS 4096
 
 namespace Sdx
 {
 
+namespace
+{
+// rapidjson output stream holding the command frames to send. The header of a frame is reserved before its JSON is
+// written in place, and filled once the size is known.
+class CmdFrameBuffer
+{
+public:
+  typedef char Ch;
+
+  inline void Put(char c) { m_data.push_back(c); }
+  inline void Flush() {}
+
+  inline void clear() { m_data.clear(); }
+  inline void resize(size_t size) { m_data.resize(size); }
+  inline size_t size() const { return m_data.size(); }
+  inline char* data() { return m_data.data(); }
+
+private:
+  std::vector<char> m_data;
+};
+
+// Uuid of the command of a serialized result, empty if it can't be found
+std::string relatedCommandUuid(const char* json, size_t size)
+{
+  rapidjson::Document result;
+  result.Parse(json, size);
+  if (result.HasParseError() || !result.IsObject())
+    return std::string();
+
+  auto relatedCommand = result.FindMember(CommandResult::RelatedCommand.c_str());
+  if (relatedCommand == result.MemberEnd() || !relatedCommand->value.IsString())
+    return std::string();
+
+  rapidjson::Document command;
+  command.Parse(relatedCommand->value.GetString(), relatedCommand->value.GetStringLength());
+  if (command.HasParseError() || !command.IsObject())
+    return std::string();
+
+  auto uuid = command.FindMember(CommandBase::CmdUuidKey.c_str());
+  if (uuid == command.MemberEnd() || !uuid->value.IsString())
+    return std::string();
+  return uuid->value.GetString();
+}
+} // namespace
+
 struct CmdClient::Pimpl
 {
+  // Also written by the thread receiving the results
+  std::mutex errorMutex;
   std::string error_message;
 
   int s;
   struct hostent* server;
   struct sockaddr_in serv_addr;
-  bool connected;
-  char message2Send[CMD_BLOCK_SIZE];
-  char message[CMD_BLOCK_SIZE];
+  std::atomic<bool> connected;
+  CmdFrameBuffer message2Send;
+  rapidjson::Writer<CmdFrameBuffer> writer;
+
+  // Received bytes are buffered, a single recv can bring many messages. The current message points in the buffer
+  // and is valid until the next receiveMessage().
+  std::vector<char> readBuffer;
+  size_t readBegin;
+  size_t readEnd;
+  const char* message;
+  size_t messageSize;
   std::string address;
-  bool stop_request;
+  std::atomic<bool> stop_request;
   bool exceptionOnError;
   bool verbose;
+
+  // A result that couldn't be parsed is parked with its error instead, and waitCommand throws it
+  struct PendingResult
+  {
+    CommandResultPtr result;
+    std::string error;
+    std::list<std::string>::iterator order;
+  };
+
+  std::unordered_map<std::string, PendingResult> pendingResults;
+  std::list<std::string> pendingOrder;
+  std::size_t maxPendingResults;
+
+  // Once an asynchronous command is sent, the reactor thread receives every result. Results with a registered
+  // callback are completed, others are parked for waitCommand.
+  std::mutex sendMutex;
+  std::mutex mutex;
+  std::condition_variable resultReceived;
+  std::unordered_map<std::string, ResultCallback> callbacks;
+  std::thread reactor;
+  bool reactorRunning;
+
+  // A single thread reads the socket at a time: a waitCommand caller, getServerApiVersion or the reactor. The
+  // reader completes the results of the other commands.
+  bool reading;
+#ifndef _WIN32
+  int wakeupFd;
+#endif
+
+  // Must be called with mutex locked
+  CommandResultPtr takePendingResult(const std::string& uuid)
+  {
+    auto it = pendingResults.find(uuid);
+    if (it == pendingResults.end())
+      return nullptr;
+
+    CommandResultPtr result = std::move(it->second.result);
+    const std::string error = std::move(it->second.error);
+    pendingOrder.erase(it->second.order);
+    pendingResults.erase(it);
+    if (!result)
+      throw std::runtime_error(error);
+    return result;
+  }
+
+  // Must be called with mutex locked
+  void parkPendingResult(CommandResultPtr result)
+  {
+    const std::string uuid = result->relatedCommandUuid();
+    parkPendingResult(uuid, std::move(result), std::string());
+  }
+
+  // Must be called with mutex locked
+  void parkPendingResult(const std::string& uuid, CommandResultPtr result, const std::string& error)
+  {
+    if (maxPendingResults == 0)
+      return;
+
+    if (auto it = pendingResults.find(uuid); it != pendingResults.end())
+    {
+      it->second.result = std::move(result);
+      it->second.error = error;
+      return;
+    }
+
+    // Results of posted commands that are never waited on must not accumulate forever
+    if (pendingResults.size() >= maxPendingResults)
+    {
+      pendingResults.erase(pendingOrder.front());
+      pendingOrder.pop_front();
+    }
+
+    auto order = pendingOrder.insert(pendingOrder.end(), uuid);
+    pendingResults.emplace(uuid, PendingResult {std::move(result), error, order});
+  }
 };
 
 CmdClient::CmdClient(bool exceptionOnError) : m(new Pimpl)
 {
+  m->writer.Reset(m->message2Send);
   m->s = -1;
   m->server = 0;
   m->connected = false;
   m->exceptionOnError = exceptionOnError;
   m->verbose = false;
   m->stop_request = false;
+  m->maxPendingResults = CMD_MAX_PENDING_RESULTS;
+  m->readBuffer.resize(CMD_READ_BUFFER_SIZE);
+  m->readBegin = 0;
+  m->readEnd = 0;
+  m->message = nullptr;
+  m->messageSize = 0;
+  m->reactorRunning = false;
+  m->reading = false;
+#ifndef _WIN32
+  m->wakeupFd = -1;
+#endif
 #if _WIN32
   WORD versionWanted = MAKEWORD(2, 0);
   WSADATA wsaData;
@@ -64,6 +223,7 @@ CmdClient::CmdClient(bool exceptionOnError) : m(new Pimpl)
 CmdClient::~CmdClient(void)
 {
   m->stop_request = true;
+  stopReactor();
   closeSocket();
 
   delete m;
@@ -74,7 +234,7 @@ CmdClient::~CmdClient(void)
 
 int CmdClient::port() const
 {
-  return static_cast<int>(m->serv_addr.sin_port);
+  return static_cast<int>(ntohs(m->serv_addr.sin_port));
 }
 
 const std::string& CmdClient::address() const
@@ -84,11 +244,13 @@ const std::string& CmdClient::address() const
 
 bool CmdClient::hasError() const
 {
+  std::lock_guard<std::mutex> lock(m->errorMutex);
   return !m->error_message.empty();
 }
 
 void CmdClient::clearError()
 {
+  std::lock_guard<std::mutex> lock(m->errorMutex);
   m->error_message.clear();
 }
 
@@ -143,7 +305,10 @@ bool CmdClient::isVerbose() const
 
 void CmdClient::errorMessage(const std::string& msg)
 {
-  m->error_message = msg;
+  {
+    std::lock_guard<std::mutex> lock(m->errorMutex);
+    m->error_message = msg;
+  }
   if (m->exceptionOnError)
     throw std::runtime_error(msg);
   if (m->verbose)
@@ -157,112 +322,557 @@ bool CmdClient::isConnected() const
 
 int CmdClient::getServerApiVersion()
 {
-  int msgSize = 7;
-  reinterpret_cast<uint16_t*>(&m->message2Send)[0] = msgSize - 2;
-  m->message2Send[2] = static_cast<char>(CmdMsgId_ApiVersion);
-  reinterpret_cast<uint32_t*>(&m->message2Send[3])[0] = Cmd::COMMANDS_API_VERSION;
-
-  if (sendMessage(m->message2Send, msgSize))
+  const int msgSize = 7;
+  char message2Send[msgSize];
+  const uint16_t length = msgSize - 2;
+  const uint32_t apiVersion = Cmd::COMMANDS_API_VERSION;
+  memcpy(&message2Send[0], &length, sizeof(length));
+  message2Send[2] = static_cast<char>(CmdMsgId_ApiVersion);
+  memcpy(&message2Send[3], &apiVersion, sizeof(apiVersion));
+
+  // The reader is taken before sending, so no other thread can receive the answer
+  acquireReader();
+  int version = 0;
+  try
   {
-    while (true)
+    if (sendMessage(message2Send, msgSize))
     {
-      if (!receiveMessage())
-        return 0;
-
-      int msgId = static_cast<int>(m->message[2]);
-      switch (msgId)
+      while (version == 0 && receiveMessage())
       {
-        case CmdMsgId_ApiVersion:
-          return reinterpret_cast<uint32_t*>(&m->message[3])[0];
-        default:
-          break;
+        if (static_cast<int>(m->message[2]) == CmdMsgId_ApiVersion)
+        {
+          uint32_t receivedVersion;
+          memcpy(&receivedVersion, &m->message[3], sizeof(receivedVersion));
+          version = static_cast<int>(receivedVersion);
+        }
+        else
+        {
+          dispatchMessage(std::string());
+        }
       }
     }
   }
+  catch (...)
+  {
+    releaseReader();
+    throw;
+  }
+
+  releaseReader();
+  return version;
+}
+
+bool CmdClient::serializeCommand(CommandBasePtr cmd)
+{
+  // The frame is appended to the connection's send buffer, the JSON is written in place after the reserved header
+  const size_t begin = m->message2Send.size();
+  m->message2Send.resize(begin + CMD_HEADER_SIZE);
+  m->writer.Reset(m->message2Send);
+  cmd->values().Accept(m->writer);
+  m->message2Send.Put('\0');
+
+  // Command frames are sized with 16 bits
+  const size_t msgSize = m->message2Send.size() - begin;
+  if (msgSize - 2 > CMD_BLOCK_SIZE)
+  {
+    m->message2Send.resize(begin);
+    errorMessage("Command " + cmd->name() + " is too large to be sent (" + std::to_string(msgSize) + " bytes)");
+    return false;
+  }
 
-  return 0;
+  char* header = m->message2Send.data() + begin;
+  const uint16_t length = static_cast<uint16_t>(msgSize - 2);
+  memcpy(&header[0], &length, sizeof(length));
+  header[2] = static_cast<char>(CmdMsgId_Command);
+  return true;
 }
 
 bool CmdClient::sendCommand(CommandBasePtr cmd)
 {
-  std::string jsonStr = cmd->toString();
-  m->message2Send[2] = static_cast<char>(CmdMsgId_Command);
-  memcpy(&m->message2Send[3], jsonStr.c_str(), jsonStr.size() + 1);
+  std::lock_guard<std::mutex> lock(m->sendMutex);
+
+  m->message2Send.clear();
+  if (!serializeCommand(cmd))
+    return false;
+
+  return sendMessage(m->message2Send.data(), static_cast<int>(m->message2Send.size()));
+}
+
+bool CmdClient::sendCommands(const std::vector<CommandBasePtr>& cmds)
+{
+  std::lock_guard<std::mutex> lock(m->sendMutex);
+
+  // All the frames are written one after the other and sent at once
+  m->message2Send.clear();
+  for (const CommandBasePtr& cmd : cmds)
+  {
+    if (!serializeCommand(cmd))
+      return false;
+  }
 
-  int msgSize = static_cast<int>(jsonStr.size()) + 4;
-  reinterpret_cast<uint16_t*>(&m->message2Send)[0] = msgSize - 2;
+  if (m->message2Send.size() == 0)
+    return true;
 
-  return sendMessage(m->message2Send, msgSize);
+  return sendMessage(m->message2Send.data(), static_cast<int>(m->message2Send.size()));
 }
 
 CommandResultPtr CmdClient::waitCommand(CommandBasePtr cmd)
 {
+  std::unique_lock<std::mutex> lock(m->mutex);
   while (true)
   {
-    if (!receiveMessage())
+    if (auto result = m->takePendingResult(cmd->uuid()))
+      return result;
+
+    // Once started, the reactor receives every result. Until then, one of the waiting threads reads for all of them.
+    if (m->reactor.joinable())
+    {
+      if (!m->reactorRunning)
+        break;
+    }
+    else if (!m->reading)
     {
-      std::cout << "Failed to receive command result. Is server still running?" << std::endl;
-      throw std::runtime_error("Failed to receive command result. Is server still running?");
+      m->reading = true;
+      lock.unlock();
+      if (auto result = readResult(cmd->uuid()))
+        return result;
+      break;
     }
 
-    int msgId = static_cast<int>(m->message[2]);
-    switch (msgId)
+    m->resultReceived.wait(lock);
+  }
+
+  throw std::runtime_error("Failed to receive command result. Is server still running?");
+}
+
+CommandResultPtr CmdClient::readResult(const std::string& uuid)
+{
+  CommandResultPtr result;
+  try
+  {
+    while (!result && receiveMessage())
+      result = dispatchMessage(uuid);
+  }
+  catch (...)
+  {
+    releaseReader();
+    throw;
+  }
+
+  releaseReader();
+  return result;
+}
+
+void CmdClient::acquireReader()
+{
+  std::unique_lock<std::mutex> lock(m->mutex);
+  m->resultReceived.wait(lock, [this] { return !m->reading; });
+  m->reading = true;
+}
+
+void CmdClient::releaseReader()
+{
+  // Results left in the buffer would wait for the next reader, which may only come with the next received bytes
+  while (popMessage())
+  {
+    try
+    {
+      dispatchMessage(std::string());
+    }
+    catch (const std::runtime_error&)
     {
-      case CmdMsgId_Result:
-      {
-        char* msgJson = &m->message[7];
-        std::string errorMsg;
-        if (auto result = CommandFactory::instance()->createCommandResult(msgJson, &errorMsg))
-        {
-          if (cmd->uuid() == result->relatedCommand()->uuid())
-            return result;
-        }
-        else
-        {
-          std::cout << "Failed to parse " << msgJson << std::endl;
-          std::cout << errorMsg << std::endl;
-          throw std::runtime_error(errorMsg.c_str());
-        }
-        break;
-      }
-      default:
-        break;
     }
   }
+
+  std::lock_guard<std::mutex> lock(m->mutex);
+  m->reading = false;
+  m->resultReceived.notify_all();
 }
 
-bool CmdClient::receiveMessage()
+bool CmdClient::sendCommandAsync(CommandBasePtr cmd, ResultCallback callback)
 {
-  int rx(0);
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    if (!startReactor())
+      return false;
+
+    // Registered before sending, the result can't arrive before its callback
+    m->callbacks[cmd->uuid()] = std::move(callback);
+  }
+
+  // If the connection is lost meanwhile, the reactor may already have called the callback with nullptr. The failure
+  // is then reported by the callback only.
+  bool sent = false;
+  try
+  {
+    sent = sendCommand(cmd);
+  }
+  catch (...)
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    if (m->callbacks.erase(cmd->uuid()) == 0)
+      return true;
+    throw;
+  }
 
-  do
+  if (!sent)
   {
-    rx = recv(m->s, m->message, 2, MSG_PEEK);
+    std::lock_guard<std::mutex> lock(m->mutex);
+    if (m->callbacks.erase(cmd->uuid()) == 0)
+      return true;
+  }
+  return sent;
+}
+
+CommandResultPtr CmdClient::parseResultMessage()
+{
+  if (static_cast<int>(m->message[2]) != CmdMsgId_Result)
+    return nullptr;
+
+  // Skip the null terminator
+  std::string msgJson(&m->message[CMD_RESULT_HEADER_SIZE], m->messageSize - CMD_RESULT_HEADER_SIZE);
+  if (!msgJson.empty() && msgJson.back() == '\0')
+    msgJson.pop_back();
+
+  std::string errorMsg;
+  if (auto result = CommandFactory::instance()->createCommandResult(msgJson, &errorMsg))
+    return result;
 
-    if (rx <= 0)
+  if (m->verbose)
+    std::cout << "Failed to parse " << msgJson << std::endl;
+  throw std::runtime_error(errorMsg.c_str());
+}
+
+void CmdClient::dispatchResult(CommandResultPtr result)
+{
+  ResultCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    auto it = m->callbacks.find(result->relatedCommandUuid());
+    if (it == m->callbacks.end())
     {
-      checkStopRequest();
-      return false;
+      m->parkPendingResult(result);
+      m->resultReceived.notify_all();
+      return;
+    }
+
+    callback = std::move(it->second);
+    m->callbacks.erase(it);
+  }
+
+  callback(result);
+}
+
+std::string CmdClient::messageCommandUuid() const
+{
+  size_t size = m->messageSize - CMD_RESULT_HEADER_SIZE;
+  if (size > 0 && m->message[CMD_RESULT_HEADER_SIZE + size - 1] == '\0')
+    --size;
+  return relatedCommandUuid(&m->message[CMD_RESULT_HEADER_SIZE], size);
+}
+
+void CmdClient::failCommand(const std::string& uuid, const std::string& error)
+{
+  ResultCallback callback;
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    auto it = m->callbacks.find(uuid);
+    if (it == m->callbacks.end())
+    {
+      m->parkPendingResult(uuid, nullptr, error);
+      m->resultReceived.notify_all();
+      return;
     }
-  } while (rx < 2);
 
-  int bytesToRead = static_cast<int>(reinterpret_cast<uint16_t*>(&m->message[0])[0]) + 2;
-  char* messagePtr = m->message;
+    callback = std::move(it->second);
+    m->callbacks.erase(it);
+  }
+
+  callback(nullptr);
+}
+
+bool CmdClient::startReactor()
+{
+  if (m->reactor.joinable())
+    return m->reactorRunning;
+
+  if (!m->connected)
+    return false;
+
+#ifndef _WIN32
+  m->wakeupFd = eventfd(0, EFD_CLOEXEC);
+  if (m->wakeupFd < 0)
+    return false;
+#endif
+
+  m->reactorRunning = true;
+  m->reactor = std::thread(&CmdClient::runReactor, this);
+  return true;
+}
 
-  do
+void CmdClient::stopReactor()
+{
+  if (!m->reactor.joinable())
+    return;
+
+#ifndef _WIN32
+  uint64_t wakeup = 1;
+  if (write(m->wakeupFd, &wakeup, sizeof(wakeup)) < 0)
+    std::cout << "Failed to wake up the command reactor" << std::endl;
+#endif
   {
-    rx = recv(m->s, messagePtr, bytesToRead, MSG_WAITALL);
+    std::lock_guard<std::mutex> lock(m->mutex);
+    m->reactorRunning = false;
+  }
+  m->resultReceived.notify_all();
+
+  m->reactor.join();
+#ifndef _WIN32
+  close(m->wakeupFd);
+  m->wakeupFd = -1;
+#endif
+}
 
-    if (rx <= 0)
+void CmdClient::runReactor()
+{
+  try
+  {
+#ifndef _WIN32
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event {};
+    event.events = EPOLLIN;
+    event.data.fd = m->s;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, m->s, &event);
+    event.data.fd = m->wakeupFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, m->wakeupFd, &event);
+
+    // Results already buffered don't make the socket readable
+    bool running = receiveAvailableResults();
+    while (running)
     {
-      checkStopRequest();
+      epoll_event events[2];
+      int count = epoll_wait(epollFd, events, 2, -1);
+      if (count < 0 && errno == EINTR)
+        continue;
+
+      running = count > 0;
+      for (int i = 0; running && i < count; ++i)
+      {
+        if (events[i].data.fd == m->wakeupFd)
+          running = false;
+        else
+          running = receiveAvailableResults();
+      }
+    }
+    close(epollFd);
+#else
+    bool running = receiveAvailableResults();
+    while (running)
+    {
+      {
+        std::lock_guard<std::mutex> lock(m->mutex);
+        if (!m->reactorRunning)
+          break;
+      }
+
+      fd_set fds;
+      FD_ZERO(&fds);
+      FD_SET(m->s, &fds);
+      timeval tv {0, 100000};
+      int status = select(m->s + 1, &fds, 0, 0, &tv);
+      if (status < 0 || (status > 0 && !receiveAvailableResults()))
+        break;
+    }
+#endif
+  }
+  catch (const std::exception& e)
+  {
+    if (m->verbose)
+      std::cout << e.what() << std::endl;
+  }
+
+  // Commands still waiting for their result will never get it
+  std::unordered_map<std::string, ResultCallback> callbacks;
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    m->reactorRunning = false;
+    callbacks.swap(m->callbacks);
+  }
+  m->resultReceived.notify_all();
+
+  for (auto& [uuid, callback] : callbacks)
+    callback(nullptr);
+}
+
+bool CmdClient::receiveAvailableResults()
+{
+  {
+    std::unique_lock<std::mutex> lock(m->mutex);
+    m->resultReceived.wait(lock, [this] { return !m->reading || !m->reactorRunning; });
+    if (!m->reactorRunning)
       return false;
+    m->reading = true;
+  }
+
+  // Another reader may have taken the bytes which woke the reactor up, recv would then block
+  bool received = true;
+  try
+  {
+    if (isReadable())
+    {
+      received = fillReadBuffer(nextMessageSize());
+      while (received && popMessage())
+        dispatchMessage(std::string());
     }
+  }
+  catch (...)
+  {
+    releaseReader();
+    throw;
+  }
+
+  releaseReader();
+  return received;
+}
+
+CommandResultPtr CmdClient::dispatchMessage(const std::string& waitedUuid)
+{
+  CommandResultPtr result;
+  try
+  {
+    result = parseResultMessage();
+  }
+  catch (const std::runtime_error& e)
+  {
+    // The error goes to the command of the result. The reactor stops if there is none.
+    const std::string uuid = messageCommandUuid();
+    if (uuid.empty() || uuid == waitedUuid)
+      throw;
+    failCommand(uuid, e.what());
+    return nullptr;
+  }
 
-    bytesToRead -= rx;
-    messagePtr += rx;
-  } while (bytesToRead > 0);
+  if (!result)
+    return nullptr;
+  if (!waitedUuid.empty() && result->relatedCommandUuid() == waitedUuid)
+    return result;
 
+  dispatchResult(result);
+  return nullptr;
+}
+
+std::size_t CmdClient::pendingResultCount() const
+{
+  std::lock_guard<std::mutex> lock(m->mutex);
+  return m->pendingResults.size();
+}
+
+void CmdClient::setMaxPendingResults(std::size_t maxPendingResults)
+{
+  std::lock_guard<std::mutex> lock(m->mutex);
+  m->maxPendingResults = maxPendingResults;
+  while (m->pendingResults.size() > m->maxPendingResults)
+  {
+    m->pendingResults.erase(m->pendingOrder.front());
+    m->pendingOrder.pop_front();
+  }
+}
+
+std::size_t CmdClient::maxPendingResults() const
+{
+  std::lock_guard<std::mutex> lock(m->mutex);
+  return m->maxPendingResults;
+}
+
+size_t CmdClient::nextMessageSize() const
+{
+  const size_t available = m->readEnd - m->readBegin;
+  if (available < CMD_HEADER_SIZE)
+    return 0;
+
+  const char* header = &m->readBuffer[m->readBegin];
+
+  uint16_t length;
+  memcpy(&length, header, sizeof(length));
+  size_t msgSize = std::max(static_cast<size_t>(length) + 2, static_cast<size_t>(CMD_HEADER_SIZE));
+
+  // The 16 bits frame size can't describe large results, their JSON length is sent on 32 bits after the message id
+  if (static_cast<int>(header[2]) == CmdMsgId_Result)
+  {
+    if (available < CMD_RESULT_HEADER_SIZE)
+      return 0;
+
+    uint32_t jsonLength;
+    memcpy(&jsonLength, &header[CMD_HEADER_SIZE], sizeof(jsonLength));
+    msgSize = CMD_RESULT_HEADER_SIZE + static_cast<size_t>(jsonLength);
+  }
+
+  return msgSize;
+}
+
+bool CmdClient::fillReadBuffer(size_t msgSize)
+{
+  if (m->readBegin == m->readEnd)
+  {
+    m->readBegin = 0;
+    m->readEnd = 0;
+  }
+
+  // Make room at the end of the buffer for the rest of the message, or for anything if its size is still unknown
+  const size_t required = std::max(msgSize, static_cast<size_t>(CMD_RESULT_HEADER_SIZE));
+  if (m->readEnd == m->readBuffer.size() || m->readBuffer.size() - m->readBegin < required)
+  {
+    memmove(m->readBuffer.data(), &m->readBuffer[m->readBegin], m->readEnd - m->readBegin);
+    m->readEnd -= m->readBegin;
+    m->readBegin = 0;
+  }
+  if (m->readBuffer.size() < required)
+    m->readBuffer.resize(required);
+
+  // Take everything the kernel has, up to the free space
+  int rx = recv(m->s,
+                &m->readBuffer[m->readEnd],
+                static_cast<int>(std::min(m->readBuffer.size() - m->readEnd, static_cast<size_t>(INT32_MAX))),
+                0);
+
+  if (rx <= 0)
+  {
+    checkStopRequest();
+    return false;
+  }
+
+  m->readEnd += static_cast<size_t>(rx);
+  return true;
+}
+
+bool CmdClient::isReadable() const
+{
+  fd_set fds;
+  FD_ZERO(&fds);
+  FD_SET(m->s, &fds);
+  timeval tv {0, 0};
+  return select(m->s + 1, &fds, 0, 0, &tv) != 0;
+}
+
+bool CmdClient::popMessage()
+{
+  const size_t msgSize = nextMessageSize();
+  if (msgSize == 0 || m->readEnd - m->readBegin < msgSize)
+    return false;
+
+  m->message = &m->readBuffer[m->readBegin];
+  m->messageSize = msgSize;
+  m->readBegin += msgSize;
+  return true;
+}
+
+bool CmdClient::receiveMessage()
+{
+  while (!popMessage())
+  {
+    if (!fillReadBuffer(nextMessageSize()))
+      return false;
+  }
   return true;
 }
 
@@ -336,10 +946,19 @@ bool CmdClient::sendMessage(const char* message, int length)
   {
     return false;
   }
-  if (length != send(m->s, message, length, 0))
+
+  // Large batches may be partially written, resume where the kernel stopped
+  while (length > 0)
   {
-    errorMessage("Error sending message.");
-    return false;
+    int tx = send(m->s, message, length, 0);
+    if (tx <= 0)
+    {
+      errorMessage("Error sending message.");
+      return false;
+    }
+
+    message += tx;
+    length -= tx;
   }
   return true;
 }
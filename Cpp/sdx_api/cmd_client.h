@@ -1,8 +1,11 @@
 #ifndef CMD_CLIENT_H
 #define CMD_CLIENT_H
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "command_base.h"
 
@@ -30,8 +33,32 @@ public:
 
   int getServerApiVersion();
   bool sendCommand(CommandBasePtr cmd);
+
+  // Sends all the commands with a single write. Their results are waited with waitCommand.
+  bool sendCommands(const std::vector<CommandBasePtr>& cmds);
+
+  // Returns the result of cmd. Results of other commands received while waiting are kept in a pending table keyed
+  // by command UUID, so commands can be posted back to back and waited on in any order. Throws if the result can't
+  // be received or parsed.
   CommandResultPtr waitCommand(CommandBasePtr cmd);
 
+  // Called with the result of an asynchronous command, or with nullptr if the connection is lost before the result
+  // is received or if the result can't be parsed. The callback runs on the thread receiving the results, usually the
+  // reactor thread, and must not wait for another command.
+  using ResultCallback = std::function<void(CommandResultPtr)>;
+
+  // Sends cmd and returns without waiting. The first call starts a reactor thread which receives every result from
+  // then on, including the ones waited with waitCommand. Returns false, or throws, only when the callback won't be
+  // called.
+  bool sendCommandAsync(CommandBasePtr cmd, ResultCallback callback);
+
+  // Number of received results that were not waited on yet.
+  std::size_t pendingResultCount() const;
+
+  // Maximum number of results kept in the pending table. When full, the oldest result is discarded.
+  void setMaxPendingResults(std::size_t maxPendingResults);
+  std::size_t maxPendingResults() const;
+
   int port() const;
   const std::string& address() const;
 
@@ -45,7 +72,24 @@ private:
   void checkStopRequest();
   void errorMessage(const std::string& msg);
   void closeSocket();
+  bool serializeCommand(CommandBasePtr cmd);
+  size_t nextMessageSize() const;
+  bool fillReadBuffer(size_t msgSize);
+  bool popMessage();
   bool receiveMessage();
+  bool isReadable() const;
+  void acquireReader();
+  void releaseReader();
+  CommandResultPtr readResult(const std::string& uuid);
+  CommandResultPtr parseResultMessage();
+  std::string messageCommandUuid() const;
+  CommandResultPtr dispatchMessage(const std::string& waitedUuid);
+  void dispatchResult(CommandResultPtr result);
+  void failCommand(const std::string& uuid, const std::string& error);
+  bool startReactor();
+  void stopReactor();
+  void runReactor();
+  bool receiveAvailableResults();
   bool sendMessage(const char* message, int length);
 };
 
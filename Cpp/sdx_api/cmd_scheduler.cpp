@@ -0,0 +1,112 @@
+#include "cmd_scheduler.h"
+
+namespace Sdx
+{
+
+std::coroutine_handle<> CmdTask::FinalAwaiter::await_suspend(Handle handle) noexcept
+{
+  promise_type& promise = handle.promise();
+  if (promise.continuation)
+    return promise.continuation;
+
+  if (promise.scheduler)
+    promise.scheduler->taskDone();
+  return std::noop_coroutine();
+}
+
+CmdTask& CmdTask::operator=(CmdTask&& other) noexcept
+{
+  if (this != &other)
+  {
+    if (m_handle)
+      m_handle.destroy();
+    m_handle = std::exchange(other.m_handle, {});
+  }
+  return *this;
+}
+
+CmdTask::~CmdTask()
+{
+  if (m_handle)
+    m_handle.destroy();
+}
+
+std::coroutine_handle<> CmdTask::await_suspend(Handle caller) noexcept
+{
+  promise_type& promise = m_handle.promise();
+  promise.continuation = caller;
+  promise.scheduler = caller.promise().scheduler;
+  return m_handle;
+}
+
+void CmdTask::await_resume() const
+{
+  if (m_handle && m_handle.promise().exception)
+    std::rethrow_exception(m_handle.promise().exception);
+}
+
+CmdScheduler::CmdScheduler() : m_running(0)
+{
+}
+
+CmdScheduler::~CmdScheduler() = default;
+
+void CmdScheduler::spawn(CmdTask task)
+{
+  if (task.isDone())
+    return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  task.m_handle.promise().scheduler = this;
+  m_ready.push_back(task.m_handle);
+  m_tasks.push_back(std::move(task));
+  ++m_running;
+}
+
+void CmdScheduler::schedule(std::coroutine_handle<> handle)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_ready.push_back(handle);
+  }
+  m_wakeup.notify_one();
+}
+
+void CmdScheduler::taskDone()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  --m_running;
+}
+
+void CmdScheduler::run()
+{
+  while (true)
+  {
+    std::coroutine_handle<> handle;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wakeup.wait(lock, [this] { return !m_ready.empty() || m_running == 0; });
+      if (m_ready.empty())
+        break;
+
+      handle = m_ready.front();
+      m_ready.pop_front();
+    }
+
+    handle.resume();
+  }
+
+  std::vector<CmdTask> tasks;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    tasks.swap(m_tasks);
+  }
+
+  for (const CmdTask& task : tasks)
+  {
+    if (task.m_handle.promise().exception)
+      std::rethrow_exception(task.m_handle.promise().exception);
+  }
+}
+
+} // namespace Sdx
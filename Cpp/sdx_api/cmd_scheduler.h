@@ -0,0 +1,106 @@
+#ifndef CMD_SCHEDULER_H
+#define CMD_SCHEDULER_H
+
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Sdx
+{
+
+class CmdScheduler;
+
+//
+// Coroutine running on a CmdScheduler. A task can await commands with RemoteSimulator::callCo and other tasks.
+//
+//  CmdTask configure(RemoteSimulator& sim)
+//  {
+//    co_await sim.callCo(Cmd::New::create(true));
+//    auto result = co_await sim.callCo(Cmd::GetSimulatorState::create());
+//  }
+//
+class CmdTask
+{
+public:
+  struct promise_type;
+  using Handle = std::coroutine_handle<promise_type>;
+
+  struct FinalAwaiter
+  {
+    bool await_ready() const noexcept { return false; }
+    std::coroutine_handle<> await_suspend(Handle handle) noexcept;
+    void await_resume() const noexcept {}
+  };
+
+  struct promise_type
+  {
+    CmdScheduler* scheduler = nullptr;
+    std::coroutine_handle<> continuation;
+    std::exception_ptr exception;
+
+    CmdTask get_return_object() { return CmdTask(Handle::from_promise(*this)); }
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+    void return_void() const noexcept {}
+    void unhandled_exception() { exception = std::current_exception(); }
+  };
+
+  CmdTask(CmdTask&& other) noexcept : m_handle(std::exchange(other.m_handle, {})) {}
+  CmdTask& operator=(CmdTask&& other) noexcept;
+  CmdTask(const CmdTask&) = delete;
+  CmdTask& operator=(const CmdTask&) = delete;
+  ~CmdTask();
+
+  bool isDone() const { return !m_handle || m_handle.done(); }
+
+  // Awaiting a task from another task starts it on the same scheduler and resumes the caller when it completes
+  bool await_ready() const noexcept { return isDone(); }
+  std::coroutine_handle<> await_suspend(Handle caller) noexcept;
+  void await_resume() const;
+
+private:
+  explicit CmdTask(Handle handle) : m_handle(handle) {}
+
+  Handle m_handle;
+  friend class CmdScheduler;
+};
+
+//
+// Resumes CmdTask coroutines on the thread calling run(). Command results received by the simulators' reactor threads
+// are handed back to the scheduler, so a single thread can drive many simulators without blocking on any of them.
+//
+class CmdScheduler
+{
+public:
+  CmdScheduler();
+  ~CmdScheduler();
+
+  // Takes ownership of the task, it will start in the next run()
+  void spawn(CmdTask task);
+
+  // Resumes tasks as their commands complete, until every spawned task is done. Rethrows the first exception that
+  // escaped a task.
+  void run();
+
+  // Queues a suspended coroutine to be resumed by run(). Can be called from any thread.
+  void schedule(std::coroutine_handle<> handle);
+
+private:
+  void taskDone();
+
+  std::mutex m_mutex;
+  std::condition_variable m_wakeup;
+  std::deque<std::coroutine_handle<>> m_ready;
+  std::vector<CmdTask> m_tasks;
+  std::size_t m_running;
+  friend class CmdTask;
+};
+
+} // namespace Sdx
+
+#endif // CMD_SCHEDULER_H
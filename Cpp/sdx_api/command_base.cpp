@@ -5,17 +5,96 @@
 #include <rapidjson/prettywriter.h>
 #include <rapidjson/writer.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <random>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
 #include "date_time.h"
 
 namespace Sdx
 {
+namespace
+{
+std::atomic<int> uuidGeneratorType {CommandBase::UUID_FAST};
+
+// xoshiro256** seeded with splitmix64, one instance per thread
+class FastUuidGenerator
+{
+public:
+  FastUuidGenerator()
+  {
+    std::random_device device;
+    uint64_t seed = (static_cast<uint64_t>(device()) << 32) ^ device();
+    seed ^= static_cast<uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    seed ^= std::hash<std::thread::id>()(std::this_thread::get_id());
+    for (uint64_t& state : m_state)
+      state = splitMix64(seed);
+  }
+
+  // Writes a version 4 UUID in its 36 characters text form, without null terminator
+  void generate(char* uuid)
+  {
+    uint64_t high = next();
+    uint64_t low = next();
+    high = (high & 0xFFFFFFFFFFFF0FFFull) | 0x0000000000004000ull; // Version 4
+    low = (low & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;   // Variant 10xx
+
+    static const char digits[] = "0123456789abcdef";
+    for (int i = 0; i < 16; ++i)
+    {
+      const unsigned byte = static_cast<unsigned>(((i < 8 ? high : low) >> (56 - 8 * (i & 7))) & 0xFF);
+      const int pos = 2 * i + (i >= 4) + (i >= 6) + (i >= 8) + (i >= 10);
+      uuid[pos] = digits[byte >> 4];
+      uuid[pos + 1] = digits[byte & 0xF];
+    }
+    uuid[8] = uuid[13] = uuid[18] = uuid[23] = '-';
+  }
+
+private:
+  static uint64_t splitMix64(uint64_t& x)
+  {
+    uint64_t z = (x += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+  }
+
+  static uint64_t rotl(uint64_t x, int k) { return (x << k) | (x >> (64 - k)); }
+
+  uint64_t next()
+  {
+    const uint64_t result = rotl(m_state[1] * 5, 7) * 9;
+    const uint64_t t = m_state[1] << 17;
+    m_state[2] ^= m_state[0];
+    m_state[3] ^= m_state[1];
+    m_state[1] ^= m_state[2];
+    m_state[0] ^= m_state[3];
+    m_state[2] ^= t;
+    m_state[3] = rotl(m_state[3], 45);
+    return result;
+  }
+
+  uint64_t m_state[4];
+};
+} // namespace
+
 const std::string CommandBase::CmdNameKey("CmdName");
 const std::string CommandBase::CmdTargetIdKey("CmdTargetId");
 const std::string CommandBase::CmdUuidKey("CmdUuid");
 const std::string CommandBase::CmdTimestampKey("CmdTimestamp");
 const std::string CommandBase::CmdHidden("CmdHidden");
 
-CommandBase::CommandBase(const std::string& cmdName, const std::string& targetId) : m_cmdName(cmdName)
+CommandBase::CommandBase(const std::string& cmdName, const std::string& targetId) :
+  m_cmdName(cmdName),
+  m_allocator(JsonArena::acquire()),
+  m_values(m_allocator.get())
 {
   m_values.SetObject();
   rapidjson::Value value;
@@ -23,15 +102,6 @@ CommandBase::CommandBase(const std::string& cmdName, const std::string& targetId
   setValue(CmdNameKey, value);
   generateUuid();
 
-  m_cmdSplittedName += m_cmdName[0];
-  for (size_t i = 1; i < m_cmdName.size(); ++i)
-  {
-    char letter = m_cmdName[i];
-    if (letter >= 'A' && letter <= 'Z')
-      m_cmdSplittedName += ' ';
-    m_cmdSplittedName += letter;
-  }
-
   if (!targetId.empty())
   {
     value.SetString(targetId.c_str(), static_cast<rapidjson::SizeType>(targetId.size()), m_values.GetAllocator());
@@ -39,12 +109,55 @@ CommandBase::CommandBase(const std::string& cmdName, const std::string& targetId
   }
 }
 
+const std::string& CommandBase::splittedName() const
+{
+  // Only depends on the command name, computed once per command type when first needed
+  static std::mutex mutex;
+  static std::unordered_map<std::string, std::string> splittedNames;
+
+  std::lock_guard<std::mutex> lock(mutex);
+  auto [it, inserted] = splittedNames.try_emplace(m_cmdName);
+  if (inserted && !m_cmdName.empty())
+  {
+    std::string& splittedName = it->second;
+    splittedName += m_cmdName[0];
+    for (size_t i = 1; i < m_cmdName.size(); ++i)
+    {
+      char letter = m_cmdName[i];
+      if (letter >= 'A' && letter <= 'Z')
+        splittedName += ' ';
+      splittedName += letter;
+    }
+  }
+  return it->second;
+}
+
+void CommandBase::setUuidGenerator(UuidGenerator generator)
+{
+  uuidGeneratorType = generator;
+}
+
+CommandBase::UuidGenerator CommandBase::uuidGenerator()
+{
+  return static_cast<UuidGenerator>(uuidGeneratorType.load(std::memory_order_relaxed));
+}
+
 void CommandBase::generateUuid()
 {
-  Guid newGuid = GuidGenerator().newGuid();
-  std::stringstream stream;
-  stream << newGuid;
-  m_cmdUuid = stream.str();
+  if (uuidGenerator() == UUID_FAST)
+  {
+    thread_local FastUuidGenerator generator;
+    char uuid[36];
+    generator.generate(uuid);
+    m_cmdUuid.assign(uuid, sizeof(uuid));
+  }
+  else
+  {
+    Guid newGuid = GuidGenerator().newGuid();
+    std::stringstream stream;
+    stream << newGuid;
+    m_cmdUuid = stream.str();
+  }
 
   rapidjson::Value value;
   value.SetString(m_cmdUuid.c_str(), static_cast<rapidjson::SizeType>(m_cmdUuid.size()), m_values.GetAllocator());
@@ -53,6 +166,7 @@ void CommandBase::generateUuid()
 
 const rapidjson::Document& CommandBase::values() const
 {
+  prepareValues();
   return m_values;
 }
 
@@ -147,6 +261,7 @@ void CommandBase::setGpsTimestamp(const Sdx::DateTime& gpsTimestamp)
 
 std::string CommandBase::toString(bool compact) const
 {
+  prepareValues();
   rapidjson::StringBuffer sb;
 
   if (compact)
@@ -181,6 +296,7 @@ std::string CommandBase::toReadableCommand(bool includeName) const
 
 const rapidjson::Value& CommandBase::value(const std::string& key) const
 {
+  prepareValues();
   if (contains(key))
     return m_values[key.c_str()];
   else
@@ -190,6 +306,7 @@ const rapidjson::Value& CommandBase::value(const std::string& key) const
 rapidjson::Value& CommandBase::value(const std::string& key)
 {
   static rapidjson::Value defaultValue;
+  prepareValues();
   if (contains(key))
     return m_values[key.c_str()];
   else
@@ -198,14 +315,176 @@ rapidjson::Value& CommandBase::value(const std::string& key)
 
 void CommandBase::setValue(const std::string& key, rapidjson::Value& value)
 {
+  // Only the field named key is invalidated. Nothing is cached or resolved while the command is constructed, when
+  // fieldNames() can't be called yet.
+  std::size_t index = NoField;
+  if (!m_fieldMembers.empty() || hasCachedValues())
+  {
+    const std::vector<std::string>& names = fieldNames();
+    index = static_cast<std::size_t>(std::find(names.begin(), names.end(), key) - names.begin());
+    if (index == names.size())
+      index = NoField;
+  }
+
+  if (index != NoField)
+    clearCachedValue(index);
+
   if (contains(key))
+  {
     m_values[key.c_str()] = value;
+  }
   else
+  {
+    // Members are appended, the other fields keep their position
     m_values.AddMember(rapidjson::StringRef(key.c_str()), value, m_values.GetAllocator());
+    if (index != NoField && !m_fieldMembers.empty())
+      m_fieldMembers[index] = m_values.MemberCount() - 1;
+  }
+}
+
+const rapidjson::Value& CommandBase::field(std::size_t index) const
+{
+  static const rapidjson::Value nullValue;
+  // Decoded fields are matrices, validated while they were decoded
+  static const rapidjson::Value decodedValue(rapidjson::kArrayType);
+
+  const rapidjson::SizeType member = m_fieldMembers.empty() ? findMember(index) : m_fieldMembers[index];
+  if (member == DecodedMember)
+    return decodedValue;
+  return member != NoMember ? (m_values.MemberBegin() + member)->value : nullValue;
+}
+
+rapidjson::SizeType CommandBase::findMember(std::size_t index) const
+{
+  const std::string& name = fieldNames()[index];
+  const auto it = m_values.FindMember(rapidjson::StringRef(name.c_str(), static_cast<rapidjson::SizeType>(name.size())));
+  return it != m_values.MemberEnd() ? static_cast<rapidjson::SizeType>(it - m_values.MemberBegin()) : NoMember;
+}
+
+void CommandBase::setField(std::size_t index, rapidjson::Value&& value)
+{
+  clearCachedValue(index);
+  if (m_fieldMembers.empty())
+    resolveFields();
+
+  if (const rapidjson::SizeType member = m_fieldMembers[index]; member != NoMember)
+  {
+    (m_values.MemberBegin() + member)->value = std::move(value);
+  }
+  else
+  {
+    // Field names are static, the document can refer to them
+    const std::string& name = fieldNames()[index];
+    m_values.AddMember(rapidjson::StringRef(name.c_str(), static_cast<rapidjson::SizeType>(name.size())),
+                       value,
+                       m_values.GetAllocator());
+    m_fieldMembers[index] = m_values.MemberCount() - 1;
+  }
+}
+
+void CommandBase::resolveFields()
+{
+  const std::vector<std::string>& names = fieldNames();
+  m_fieldMembers.assign(names.size(), NoMember);
+  if (!m_values.IsObject())
+    return;
+
+  rapidjson::SizeType member = 0;
+  for (auto it = m_values.MemberBegin(); it != m_values.MemberEnd(); ++it, ++member)
+  {
+    const std::string_view memberName(it->name.GetString(), it->name.GetStringLength());
+    for (std::size_t index = 0; index < names.size(); ++index)
+    {
+      // The first member wins, like rapidjson's FindMember
+      if (m_fieldMembers[index] == NoMember && names[index] == memberName)
+      {
+        m_fieldMembers[index] = member;
+        break;
+      }
+    }
+  }
+}
+
+std::shared_ptr<const void> CommandBase::findCachedValue(std::size_t index) const
+{
+  std::lock_guard<std::mutex> lock(m_cachedValuesMutex);
+  const CachedValue* cached = findCachedValueLocked(index);
+  return cached ? cached->value : nullptr;
+}
+
+const CommandBase::CachedValue* CommandBase::findCachedValueLocked(std::size_t index) const
+{
+  for (const CachedValue& cached : m_cachedValues)
+  {
+    if (cached.index == index)
+      return &cached;
+  }
+  return nullptr;
+}
+
+bool CommandBase::isDecodedField(std::size_t index) const
+{
+  return !m_fieldMembers.empty() && m_fieldMembers[index] == DecodedMember;
+}
+
+bool CommandBase::hasCachedValues() const
+{
+  std::lock_guard<std::mutex> lock(m_cachedValuesMutex);
+  return !m_cachedValues.empty();
+}
+
+void CommandBase::clearCachedValue(std::size_t index)
+{
+  std::lock_guard<std::mutex> lock(m_cachedValuesMutex);
+  auto it = std::find_if(m_cachedValues.begin(), m_cachedValues.end(), [index](const CachedValue& cached) {
+    return cached.index == index;
+  });
+  if (it != m_cachedValues.end())
+    m_cachedValues.erase(it);
+
+  // A decoded field is read from the document again, formatted or not
+  if (!m_fieldMembers.empty() && m_fieldMembers[index] == DecodedMember)
+    m_fieldMembers[index] = findMember(index);
+}
+
+void CommandBase::clearCachedValues()
+{
+  std::lock_guard<std::mutex> lock(m_cachedValuesMutex);
+  if (m_hasDecodedFields)
+    formatDecodedFields();
+  m_cachedValues.clear();
+  m_fieldMembers.clear();
+}
+
+void CommandBase::formatDecodedFields() const
+{
+  // The document belongs to this command, it is only completed here
+  rapidjson::Document& values = const_cast<rapidjson::Document&>(m_values);
+  for (CachedValue& cached : m_cachedValues)
+  {
+    if (cached.format)
+    {
+      if (const rapidjson::SizeType member = findMember(cached.index); member != NoMember)
+        cached.format(cached.value.get(), (values.MemberBegin() + member)->value, values.GetAllocator());
+      cached.format = nullptr;
+    }
+  }
+  m_hasDecodedFields = false;
+}
+
+void CommandBase::prepareValues() const
+{
+  if (m_hasDecodedFields)
+  {
+    std::lock_guard<std::mutex> lock(m_cachedValuesMutex);
+    formatDecodedFields();
+  }
 }
 
 bool CommandBase::parse(const std::string& serializedCommand, std::string* errorMsg)
 {
+  clearCachedValues();
+  m_fieldMembers.clear();
   m_values.Parse(serializedCommand.c_str());
   if (m_values.HasParseError())
   {
@@ -225,6 +504,8 @@ bool CommandBase::parse(const std::string& serializedCommand, std::string* error
       *errorMsg = "Unexpected command name: " + name + " (expecting " + m_cmdName + ")";
     return false;
   }
+
+  resolveFields();
   return true;
 }
 
@@ -3,11 +3,20 @@
 
 #include <rapidjson/document.h>
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "json_arena.h"
+
+template<typename T>
+struct parse_json;
+
 namespace Sdx
 {
 class CommandBase;
@@ -28,6 +37,15 @@ public:
     EXECUTE_IF_NO_CONFIG = 1 << 3
   };
 
+  enum UuidGenerator
+  {
+    UUID_SYSTEM, // GuidGenerator, backed by the OS generator
+    UUID_FAST    // Per-thread pseudo-random generator seeded once, the default
+  };
+
+  static void setUuidGenerator(UuidGenerator generator);
+  static UuidGenerator uuidGenerator();
+
   static const std::string CmdNameKey;
   static const std::string CmdTargetIdKey;
   static const std::string CmdUuidKey;
@@ -43,7 +61,7 @@ public:
   virtual std::string documentation() const;
   virtual std::optional<std::string> deprecated() const;
   inline const std::string& name() const { return m_cmdName; }
-  inline const std::string& splittedName() const { return m_cmdSplittedName; }
+  const std::string& splittedName() const;
   inline const std::string& uuid() const { return m_cmdUuid; }
 
   void setHidden(bool isHidden);
@@ -70,12 +88,100 @@ public:
   virtual const std::vector<std::string>& fieldNames() const = 0;
 
 protected:
+  // Generated commands access their fields by position in fieldNames(). A missing field reads as a null value.
+  const rapidjson::Value& field(std::size_t index) const;
+  // Replaces the field, or adds it if it is missing
+  void setField(std::size_t index, rapidjson::Value&& value);
+  // Finds the members of all the fields, in one pass over the document
+  void resolveFields();
+
+  // Parses a field for a getter. Nothing is cached: a field read once costs a single parse, and the value is moved out.
+  // A field decoded without the document is copied from its decoded value.
+  template<typename T>
+  T fieldValue(std::size_t index) const
+  {
+    if (isDecodedField(index))
+    {
+      if (std::shared_ptr<const void> value = findCachedValue(index))
+        return *static_cast<const T*>(value.get());
+    }
+    return parse_json<T>::parse(field(index));
+  }
+
+  // Parses a field the first time it is read and shares the typed value until the field is set again, so repeated
+  // reads neither parse nor copy it. The snapshot stays valid after the field is set, it is no longer updated then.
+  // The cached value lives beside the document, only the fields read this way are kept twice.
+  template<typename T>
+  std::shared_ptr<const T> sharedValue(std::size_t index) const
+  {
+    std::lock_guard<std::mutex> lock(m_cachedValuesMutex);
+    if (const CachedValue* cached = findCachedValueLocked(index))
+      return std::static_pointer_cast<const T>(cached->value);
+
+    std::shared_ptr<const T> value = std::make_shared<const T>(parse_json<T>::parse(field(index)));
+    m_cachedValues.push_back({index, value, nullptr});
+    return value;
+  }
+
+  // Keeps a field which was decoded without the document (see ResultDecoder). The document only holds a null
+  // placeholder, the value is formatted back into it the first time the whole document is needed.
+  template<typename T>
+  void setDecodedField(std::size_t index, T&& value)
+  {
+    using Type = std::decay_t<T>;
+    if (m_fieldMembers.empty())
+      resolveFields();
+
+    std::lock_guard<std::mutex> lock(m_cachedValuesMutex);
+    m_cachedValues.push_back({index, std::make_shared<const Type>(std::forward<T>(value)), &formatCachedValue<Type>});
+    m_fieldMembers[index] = DecodedMember;
+    m_hasDecodedFields = true;
+  }
+
+  void clearCachedValue(std::size_t index);
+  void clearCachedValues();
+
   std::string m_cmdName;
-  std::string m_cmdSplittedName;
   std::string m_cmdUuid;
+  JsonArena::AllocatorPtr m_allocator; // Null unless the JSON arena is enabled, must outlive m_values
   rapidjson::Document m_values;
   friend class CommandFactory;
   friend class CommandResultFactory;
+
+private:
+  static constexpr rapidjson::SizeType NoMember = ~rapidjson::SizeType(0);
+  static constexpr rapidjson::SizeType DecodedMember = NoMember - 1;
+  static constexpr std::size_t NoField = ~std::size_t(0);
+
+  using FormatFunction = void (*)(const void*, rapidjson::Value&, rapidjson::Document::AllocatorType&);
+  struct CachedValue
+  {
+    std::size_t index;
+    std::shared_ptr<const void> value;
+    FormatFunction format; // Set while the document only holds a placeholder for this field
+  };
+
+  template<typename T>
+  static void formatCachedValue(const void* value, rapidjson::Value& member, rapidjson::Document::AllocatorType& alloc)
+  {
+    member = parse_json<T>::format(*static_cast<const T*>(value), alloc);
+  }
+
+  std::shared_ptr<const void> findCachedValue(std::size_t index) const;
+  // Expects m_cachedValuesMutex to be held
+  const CachedValue* findCachedValueLocked(std::size_t index) const;
+  bool isDecodedField(std::size_t index) const;
+  bool hasCachedValues() const;
+  rapidjson::SizeType findMember(std::size_t index) const;
+  // Writes the decoded fields into the document, expects m_cachedValuesMutex to be held
+  void formatDecodedFields() const;
+  void prepareValues() const;
+
+  // Member index of each field in m_values, empty until resolved
+  std::vector<rapidjson::SizeType> m_fieldMembers;
+  mutable std::mutex m_cachedValuesMutex;
+  mutable std::vector<CachedValue> m_cachedValues;
+  mutable std::atomic<bool> m_hasDecodedFields;
 };
 
 } // namespace Sdx
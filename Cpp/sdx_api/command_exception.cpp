@@ -4,7 +4,9 @@ using namespace Sdx;
 
 CommandException::CommandException(CommandResultPtr cmdResult, const std::string& errorMsg) : m_cmdResult(cmdResult)
 {
-  m_message = m_cmdResult->relatedCommand()->name() + " command failed => " + m_cmdResult->message() + errorMsg;
+  CommandBasePtr relatedCmd = m_cmdResult->relatedCommand();
+  const std::string cmdName = relatedCmd ? relatedCmd->name() : "Unknown";
+  m_message = cmdName + " command failed => " + m_cmdResult->message() + errorMsg;
 }
 
 CommandException::~CommandException() throw()
@@ -2,11 +2,15 @@
 
 #include <rapidjson/document.h>
 
+#include <algorithm>
 #include <iostream>
+#include <string_view>
 #include <unordered_map>
 
 #include "command_base.h"
+#include "command_registry.h"
 #include "command_result.h"
+#include "result_decoder.h"
 
 namespace Sdx
 {
@@ -16,19 +20,31 @@ struct CommandFactory::Pimpl
   using FactoryMap = std::unordered_map<std::string, FactoryFunction>;
   using TargetFactoryMap = std::unordered_map<std::string, FactoryMap>;
 
-  const FactoryMap& getFactoryFromJson(const rapidjson::Document& doc)
+  static FactoryFunction find(const FactoryMap& factoryMap, std::string_view cmdName)
   {
-    if (doc.HasMember(CommandBase::CmdTargetIdKey.c_str()))
-    {
-      const std::string targetID = doc[CommandBase::CmdTargetIdKey.c_str()].GetString();
+    const auto it = factoryMap.find(std::string(cmdName));
+    return it != factoryMap.end() ? it->second : nullptr;
+  }
+
+  // Commands of a target fall back to the commands without target
+  FactoryFunction findFactoryFunction(std::string_view targetId, std::string_view cmdName) const
+  {
+    if (const CommandRegistryEntry* entry = findRegisteredCommand(targetId, cmdName))
+      return entry->create;
 
-      if (const auto it = targetFactory.find(targetID); it != targetFactory.end())
+    if (!targetId.empty())
+    {
+      if (const auto it = targetFactory.find(std::string(targetId)); it != targetFactory.end())
       {
-        return it->second;
+        if (FactoryFunction fct = find(it->second, cmdName))
+          return fct;
       }
+
+      if (const CommandRegistryEntry* entry = findRegisteredCommand({}, cmdName))
+        return entry->create;
     }
 
-    return factory;
+    return factory.empty() ? nullptr : find(factory, cmdName);
   }
 
   FactoryMap factory;
@@ -54,28 +70,36 @@ CommandBasePtr CommandFactory::createCommand(const std::string& serializedComman
     errorMsg->clear();
   }
 
-  rapidjson::Document doc;
-  if (!CommandBase::parse(serializedCommand, doc, errorMsg))
+  // The command is parsed once, then the document and its allocator are handed over to the new command
+  JsonArena::AllocatorPtr allocator = JsonArena::acquire();
+  rapidjson::Document doc(allocator.get());
+  std::vector<ResultDecoder::DecodedField> decodedFields;
+  if (!ResultDecoder::parse(serializedCommand, doc, decodedFields, errorMsg))
   {
     return nullptr;
   }
 
-  const auto& factory = m->getFactoryFromJson(doc);
-  const std::string cmdName = doc[CommandBase::CmdNameKey.c_str()].GetString();
+  std::string_view targetId;
+  if (const auto it = doc.FindMember(CommandBase::CmdTargetIdKey.c_str()); it != doc.MemberEnd())
+    targetId = std::string_view(it->value.GetString(), it->value.GetStringLength());
+  const rapidjson::Value& cmdName = doc[CommandBase::CmdNameKey.c_str()];
 
-  if (const auto it = factory.find(cmdName); it != m->factory.end())
+  if (FactoryFunction createFunction =
+        m->findFactoryFunction(targetId, std::string_view(cmdName.GetString(), cmdName.GetStringLength())))
   {
-    auto cmd = it->second();
-    cmd->m_values.CopyFrom(doc, cmd->m_values.GetAllocator());
-
-    rapidjson::Value& uuidValue = doc[CommandBase::CmdUuidKey.c_str()];
-    cmd->m_cmdUuid = uuidValue.GetString();
-
-    rapidjson::Value newValue;
-    newValue.SetString(cmd->m_cmdUuid.c_str(),
-                       static_cast<rapidjson::SizeType>(cmd->m_cmdUuid.size()),
-                       cmd->m_values.GetAllocator());
-    cmd->setValue(CommandBase::CmdUuidKey, newValue);
+    auto cmd = createFunction();
+    cmd->m_values.Swap(doc);
+    cmd->m_allocator.swap(allocator);
+    cmd->m_cmdUuid = cmd->m_values[CommandBase::CmdUuidKey.c_str()].GetString();
+    cmd->resolveFields();
+
+    const std::vector<std::string>& fieldNames = cmd->fieldNames();
+    for (ResultDecoder::DecodedField& decodedField : decodedFields)
+    {
+      const auto it = std::find(fieldNames.begin(), fieldNames.end(), decodedField.name);
+      if (it != fieldNames.end())
+        cmd->setDecodedField(it - fieldNames.begin(), std::move(decodedField.value));
+    }
 
     if (cmd->isValid())
     {
@@ -91,7 +115,7 @@ CommandBasePtr CommandFactory::createCommand(const std::string& serializedComman
   {
     if (errorMsg)
     {
-      *errorMsg = "Factory function not found for " + cmdName;
+      *errorMsg = "Factory function not found for " + std::string(cmdName.GetString());
     }
   }
   return nullptr;
@@ -99,17 +123,18 @@ CommandBasePtr CommandFactory::createCommand(const std::string& serializedComman
 
 CommandResultPtr CommandFactory::createCommandResult(const std::string& serializedCommand, std::string* errorMsg)
 {
-  if (auto result = CommandResult::dynamicCast(createCommand(serializedCommand, errorMsg)))
+  // The related command is only parsed if CommandResult::relatedCommand() is called. Results are still rejected if
+  // they don't carry a related command with a uuid, which is how they are matched to their command.
+  CommandResultPtr result = CommandResult::dynamicCast(createCommand(serializedCommand, errorMsg));
+  if (result && (!result->contains(CommandResult::RelatedCommand) || result->relatedCommandUuid().empty()))
   {
-    result->m_relatedCommand = createCommand(result->value(CommandResult::RelatedCommand).GetString(), errorMsg);
-
-    if (result->m_relatedCommand)
+    if (errorMsg)
     {
-      return result;
+      *errorMsg = "Invalid related command: " + serializedCommand;
     }
+    return nullptr;
   }
-
-  return nullptr;
+  return result;
 }
 
 void CommandFactory::registerFactoryFunction(const std::string& targetID,
@@ -118,7 +143,7 @@ void CommandFactory::registerFactoryFunction(const std::string& targetID,
 {
   auto& factory = targetID.empty() ? m->factory : m->targetFactory[targetID];
 
-  if (factory.find(cmdName) == factory.end())
+  if (!findRegisteredCommand(targetID, cmdName) && factory.find(cmdName) == factory.end())
   {
     factory[cmdName] = fct;
   }
@@ -9,31 +9,10 @@
 #include "command_base.h"
 #include "parse_json.hpp"
 
-#define REGISTER_COMMAND_TO_FACTORY_DECL(COMMAND_CLASS_NAME)                                                  \
-  inline CommandBasePtr functionToCreateCommand##COMMAND_CLASS_NAME()                                         \
-  {                                                                                                           \
-    return std::make_shared<COMMAND_CLASS_NAME>();                                                            \
-  }                                                                                                           \
-  class ClassToRegisterCommand##COMMAND_CLASS_NAME                                                            \
-  {                                                                                                           \
-  public:                                                                                                     \
-    ClassToRegisterCommand##COMMAND_CLASS_NAME()                                                              \
-    {                                                                                                         \
-      CommandFactory::instance()->registerFactoryFunction(COMMAND_CLASS_NAME::TargetId,                       \
-                                                          COMMAND_CLASS_NAME::CmdName,                        \
-                                                          functionToCreateCommand##COMMAND_CLASS_NAME);       \
-    }                                                                                                         \
-  };                                                                                                          \
-  ClassToRegisterCommand##COMMAND_CLASS_NAME functionToCreateInstanceToRegisterCommand##COMMAND_CLASS_NAME(); \
-  static ClassToRegisterCommand##COMMAND_CLASS_NAME instanceToRegisterCommand##COMMAND_CLASS_NAME =           \
-    functionToCreateInstanceToRegisterCommand##COMMAND_CLASS_NAME();
-
-#define REGISTER_COMMAND_TO_FACTORY_IMPL(COMMAND_CLASS_NAME)                                                 \
-  ClassToRegisterCommand##COMMAND_CLASS_NAME functionToCreateInstanceToRegisterCommand##COMMAND_CLASS_NAME() \
-  {                                                                                                          \
-    static ClassToRegisterCommand##COMMAND_CLASS_NAME staticInstance;                                        \
-    return staticInstance;                                                                                   \
-  }
+// Generated commands are found in the compile-time registry (command_registry.h). These macros are kept for the
+// generated code and don't register anything at startup.
+#define REGISTER_COMMAND_TO_FACTORY_DECL(COMMAND_CLASS_NAME) static_assert(true)
+#define REGISTER_COMMAND_TO_FACTORY_IMPL(COMMAND_CLASS_NAME) static_assert(true)
 
 namespace Sdx
 {
@@ -46,6 +25,7 @@ public:
   CommandBasePtr createCommand(const std::string& serializedCommand, std::string* errorMsg = nullptr);
   CommandResultPtr createCommandResult(const std::string& serializedCommand, std::string* errorMsg = nullptr);
   using FactoryFunction = CommandBasePtr (*)();
+  // Adds a command which isn't part of the generated registry
   void registerFactoryFunction(const std::string& targetID, const std::string& cmdName, FactoryFunction fct);
 
 private:
@@ -0,0 +1,169 @@
+#ifndef COMMAND_REGISTRY_H
+#define COMMAND_REGISTRY_H
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string_view>
+
+#include "command_factory.h"
+
+namespace Sdx
+{
+
+struct CommandRegistryEntry
+{
+  std::string_view targetId;
+  std::string_view cmdName;
+  CommandFactory::FactoryFunction create;
+};
+
+//
+// Perfect hash table of commands, built at compile time (hash and displace).
+//
+// Keys are hashed once into a bucket, each bucket stores the displacement which sends all of its keys to distinct
+// slots. A lookup is one hash, two array reads and one string comparison, and the table needs no initialization at
+// runtime.
+//
+template<std::size_t N>
+class CommandRegistry
+{
+public:
+  static constexpr std::size_t BucketCount = N / 4 + 1;
+  static constexpr std::size_t SlotCount = std::bit_ceil(2 * N);
+  static constexpr uint16_t EmptySlot = UINT16_MAX;
+  static constexpr uint16_t MaxDisplacement = 4096;
+
+  static_assert(N < EmptySlot, "Too many commands for the registry");
+
+  static constexpr uint64_t hash(std::string_view targetId, std::string_view cmdName)
+  {
+    // FNV-1a, with a separator which can't be part of a name
+    uint64_t h = 14695981039346656037ull;
+    auto add = [&h](uint8_t c) {
+      h ^= c;
+      h *= 1099511628211ull;
+    };
+
+    for (char c : targetId)
+      add(static_cast<uint8_t>(c));
+    add(0xff);
+    for (char c : cmdName)
+      add(static_cast<uint8_t>(c));
+    return h;
+  }
+
+  constexpr explicit CommandRegistry(const std::array<CommandRegistryEntry, N>& entries) :
+    m_entries(entries),
+    m_displacements {},
+    m_slots {}
+  {
+    std::array<uint64_t, N> hashes {};
+    std::array<uint16_t, BucketCount + 1> bucketBegin {};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      hashes[i] = hash(entries[i].targetId, entries[i].cmdName);
+      ++bucketBegin[bucketOf(hashes[i]) + 1];
+    }
+
+    std::size_t largestBucket = 0;
+    for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+    {
+      largestBucket = std::max<std::size_t>(largestBucket, bucketBegin[bucket + 1]);
+      bucketBegin[bucket + 1] += bucketBegin[bucket];
+    }
+
+    // Entries grouped by bucket
+    std::array<uint16_t, N> bucketEntries {};
+    std::array<uint16_t, BucketCount> bucketFill {};
+    for (std::size_t i = 0; i < N; ++i)
+    {
+      const std::size_t bucket = bucketOf(hashes[i]);
+      bucketEntries[bucketBegin[bucket] + bucketFill[bucket]++] = static_cast<uint16_t>(i);
+    }
+
+    for (uint16_t& slot : m_slots)
+      slot = EmptySlot;
+
+    // The largest buckets are placed first, while the table is still mostly empty
+    for (std::size_t size = largestBucket; size > 0; --size)
+    {
+      for (std::size_t bucket = 0; bucket < BucketCount; ++bucket)
+      {
+        if (std::size_t(bucketBegin[bucket + 1] - bucketBegin[bucket]) == size)
+          placeBucket(bucket, hashes, bucketEntries, bucketBegin[bucket], bucketBegin[bucket + 1]);
+      }
+    }
+  }
+
+  const CommandRegistryEntry* find(std::string_view targetId, std::string_view cmdName) const
+  {
+    const uint64_t h = hash(targetId, cmdName);
+    const uint16_t index = m_slots[slotOf(h, m_displacements[bucketOf(h)])];
+    if (index == EmptySlot)
+      return nullptr;
+
+    const CommandRegistryEntry& entry = m_entries[index];
+    return entry.targetId == targetId && entry.cmdName == cmdName ? &entry : nullptr;
+  }
+
+  constexpr const std::array<CommandRegistryEntry, N>& entries() const { return m_entries; }
+
+private:
+  static constexpr std::size_t bucketOf(uint64_t h) { return static_cast<std::size_t>((h >> 32) % BucketCount); }
+
+  static constexpr std::size_t slotOf(uint64_t h, uint16_t displacement)
+  {
+    const uint64_t step = (h >> 32) | 1;
+    return static_cast<std::size_t>((h + displacement * step) & (SlotCount - 1));
+  }
+
+  constexpr void placeBucket(std::size_t bucket,
+                             const std::array<uint64_t, N>& hashes,
+                             const std::array<uint16_t, N>& bucketEntries,
+                             std::size_t begin,
+                             std::size_t end)
+  {
+    for (uint16_t displacement = 0; displacement < MaxDisplacement; ++displacement)
+    {
+      std::size_t placed = begin;
+      for (; placed < end; ++placed)
+      {
+        const std::size_t slot = slotOf(hashes[bucketEntries[placed]], displacement);
+        if (m_slots[slot] != EmptySlot)
+          break;
+        m_slots[slot] = bucketEntries[placed];
+      }
+
+      if (placed == end)
+      {
+        m_displacements[bucket] = displacement;
+        return;
+      }
+
+      // Undo this attempt
+      for (std::size_t i = begin; i < placed; ++i)
+        m_slots[slotOf(hashes[bucketEntries[i]], displacement)] = EmptySlot;
+    }
+
+    // Reached only with duplicated commands, fails the compilation
+    throw std::logic_error("Can't build the command registry, is a command registered twice?");
+  }
+
+  std::array<CommandRegistryEntry, N> m_entries;
+  std::array<uint16_t, BucketCount> m_displacements;
+  std::array<uint16_t, SlotCount> m_slots;
+};
+
+// Looks up the generated commands, defined in command_registry_generated_code.cpp
+const CommandRegistryEntry* findRegisteredCommand(std::string_view targetId, std::string_view cmdName);
+// All the generated commands, checked against the generated sources by command_registry_test
+std::span<const CommandRegistryEntry> registeredCommands();
+
+} // namespace Sdx
+
+#endif // COMMAND_REGISTRY_H
@@ -0,0 +1,1194 @@
+#include "command_registry.h"
+
+#include "all_commands.h"
+
+namespace Sdx
+{
+
+namespace
+{
+template<class T>
+CommandBasePtr createCommand()
+{
+  return std::make_shared<T>();
+}
+
+constexpr std::array<CommandRegistryEntry, 1162> Entries = {{
+  {"", "AbortWaitSimulatorState", createCommand<Cmd::AbortWaitSimulatorState>},
+  {"", "AddDataSet", createCommand<Cmd::AddDataSet>},
+  {"", "AddEmptySVAntennaModel", createCommand<Cmd::AddEmptySVAntennaModel>},
+  {"", "AddEmptyVehicleAntennaModel", createCommand<Cmd::AddEmptyVehicleAntennaModel>},
+  {"", "AddIntTx", createCommand<Cmd::AddIntTx>},
+  {"", "AddSVGainPatternOffset", createCommand<Cmd::AddSVGainPatternOffset>},
+  {"", "AddSVPhasePatternOffset", createCommand<Cmd::AddSVPhasePatternOffset>},
+  {"", "AddSpoofTx", createCommand<Cmd::AddSpoofTx>},
+  {"", "AddVehicleGainPatternOffset", createCommand<Cmd::AddVehicleGainPatternOffset>},
+  {"", "AddVehiclePhasePatternOffset", createCommand<Cmd::AddVehiclePhasePatternOffset>},
+  {"", "ApplyDelayInSbas", createCommand<Cmd::ApplyDelayInSbas>},
+  {"", "Arm", createCommand<Cmd::Arm>},
+  {"", "ArmPPS", createCommand<Cmd::ArmPPS>},
+  {"", "BeginIntTxTrackDefinition", createCommand<Cmd::BeginIntTxTrackDefinition>},
+  {"", "BeginRouteDefinition", createCommand<Cmd::BeginRouteDefinition>},
+  {"", "BeginSpoofTxTrackDefinition", createCommand<Cmd::BeginSpoofTxTrackDefinition>},
+  {"", "BeginTrackDefinition", createCommand<Cmd::BeginTrackDefinition>},
+  {"", "BeginVehicleInfo", createCommand<Cmd::BeginVehicleInfo>},
+  {"", "BroadcastConfig", createCommand<Cmd::BroadcastConfig>},
+  {"", "CalibFunction", createCommand<Cmd::CalibFunction>},
+  {"", "CalibratePilotOutput", createCommand<Cmd::CalibratePilotOutput>},
+  {"", "CancelBroadcastConfig", createCommand<Cmd::CancelBroadcastConfig>},
+  {"", "ChangeCustomSignalColor", createCommand<Cmd::ChangeCustomSignalColor>},
+  {"", "ChangeIntTxColor", createCommand<Cmd::ChangeIntTxColor>},
+  {"", "ChangeModulationTargetInterference", createCommand<Cmd::ChangeModulationTargetInterference>},
+  {"", "ChangeModulationTargetName", createCommand<Cmd::ChangeModulationTargetName>},
+  {"", "ChangeModulationTargetSignals", createCommand<Cmd::ChangeModulationTargetSignals>},
+  {"", "ChangeSpoofTxColor", createCommand<Cmd::ChangeSpoofTxColor>},
+  {"", "ClearAllAntennaChanges", createCommand<Cmd::ClearAllAntennaChanges>},
+  {"", "ClearAllLOSForSystem", createCommand<Cmd::ClearAllLOSForSystem>},
+  {"", "ClearAllMessageModifications", createCommand<Cmd::ClearAllMessageModifications>},
+  {"", "ClearAllMessageModificationsForNavMsgFamily", createCommand<Cmd::ClearAllMessageModificationsForNavMsgFamily>},
+  {"", "ClearAllMessageModificationsForSignal", createCommand<Cmd::ClearAllMessageModificationsForSignal>},
+  {"", "ClearAllSbasServiceMessageRegionGroup", createCommand<Cmd::ClearAllSbasServiceMessageRegionGroup>},
+  {"", "ClearAutomatePage", createCommand<Cmd::ClearAutomatePage>},
+  {"", "ClearQzssL1SAugmentations", createCommand<Cmd::ClearQzssL1SAugmentations>},
+  {"", "ClearSpoofTxGpuIdx", createCommand<Cmd::ClearSpoofTxGpuIdx>},
+  {"", "ClearStatusLog", createCommand<Cmd::ClearStatusLog>},
+  {"", "ClearVehiculeTrajectory", createCommand<Cmd::ClearVehiculeTrajectory>},
+  {"", "CommandGroup", createCommand<Cmd::CommandGroup>},
+  {"", "ConnectSerialPortReceiver", createCommand<Cmd::ConnectSerialPortReceiver>},
+  {"", "CopySVAntennaModel", createCommand<Cmd::CopySVAntennaModel>},
+  {"", "CopyVehicleAntennaModel", createCommand<Cmd::CopyVehicleAntennaModel>},
+  {"", "DataFolderResult", createCommand<Cmd::DataFolderResult>},
+  {"", "DeleteDataSet", createCommand<Cmd::DeleteDataSet>},
+  {"", "DeleteSVAntennaModel", createCommand<Cmd::DeleteSVAntennaModel>},
+  {"", "DeleteVehicleAntennaModel", createCommand<Cmd::DeleteVehicleAntennaModel>},
+  {"", "DisconnectSerialPortReceiver", createCommand<Cmd::DisconnectSerialPortReceiver>},
+  {"", "DuplicateDataSet", createCommand<Cmd::DuplicateDataSet>},
+  {"", "EnableAlmanacExtrapolationFromEphemeris", createCommand<Cmd::EnableAlmanacExtrapolationFromEphemeris>},
+  {"", "EnableAutomaticGpuAllocation", createCommand<Cmd::EnableAutomaticGpuAllocation>},
+  {"", "EnableCnav2Pages", createCommand<Cmd::EnableCnav2Pages>},
+  {"", "EnableDektecAdjustedNoise", createCommand<Cmd::EnableDektecAdjustedNoise>},
+  {"", "EnableEachSV", createCommand<Cmd::EnableEachSV>},
+  {"", "EnableElevationMaskAbove", createCommand<Cmd::EnableElevationMaskAbove>},
+  {"", "EnableElevationMaskBelow", createCommand<Cmd::EnableElevationMaskBelow>},
+  {"", "EnableIntTx", createCommand<Cmd::EnableIntTx>},
+  {"", "EnableIntTxSignal", createCommand<Cmd::EnableIntTxSignal>},
+  {"", "EnableIntTxTrajectorySmoothing", createCommand<Cmd::EnableIntTxTrajectorySmoothing>},
+  {"", "EnableIonoOffset", createCommand<Cmd::EnableIonoOffset>},
+  {"", "EnableLogDownlink", createCommand<Cmd::EnableLogDownlink>},
+  {"", "EnableLogHILInput", createCommand<Cmd::EnableLogHILInput>},
+  {"", "EnableLogNmea", createCommand<Cmd::EnableLogNmea>},
+  {"", "EnableLogRaw", createCommand<Cmd::EnableLogRaw>},
+  {"", "EnableLogRinex", createCommand<Cmd::EnableLogRinex>},
+  {"", "EnableLosForEachSV", createCommand<Cmd::EnableLosForEachSV>},
+  {"", "EnableLosForSV", createCommand<Cmd::EnableLosForSV>},
+  {"", "EnableMainInstanceSync", createCommand<Cmd::EnableMainInstanceSync>},
+  {"", "EnableMasterPps", createCommand<Cmd::EnableMasterPps>},
+  {"", "EnableMultipath", createCommand<Cmd::EnableMultipath>},
+  {"", "EnableNtpClient", createCommand<Cmd::EnableNtpClient>},
+  {"", "EnableOsnmaForEachSV", createCommand<Cmd::EnableOsnmaForEachSV>},
+  {"", "EnableOsnmaForSV", createCommand<Cmd::EnableOsnmaForSV>},
+  {"", "EnablePYCodeForEachSV", createCommand<Cmd::EnablePYCodeForEachSV>},
+  {"", "EnablePYCodeForSV", createCommand<Cmd::EnablePYCodeForSV>},
+  {"", "EnablePlugin", createCommand<Cmd::EnablePlugin>},
+  {"", "EnableRFOutputForEachSV", createCommand<Cmd::EnableRFOutputForEachSV>},
+  {"", "EnableRFOutputForSV", createCommand<Cmd::EnableRFOutputForSV>},
+  {"", "EnableSV", createCommand<Cmd::EnableSV>},
+  {"", "EnableSbasFastCorrectionsFor", createCommand<Cmd::EnableSbasFastCorrectionsFor>},
+  {"", "EnableSbasLongTermCorrectionsFor", createCommand<Cmd::EnableSbasLongTermCorrectionsFor>},
+  {"", "EnableSbasMessages", createCommand<Cmd::EnableSbasMessages>},
+  {"", "EnableSignalForEachSV", createCommand<Cmd::EnableSignalForEachSV>},
+  {"", "EnableSignalForSV", createCommand<Cmd::EnableSignalForSV>},
+  {"", "EnableSignalStrengthModel", createCommand<Cmd::EnableSignalStrengthModel>},
+  {"", "EnableSimulationStopAtTrajectoryEnd", createCommand<Cmd::EnableSimulationStopAtTrajectoryEnd>},
+  {"", "EnableSlavePps", createCommand<Cmd::EnableSlavePps>},
+  {"", "EnableSpoofTx", createCommand<Cmd::EnableSpoofTx>},
+  {"", "EnableSpoofTxTrajectorySmoothing", createCommand<Cmd::EnableSpoofTxTrajectorySmoothing>},
+  {"", "EnableTrajectorySmoothing", createCommand<Cmd::EnableTrajectorySmoothing>},
+  {"", "EnableWorkerInstanceSync", createCommand<Cmd::EnableWorkerInstanceSync>},
+  {"", "EndIntTxTrackDefinition", createCommand<Cmd::EndIntTxTrackDefinition>},
+  {"", "EndIntTxTrackDefinitionResult", createCommand<Cmd::EndIntTxTrackDefinitionResult>},
+  {"", "EndRouteDefinition", createCommand<Cmd::EndRouteDefinition>},
+  {"", "EndRouteDefinitionResult", createCommand<Cmd::EndRouteDefinitionResult>},
+  {"", "EndSpoofTxTrackDefinition", createCommand<Cmd::EndSpoofTxTrackDefinition>},
+  {"", "EndSpoofTxTrackDefinitionResult", createCommand<Cmd::EndSpoofTxTrackDefinitionResult>},
+  {"", "EndTrackDefinition", createCommand<Cmd::EndTrackDefinition>},
+  {"", "EndTrackDefinitionResult", createCommand<Cmd::EndTrackDefinitionResult>},
+  {"", "EndVehicleInfo", createCommand<Cmd::EndVehicleInfo>},
+  {"", "ExecuteGpuBenchmark", createCommand<Cmd::ExecuteGpuBenchmark>},
+  {"", "ExecuteGpuBenchmarkResult", createCommand<Cmd::ExecuteGpuBenchmarkResult>},
+  {"", "ExportHilGraphDataToCSV", createCommand<Cmd::ExportHilGraphDataToCSV>},
+  {"", "ExportIonoGridErrors", createCommand<Cmd::ExportIonoGridErrors>},
+  {"", "ExportIonoGridGIVEI", createCommand<Cmd::ExportIonoGridGIVEI>},
+  {"", "ExportIonoGridMask", createCommand<Cmd::ExportIonoGridMask>},
+  {"", "ExportMerkleTree", createCommand<Cmd::ExportMerkleTree>},
+  {"", "ExportMessageSequenceToCSV", createCommand<Cmd::ExportMessageSequenceToCSV>},
+  {"", "ExportPerformanceDataToCSV", createCommand<Cmd::ExportPerformanceDataToCSV>},
+  {"", "ExportSVAntennaModel", createCommand<Cmd::ExportSVAntennaModel>},
+  {"", "ExportSbasMessageSequence", createCommand<Cmd::ExportSbasMessageSequence>},
+  {"", "ExportVehicleAntennaModel", createCommand<Cmd::ExportVehicleAntennaModel>},
+  {"", "ExportWFAntenna", createCommand<Cmd::ExportWFAntenna>},
+  {"", "FailureResult", createCommand<Cmd::FailureResult>},
+  {"", "ForceAttitudeToZero", createCommand<Cmd::ForceAttitudeToZero>},
+  {"", "ForceIntTxAttitudeToZero", createCommand<Cmd::ForceIntTxAttitudeToZero>},
+  {"", "ForceSVGeo", createCommand<Cmd::ForceSVGeo>},
+  {"", "ForceSpoofTxAttitudeToZero", createCommand<Cmd::ForceSpoofTxAttitudeToZero>},
+  {"", "GetActiveDataSet", createCommand<Cmd::GetActiveDataSet>},
+  {"", "GetActiveDataSetResult", createCommand<Cmd::GetActiveDataSetResult>},
+  {"", "GetAgeOfDataBeiDou", createCommand<Cmd::GetAgeOfDataBeiDou>},
+  {"", "GetAgeOfDataBeiDouResult", createCommand<Cmd::GetAgeOfDataBeiDouResult>},
+  {"", "GetAllIntTxID", createCommand<Cmd::GetAllIntTxID>},
+  {"", "GetAllIntTxIDResult", createCommand<Cmd::GetAllIntTxIDResult>},
+  {"", "GetAllMerkleTreeID", createCommand<Cmd::GetAllMerkleTreeID>},
+  {"", "GetAllMerkleTreeIDResult", createCommand<Cmd::GetAllMerkleTreeIDResult>},
+  {"", "GetAllMessageModificationIdsForNavMsgFamily", createCommand<Cmd::GetAllMessageModificationIdsForNavMsgFamily>},
+  {"", "GetAllMessageModificationIdsForNavMsgFamilyResult", createCommand<Cmd::GetAllMessageModificationIdsForNavMsgFamilyResult>},
+  {"", "GetAllMessageModificationIdsForSignal", createCommand<Cmd::GetAllMessageModificationIdsForSignal>},
+  {"", "GetAllMessageModificationIdsForSignalResult", createCommand<Cmd::GetAllMessageModificationIdsForSignalResult>},
+  {"", "GetAllModulationTargets", createCommand<Cmd::GetAllModulationTargets>},
+  {"", "GetAllModulationTargetsResult", createCommand<Cmd::GetAllModulationTargetsResult>},
+  {"", "GetAllMultipathForResult", createCommand<Cmd::GetAllMultipathForResult>},
+  {"", "GetAllMultipathForSV", createCommand<Cmd::GetAllMultipathForSV>},
+  {"", "GetAllMultipathForSignal", createCommand<Cmd::GetAllMultipathForSignal>},
+  {"", "GetAllMultipathForSystem", createCommand<Cmd::GetAllMultipathForSystem>},
+  {"", "GetAllPowerForSV", createCommand<Cmd::GetAllPowerForSV>},
+  {"", "GetAllPowerForSVResult", createCommand<Cmd::GetAllPowerForSVResult>},
+  {"", "GetAllPseudorangeRampForSV", createCommand<Cmd::GetAllPseudorangeRampForSV>},
+  {"", "GetAllPseudorangeRampForSVResult", createCommand<Cmd::GetAllPseudorangeRampForSVResult>},
+  {"", "GetAllSVAntennaNames", createCommand<Cmd::GetAllSVAntennaNames>},
+  {"", "GetAllSVAntennaNamesResult", createCommand<Cmd::GetAllSVAntennaNamesResult>},
+  {"", "GetAllSatellitesPseudorangeNoiseGaussMarkov", createCommand<Cmd::GetAllSatellitesPseudorangeNoiseGaussMarkov>},
+  {"", "GetAllSatellitesPseudorangeNoiseOffset", createCommand<Cmd::GetAllSatellitesPseudorangeNoiseOffset>},
+  {"", "GetAllSatellitesPseudorangeNoiseSineWave", createCommand<Cmd::GetAllSatellitesPseudorangeNoiseSineWave>},
+  {"", "GetAllSignalsFromIntTx", createCommand<Cmd::GetAllSignalsFromIntTx>},
+  {"", "GetAllSignalsFromIntTxResult", createCommand<Cmd::GetAllSignalsFromIntTxResult>},
+  {"", "GetAllSpoofTxID", createCommand<Cmd::GetAllSpoofTxID>},
+  {"", "GetAllSpoofTxIDResult", createCommand<Cmd::GetAllSpoofTxIDResult>},
+  {"", "GetAllVehicleAntennaNames", createCommand<Cmd::GetAllVehicleAntennaNames>},
+  {"", "GetAllVehicleAntennaNamesResult", createCommand<Cmd::GetAllVehicleAntennaNamesResult>},
+  {"", "GetAlmanacInitialUploadTimeOffset", createCommand<Cmd::GetAlmanacInitialUploadTimeOffset>},
+  {"", "GetAlmanacInitialUploadTimeOffsetResult", createCommand<Cmd::GetAlmanacInitialUploadTimeOffsetResult>},
+  {"", "GetAlmanacUploadTimeInterval", createCommand<Cmd::GetAlmanacUploadTimeInterval>},
+  {"", "GetAlmanacUploadTimeIntervalResult", createCommand<Cmd::GetAlmanacUploadTimeIntervalResult>},
+  {"", "GetAntennaChange", createCommand<Cmd::GetAntennaChange>},
+  {"", "GetAntennaChangeResult", createCommand<Cmd::GetAntennaChangeResult>},
+  {"", "GetBeiDouAutonomousHealthForSV", createCommand<Cmd::GetBeiDouAutonomousHealthForSV>},
+  {"", "GetBeiDouAutonomousHealthForSVResult", createCommand<Cmd::GetBeiDouAutonomousHealthForSVResult>},
+  {"", "GetBeiDouCNavHealthInfoForSV", createCommand<Cmd::GetBeiDouCNavHealthInfoForSV>},
+  {"", "GetBeiDouCNavHealthInfoForSVResult", createCommand<Cmd::GetBeiDouCNavHealthInfoForSVResult>},
+  {"", "GetBeiDouEphBoolParamForEachSV", createCommand<Cmd::GetBeiDouEphBoolParamForEachSV>},
+  {"", "GetBeiDouEphBoolParamForEachSVResult", createCommand<Cmd::GetBeiDouEphBoolParamForEachSVResult>},
+  {"", "GetBeiDouEphBoolParamForSV", createCommand<Cmd::GetBeiDouEphBoolParamForSV>},
+  {"", "GetBeiDouEphBoolParamForSVResult", createCommand<Cmd::GetBeiDouEphBoolParamForSVResult>},
+  {"", "GetBeiDouEphDoubleParamForEachSV", createCommand<Cmd::GetBeiDouEphDoubleParamForEachSV>},
+  {"", "GetBeiDouEphDoubleParamForEachSVResult", createCommand<Cmd::GetBeiDouEphDoubleParamForEachSVResult>},
+  {"", "GetBeiDouEphDoubleParamForSV", createCommand<Cmd::GetBeiDouEphDoubleParamForSV>},
+  {"", "GetBeiDouEphDoubleParamForSVResult", createCommand<Cmd::GetBeiDouEphDoubleParamForSVResult>},
+  {"", "GetBeiDouEphemerisBoolParams", createCommand<Cmd::GetBeiDouEphemerisBoolParams>},
+  {"", "GetBeiDouEphemerisDoubleParams", createCommand<Cmd::GetBeiDouEphemerisDoubleParams>},
+  {"", "GetBeiDouHealthInfoForSV", createCommand<Cmd::GetBeiDouHealthInfoForSV>},
+  {"", "GetBeiDouHealthInfoForSVResult", createCommand<Cmd::GetBeiDouHealthInfoForSVResult>},
+  {"", "GetBeiDouHealthStatusForSV", createCommand<Cmd::GetBeiDouHealthStatusForSV>},
+  {"", "GetBeiDouHealthStatusForSVResult", createCommand<Cmd::GetBeiDouHealthStatusForSVResult>},
+  {"", "GetCnav2PagesEnabled", createCommand<Cmd::GetCnav2PagesEnabled>},
+  {"", "GetCnav2PagesEnabledResult", createCommand<Cmd::GetCnav2PagesEnabledResult>},
+  {"", "GetComputerSystemTimeSinceEpochAtPps0", createCommand<Cmd::GetComputerSystemTimeSinceEpochAtPps0>},
+  {"", "GetComputerSystemTimeSinceEpochAtPps0Result", createCommand<Cmd::GetComputerSystemTimeSinceEpochAtPps0Result>},
+  {"", "GetConfigBroadcastFilter", createCommand<Cmd::GetConfigBroadcastFilter>},
+  {"", "GetConfigBroadcastFilterResult", createCommand<Cmd::GetConfigBroadcastFilterResult>},
+  {"", "GetConfigBroadcastOnStart", createCommand<Cmd::GetConfigBroadcastOnStart>},
+  {"", "GetConfigBroadcastOnStartResult", createCommand<Cmd::GetConfigBroadcastOnStartResult>},
+  {"", "GetConfigPaths", createCommand<Cmd::GetConfigPaths>},
+  {"", "GetConfigPathsResult", createCommand<Cmd::GetConfigPathsResult>},
+  {"", "GetConstellationParameterForEachSV", createCommand<Cmd::GetConstellationParameterForEachSV>},
+  {"", "GetConstellationParameterForEachSVResult", createCommand<Cmd::GetConstellationParameterForEachSVResult>},
+  {"", "GetConstellationParameterForSV", createCommand<Cmd::GetConstellationParameterForSV>},
+  {"", "GetConstellationParameterForSVResult", createCommand<Cmd::GetConstellationParameterForSVResult>},
+  {"", "GetCrossAuthenticatedSatellitesForSV", createCommand<Cmd::GetCrossAuthenticatedSatellitesForSV>},
+  {"", "GetCrossAuthenticatedSatellitesForSVResult", createCommand<Cmd::GetCrossAuthenticatedSatellitesForSVResult>},
+  {"", "GetCurrentConfigPath", createCommand<Cmd::GetCurrentConfigPath>},
+  {"", "GetCurrentConfigPathResult", createCommand<Cmd::GetCurrentConfigPathResult>},
+  {"", "GetCurrentPropagationModel", createCommand<Cmd::GetCurrentPropagationModel>},
+  {"", "GetCurrentPropagationModelResult", createCommand<Cmd::GetCurrentPropagationModelResult>},
+  {"", "GetDataFolder", createCommand<Cmd::GetDataFolder>},
+  {"", "GetDataSetAssignation", createCommand<Cmd::GetDataSetAssignation>},
+  {"", "GetDataSetAssignationResult", createCommand<Cmd::GetDataSetAssignationResult>},
+  {"", "GetDefaultIntTxPersistence", createCommand<Cmd::GetDefaultIntTxPersistence>},
+  {"", "GetDefaultIntTxPersistenceResult", createCommand<Cmd::GetDefaultIntTxPersistenceResult>},
+  {"", "GetDefaultVehicleAntennaModel", createCommand<Cmd::GetDefaultVehicleAntennaModel>},
+  {"", "GetDefaultVehicleAntennaModelResult", createCommand<Cmd::GetDefaultVehicleAntennaModelResult>},
+  {"", "GetDuration", createCommand<Cmd::GetDuration>},
+  {"", "GetDurationResult", createCommand<Cmd::GetDurationResult>},
+  {"", "GetDynamicRangeOffset", createCommand<Cmd::GetDynamicRangeOffset>},
+  {"", "GetDynamicRangeOffsetResult", createCommand<Cmd::GetDynamicRangeOffsetResult>},
+  {"", "GetEffectiveIonisationLevelCoefficient", createCommand<Cmd::GetEffectiveIonisationLevelCoefficient>},
+  {"", "GetEffectiveIonisationLevelCoefficientResult", createCommand<Cmd::GetEffectiveIonisationLevelCoefficientResult>},
+  {"", "GetElevationAzimuthForEachSV", createCommand<Cmd::GetElevationAzimuthForEachSV>},
+  {"", "GetElevationAzimuthForEachSVResult", createCommand<Cmd::GetElevationAzimuthForEachSVResult>},
+  {"", "GetElevationAzimuthForSV", createCommand<Cmd::GetElevationAzimuthForSV>},
+  {"", "GetElevationAzimuthForSVResult", createCommand<Cmd::GetElevationAzimuthForSVResult>},
+  {"", "GetElevationMaskAbove", createCommand<Cmd::GetElevationMaskAbove>},
+  {"", "GetElevationMaskAboveResult", createCommand<Cmd::GetElevationMaskAboveResult>},
+  {"", "GetElevationMaskBelow", createCommand<Cmd::GetElevationMaskBelow>},
+  {"", "GetElevationMaskBelowResult", createCommand<Cmd::GetElevationMaskBelowResult>},
+  {"", "GetEnabledSignalsForSV", createCommand<Cmd::GetEnabledSignalsForSV>},
+  {"", "GetEnabledSignalsForSVResult", createCommand<Cmd::GetEnabledSignalsForSVResult>},
+  {"", "GetEncryptionLibraryPath", createCommand<Cmd::GetEncryptionLibraryPath>},
+  {"", "GetEncryptionLibraryPathResult", createCommand<Cmd::GetEncryptionLibraryPathResult>},
+  {"", "GetEngineLatency", createCommand<Cmd::GetEngineLatency>},
+  {"", "GetEngineLatencyResult", createCommand<Cmd::GetEngineLatencyResult>},
+  {"", "GetEphemerisErrorForSV", createCommand<Cmd::GetEphemerisErrorForSV>},
+  {"", "GetEphemerisErrorForSVResult", createCommand<Cmd::GetEphemerisErrorForSVResult>},
+  {"", "GetEphemerisReferenceTime", createCommand<Cmd::GetEphemerisReferenceTime>},
+  {"", "GetEphemerisReferenceTimeForSV", createCommand<Cmd::GetEphemerisReferenceTimeForSV>},
+  {"", "GetEphemerisReferenceTimeForSVResult", createCommand<Cmd::GetEphemerisReferenceTimeForSVResult>},
+  {"", "GetEphemerisTocOffset", createCommand<Cmd::GetEphemerisTocOffset>},
+  {"", "GetEphemerisTocOffsetResult", createCommand<Cmd::GetEphemerisTocOffsetResult>},
+  {"", "GetEphemerisUpdateInterval", createCommand<Cmd::GetEphemerisUpdateInterval>},
+  {"", "GetEphemerisUpdateIntervalResult", createCommand<Cmd::GetEphemerisUpdateIntervalResult>},
+  {"", "GetGalileoDataHealthForSV", createCommand<Cmd::GetGalileoDataHealthForSV>},
+  {"", "GetGalileoDataHealthForSVResult", createCommand<Cmd::GetGalileoDataHealthForSVResult>},
+  {"", "GetGalileoEphDoubleParamForEachSV", createCommand<Cmd::GetGalileoEphDoubleParamForEachSV>},
+  {"", "GetGalileoEphDoubleParamForEachSVResult", createCommand<Cmd::GetGalileoEphDoubleParamForEachSVResult>},
+  {"", "GetGalileoEphDoubleParamForSV", createCommand<Cmd::GetGalileoEphDoubleParamForSV>},
+  {"", "GetGalileoEphDoubleParamForSVResult", createCommand<Cmd::GetGalileoEphDoubleParamForSVResult>},
+  {"", "GetGalileoEphemerisDoubleParams", createCommand<Cmd::GetGalileoEphemerisDoubleParams>},
+  {"", "GetGalileoFnavSatelliteK", createCommand<Cmd::GetGalileoFnavSatelliteK>},
+  {"", "GetGalileoFnavSatelliteKResult", createCommand<Cmd::GetGalileoFnavSatelliteKResult>},
+  {"", "GetGalileoSignalHealthForSV", createCommand<Cmd::GetGalileoSignalHealthForSV>},
+  {"", "GetGalileoSignalHealthForSVResult", createCommand<Cmd::GetGalileoSignalHealthForSVResult>},
+  {"", "GetGaussianNoisePowerDensityOffset", createCommand<Cmd::GetGaussianNoisePowerDensityOffset>},
+  {"", "GetGaussianNoisePowerDensityOffsetResult", createCommand<Cmd::GetGaussianNoisePowerDensityOffsetResult>},
+  {"", "GetGlobalPowerOffset", createCommand<Cmd::GetGlobalPowerOffset>},
+  {"", "GetGlobalPowerOffsetResult", createCommand<Cmd::GetGlobalPowerOffsetResult>},
+  {"", "GetGlonassAlmanacUnhealthyFlagForSV", createCommand<Cmd::GetGlonassAlmanacUnhealthyFlagForSV>},
+  {"", "GetGlonassAlmanacUnhealthyFlagForSVResult", createCommand<Cmd::GetGlonassAlmanacUnhealthyFlagForSVResult>},
+  {"", "GetGlonassDoubleParams", createCommand<Cmd::GetGlonassDoubleParams>},
+  {"", "GetGlonassEphDoubleParamForEachSV", createCommand<Cmd::GetGlonassEphDoubleParamForEachSV>},
+  {"", "GetGlonassEphDoubleParamForEachSVResult", createCommand<Cmd::GetGlonassEphDoubleParamForEachSVResult>},
+  {"", "GetGlonassEphDoubleParamForSV", createCommand<Cmd::GetGlonassEphDoubleParamForSV>},
+  {"", "GetGlonassEphDoubleParamForSVResult", createCommand<Cmd::GetGlonassEphDoubleParamForSVResult>},
+  {"", "GetGlonassEphemerisHealthFlagForSV", createCommand<Cmd::GetGlonassEphemerisHealthFlagForSV>},
+  {"", "GetGlonassEphemerisHealthFlagForSVResult", createCommand<Cmd::GetGlonassEphemerisHealthFlagForSVResult>},
+  {"", "GetGlonassFrequencyNumberForEachSV", createCommand<Cmd::GetGlonassFrequencyNumberForEachSV>},
+  {"", "GetGlonassFrequencyNumberForEachSVResult", createCommand<Cmd::GetGlonassFrequencyNumberForEachSVResult>},
+  {"", "GetGpsAntiSpoofingFlagForSV", createCommand<Cmd::GetGpsAntiSpoofingFlagForSV>},
+  {"", "GetGpsAntiSpoofingFlagForSVResult", createCommand<Cmd::GetGpsAntiSpoofingFlagForSVResult>},
+  {"", "GetGpsCNavAlertFlagToSV", createCommand<Cmd::GetGpsCNavAlertFlagToSV>},
+  {"", "GetGpsCNavAlertFlagToSVResult", createCommand<Cmd::GetGpsCNavAlertFlagToSVResult>},
+  {"", "GetGpsConfigurationCodeForSV", createCommand<Cmd::GetGpsConfigurationCodeForSV>},
+  {"", "GetGpsConfigurationCodeForSVResult", createCommand<Cmd::GetGpsConfigurationCodeForSVResult>},
+  {"", "GetGpsConfigurationForEachSV", createCommand<Cmd::GetGpsConfigurationForEachSV>},
+  {"", "GetGpsConfigurationForEachSVResult", createCommand<Cmd::GetGpsConfigurationForEachSVResult>},
+  {"", "GetGpsDataHealthForSV", createCommand<Cmd::GetGpsDataHealthForSV>},
+  {"", "GetGpsDataHealthForSVResult", createCommand<Cmd::GetGpsDataHealthForSVResult>},
+  {"", "GetGpsEphBoolParamForEachSV", createCommand<Cmd::GetGpsEphBoolParamForEachSV>},
+  {"", "GetGpsEphBoolParamForEachSVResult", createCommand<Cmd::GetGpsEphBoolParamForEachSVResult>},
+  {"", "GetGpsEphBoolParamForSV", createCommand<Cmd::GetGpsEphBoolParamForSV>},
+  {"", "GetGpsEphBoolParamForSVResult", createCommand<Cmd::GetGpsEphBoolParamForSVResult>},
+  {"", "GetGpsEphDoubleParamForEachSV", createCommand<Cmd::GetGpsEphDoubleParamForEachSV>},
+  {"", "GetGpsEphDoubleParamForEachSVResult", createCommand<Cmd::GetGpsEphDoubleParamForEachSVResult>},
+  {"", "GetGpsEphDoubleParamForSV", createCommand<Cmd::GetGpsEphDoubleParamForSV>},
+  {"", "GetGpsEphDoubleParamForSVResult", createCommand<Cmd::GetGpsEphDoubleParamForSVResult>},
+  {"", "GetGpsEphemerisBoolParams", createCommand<Cmd::GetGpsEphemerisBoolParams>},
+  {"", "GetGpsEphemerisDoubleParams", createCommand<Cmd::GetGpsEphemerisDoubleParams>},
+  {"", "GetGpsL1HealthForSV", createCommand<Cmd::GetGpsL1HealthForSV>},
+  {"", "GetGpsL1HealthForSVResult", createCommand<Cmd::GetGpsL1HealthForSVResult>},
+  {"", "GetGpsL1cHealthForSV", createCommand<Cmd::GetGpsL1cHealthForSV>},
+  {"", "GetGpsL1cHealthForSVResult", createCommand<Cmd::GetGpsL1cHealthForSVResult>},
+  {"", "GetGpsL2HealthForSV", createCommand<Cmd::GetGpsL2HealthForSV>},
+  {"", "GetGpsL2HealthForSVResult", createCommand<Cmd::GetGpsL2HealthForSVResult>},
+  {"", "GetGpsL5HealthForSV", createCommand<Cmd::GetGpsL5HealthForSV>},
+  {"", "GetGpsL5HealthForSVResult", createCommand<Cmd::GetGpsL5HealthForSVResult>},
+  {"", "GetGpsNavAlertFlagForSV", createCommand<Cmd::GetGpsNavAlertFlagForSV>},
+  {"", "GetGpsNavAlertFlagForSVResult", createCommand<Cmd::GetGpsNavAlertFlagForSVResult>},
+  {"", "GetGpsSVConfigurationForAllSat", createCommand<Cmd::GetGpsSVConfigurationForAllSat>},
+  {"", "GetGpsSignalHealthForSV", createCommand<Cmd::GetGpsSignalHealthForSV>},
+  {"", "GetGpsSignalHealthForSVResult", createCommand<Cmd::GetGpsSignalHealthForSVResult>},
+  {"", "GetGpsStartTime", createCommand<Cmd::GetGpsStartTime>},
+  {"", "GetGpsStartTimeResult", createCommand<Cmd::GetGpsStartTimeResult>},
+  {"", "GetGpsTimingReceiver", createCommand<Cmd::GetGpsTimingReceiver>},
+  {"", "GetGpsTimingReceiverResult", createCommand<Cmd::GetGpsTimingReceiverResult>},
+  {"", "GetGpu", createCommand<Cmd::GetGpu>},
+  {"", "GetGpuResult", createCommand<Cmd::GetGpuResult>},
+  {"", "GetHilExtrapolationState", createCommand<Cmd::GetHilExtrapolationState>},
+  {"", "GetHilExtrapolationStateResult", createCommand<Cmd::GetHilExtrapolationStateResult>},
+  {"", "GetHilPort", createCommand<Cmd::GetHilPort>},
+  {"", "GetIntTx", createCommand<Cmd::GetIntTx>},
+  {"", "GetIntTxAWGN", createCommand<Cmd::GetIntTxAWGN>},
+  {"", "GetIntTxAWGNResult", createCommand<Cmd::GetIntTxAWGNResult>},
+  {"", "GetIntTxAntenna", createCommand<Cmd::GetIntTxAntenna>},
+  {"", "GetIntTxAntennaOffset", createCommand<Cmd::GetIntTxAntennaOffset>},
+  {"", "GetIntTxAntennaOffsetResult", createCommand<Cmd::GetIntTxAntennaOffsetResult>},
+  {"", "GetIntTxAntennaResult", createCommand<Cmd::GetIntTxAntennaResult>},
+  {"", "GetIntTxBOC", createCommand<Cmd::GetIntTxBOC>},
+  {"", "GetIntTxBOCResult", createCommand<Cmd::GetIntTxBOCResult>},
+  {"", "GetIntTxBPSK", createCommand<Cmd::GetIntTxBPSK>},
+  {"", "GetIntTxBPSKResult", createCommand<Cmd::GetIntTxBPSKResult>},
+  {"", "GetIntTxCW", createCommand<Cmd::GetIntTxCW>},
+  {"", "GetIntTxCWResult", createCommand<Cmd::GetIntTxCWResult>},
+  {"", "GetIntTxChirp", createCommand<Cmd::GetIntTxChirp>},
+  {"", "GetIntTxChirpResult", createCommand<Cmd::GetIntTxChirpResult>},
+  {"", "GetIntTxCircular", createCommand<Cmd::GetIntTxCircular>},
+  {"", "GetIntTxCircularResult", createCommand<Cmd::GetIntTxCircularResult>},
+  {"", "GetIntTxColor", createCommand<Cmd::GetIntTxColor>},
+  {"", "GetIntTxColorResult", createCommand<Cmd::GetIntTxColorResult>},
+  {"", "GetIntTxFix", createCommand<Cmd::GetIntTxFix>},
+  {"", "GetIntTxFixEcef", createCommand<Cmd::GetIntTxFixEcef>},
+  {"", "GetIntTxFixEcefResult", createCommand<Cmd::GetIntTxFixEcefResult>},
+  {"", "GetIntTxFixResult", createCommand<Cmd::GetIntTxFixResult>},
+  {"", "GetIntTxHiddenOnMap", createCommand<Cmd::GetIntTxHiddenOnMap>},
+  {"", "GetIntTxHiddenOnMapResult", createCommand<Cmd::GetIntTxHiddenOnMapResult>},
+  {"", "GetIntTxIqFile", createCommand<Cmd::GetIntTxIqFile>},
+  {"", "GetIntTxIqFileResult", createCommand<Cmd::GetIntTxIqFileResult>},
+  {"", "GetIntTxPersistence", createCommand<Cmd::GetIntTxPersistence>},
+  {"", "GetIntTxPersistenceResult", createCommand<Cmd::GetIntTxPersistenceResult>},
+  {"", "GetIntTxPulse", createCommand<Cmd::GetIntTxPulse>},
+  {"", "GetIntTxPulseResult", createCommand<Cmd::GetIntTxPulseResult>},
+  {"", "GetIntTxResult", createCommand<Cmd::GetIntTxResult>},
+  {"", "GetIntTxTrajectory", createCommand<Cmd::GetIntTxTrajectory>},
+  {"", "GetIntTxTrajectoryResult", createCommand<Cmd::GetIntTxTrajectoryResult>},
+  {"", "GetIntTxVehicleType", createCommand<Cmd::GetIntTxVehicleType>},
+  {"", "GetIntTxVehicleTypeResult", createCommand<Cmd::GetIntTxVehicleTypeResult>},
+  {"", "GetInterModulation", createCommand<Cmd::GetInterModulation>},
+  {"", "GetInterModulationResult", createCommand<Cmd::GetInterModulationResult>},
+  {"", "GetIonoAlpha", createCommand<Cmd::GetIonoAlpha>},
+  {"", "GetIonoAlphaResult", createCommand<Cmd::GetIonoAlphaResult>},
+  {"", "GetIonoBdgimAlpha", createCommand<Cmd::GetIonoBdgimAlpha>},
+  {"", "GetIonoBdgimAlphaResult", createCommand<Cmd::GetIonoBdgimAlphaResult>},
+  {"", "GetIonoBeta", createCommand<Cmd::GetIonoBeta>},
+  {"", "GetIonoBetaResult", createCommand<Cmd::GetIonoBetaResult>},
+  {"", "GetIonoGridError", createCommand<Cmd::GetIonoGridError>},
+  {"", "GetIonoGridErrorAll", createCommand<Cmd::GetIonoGridErrorAll>},
+  {"", "GetIonoGridErrorAllResult", createCommand<Cmd::GetIonoGridErrorAllResult>},
+  {"", "GetIonoGridErrorResult", createCommand<Cmd::GetIonoGridErrorResult>},
+  {"", "GetIonoGridGIVEI", createCommand<Cmd::GetIonoGridGIVEI>},
+  {"", "GetIonoGridGIVEIAll", createCommand<Cmd::GetIonoGridGIVEIAll>},
+  {"", "GetIonoGridGIVEIAllResult", createCommand<Cmd::GetIonoGridGIVEIAllResult>},
+  {"", "GetIonoGridGIVEIResult", createCommand<Cmd::GetIonoGridGIVEIResult>},
+  {"", "GetIonoGridMask", createCommand<Cmd::GetIonoGridMask>},
+  {"", "GetIonoGridMaskAll", createCommand<Cmd::GetIonoGridMaskAll>},
+  {"", "GetIonoGridMaskAllResult", createCommand<Cmd::GetIonoGridMaskAllResult>},
+  {"", "GetIonoGridMaskResult", createCommand<Cmd::GetIonoGridMaskResult>},
+  {"", "GetIonoModel", createCommand<Cmd::GetIonoModel>},
+  {"", "GetIonoModelResult", createCommand<Cmd::GetIonoModelResult>},
+  {"", "GetIssueOfData", createCommand<Cmd::GetIssueOfData>},
+  {"", "GetIssueOfDataBeiDou", createCommand<Cmd::GetIssueOfDataBeiDou>},
+  {"", "GetIssueOfDataBeiDouResult", createCommand<Cmd::GetIssueOfDataBeiDouResult>},
+  {"", "GetIssueOfDataGalileo", createCommand<Cmd::GetIssueOfDataGalileo>},
+  {"", "GetIssueOfDataGalileoResult", createCommand<Cmd::GetIssueOfDataGalileoResult>},
+  {"", "GetIssueOfDataNavIC", createCommand<Cmd::GetIssueOfDataNavIC>},
+  {"", "GetIssueOfDataNavICResult", createCommand<Cmd::GetIssueOfDataNavICResult>},
+  {"", "GetIssueOfDataQzss", createCommand<Cmd::GetIssueOfDataQzss>},
+  {"", "GetIssueOfDataQzssResult", createCommand<Cmd::GetIssueOfDataQzssResult>},
+  {"", "GetIssueOfDataResult", createCommand<Cmd::GetIssueOfDataResult>},
+  {"", "GetLastLeapSecondDate", createCommand<Cmd::GetLastLeapSecondDate>},
+  {"", "GetLastLeapSecondDateResult", createCommand<Cmd::GetLastLeapSecondDateResult>},
+  {"", "GetLeapSecondFuture", createCommand<Cmd::GetLeapSecondFuture>},
+  {"", "GetLeapSecondFutureResult", createCommand<Cmd::GetLeapSecondFutureResult>},
+  {"", "GetLogNmeaRate", createCommand<Cmd::GetLogNmeaRate>},
+  {"", "GetLogRawRate", createCommand<Cmd::GetLogRawRate>},
+  {"", "GetMainInstanceStatus", createCommand<Cmd::GetMainInstanceStatus>},
+  {"", "GetMainInstanceStatusResult", createCommand<Cmd::GetMainInstanceStatusResult>},
+  {"", "GetManualPowerOffsetForSV", createCommand<Cmd::GetManualPowerOffsetForSV>},
+  {"", "GetManualPowerOffsetForSVResult", createCommand<Cmd::GetManualPowerOffsetForSVResult>},
+  {"", "GetMasterStatus", createCommand<Cmd::GetMasterStatus>},
+  {"", "GetMasterStatusResult", createCommand<Cmd::GetMasterStatusResult>},
+  {"", "GetMerkleTreeParameters", createCommand<Cmd::GetMerkleTreeParameters>},
+  {"", "GetMerkleTreeParametersResult", createCommand<Cmd::GetMerkleTreeParametersResult>},
+  {"", "GetMerkleTreeXML", createCommand<Cmd::GetMerkleTreeXML>},
+  {"", "GetMerkleTreeXMLResult", createCommand<Cmd::GetMerkleTreeXMLResult>},
+  {"", "GetMessageModificationToBeiDouCNav1", createCommand<Cmd::GetMessageModificationToBeiDouCNav1>},
+  {"", "GetMessageModificationToBeiDouCNav1Result", createCommand<Cmd::GetMessageModificationToBeiDouCNav1Result>},
+  {"", "GetMessageModificationToBeiDouCNav2", createCommand<Cmd::GetMessageModificationToBeiDouCNav2>},
+  {"", "GetMessageModificationToBeiDouCNav2Result", createCommand<Cmd::GetMessageModificationToBeiDouCNav2Result>},
+  {"", "GetMessageModificationToBeiDouD1Nav", createCommand<Cmd::GetMessageModificationToBeiDouD1Nav>},
+  {"", "GetMessageModificationToBeiDouD1NavResult", createCommand<Cmd::GetMessageModificationToBeiDouD1NavResult>},
+  {"", "GetMessageModificationToBeiDouD2Nav", createCommand<Cmd::GetMessageModificationToBeiDouD2Nav>},
+  {"", "GetMessageModificationToBeiDouD2NavResult", createCommand<Cmd::GetMessageModificationToBeiDouD2NavResult>},
+  {"", "GetMessageModificationToGalileoCNav", createCommand<Cmd::GetMessageModificationToGalileoCNav>},
+  {"", "GetMessageModificationToGalileoCNavResult", createCommand<Cmd::GetMessageModificationToGalileoCNavResult>},
+  {"", "GetMessageModificationToGalileoFNav", createCommand<Cmd::GetMessageModificationToGalileoFNav>},
+  {"", "GetMessageModificationToGalileoFNavResult", createCommand<Cmd::GetMessageModificationToGalileoFNavResult>},
+  {"", "GetMessageModificationToGalileoINav", createCommand<Cmd::GetMessageModificationToGalileoINav>},
+  {"", "GetMessageModificationToGalileoINavResult", createCommand<Cmd::GetMessageModificationToGalileoINavResult>},
+  {"", "GetMessageModificationToGlonassNav", createCommand<Cmd::GetMessageModificationToGlonassNav>},
+  {"", "GetMessageModificationToGlonassNavResult", createCommand<Cmd::GetMessageModificationToGlonassNavResult>},
+  {"", "GetMessageModificationToGpsCNav", createCommand<Cmd::GetMessageModificationToGpsCNav>},
+  {"", "GetMessageModificationToGpsCNav2", createCommand<Cmd::GetMessageModificationToGpsCNav2>},
+  {"", "GetMessageModificationToGpsCNav2Result", createCommand<Cmd::GetMessageModificationToGpsCNav2Result>},
+  {"", "GetMessageModificationToGpsCNavResult", createCommand<Cmd::GetMessageModificationToGpsCNavResult>},
+  {"", "GetMessageModificationToGpsLNav", createCommand<Cmd::GetMessageModificationToGpsLNav>},
+  {"", "GetMessageModificationToGpsLNavResult", createCommand<Cmd::GetMessageModificationToGpsLNavResult>},
+  {"", "GetMessageModificationToNavICNav", createCommand<Cmd::GetMessageModificationToNavICNav>},
+  {"", "GetMessageModificationToNavICNavResult", createCommand<Cmd::GetMessageModificationToNavICNavResult>},
+  {"", "GetMessageModificationToPulsarNav", createCommand<Cmd::GetMessageModificationToPulsarNav>},
+  {"", "GetMessageModificationToPulsarNavResult", createCommand<Cmd::GetMessageModificationToPulsarNavResult>},
+  {"", "GetMessageModificationToPulsarX1", createCommand<Cmd::GetMessageModificationToPulsarX1>},
+  {"", "GetMessageModificationToPulsarX1Result", createCommand<Cmd::GetMessageModificationToPulsarX1Result>},
+  {"", "GetMessageModificationToQzssCNav", createCommand<Cmd::GetMessageModificationToQzssCNav>},
+  {"", "GetMessageModificationToQzssCNav2", createCommand<Cmd::GetMessageModificationToQzssCNav2>},
+  {"", "GetMessageModificationToQzssCNav2Result", createCommand<Cmd::GetMessageModificationToQzssCNav2Result>},
+  {"", "GetMessageModificationToQzssCNavResult", createCommand<Cmd::GetMessageModificationToQzssCNavResult>},
+  {"", "GetMessageModificationToQzssLNav", createCommand<Cmd::GetMessageModificationToQzssLNav>},
+  {"", "GetMessageModificationToQzssLNavResult", createCommand<Cmd::GetMessageModificationToQzssLNavResult>},
+  {"", "GetMessageModificationToQzssSlas", createCommand<Cmd::GetMessageModificationToQzssSlas>},
+  {"", "GetMessageModificationToQzssSlasResult", createCommand<Cmd::GetMessageModificationToQzssSlasResult>},
+  {"", "GetMessageModificationToSbasNav", createCommand<Cmd::GetMessageModificationToSbasNav>},
+  {"", "GetMessageModificationToSbasNavResult", createCommand<Cmd::GetMessageModificationToSbasNavResult>},
+  {"", "GetMessageSequence", createCommand<Cmd::GetMessageSequence>},
+  {"", "GetMessageSequenceResult", createCommand<Cmd::GetMessageSequenceResult>},
+  {"", "GetModulationTarget", createCommand<Cmd::GetModulationTarget>},
+  {"", "GetModulationTargetInterferences", createCommand<Cmd::GetModulationTargetInterferences>},
+  {"", "GetModulationTargetInterferencesResult", createCommand<Cmd::GetModulationTargetInterferencesResult>},
+  {"", "GetModulationTargetResult", createCommand<Cmd::GetModulationTargetResult>},
+  {"", "GetModulationTargetSignals", createCommand<Cmd::GetModulationTargetSignals>},
+  {"", "GetModulationTargetSignalsResult", createCommand<Cmd::GetModulationTargetSignalsResult>},
+  {"", "GetMultipathForID", createCommand<Cmd::GetMultipathForID>},
+  {"", "GetMultipathForIDResult", createCommand<Cmd::GetMultipathForIDResult>},
+  {"", "GetN310LocalOscillatorSource", createCommand<Cmd::GetN310LocalOscillatorSource>},
+  {"", "GetN310LocalOscillatorSourceResult", createCommand<Cmd::GetN310LocalOscillatorSourceResult>},
+  {"", "GetNavICEphDoubleParamForEachSV", createCommand<Cmd::GetNavICEphDoubleParamForEachSV>},
+  {"", "GetNavICEphDoubleParamForEachSVResult", createCommand<Cmd::GetNavICEphDoubleParamForEachSVResult>},
+  {"", "GetNavICEphDoubleParamForSV", createCommand<Cmd::GetNavICEphDoubleParamForSV>},
+  {"", "GetNavICEphDoubleParamForSVResult", createCommand<Cmd::GetNavICEphDoubleParamForSVResult>},
+  {"", "GetNavICEphemerisDoubleParam", createCommand<Cmd::GetNavICEphemerisDoubleParam>},
+  {"", "GetNavICEphemerisDoubleParams", createCommand<Cmd::GetNavICEphemerisDoubleParams>},
+  {"", "GetNavICL1HealthForSV", createCommand<Cmd::GetNavICL1HealthForSV>},
+  {"", "GetNavICL1HealthForSVResult", createCommand<Cmd::GetNavICL1HealthForSVResult>},
+  {"", "GetNavICL5HealthForSV", createCommand<Cmd::GetNavICL5HealthForSV>},
+  {"", "GetNavICL5HealthForSVResult", createCommand<Cmd::GetNavICL5HealthForSVResult>},
+  {"", "GetNavICNavAlertFlagForSV", createCommand<Cmd::GetNavICNavAlertFlagForSV>},
+  {"", "GetNavICNavAlertFlagForSVResult", createCommand<Cmd::GetNavICNavAlertFlagForSVResult>},
+  {"", "GetNavICSHealthForSV", createCommand<Cmd::GetNavICSHealthForSV>},
+  {"", "GetNavICSHealthForSVResult", createCommand<Cmd::GetNavICSHealthForSVResult>},
+  {"", "GetNavICSatelliteL5Health", createCommand<Cmd::GetNavICSatelliteL5Health>},
+  {"", "GetNavICSatelliteNavAlertFlag", createCommand<Cmd::GetNavICSatelliteNavAlertFlag>},
+  {"", "GetNmeaLoggerSentences", createCommand<Cmd::GetNmeaLoggerSentences>},
+  {"", "GetNmeaLoggerSentencesResult", createCommand<Cmd::GetNmeaLoggerSentencesResult>},
+  {"", "GetNmeaLoggerSerialPortDelay", createCommand<Cmd::GetNmeaLoggerSerialPortDelay>},
+  {"", "GetNmeaLoggerSerialPortDelayResult", createCommand<Cmd::GetNmeaLoggerSerialPortDelayResult>},
+  {"", "GetNtpServer", createCommand<Cmd::GetNtpServer>},
+  {"", "GetNtpServerResult", createCommand<Cmd::GetNtpServerResult>},
+  {"", "GetOfficialLeapSecond", createCommand<Cmd::GetOfficialLeapSecond>},
+  {"", "GetOfficialLeapSecondResult", createCommand<Cmd::GetOfficialLeapSecondResult>},
+  {"", "GetOsnmaMacFunction", createCommand<Cmd::GetOsnmaMacFunction>},
+  {"", "GetOsnmaMacFunctionResult", createCommand<Cmd::GetOsnmaMacFunctionResult>},
+  {"", "GetOsnmaMacLtId", createCommand<Cmd::GetOsnmaMacLtId>},
+  {"", "GetOsnmaMacLtIdResult", createCommand<Cmd::GetOsnmaMacLtIdResult>},
+  {"", "GetOsnmaTagSize", createCommand<Cmd::GetOsnmaTagSize>},
+  {"", "GetOsnmaTagSizeResult", createCommand<Cmd::GetOsnmaTagSizeResult>},
+  {"", "GetOsnmaTeslaHashFunction", createCommand<Cmd::GetOsnmaTeslaHashFunction>},
+  {"", "GetOsnmaTeslaHashFunctionResult", createCommand<Cmd::GetOsnmaTeslaHashFunctionResult>},
+  {"", "GetOsnmaTeslaKeySize", createCommand<Cmd::GetOsnmaTeslaKeySize>},
+  {"", "GetOsnmaTeslaKeySizeResult", createCommand<Cmd::GetOsnmaTeslaKeySizeResult>},
+  {"", "GetPerturbations", createCommand<Cmd::GetPerturbations>},
+  {"", "GetPerturbationsForAllSat", createCommand<Cmd::GetPerturbationsForAllSat>},
+  {"", "GetPerturbationsForAllSatResult", createCommand<Cmd::GetPerturbationsForAllSatResult>},
+  {"", "GetPerturbationsResult", createCommand<Cmd::GetPerturbationsResult>},
+  {"", "GetPlugins", createCommand<Cmd::GetPlugins>},
+  {"", "GetPluginsResult", createCommand<Cmd::GetPluginsResult>},
+  {"", "GetPowerGlobalOffset", createCommand<Cmd::GetPowerGlobalOffset>},
+  {"", "GetPowerOffset", createCommand<Cmd::GetPowerOffset>},
+  {"", "GetPowerSbasOffset", createCommand<Cmd::GetPowerSbasOffset>},
+  {"", "GetPowerSbasOffsetResult", createCommand<Cmd::GetPowerSbasOffsetResult>},
+  {"", "GetPrnForEachSV", createCommand<Cmd::GetPrnForEachSV>},
+  {"", "GetPrnForEachSVResult", createCommand<Cmd::GetPrnForEachSVResult>},
+  {"", "GetPrnOfSVID", createCommand<Cmd::GetPrnOfSVID>},
+  {"", "GetPrnOfSVIDResult", createCommand<Cmd::GetPrnOfSVIDResult>},
+  {"", "GetPropagationModelParameters", createCommand<Cmd::GetPropagationModelParameters>},
+  {"", "GetPropagationModelParametersResult", createCommand<Cmd::GetPropagationModelParametersResult>},
+  {"", "GetPseudorangeNoiseGaussMarkovForEachSV", createCommand<Cmd::GetPseudorangeNoiseGaussMarkovForEachSV>},
+  {"", "GetPseudorangeNoiseGaussMarkovForEachSVResult", createCommand<Cmd::GetPseudorangeNoiseGaussMarkovForEachSVResult>},
+  {"", "GetPseudorangeNoiseGaussMarkovForSV", createCommand<Cmd::GetPseudorangeNoiseGaussMarkovForSV>},
+  {"", "GetPseudorangeNoiseGaussMarkovForSVResult", createCommand<Cmd::GetPseudorangeNoiseGaussMarkovForSVResult>},
+  {"", "GetPseudorangeNoiseOffsetForEachSV", createCommand<Cmd::GetPseudorangeNoiseOffsetForEachSV>},
+  {"", "GetPseudorangeNoiseOffsetForEachSVResult", createCommand<Cmd::GetPseudorangeNoiseOffsetForEachSVResult>},
+  {"", "GetPseudorangeNoiseOffsetForSV", createCommand<Cmd::GetPseudorangeNoiseOffsetForSV>},
+  {"", "GetPseudorangeNoiseOffsetForSVResult", createCommand<Cmd::GetPseudorangeNoiseOffsetForSVResult>},
+  {"", "GetPseudorangeNoiseSineWaveForEachSV", createCommand<Cmd::GetPseudorangeNoiseSineWaveForEachSV>},
+  {"", "GetPseudorangeNoiseSineWaveForEachSVResult", createCommand<Cmd::GetPseudorangeNoiseSineWaveForEachSVResult>},
+  {"", "GetPseudorangeNoiseSineWaveForSV", createCommand<Cmd::GetPseudorangeNoiseSineWaveForSV>},
+  {"", "GetPseudorangeNoiseSineWaveForSVResult", createCommand<Cmd::GetPseudorangeNoiseSineWaveForSVResult>},
+  {"", "GetPseudorangeRampForSV", createCommand<Cmd::GetPseudorangeRampForSV>},
+  {"", "GetPseudorangeRampForSVResult", createCommand<Cmd::GetPseudorangeRampForSVResult>},
+  {"", "GetPulsarX1AccuracyIntegrityForSV", createCommand<Cmd::GetPulsarX1AccuracyIntegrityForSV>},
+  {"", "GetPulsarX1AccuracyIntegrityForSVResult", createCommand<Cmd::GetPulsarX1AccuracyIntegrityForSVResult>},
+  {"", "GetPulsarX1HealthForSV", createCommand<Cmd::GetPulsarX1HealthForSV>},
+  {"", "GetPulsarX1HealthForSVResult", createCommand<Cmd::GetPulsarX1HealthForSVResult>},
+  {"", "GetPulsarX5AccuracyIntegrityForSV", createCommand<Cmd::GetPulsarX5AccuracyIntegrityForSV>},
+  {"", "GetPulsarX5AccuracyIntegrityForSVResult", createCommand<Cmd::GetPulsarX5AccuracyIntegrityForSVResult>},
+  {"", "GetPulsarX5HealthForSV", createCommand<Cmd::GetPulsarX5HealthForSV>},
+  {"", "GetPulsarX5HealthForSVResult", createCommand<Cmd::GetPulsarX5HealthForSVResult>},
+  {"", "GetQzssEphBoolParamForEachSV", createCommand<Cmd::GetQzssEphBoolParamForEachSV>},
+  {"", "GetQzssEphBoolParamForEachSVResult", createCommand<Cmd::GetQzssEphBoolParamForEachSVResult>},
+  {"", "GetQzssEphBoolParamForSV", createCommand<Cmd::GetQzssEphBoolParamForSV>},
+  {"", "GetQzssEphBoolParamForSVResult", createCommand<Cmd::GetQzssEphBoolParamForSVResult>},
+  {"", "GetQzssEphDoubleParamForEachSV", createCommand<Cmd::GetQzssEphDoubleParamForEachSV>},
+  {"", "GetQzssEphDoubleParamForEachSVResult", createCommand<Cmd::GetQzssEphDoubleParamForEachSVResult>},
+  {"", "GetQzssEphDoubleParamForSV", createCommand<Cmd::GetQzssEphDoubleParamForSV>},
+  {"", "GetQzssEphDoubleParamForSVResult", createCommand<Cmd::GetQzssEphDoubleParamForSVResult>},
+  {"", "GetQzssEphemerisBoolParam", createCommand<Cmd::GetQzssEphemerisBoolParam>},
+  {"", "GetQzssEphemerisBoolParams", createCommand<Cmd::GetQzssEphemerisBoolParams>},
+  {"", "GetQzssEphemerisDoubleParam", createCommand<Cmd::GetQzssEphemerisDoubleParam>},
+  {"", "GetQzssEphemerisDoubleParams", createCommand<Cmd::GetQzssEphemerisDoubleParams>},
+  {"", "GetQzssL1DataHealthForSV", createCommand<Cmd::GetQzssL1DataHealthForSV>},
+  {"", "GetQzssL1DataHealthForSVResult", createCommand<Cmd::GetQzssL1DataHealthForSVResult>},
+  {"", "GetQzssL1HealthForSV", createCommand<Cmd::GetQzssL1HealthForSV>},
+  {"", "GetQzssL1HealthForSVResult", createCommand<Cmd::GetQzssL1HealthForSVResult>},
+  {"", "GetQzssL1SAugmentation", createCommand<Cmd::GetQzssL1SAugmentation>},
+  {"", "GetQzssL1SAugmentationResult", createCommand<Cmd::GetQzssL1SAugmentationResult>},
+  {"", "GetQzssL1SAugmentations", createCommand<Cmd::GetQzssL1SAugmentations>},
+  {"", "GetQzssL1SAugmentationsResult", createCommand<Cmd::GetQzssL1SAugmentationsResult>},
+  {"", "GetQzssL1cHealthForSV", createCommand<Cmd::GetQzssL1cHealthForSV>},
+  {"", "GetQzssL1cHealthForSVResult", createCommand<Cmd::GetQzssL1cHealthForSVResult>},
+  {"", "GetQzssL2HealthForSV", createCommand<Cmd::GetQzssL2HealthForSV>},
+  {"", "GetQzssL2HealthForSVResult", createCommand<Cmd::GetQzssL2HealthForSVResult>},
+  {"", "GetQzssL5HealthForSV", createCommand<Cmd::GetQzssL5HealthForSV>},
+  {"", "GetQzssL5HealthForSVResult", createCommand<Cmd::GetQzssL5HealthForSVResult>},
+  {"", "GetQzssL6HealthForSV", createCommand<Cmd::GetQzssL6HealthForSV>},
+  {"", "GetQzssL6HealthForSVResult", createCommand<Cmd::GetQzssL6HealthForSVResult>},
+  {"", "GetQzssNavAlertFlagForSV", createCommand<Cmd::GetQzssNavAlertFlagForSV>},
+  {"", "GetQzssNavAlertFlagForSVResult", createCommand<Cmd::GetQzssNavAlertFlagForSVResult>},
+  {"", "GetQzssSatelliteL1DataHealth", createCommand<Cmd::GetQzssSatelliteL1DataHealth>},
+  {"", "GetQzssSatelliteL1Health", createCommand<Cmd::GetQzssSatelliteL1Health>},
+  {"", "GetQzssSatelliteL1cHealth", createCommand<Cmd::GetQzssSatelliteL1cHealth>},
+  {"", "GetQzssSatelliteL2Health", createCommand<Cmd::GetQzssSatelliteL2Health>},
+  {"", "GetQzssSatelliteL5Health", createCommand<Cmd::GetQzssSatelliteL5Health>},
+  {"", "GetQzssSatelliteNavAlertFlag", createCommand<Cmd::GetQzssSatelliteNavAlertFlag>},
+  {"", "GetRawDataLoggingInterval", createCommand<Cmd::GetRawDataLoggingInterval>},
+  {"", "GetSVAntennaGain", createCommand<Cmd::GetSVAntennaGain>},
+  {"", "GetSVAntennaGainResult", createCommand<Cmd::GetSVAntennaGainResult>},
+  {"", "GetSVAntennaModelForEachSV", createCommand<Cmd::GetSVAntennaModelForEachSV>},
+  {"", "GetSVAntennaModelForEachSVResult", createCommand<Cmd::GetSVAntennaModelForEachSVResult>},
+  {"", "GetSVAntennaModelForSV", createCommand<Cmd::GetSVAntennaModelForSV>},
+  {"", "GetSVAntennaModelForSVResult", createCommand<Cmd::GetSVAntennaModelForSVResult>},
+  {"", "GetSVAntennaPhaseOffset", createCommand<Cmd::GetSVAntennaPhaseOffset>},
+  {"", "GetSVAntennaPhaseOffsetResult", createCommand<Cmd::GetSVAntennaPhaseOffsetResult>},
+  {"", "GetSVDataUpdateMode", createCommand<Cmd::GetSVDataUpdateMode>},
+  {"", "GetSVDataUpdateModeResult", createCommand<Cmd::GetSVDataUpdateModeResult>},
+  {"", "GetSVGainPatternOffset", createCommand<Cmd::GetSVGainPatternOffset>},
+  {"", "GetSVGainPatternOffsetResult", createCommand<Cmd::GetSVGainPatternOffsetResult>},
+  {"", "GetSVIDsOfPrn", createCommand<Cmd::GetSVIDsOfPrn>},
+  {"", "GetSVIDsOfPrnResult", createCommand<Cmd::GetSVIDsOfPrnResult>},
+  {"", "GetSVPhasePatternOffset", createCommand<Cmd::GetSVPhasePatternOffset>},
+  {"", "GetSVPhasePatternOffsetResult", createCommand<Cmd::GetSVPhasePatternOffsetResult>},
+  {"", "GetSVType", createCommand<Cmd::GetSVType>},
+  {"", "GetSVTypeResult", createCommand<Cmd::GetSVTypeResult>},
+  {"", "GetSbasDeltaUdreiOutsideOfRegions", createCommand<Cmd::GetSbasDeltaUdreiOutsideOfRegions>},
+  {"", "GetSbasDeltaUdreiOutsideOfRegionsResult", createCommand<Cmd::GetSbasDeltaUdreiOutsideOfRegionsResult>},
+  {"", "GetSbasEphParamsForSV", createCommand<Cmd::GetSbasEphParamsForSV>},
+  {"", "GetSbasEphParamsForSVResult", createCommand<Cmd::GetSbasEphParamsForSVResult>},
+  {"", "GetSbasEphemerisReferenceTimeForSV", createCommand<Cmd::GetSbasEphemerisReferenceTimeForSV>},
+  {"", "GetSbasEphemerisReferenceTimeForSVResult", createCommand<Cmd::GetSbasEphemerisReferenceTimeForSVResult>},
+  {"", "GetSbasMessageUpdateInterval", createCommand<Cmd::GetSbasMessageUpdateInterval>},
+  {"", "GetSbasMessageUpdateIntervalResult", createCommand<Cmd::GetSbasMessageUpdateIntervalResult>},
+  {"", "GetSbasMessagesEnabled", createCommand<Cmd::GetSbasMessagesEnabled>},
+  {"", "GetSbasMessagesEnabledResult", createCommand<Cmd::GetSbasMessagesEnabledResult>},
+  {"", "GetSbasMonitoredSystems", createCommand<Cmd::GetSbasMonitoredSystems>},
+  {"", "GetSbasMonitoredSystemsResult", createCommand<Cmd::GetSbasMonitoredSystemsResult>},
+  {"", "GetSbasServiceMessageRegionGroup", createCommand<Cmd::GetSbasServiceMessageRegionGroup>},
+  {"", "GetSbasServiceMessageRegionGroupResult", createCommand<Cmd::GetSbasServiceMessageRegionGroupResult>},
+  {"", "GetSignalFilterAssignation", createCommand<Cmd::GetSignalFilterAssignation>},
+  {"", "GetSignalFilterAssignationResult", createCommand<Cmd::GetSignalFilterAssignationResult>},
+  {"", "GetSignalFromIntTx", createCommand<Cmd::GetSignalFromIntTx>},
+  {"", "GetSignalFromIntTxResult", createCommand<Cmd::GetSignalFromIntTxResult>},
+  {"", "GetSignalPowerOffset", createCommand<Cmd::GetSignalPowerOffset>},
+  {"", "GetSignalPowerOffsetResult", createCommand<Cmd::GetSignalPowerOffsetResult>},
+  {"", "GetSimulationElapsedTime", createCommand<Cmd::GetSimulationElapsedTime>},
+  {"", "GetSimulatorState", createCommand<Cmd::GetSimulatorState>},
+  {"", "GetSlaveStatus", createCommand<Cmd::GetSlaveStatus>},
+  {"", "GetSlaveStatusResult", createCommand<Cmd::GetSlaveStatusResult>},
+  {"", "GetSpoofTx", createCommand<Cmd::GetSpoofTx>},
+  {"", "GetSpoofTxAntenna", createCommand<Cmd::GetSpoofTxAntenna>},
+  {"", "GetSpoofTxAntennaOffset", createCommand<Cmd::GetSpoofTxAntennaOffset>},
+  {"", "GetSpoofTxAntennaOffsetResult", createCommand<Cmd::GetSpoofTxAntennaOffsetResult>},
+  {"", "GetSpoofTxAntennaResult", createCommand<Cmd::GetSpoofTxAntennaResult>},
+  {"", "GetSpoofTxCircular", createCommand<Cmd::GetSpoofTxCircular>},
+  {"", "GetSpoofTxCircularResult", createCommand<Cmd::GetSpoofTxCircularResult>},
+  {"", "GetSpoofTxColor", createCommand<Cmd::GetSpoofTxColor>},
+  {"", "GetSpoofTxColorResult", createCommand<Cmd::GetSpoofTxColorResult>},
+  {"", "GetSpoofTxFix", createCommand<Cmd::GetSpoofTxFix>},
+  {"", "GetSpoofTxFixEcef", createCommand<Cmd::GetSpoofTxFixEcef>},
+  {"", "GetSpoofTxFixEcefResult", createCommand<Cmd::GetSpoofTxFixEcefResult>},
+  {"", "GetSpoofTxFixResult", createCommand<Cmd::GetSpoofTxFixResult>},
+  {"", "GetSpoofTxRemoteAddress", createCommand<Cmd::GetSpoofTxRemoteAddress>},
+  {"", "GetSpoofTxRemoteAddressResult", createCommand<Cmd::GetSpoofTxRemoteAddressResult>},
+  {"", "GetSpoofTxResult", createCommand<Cmd::GetSpoofTxResult>},
+  {"", "GetSpoofTxTrajectory", createCommand<Cmd::GetSpoofTxTrajectory>},
+  {"", "GetSpoofTxTrajectoryResult", createCommand<Cmd::GetSpoofTxTrajectoryResult>},
+  {"", "GetSpoofTxVehicleType", createCommand<Cmd::GetSpoofTxVehicleType>},
+  {"", "GetSpoofTxVehicleTypeResult", createCommand<Cmd::GetSpoofTxVehicleTypeResult>},
+  {"", "GetStartTimeMode", createCommand<Cmd::GetStartTimeMode>},
+  {"", "GetStartTimeModeResult", createCommand<Cmd::GetStartTimeModeResult>},
+  {"", "GetStartTimeOffset", createCommand<Cmd::GetStartTimeOffset>},
+  {"", "GetStartTimeOffsetResult", createCommand<Cmd::GetStartTimeOffsetResult>},
+  {"", "GetStatusLog", createCommand<Cmd::GetStatusLog>},
+  {"", "GetStatusLogResult", createCommand<Cmd::GetStatusLogResult>},
+  {"", "GetStreamingBuffer", createCommand<Cmd::GetStreamingBuffer>},
+  {"", "GetStreamingBufferResult", createCommand<Cmd::GetStreamingBufferResult>},
+  {"", "GetSyncTime", createCommand<Cmd::GetSyncTime>},
+  {"", "GetSyncTimeMainInstance", createCommand<Cmd::GetSyncTimeMainInstance>},
+  {"", "GetSyncTimeMainInstanceResult", createCommand<Cmd::GetSyncTimeMainInstanceResult>},
+  {"", "GetSyncTimeMaster", createCommand<Cmd::GetSyncTimeMaster>},
+  {"", "GetSyncTimeResult", createCommand<Cmd::GetSyncTimeResult>},
+  {"", "GetTransmittedPrnForSV", createCommand<Cmd::GetTransmittedPrnForSV>},
+  {"", "GetTransmittedPrnForSVResult", createCommand<Cmd::GetTransmittedPrnForSVResult>},
+  {"", "GetTropoModel", createCommand<Cmd::GetTropoModel>},
+  {"", "GetTropoModelResult", createCommand<Cmd::GetTropoModelResult>},
+  {"", "GetUdreiForEachSV", createCommand<Cmd::GetUdreiForEachSV>},
+  {"", "GetUdreiForEachSVResult", createCommand<Cmd::GetUdreiForEachSVResult>},
+  {"", "GetUdreiForSV", createCommand<Cmd::GetUdreiForSV>},
+  {"", "GetUdreiForSVResult", createCommand<Cmd::GetUdreiForSVResult>},
+  {"", "GetVehicleAntennaGain", createCommand<Cmd::GetVehicleAntennaGain>},
+  {"", "GetVehicleAntennaGainResult", createCommand<Cmd::GetVehicleAntennaGainResult>},
+  {"", "GetVehicleAntennaModel", createCommand<Cmd::GetVehicleAntennaModel>},
+  {"", "GetVehicleAntennaModelResult", createCommand<Cmd::GetVehicleAntennaModelResult>},
+  {"", "GetVehicleAntennaOffset", createCommand<Cmd::GetVehicleAntennaOffset>},
+  {"", "GetVehicleAntennaOffsetResult", createCommand<Cmd::GetVehicleAntennaOffsetResult>},
+  {"", "GetVehicleAntennaPhaseOffset", createCommand<Cmd::GetVehicleAntennaPhaseOffset>},
+  {"", "GetVehicleAntennaPhaseOffsetResult", createCommand<Cmd::GetVehicleAntennaPhaseOffsetResult>},
+  {"", "GetVehicleGainPatternOffset", createCommand<Cmd::GetVehicleGainPatternOffset>},
+  {"", "GetVehicleGainPatternOffsetResult", createCommand<Cmd::GetVehicleGainPatternOffsetResult>},
+  {"", "GetVehiclePhasePatternOffset", createCommand<Cmd::GetVehiclePhasePatternOffset>},
+  {"", "GetVehiclePhasePatternOffsetResult", createCommand<Cmd::GetVehiclePhasePatternOffsetResult>},
+  {"", "GetVehicleTrajectory", createCommand<Cmd::GetVehicleTrajectory>},
+  {"", "GetVehicleTrajectoryCircular", createCommand<Cmd::GetVehicleTrajectoryCircular>},
+  {"", "GetVehicleTrajectoryCircularResult", createCommand<Cmd::GetVehicleTrajectoryCircularResult>},
+  {"", "GetVehicleTrajectoryFix", createCommand<Cmd::GetVehicleTrajectoryFix>},
+  {"", "GetVehicleTrajectoryFixEcef", createCommand<Cmd::GetVehicleTrajectoryFixEcef>},
+  {"", "GetVehicleTrajectoryFixEcefResult", createCommand<Cmd::GetVehicleTrajectoryFixEcefResult>},
+  {"", "GetVehicleTrajectoryFixResult", createCommand<Cmd::GetVehicleTrajectoryFixResult>},
+  {"", "GetVehicleTrajectoryOrbit", createCommand<Cmd::GetVehicleTrajectoryOrbit>},
+  {"", "GetVehicleTrajectoryOrbitResult", createCommand<Cmd::GetVehicleTrajectoryOrbitResult>},
+  {"", "GetVehicleTrajectoryResult", createCommand<Cmd::GetVehicleTrajectoryResult>},
+  {"", "GetVehicleType", createCommand<Cmd::GetVehicleType>},
+  {"", "GetVehicleTypeResult", createCommand<Cmd::GetVehicleTypeResult>},
+  {"", "GetVersion", createCommand<Cmd::GetVersion>},
+  {"", "GetVisibleSV", createCommand<Cmd::GetVisibleSV>},
+  {"", "GetVisibleSVResult", createCommand<Cmd::GetVisibleSVResult>},
+  {"", "GetWFAntennaElementModel", createCommand<Cmd::GetWFAntennaElementModel>},
+  {"", "GetWFAntennaElementModelResult", createCommand<Cmd::GetWFAntennaElementModelResult>},
+  {"", "GetWFAntennaElementOffset", createCommand<Cmd::GetWFAntennaElementOffset>},
+  {"", "GetWFAntennaElementOffsetResult", createCommand<Cmd::GetWFAntennaElementOffsetResult>},
+  {"", "GetWFAntennaElementPhasePatternOffset", createCommand<Cmd::GetWFAntennaElementPhasePatternOffset>},
+  {"", "GetWFAntennaElementPhasePatternOffsetResult", createCommand<Cmd::GetWFAntennaElementPhasePatternOffsetResult>},
+  {"", "GetWFAntennaGain", createCommand<Cmd::GetWFAntennaGain>},
+  {"", "GetWFAntennaGainResult", createCommand<Cmd::GetWFAntennaGainResult>},
+  {"", "GetWFAntennaOffset", createCommand<Cmd::GetWFAntennaOffset>},
+  {"", "GetWFAntennaOffsetResult", createCommand<Cmd::GetWFAntennaOffsetResult>},
+  {"", "GetWFElement", createCommand<Cmd::GetWFElement>},
+  {"", "GetWFElementResult", createCommand<Cmd::GetWFElementResult>},
+  {"", "GetWorkerInstanceStatus", createCommand<Cmd::GetWorkerInstanceStatus>},
+  {"", "GetWorkerInstanceStatusResult", createCommand<Cmd::GetWorkerInstanceStatusResult>},
+  {"", "HilPortResult", createCommand<Cmd::HilPortResult>},
+  {"", "ImportCCIRFilesFromDirectory", createCommand<Cmd::ImportCCIRFilesFromDirectory>},
+  {"", "ImportConstellationParameters", createCommand<Cmd::ImportConstellationParameters>},
+  {"", "ImportGlonassAlmanac", createCommand<Cmd::ImportGlonassAlmanac>},
+  {"", "ImportIonoGridErrors", createCommand<Cmd::ImportIonoGridErrors>},
+  {"", "ImportIonoGridGIVEI", createCommand<Cmd::ImportIonoGridGIVEI>},
+  {"", "ImportIonoGridMask", createCommand<Cmd::ImportIonoGridMask>},
+  {"", "ImportIonoParameters", createCommand<Cmd::ImportIonoParameters>},
+  {"", "ImportMODIPFile", createCommand<Cmd::ImportMODIPFile>},
+  {"", "ImportNmeaIntTxTrack", createCommand<Cmd::ImportNmeaIntTxTrack>},
+  {"", "ImportNmeaSpoofTxTrack", createCommand<Cmd::ImportNmeaSpoofTxTrack>},
+  {"", "ImportNmeaTrack", createCommand<Cmd::ImportNmeaTrack>},
+  {"", "ImportSVAntennaModel", createCommand<Cmd::ImportSVAntennaModel>},
+  {"", "ImportVehicleAntennaModel", createCommand<Cmd::ImportVehicleAntennaModel>},
+  {"", "ImportWFAntenna", createCommand<Cmd::ImportWFAntenna>},
+  {"", "IsAlmanacExtrapolationFromEphemerisEnabled", createCommand<Cmd::IsAlmanacExtrapolationFromEphemerisEnabled>},
+  {"", "IsAlmanacExtrapolationFromEphemerisEnabledResult", createCommand<Cmd::IsAlmanacExtrapolationFromEphemerisEnabledResult>},
+  {"", "IsAttitudeToZeroForced", createCommand<Cmd::IsAttitudeToZeroForced>},
+  {"", "IsAttitudeToZeroForcedResult", createCommand<Cmd::IsAttitudeToZeroForcedResult>},
+  {"", "IsAutomaticGpuAllocationEnabled", createCommand<Cmd::IsAutomaticGpuAllocationEnabled>},
+  {"", "IsAutomaticGpuAllocationEnabledResult", createCommand<Cmd::IsAutomaticGpuAllocationEnabledResult>},
+  {"", "IsDektecAdjustedNoiseEnabled", createCommand<Cmd::IsDektecAdjustedNoiseEnabled>},
+  {"", "IsDektecAdjustedNoiseEnabledResult", createCommand<Cmd::IsDektecAdjustedNoiseEnabledResult>},
+  {"", "IsDelayAppliedInSbas", createCommand<Cmd::IsDelayAppliedInSbas>},
+  {"", "IsDelayAppliedInSbasResult", createCommand<Cmd::IsDelayAppliedInSbasResult>},
+  {"", "IsEachSVEnabled", createCommand<Cmd::IsEachSVEnabled>},
+  {"", "IsEachSVEnabledResult", createCommand<Cmd::IsEachSVEnabledResult>},
+  {"", "IsElevationMaskAboveEnabled", createCommand<Cmd::IsElevationMaskAboveEnabled>},
+  {"", "IsElevationMaskAboveEnabledResult", createCommand<Cmd::IsElevationMaskAboveEnabledResult>},
+  {"", "IsElevationMaskBelowEnabled", createCommand<Cmd::IsElevationMaskBelowEnabled>},
+  {"", "IsElevationMaskBelowEnabledResult", createCommand<Cmd::IsElevationMaskBelowEnabledResult>},
+  {"", "IsIntTxAttitudeToZeroForced", createCommand<Cmd::IsIntTxAttitudeToZeroForced>},
+  {"", "IsIntTxAttitudeToZeroForcedResult", createCommand<Cmd::IsIntTxAttitudeToZeroForcedResult>},
+  {"", "IsIntTxIgnoreRxAntennaGainPattern", createCommand<Cmd::IsIntTxIgnoreRxAntennaGainPattern>},
+  {"", "IsIntTxIgnoreRxAntennaGainPatternResult", createCommand<Cmd::IsIntTxIgnoreRxAntennaGainPatternResult>},
+  {"", "IsIntTxIgnoreRxAntennaPhasePattern", createCommand<Cmd::IsIntTxIgnoreRxAntennaPhasePattern>},
+  {"", "IsIntTxIgnoreRxAntennaPhasePatternResult", createCommand<Cmd::IsIntTxIgnoreRxAntennaPhasePatternResult>},
+  {"", "IsIntTxTrajectorySmoothingEnabled", createCommand<Cmd::IsIntTxTrajectorySmoothingEnabled>},
+  {"", "IsIntTxTrajectorySmoothingEnabledResult", createCommand<Cmd::IsIntTxTrajectorySmoothingEnabledResult>},
+  {"", "IsIonoOffsetEnabled", createCommand<Cmd::IsIonoOffsetEnabled>},
+  {"", "IsIonoOffsetEnabledResult", createCommand<Cmd::IsIonoOffsetEnabledResult>},
+  {"", "IsLOSEnabledForEachSV", createCommand<Cmd::IsLOSEnabledForEachSV>},
+  {"", "IsLOSEnabledForEachSVResult", createCommand<Cmd::IsLOSEnabledForEachSVResult>},
+  {"", "IsLogDownlinkEnabled", createCommand<Cmd::IsLogDownlinkEnabled>},
+  {"", "IsLogDownlinkEnabledResult", createCommand<Cmd::IsLogDownlinkEnabledResult>},
+  {"", "IsLogHILInputEnabled", createCommand<Cmd::IsLogHILInputEnabled>},
+  {"", "IsLogHILInputEnabledResult", createCommand<Cmd::IsLogHILInputEnabledResult>},
+  {"", "IsLogNmeaEnabled", createCommand<Cmd::IsLogNmeaEnabled>},
+  {"", "IsLogNmeaEnabledResult", createCommand<Cmd::IsLogNmeaEnabledResult>},
+  {"", "IsLogRawEnabled", createCommand<Cmd::IsLogRawEnabled>},
+  {"", "IsLogRawEnabledResult", createCommand<Cmd::IsLogRawEnabledResult>},
+  {"", "IsLogRinexEnabled", createCommand<Cmd::IsLogRinexEnabled>},
+  {"", "IsLogRinexEnabledResult", createCommand<Cmd::IsLogRinexEnabledResult>},
+  {"", "IsLosEnabledForSV", createCommand<Cmd::IsLosEnabledForSV>},
+  {"", "IsLosEnabledForSVResult", createCommand<Cmd::IsLosEnabledForSVResult>},
+  {"", "IsMapAnalysisEnabled", createCommand<Cmd::IsMapAnalysisEnabled>},
+  {"", "IsMapAnalysisEnabledResult", createCommand<Cmd::IsMapAnalysisEnabledResult>},
+  {"", "IsNtpClientEnabled", createCommand<Cmd::IsNtpClientEnabled>},
+  {"", "IsNtpClientEnabledResult", createCommand<Cmd::IsNtpClientEnabledResult>},
+  {"", "IsOsnmaEnabledForEachSV", createCommand<Cmd::IsOsnmaEnabledForEachSV>},
+  {"", "IsOsnmaEnabledForEachSVResult", createCommand<Cmd::IsOsnmaEnabledForEachSVResult>},
+  {"", "IsOsnmaEnabledForSV", createCommand<Cmd::IsOsnmaEnabledForSV>},
+  {"", "IsOsnmaEnabledForSVResult", createCommand<Cmd::IsOsnmaEnabledForSVResult>},
+  {"", "IsPYCodeEnabledForEachSV", createCommand<Cmd::IsPYCodeEnabledForEachSV>},
+  {"", "IsPYCodeEnabledForEachSVResult", createCommand<Cmd::IsPYCodeEnabledForEachSVResult>},
+  {"", "IsPYCodeEnabledForSV", createCommand<Cmd::IsPYCodeEnabledForSV>},
+  {"", "IsPYCodeEnabledForSVResult", createCommand<Cmd::IsPYCodeEnabledForSVResult>},
+  {"", "IsPluginEnabled", createCommand<Cmd::IsPluginEnabled>},
+  {"", "IsPluginEnabledResult", createCommand<Cmd::IsPluginEnabledResult>},
+  {"", "IsPropagationDelayEnabled", createCommand<Cmd::IsPropagationDelayEnabled>},
+  {"", "IsPropagationDelayEnabledResult", createCommand<Cmd::IsPropagationDelayEnabledResult>},
+  {"", "IsRFOutputEnabled", createCommand<Cmd::IsRFOutputEnabled>},
+  {"", "IsRFOutputEnabledForEachSV", createCommand<Cmd::IsRFOutputEnabledForEachSV>},
+  {"", "IsRFOutputEnabledForEachSVResult", createCommand<Cmd::IsRFOutputEnabledForEachSVResult>},
+  {"", "IsRFOutputEnabledResult", createCommand<Cmd::IsRFOutputEnabledResult>},
+  {"", "IsSVEnabled", createCommand<Cmd::IsSVEnabled>},
+  {"", "IsSVEnabledResult", createCommand<Cmd::IsSVEnabledResult>},
+  {"", "IsSVForcedGeo", createCommand<Cmd::IsSVForcedGeo>},
+  {"", "IsSVForcedGeoResult", createCommand<Cmd::IsSVForcedGeoResult>},
+  {"", "IsSatMotionFixed", createCommand<Cmd::IsSatMotionFixed>},
+  {"", "IsSatMotionFixedResult", createCommand<Cmd::IsSatMotionFixedResult>},
+  {"", "IsSbasFastCorrectionsEnabledFor", createCommand<Cmd::IsSbasFastCorrectionsEnabledFor>},
+  {"", "IsSbasFastCorrectionsEnabledForResult", createCommand<Cmd::IsSbasFastCorrectionsEnabledForResult>},
+  {"", "IsSbasLongTermCorrectionsEnabledFor", createCommand<Cmd::IsSbasLongTermCorrectionsEnabledFor>},
+  {"", "IsSbasLongTermCorrectionsEnabledForResult", createCommand<Cmd::IsSbasLongTermCorrectionsEnabledForResult>},
+  {"", "IsSignalEnabledForEachSV", createCommand<Cmd::IsSignalEnabledForEachSV>},
+  {"", "IsSignalEnabledForEachSVResult", createCommand<Cmd::IsSignalEnabledForEachSVResult>},
+  {"", "IsSignalEnabledForSV", createCommand<Cmd::IsSignalEnabledForSV>},
+  {"", "IsSignalEnabledForSVResult", createCommand<Cmd::IsSignalEnabledForSVResult>},
+  {"", "IsSignalStrengthModelEnabled", createCommand<Cmd::IsSignalStrengthModelEnabled>},
+  {"", "IsSignalStrengthModelEnabledResult", createCommand<Cmd::IsSignalStrengthModelEnabledResult>},
+  {"", "IsSimStopWhenCommandFailEnabled", createCommand<Cmd::IsSimStopWhenCommandFailEnabled>},
+  {"", "IsSimStopWhenCommandFailEnabledResult", createCommand<Cmd::IsSimStopWhenCommandFailEnabledResult>},
+  {"", "IsSimulationStopAtTrajectoryEndEnabled", createCommand<Cmd::IsSimulationStopAtTrajectoryEndEnabled>},
+  {"", "IsSimulationStopAtTrajectoryEndEnabledResult", createCommand<Cmd::IsSimulationStopAtTrajectoryEndEnabledResult>},
+  {"", "IsSpectrumVisible", createCommand<Cmd::IsSpectrumVisible>},
+  {"", "IsSpectrumVisibleResult", createCommand<Cmd::IsSpectrumVisibleResult>},
+  {"", "IsSpoofTxAttitudeToZeroForced", createCommand<Cmd::IsSpoofTxAttitudeToZeroForced>},
+  {"", "IsSpoofTxAttitudeToZeroForcedResult", createCommand<Cmd::IsSpoofTxAttitudeToZeroForcedResult>},
+  {"", "IsSpoofTxIgnoreRxAntennaGainPattern", createCommand<Cmd::IsSpoofTxIgnoreRxAntennaGainPattern>},
+  {"", "IsSpoofTxIgnoreRxAntennaGainPatternResult", createCommand<Cmd::IsSpoofTxIgnoreRxAntennaGainPatternResult>},
+  {"", "IsSpoofTxIgnoreRxAntennaPhasePattern", createCommand<Cmd::IsSpoofTxIgnoreRxAntennaPhasePattern>},
+  {"", "IsSpoofTxIgnoreRxAntennaPhasePatternResult", createCommand<Cmd::IsSpoofTxIgnoreRxAntennaPhasePatternResult>},
+  {"", "IsSpoofTxTrajectorySmoothingEnabled", createCommand<Cmd::IsSpoofTxTrajectorySmoothingEnabled>},
+  {"", "IsSpoofTxTrajectorySmoothingEnabledResult", createCommand<Cmd::IsSpoofTxTrajectorySmoothingEnabledResult>},
+  {"", "IsStopMainInstanceWhenWorkerInstanceStop", createCommand<Cmd::IsStopMainInstanceWhenWorkerInstanceStop>},
+  {"", "IsStopMainInstanceWhenWorkerInstanceStopResult", createCommand<Cmd::IsStopMainInstanceWhenWorkerInstanceStopResult>},
+  {"", "IsStopMasterWhenSlaveStop", createCommand<Cmd::IsStopMasterWhenSlaveStop>},
+  {"", "IsStopMasterWhenSlaveStopResult", createCommand<Cmd::IsStopMasterWhenSlaveStopResult>},
+  {"", "IsTrajectoryCompleted", createCommand<Cmd::IsTrajectoryCompleted>},
+  {"", "IsTrajectoryCompletedResult", createCommand<Cmd::IsTrajectoryCompletedResult>},
+  {"", "IsTrajectorySmoothingEnabled", createCommand<Cmd::IsTrajectorySmoothingEnabled>},
+  {"", "IsTrajectorySmoothingEnabledResult", createCommand<Cmd::IsTrajectorySmoothingEnabledResult>},
+  {"", "IsTransmitMessage2InSbasMessage0", createCommand<Cmd::IsTransmitMessage2InSbasMessage0>},
+  {"", "IsTransmitMessage2InSbasMessage0Result", createCommand<Cmd::IsTransmitMessage2InSbasMessage0Result>},
+  {"", "IsUsingVelocityInSbasMessage25", createCommand<Cmd::IsUsingVelocityInSbasMessage25>},
+  {"", "IsUsingVelocityInSbasMessage25Result", createCommand<Cmd::IsUsingVelocityInSbasMessage25Result>},
+  {"", "IsWFAntennaElementEnabled", createCommand<Cmd::IsWFAntennaElementEnabled>},
+  {"", "IsWFAntennaElementEnabledResult", createCommand<Cmd::IsWFAntennaElementEnabledResult>},
+  {"", "LockGUI", createCommand<Cmd::LockGUI>},
+  {"", "LogNmeaRateResult", createCommand<Cmd::LogNmeaRateResult>},
+  {"", "LogRawRateResult", createCommand<Cmd::LogRawRateResult>},
+  {"", "MessageSequenceImport", createCommand<Cmd::MessageSequenceImport>},
+  {"", "MessageSequenceInsert", createCommand<Cmd::MessageSequenceInsert>},
+  {"", "MessageSequenceRemove", createCommand<Cmd::MessageSequenceRemove>},
+  {"", "MessageSequenceSwap", createCommand<Cmd::MessageSequenceSwap>},
+  {"", "New", createCommand<Cmd::New>},
+  {"", "Open", createCommand<Cmd::Open>},
+  {"", "Pause", createCommand<Cmd::Pause>},
+  {"", "PushDynamicAlmanacData", createCommand<Cmd::PushDynamicAlmanacData>},
+  {"", "PushDynamicSVData", createCommand<Cmd::PushDynamicSVData>},
+  {"", "PushIntTxTrackEcef", createCommand<Cmd::PushIntTxTrackEcef>},
+  {"", "PushIntTxTrackEcefNed", createCommand<Cmd::PushIntTxTrackEcefNed>},
+  {"", "PushRouteEcef", createCommand<Cmd::PushRouteEcef>},
+  {"", "PushSpoofTxTrackEcef", createCommand<Cmd::PushSpoofTxTrackEcef>},
+  {"", "PushSpoofTxTrackEcefNed", createCommand<Cmd::PushSpoofTxTrackEcefNed>},
+  {"", "PushTrackEcef", createCommand<Cmd::PushTrackEcef>},
+  {"", "PushTrackEcefNed", createCommand<Cmd::PushTrackEcefNed>},
+  {"", "Quit", createCommand<Cmd::Quit>},
+  {"", "RandomizePseudorangeNoiseGaussMarkovSeedsForAllSV", createCommand<Cmd::RandomizePseudorangeNoiseGaussMarkovSeedsForAllSV>},
+  {"", "RandomizeSeedsForAllSatellitesPseudorangeNoiseGaussMarkov", createCommand<Cmd::RandomizeSeedsForAllSatellitesPseudorangeNoiseGaussMarkov>},
+  {"", "RawDataLoggingIntervalResult", createCommand<Cmd::RawDataLoggingIntervalResult>},
+  {"", "RedoCmd", createCommand<Cmd::RedoCmd>},
+  {"", "RemoveAllIntTx", createCommand<Cmd::RemoveAllIntTx>},
+  {"", "RemoveAllInterferences", createCommand<Cmd::RemoveAllInterferences>},
+  {"", "RemoveAllModulationTargets", createCommand<Cmd::RemoveAllModulationTargets>},
+  {"", "RemoveAllMultipathForSV", createCommand<Cmd::RemoveAllMultipathForSV>},
+  {"", "RemoveAllMultipathForSignal", createCommand<Cmd::RemoveAllMultipathForSignal>},
+  {"", "RemoveAllMultipathForSystem", createCommand<Cmd::RemoveAllMultipathForSystem>},
+  {"", "RemoveAllPilots", createCommand<Cmd::RemoveAllPilots>},
+  {"", "RemoveAllPseudorangeRamp", createCommand<Cmd::RemoveAllPseudorangeRamp>},
+  {"", "RemoveAllPseudorangeRampForSV", createCommand<Cmd::RemoveAllPseudorangeRampForSV>},
+  {"", "RemoveAllPseudorangeRampForSystem", createCommand<Cmd::RemoveAllPseudorangeRampForSystem>},
+  {"", "RemoveAllSignalsFromIntTx", createCommand<Cmd::RemoveAllSignalsFromIntTx>},
+  {"", "RemoveAntennaChange", createCommand<Cmd::RemoveAntennaChange>},
+  {"", "RemoveIntTx", createCommand<Cmd::RemoveIntTx>},
+  {"", "RemoveInterference", createCommand<Cmd::RemoveInterference>},
+  {"", "RemoveMerkleTree", createCommand<Cmd::RemoveMerkleTree>},
+  {"", "RemoveMessageModification", createCommand<Cmd::RemoveMessageModification>},
+  {"", "RemoveMessageModificationForNavMsgFamily", createCommand<Cmd::RemoveMessageModificationForNavMsgFamily>},
+  {"", "RemoveMessageModificationForSignal", createCommand<Cmd::RemoveMessageModificationForSignal>},
+  {"", "RemoveModulationTarget", createCommand<Cmd::RemoveModulationTarget>},
+  {"", "RemoveMultipath", createCommand<Cmd::RemoveMultipath>},
+  {"", "RemovePseudorangeRamp", createCommand<Cmd::RemovePseudorangeRamp>},
+  {"", "RemoveQzssL1SAugmentation", createCommand<Cmd::RemoveQzssL1SAugmentation>},
+  {"", "RemoveSbasServiceMessageRegionGroup", createCommand<Cmd::RemoveSbasServiceMessageRegionGroup>},
+  {"", "RemoveSignalFromIntTx", createCommand<Cmd::RemoveSignalFromIntTx>},
+  {"", "RemoveSpoofTx", createCommand<Cmd::RemoveSpoofTx>},
+  {"", "RemoveWFElement", createCommand<Cmd::RemoveWFElement>},
+  {"", "RenameDataSet", createCommand<Cmd::RenameDataSet>},
+  {"", "RenameIntTx", createCommand<Cmd::RenameIntTx>},
+  {"", "RenameSVAntennaModel", createCommand<Cmd::RenameSVAntennaModel>},
+  {"", "RenameSpoofTx", createCommand<Cmd::RenameSpoofTx>},
+  {"", "RenameVehicleAntennaModel", createCommand<Cmd::RenameVehicleAntennaModel>},
+  {"", "ResetAllSatPower", createCommand<Cmd::ResetAllSatPower>},
+  {"", "ResetDefaultConfiguration", createCommand<Cmd::ResetDefaultConfiguration>},
+  {"", "ResetManualPowerOffsets", createCommand<Cmd::ResetManualPowerOffsets>},
+  {"", "ResetPerturbations", createCommand<Cmd::ResetPerturbations>},
+  {"", "ResetToDefaultPrn", createCommand<Cmd::ResetToDefaultPrn>},
+  {"", "Resume", createCommand<Cmd::Resume>},
+  {"", "Save", createCommand<Cmd::Save>},
+  {"", "SaveAs", createCommand<Cmd::SaveAs>},
+  {"", "SetActiveDataSet", createCommand<Cmd::SetActiveDataSet>},
+  {"", "SetAgeOfDataBeiDou", createCommand<Cmd::SetAgeOfDataBeiDou>},
+  {"", "SetAllSatellitesPseudorangeNoiseGaussMarkov", createCommand<Cmd::SetAllSatellitesPseudorangeNoiseGaussMarkov>},
+  {"", "SetAllSatellitesPseudorangeNoiseOffset", createCommand<Cmd::SetAllSatellitesPseudorangeNoiseOffset>},
+  {"", "SetAllSatellitesPseudorangeNoiseSineWave", createCommand<Cmd::SetAllSatellitesPseudorangeNoiseSineWave>},
+  {"", "SetAlmanacInitialUploadTimeOffset", createCommand<Cmd::SetAlmanacInitialUploadTimeOffset>},
+  {"", "SetAlmanacUploadTimeInterval", createCommand<Cmd::SetAlmanacUploadTimeInterval>},
+  {"", "SetAntennaChange", createCommand<Cmd::SetAntennaChange>},
+  {"", "SetBeiDouAutonomousHealthForSV", createCommand<Cmd::SetBeiDouAutonomousHealthForSV>},
+  {"", "SetBeiDouCNavHealthInfoForSV", createCommand<Cmd::SetBeiDouCNavHealthInfoForSV>},
+  {"", "SetBeiDouEphBoolParamForEachSV", createCommand<Cmd::SetBeiDouEphBoolParamForEachSV>},
+  {"", "SetBeiDouEphBoolParamForSV", createCommand<Cmd::SetBeiDouEphBoolParamForSV>},
+  {"", "SetBeiDouEphDoubleParamForEachSV", createCommand<Cmd::SetBeiDouEphDoubleParamForEachSV>},
+  {"", "SetBeiDouEphDoubleParamForSV", createCommand<Cmd::SetBeiDouEphDoubleParamForSV>},
+  {"", "SetBeiDouEphemerisBoolParams", createCommand<Cmd::SetBeiDouEphemerisBoolParams>},
+  {"", "SetBeiDouEphemerisDoubleParams", createCommand<Cmd::SetBeiDouEphemerisDoubleParams>},
+  {"", "SetBeiDouHealthInfoForSV", createCommand<Cmd::SetBeiDouHealthInfoForSV>},
+  {"", "SetBeiDouHealthStatusForSV", createCommand<Cmd::SetBeiDouHealthStatusForSV>},
+  {"", "SetBeiDouUraIndexForSV", createCommand<Cmd::SetBeiDouUraIndexForSV>},
+  {"", "SetConfigBroadcastFilter", createCommand<Cmd::SetConfigBroadcastFilter>},
+  {"", "SetConfigBroadcastOnStart", createCommand<Cmd::SetConfigBroadcastOnStart>},
+  {"", "SetConstellationParameterForEachSV", createCommand<Cmd::SetConstellationParameterForEachSV>},
+  {"", "SetConstellationParameterForSV", createCommand<Cmd::SetConstellationParameterForSV>},
+  {"", "SetCrossAuthenticatedSatellitesForSV", createCommand<Cmd::SetCrossAuthenticatedSatellitesForSV>},
+  {"", "SetCurrentPropagationModel", createCommand<Cmd::SetCurrentPropagationModel>},
+  {"", "SetDataSetAssignation", createCommand<Cmd::SetDataSetAssignation>},
+  {"", "SetDefaultConfiguration", createCommand<Cmd::SetDefaultConfiguration>},
+  {"", "SetDefaultIntTxPersistence", createCommand<Cmd::SetDefaultIntTxPersistence>},
+  {"", "SetDefaultVehicleAntennaModel", createCommand<Cmd::SetDefaultVehicleAntennaModel>},
+  {"", "SetDuration", createCommand<Cmd::SetDuration>},
+  {"", "SetDynamicRangeOffset", createCommand<Cmd::SetDynamicRangeOffset>},
+  {"", "SetEffectiveIonisationLevelCoefficient", createCommand<Cmd::SetEffectiveIonisationLevelCoefficient>},
+  {"", "SetElevationMaskAbove", createCommand<Cmd::SetElevationMaskAbove>},
+  {"", "SetElevationMaskBelow", createCommand<Cmd::SetElevationMaskBelow>},
+  {"", "SetEncryptionLibraryPath", createCommand<Cmd::SetEncryptionLibraryPath>},
+  {"", "SetEngineLatency", createCommand<Cmd::SetEngineLatency>},
+  {"", "SetEphemerisErrorForSV", createCommand<Cmd::SetEphemerisErrorForSV>},
+  {"", "SetEphemerisReferenceTime", createCommand<Cmd::SetEphemerisReferenceTime>},
+  {"", "SetEphemerisReferenceTimeForSV", createCommand<Cmd::SetEphemerisReferenceTimeForSV>},
+  {"", "SetEphemerisTocOffset", createCommand<Cmd::SetEphemerisTocOffset>},
+  {"", "SetEphemerisUpdateInterval", createCommand<Cmd::SetEphemerisUpdateInterval>},
+  {"", "SetExternalChannelsPath", createCommand<Cmd::SetExternalChannelsPath>},
+  {"", "SetGalileoDataHealthForSV", createCommand<Cmd::SetGalileoDataHealthForSV>},
+  {"", "SetGalileoEphDoubleParamForEachSV", createCommand<Cmd::SetGalileoEphDoubleParamForEachSV>},
+  {"", "SetGalileoEphDoubleParamForSV", createCommand<Cmd::SetGalileoEphDoubleParamForSV>},
+  {"", "SetGalileoEphemerisDoubleParams", createCommand<Cmd::SetGalileoEphemerisDoubleParams>},
+  {"", "SetGalileoFnavSatelliteK", createCommand<Cmd::SetGalileoFnavSatelliteK>},
+  {"", "SetGalileoSignalHealthForSV", createCommand<Cmd::SetGalileoSignalHealthForSV>},
+  {"", "SetGalileoSisaE1E5aIndexForSV", createCommand<Cmd::SetGalileoSisaE1E5aIndexForSV>},
+  {"", "SetGalileoSisaE1E5bIndexForSV", createCommand<Cmd::SetGalileoSisaE1E5bIndexForSV>},
+  {"", "SetGaussianNoisePowerDensityOffset", createCommand<Cmd::SetGaussianNoisePowerDensityOffset>},
+  {"", "SetGlobalPowerOffset", createCommand<Cmd::SetGlobalPowerOffset>},
+  {"", "SetGlonassAlmanacUnhealthyFlagForSV", createCommand<Cmd::SetGlonassAlmanacUnhealthyFlagForSV>},
+  {"", "SetGlonassDoubleParams", createCommand<Cmd::SetGlonassDoubleParams>},
+  {"", "SetGlonassEphDoubleParamForEachSV", createCommand<Cmd::SetGlonassEphDoubleParamForEachSV>},
+  {"", "SetGlonassEphDoubleParamForSV", createCommand<Cmd::SetGlonassEphDoubleParamForSV>},
+  {"", "SetGlonassEphemerisHealthFlagForSV", createCommand<Cmd::SetGlonassEphemerisHealthFlagForSV>},
+  {"", "SetGpsAntiSpoofingFlagForSV", createCommand<Cmd::SetGpsAntiSpoofingFlagForSV>},
+  {"", "SetGpsCNavAlertFlagToSV", createCommand<Cmd::SetGpsCNavAlertFlagToSV>},
+  {"", "SetGpsConfigurationCodeForSV", createCommand<Cmd::SetGpsConfigurationCodeForSV>},
+  {"", "SetGpsConfigurationForEachSV", createCommand<Cmd::SetGpsConfigurationForEachSV>},
+  {"", "SetGpsDataHealthForSV", createCommand<Cmd::SetGpsDataHealthForSV>},
+  {"", "SetGpsEphBoolParamForEachSV", createCommand<Cmd::SetGpsEphBoolParamForEachSV>},
+  {"", "SetGpsEphBoolParamForSV", createCommand<Cmd::SetGpsEphBoolParamForSV>},
+  {"", "SetGpsEphDoubleParamForEachSV", createCommand<Cmd::SetGpsEphDoubleParamForEachSV>},
+  {"", "SetGpsEphDoubleParamForSV", createCommand<Cmd::SetGpsEphDoubleParamForSV>},
+  {"", "SetGpsEphemerisBoolParams", createCommand<Cmd::SetGpsEphemerisBoolParams>},
+  {"", "SetGpsEphemerisDoubleParams", createCommand<Cmd::SetGpsEphemerisDoubleParams>},
+  {"", "SetGpsL1HealthForSV", createCommand<Cmd::SetGpsL1HealthForSV>},
+  {"", "SetGpsL1cHealthForSV", createCommand<Cmd::SetGpsL1cHealthForSV>},
+  {"", "SetGpsL2HealthForSV", createCommand<Cmd::SetGpsL2HealthForSV>},
+  {"", "SetGpsL5HealthForSV", createCommand<Cmd::SetGpsL5HealthForSV>},
+  {"", "SetGpsNavAlertFlagForSV", createCommand<Cmd::SetGpsNavAlertFlagForSV>},
+  {"", "SetGpsSVConfigurationForAllSat", createCommand<Cmd::SetGpsSVConfigurationForAllSat>},
+  {"", "SetGpsSignalHealthForSV", createCommand<Cmd::SetGpsSignalHealthForSV>},
+  {"", "SetGpsStartTime", createCommand<Cmd::SetGpsStartTime>},
+  {"", "SetGpsTimingReceiver", createCommand<Cmd::SetGpsTimingReceiver>},
+  {"", "SetGpsUraIndexForSV", createCommand<Cmd::SetGpsUraIndexForSV>},
+  {"", "SetGpu", createCommand<Cmd::SetGpu>},
+  {"", "SetHilTjoin", createCommand<Cmd::SetHilTjoin>},
+  {"", "SetIntTxAWGN", createCommand<Cmd::SetIntTxAWGN>},
+  {"", "SetIntTxAntenna", createCommand<Cmd::SetIntTxAntenna>},
+  {"", "SetIntTxAntennaOffset", createCommand<Cmd::SetIntTxAntennaOffset>},
+  {"", "SetIntTxBOC", createCommand<Cmd::SetIntTxBOC>},
+  {"", "SetIntTxBPSK", createCommand<Cmd::SetIntTxBPSK>},
+  {"", "SetIntTxCW", createCommand<Cmd::SetIntTxCW>},
+  {"", "SetIntTxChirp", createCommand<Cmd::SetIntTxChirp>},
+  {"", "SetIntTxCircular", createCommand<Cmd::SetIntTxCircular>},
+  {"", "SetIntTxFix", createCommand<Cmd::SetIntTxFix>},
+  {"", "SetIntTxFixEcef", createCommand<Cmd::SetIntTxFixEcef>},
+  {"", "SetIntTxGroup", createCommand<Cmd::SetIntTxGroup>},
+  {"", "SetIntTxHiddenOnMap", createCommand<Cmd::SetIntTxHiddenOnMap>},
+  {"", "SetIntTxHil", createCommand<Cmd::SetIntTxHil>},
+  {"", "SetIntTxIgnorePropagationLoss", createCommand<Cmd::SetIntTxIgnorePropagationLoss>},
+  {"", "SetIntTxIgnoreRxAntennaGainPattern", createCommand<Cmd::SetIntTxIgnoreRxAntennaGainPattern>},
+  {"", "SetIntTxIgnoreRxAntennaPatterns", createCommand<Cmd::SetIntTxIgnoreRxAntennaPatterns>},
+  {"", "SetIntTxIgnoreRxAntennaPhasePattern", createCommand<Cmd::SetIntTxIgnoreRxAntennaPhasePattern>},
+  {"", "SetIntTxIgnoreVehicleAntennaPattern", createCommand<Cmd::SetIntTxIgnoreVehicleAntennaPattern>},
+  {"", "SetIntTxIqFile", createCommand<Cmd::SetIntTxIqFile>},
+  {"", "SetIntTxNone", createCommand<Cmd::SetIntTxNone>},
+  {"", "SetIntTxPersistence", createCommand<Cmd::SetIntTxPersistence>},
+  {"", "SetIntTxPulse", createCommand<Cmd::SetIntTxPulse>},
+  {"", "SetIntTxRefPower", createCommand<Cmd::SetIntTxRefPower>},
+  {"", "SetIntTxSignalManualPropagationLoss", createCommand<Cmd::SetIntTxSignalManualPropagationLoss>},
+  {"", "SetIntTxUseManualPropagationLoss", createCommand<Cmd::SetIntTxUseManualPropagationLoss>},
+  {"", "SetIntTxVehicleType", createCommand<Cmd::SetIntTxVehicleType>},
+  {"", "SetInterModulation", createCommand<Cmd::SetInterModulation>},
+  {"", "SetInterferenceCW", createCommand<Cmd::SetInterferenceCW>},
+  {"", "SetInterferenceChirp", createCommand<Cmd::SetInterferenceChirp>},
+  {"", "SetIonoAlpha", createCommand<Cmd::SetIonoAlpha>},
+  {"", "SetIonoBdgimAlpha", createCommand<Cmd::SetIonoBdgimAlpha>},
+  {"", "SetIonoBeta", createCommand<Cmd::SetIonoBeta>},
+  {"", "SetIonoGridError", createCommand<Cmd::SetIonoGridError>},
+  {"", "SetIonoGridErrorAll", createCommand<Cmd::SetIonoGridErrorAll>},
+  {"", "SetIonoGridGIVEI", createCommand<Cmd::SetIonoGridGIVEI>},
+  {"", "SetIonoGridGIVEIAll", createCommand<Cmd::SetIonoGridGIVEIAll>},
+  {"", "SetIonoGridMask", createCommand<Cmd::SetIonoGridMask>},
+  {"", "SetIonoGridMaskAll", createCommand<Cmd::SetIonoGridMaskAll>},
+  {"", "SetIonoModel", createCommand<Cmd::SetIonoModel>},
+  {"", "SetIssueOfData", createCommand<Cmd::SetIssueOfData>},
+  {"", "SetIssueOfDataBeiDou", createCommand<Cmd::SetIssueOfDataBeiDou>},
+  {"", "SetIssueOfDataGalileo", createCommand<Cmd::SetIssueOfDataGalileo>},
+  {"", "SetIssueOfDataNavIC", createCommand<Cmd::SetIssueOfDataNavIC>},
+  {"", "SetIssueOfDataQzss", createCommand<Cmd::SetIssueOfDataQzss>},
+  {"", "SetLeapSecond", createCommand<Cmd::SetLeapSecond>},
+  {"", "SetLeapSecondFuture", createCommand<Cmd::SetLeapSecondFuture>},
+  {"", "SetLogNmeaRate", createCommand<Cmd::SetLogNmeaRate>},
+  {"", "SetLogRawRate", createCommand<Cmd::SetLogRawRate>},
+  {"", "SetManualPowerOffsetForSV", createCommand<Cmd::SetManualPowerOffsetForSV>},
+  {"", "SetMerkleTreeParameters", createCommand<Cmd::SetMerkleTreeParameters>},
+  {"", "SetMessageModificationToBeiDouCNav1", createCommand<Cmd::SetMessageModificationToBeiDouCNav1>},
+  {"", "SetMessageModificationToBeiDouCNav2", createCommand<Cmd::SetMessageModificationToBeiDouCNav2>},
+  {"", "SetMessageModificationToBeiDouD1Nav", createCommand<Cmd::SetMessageModificationToBeiDouD1Nav>},
+  {"", "SetMessageModificationToBeiDouD2Nav", createCommand<Cmd::SetMessageModificationToBeiDouD2Nav>},
+  {"", "SetMessageModificationToGalileoCNav", createCommand<Cmd::SetMessageModificationToGalileoCNav>},
+  {"", "SetMessageModificationToGalileoFNav", createCommand<Cmd::SetMessageModificationToGalileoFNav>},
+  {"", "SetMessageModificationToGalileoINav", createCommand<Cmd::SetMessageModificationToGalileoINav>},
+  {"", "SetMessageModificationToGlonassNav", createCommand<Cmd::SetMessageModificationToGlonassNav>},
+  {"", "SetMessageModificationToGpsCNav", createCommand<Cmd::SetMessageModificationToGpsCNav>},
+  {"", "SetMessageModificationToGpsCNav2", createCommand<Cmd::SetMessageModificationToGpsCNav2>},
+  {"", "SetMessageModificationToGpsLNav", createCommand<Cmd::SetMessageModificationToGpsLNav>},
+  {"", "SetMessageModificationToNavICNav", createCommand<Cmd::SetMessageModificationToNavICNav>},
+  {"", "SetMessageModificationToPulsarNav", createCommand<Cmd::SetMessageModificationToPulsarNav>},
+  {"", "SetMessageModificationToPulsarX1", createCommand<Cmd::SetMessageModificationToPulsarX1>},
+  {"", "SetMessageModificationToQzssCNav", createCommand<Cmd::SetMessageModificationToQzssCNav>},
+  {"", "SetMessageModificationToQzssCNav2", createCommand<Cmd::SetMessageModificationToQzssCNav2>},
+  {"", "SetMessageModificationToQzssLNav", createCommand<Cmd::SetMessageModificationToQzssLNav>},
+  {"", "SetMessageModificationToQzssSlas", createCommand<Cmd::SetMessageModificationToQzssSlas>},
+  {"", "SetMessageModificationToSbasNav", createCommand<Cmd::SetMessageModificationToSbasNav>},
+  {"", "SetModulationTarget", createCommand<Cmd::SetModulationTarget>},
+  {"", "SetMultipathForSV", createCommand<Cmd::SetMultipathForSV>},
+  {"", "SetN310LocalOscillatorSource", createCommand<Cmd::SetN310LocalOscillatorSource>},
+  {"", "SetNavICEphDoubleParamForEachSV", createCommand<Cmd::SetNavICEphDoubleParamForEachSV>},
+  {"", "SetNavICEphDoubleParamForSV", createCommand<Cmd::SetNavICEphDoubleParamForSV>},
+  {"", "SetNavICEphemerisDoubleParam", createCommand<Cmd::SetNavICEphemerisDoubleParam>},
+  {"", "SetNavICEphemerisDoubleParams", createCommand<Cmd::SetNavICEphemerisDoubleParams>},
+  {"", "SetNavICL1HealthForSV", createCommand<Cmd::SetNavICL1HealthForSV>},
+  {"", "SetNavICL5HealthForSV", createCommand<Cmd::SetNavICL5HealthForSV>},
+  {"", "SetNavICNavAlertFlagForSV", createCommand<Cmd::SetNavICNavAlertFlagForSV>},
+  {"", "SetNavICSHealthForSV", createCommand<Cmd::SetNavICSHealthForSV>},
+  {"", "SetNavICSatelliteL5Health", createCommand<Cmd::SetNavICSatelliteL5Health>},
+  {"", "SetNavICSatelliteNavAlertFlag", createCommand<Cmd::SetNavICSatelliteNavAlertFlag>},
+  {"", "SetNavICUraIndex", createCommand<Cmd::SetNavICUraIndex>},
+  {"", "SetNavICUraIndexForSV", createCommand<Cmd::SetNavICUraIndexForSV>},
+  {"", "SetNmeaLoggerSentences", createCommand<Cmd::SetNmeaLoggerSentences>},
+  {"", "SetNmeaLoggerSerialPortDelay", createCommand<Cmd::SetNmeaLoggerSerialPortDelay>},
+  {"", "SetNtpServer", createCommand<Cmd::SetNtpServer>},
+  {"", "SetOsnmaMacFunction", createCommand<Cmd::SetOsnmaMacFunction>},
+  {"", "SetOsnmaMacLtId", createCommand<Cmd::SetOsnmaMacLtId>},
+  {"", "SetOsnmaTagSize", createCommand<Cmd::SetOsnmaTagSize>},
+  {"", "SetOsnmaTeslaHashFunction", createCommand<Cmd::SetOsnmaTeslaHashFunction>},
+  {"", "SetOsnmaTeslaKeySize", createCommand<Cmd::SetOsnmaTeslaKeySize>},
+  {"", "SetPerturbations", createCommand<Cmd::SetPerturbations>},
+  {"", "SetPerturbationsForAllSat", createCommand<Cmd::SetPerturbationsForAllSat>},
+  {"", "SetPilotCW", createCommand<Cmd::SetPilotCW>},
+  {"", "SetPilotPRN", createCommand<Cmd::SetPilotPRN>},
+  {"", "SetPowerGlobalOffset", createCommand<Cmd::SetPowerGlobalOffset>},
+  {"", "SetPowerOffset", createCommand<Cmd::SetPowerOffset>},
+  {"", "SetPowerSbasOffset", createCommand<Cmd::SetPowerSbasOffset>},
+  {"", "SetPps0GpsTime", createCommand<Cmd::SetPps0GpsTime>},
+  {"", "SetPrnForEachSV", createCommand<Cmd::SetPrnForEachSV>},
+  {"", "SetPrnOfSVID", createCommand<Cmd::SetPrnOfSVID>},
+  {"", "SetPropagationDelay", createCommand<Cmd::SetPropagationDelay>},
+  {"", "SetPropagationModelParameters", createCommand<Cmd::SetPropagationModelParameters>},
+  {"", "SetPseudorangeNoiseGaussMarkovForEachSV", createCommand<Cmd::SetPseudorangeNoiseGaussMarkovForEachSV>},
+  {"", "SetPseudorangeNoiseGaussMarkovForSV", createCommand<Cmd::SetPseudorangeNoiseGaussMarkovForSV>},
+  {"", "SetPseudorangeNoiseOffsetForEachSV", createCommand<Cmd::SetPseudorangeNoiseOffsetForEachSV>},
+  {"", "SetPseudorangeNoiseOffsetForSV", createCommand<Cmd::SetPseudorangeNoiseOffsetForSV>},
+  {"", "SetPseudorangeNoiseSineWaveForEachSV", createCommand<Cmd::SetPseudorangeNoiseSineWaveForEachSV>},
+  {"", "SetPseudorangeNoiseSineWaveForSV", createCommand<Cmd::SetPseudorangeNoiseSineWaveForSV>},
+  {"", "SetPseudorangeRampForSV", createCommand<Cmd::SetPseudorangeRampForSV>},
+  {"", "SetPulsarX1AccuracyIntegrityForSV", createCommand<Cmd::SetPulsarX1AccuracyIntegrityForSV>},
+  {"", "SetPulsarX1HealthForSV", createCommand<Cmd::SetPulsarX1HealthForSV>},
+  {"", "SetPulsarX5AccuracyIntegrityForSV", createCommand<Cmd::SetPulsarX5AccuracyIntegrityForSV>},
+  {"", "SetPulsarX5HealthForSV", createCommand<Cmd::SetPulsarX5HealthForSV>},
+  {"", "SetQzssEphBoolParamForEachSV", createCommand<Cmd::SetQzssEphBoolParamForEachSV>},
+  {"", "SetQzssEphBoolParamForSV", createCommand<Cmd::SetQzssEphBoolParamForSV>},
+  {"", "SetQzssEphDoubleParamForEachSV", createCommand<Cmd::SetQzssEphDoubleParamForEachSV>},
+  {"", "SetQzssEphDoubleParamForSV", createCommand<Cmd::SetQzssEphDoubleParamForSV>},
+  {"", "SetQzssEphemerisBoolParam", createCommand<Cmd::SetQzssEphemerisBoolParam>},
+  {"", "SetQzssEphemerisBoolParams", createCommand<Cmd::SetQzssEphemerisBoolParams>},
+  {"", "SetQzssEphemerisDoubleParam", createCommand<Cmd::SetQzssEphemerisDoubleParam>},
+  {"", "SetQzssEphemerisDoubleParams", createCommand<Cmd::SetQzssEphemerisDoubleParams>},
+  {"", "SetQzssL1DataHealthForSV", createCommand<Cmd::SetQzssL1DataHealthForSV>},
+  {"", "SetQzssL1HealthForSV", createCommand<Cmd::SetQzssL1HealthForSV>},
+  {"", "SetQzssL1SAugmentation", createCommand<Cmd::SetQzssL1SAugmentation>},
+  {"", "SetQzssL1cHealthForSV", createCommand<Cmd::SetQzssL1cHealthForSV>},
+  {"", "SetQzssL2HealthForSV", createCommand<Cmd::SetQzssL2HealthForSV>},
+  {"", "SetQzssL5HealthForSV", createCommand<Cmd::SetQzssL5HealthForSV>},
+  {"", "SetQzssL6HealthForSV", createCommand<Cmd::SetQzssL6HealthForSV>},
+  {"", "SetQzssNavAlertFlagForSV", createCommand<Cmd::SetQzssNavAlertFlagForSV>},
+  {"", "SetQzssSatelliteL1DataHealth", createCommand<Cmd::SetQzssSatelliteL1DataHealth>},
+  {"", "SetQzssSatelliteL1Health", createCommand<Cmd::SetQzssSatelliteL1Health>},
+  {"", "SetQzssSatelliteL1cHealth", createCommand<Cmd::SetQzssSatelliteL1cHealth>},
+  {"", "SetQzssSatelliteL2Health", createCommand<Cmd::SetQzssSatelliteL2Health>},
+  {"", "SetQzssSatelliteL5Health", createCommand<Cmd::SetQzssSatelliteL5Health>},
+  {"", "SetQzssSatelliteNavAlertFlag", createCommand<Cmd::SetQzssSatelliteNavAlertFlag>},
+  {"", "SetQzssUraIndex", createCommand<Cmd::SetQzssUraIndex>},
+  {"", "SetQzssUraIndexForSV", createCommand<Cmd::SetQzssUraIndexForSV>},
+  {"", "SetRFOutputOffsets", createCommand<Cmd::SetRFOutputOffsets>},
+  {"", "SetRawDataLoggingInterval", createCommand<Cmd::SetRawDataLoggingInterval>},
+  {"", "SetRfGain", createCommand<Cmd::SetRfGain>},
+  {"", "SetSVAntennaGain", createCommand<Cmd::SetSVAntennaGain>},
+  {"", "SetSVAntennaGainCSV", createCommand<Cmd::SetSVAntennaGainCSV>},
+  {"", "SetSVAntennaModelForEachSV", createCommand<Cmd::SetSVAntennaModelForEachSV>},
+  {"", "SetSVAntennaModelForSV", createCommand<Cmd::SetSVAntennaModelForSV>},
+  {"", "SetSVAntennaPhaseOffset", createCommand<Cmd::SetSVAntennaPhaseOffset>},
+  {"", "SetSVAntennaPhaseOffsetCSV", createCommand<Cmd::SetSVAntennaPhaseOffsetCSV>},
+  {"", "SetSVDataUpdateMode", createCommand<Cmd::SetSVDataUpdateMode>},
+  {"", "SetSVType", createCommand<Cmd::SetSVType>},
+  {"", "SetSatMotionFixed", createCommand<Cmd::SetSatMotionFixed>},
+  {"", "SetSbasCorrectionsHealthForSV", createCommand<Cmd::SetSbasCorrectionsHealthForSV>},
+  {"", "SetSbasDeltaUdreiOutsideOfRegions", createCommand<Cmd::SetSbasDeltaUdreiOutsideOfRegions>},
+  {"", "SetSbasEphParamsForSV", createCommand<Cmd::SetSbasEphParamsForSV>},
+  {"", "SetSbasEphemerisReferenceTimeForSV", createCommand<Cmd::SetSbasEphemerisReferenceTimeForSV>},
+  {"", "SetSbasIntegrityHealthForSV", createCommand<Cmd::SetSbasIntegrityHealthForSV>},
+  {"", "SetSbasMessageUpdateInterval", createCommand<Cmd::SetSbasMessageUpdateInterval>},
+  {"", "SetSbasMonitoredSystems", createCommand<Cmd::SetSbasMonitoredSystems>},
+  {"", "SetSbasRangingHealthForSV", createCommand<Cmd::SetSbasRangingHealthForSV>},
+  {"", "SetSbasReservedHealthForSV", createCommand<Cmd::SetSbasReservedHealthForSV>},
+  {"", "SetSbasServiceHealthForSV", createCommand<Cmd::SetSbasServiceHealthForSV>},
+  {"", "SetSbasServiceMessageRegionGroup", createCommand<Cmd::SetSbasServiceMessageRegionGroup>},
+  {"", "SetSbasUraIndexForSV", createCommand<Cmd::SetSbasUraIndexForSV>},
+  {"", "SetSignalFilterAssignation", createCommand<Cmd::SetSignalFilterAssignation>},
+  {"", "SetSignalPowerOffset", createCommand<Cmd::SetSignalPowerOffset>},
+  {"", "SetSpectrumVisible", createCommand<Cmd::SetSpectrumVisible>},
+  {"", "SetSpoofSignalManualPropagationLoss", createCommand<Cmd::SetSpoofSignalManualPropagationLoss>},
+  {"", "SetSpoofTxAntenna", createCommand<Cmd::SetSpoofTxAntenna>},
+  {"", "SetSpoofTxAntennaOffset", createCommand<Cmd::SetSpoofTxAntennaOffset>},
+  {"", "SetSpoofTxCircular", createCommand<Cmd::SetSpoofTxCircular>},
+  {"", "SetSpoofTxFix", createCommand<Cmd::SetSpoofTxFix>},
+  {"", "SetSpoofTxFixEcef", createCommand<Cmd::SetSpoofTxFixEcef>},
+  {"", "SetSpoofTxGpuIdx", createCommand<Cmd::SetSpoofTxGpuIdx>},
+  {"", "SetSpoofTxHil", createCommand<Cmd::SetSpoofTxHil>},
+  {"", "SetSpoofTxIgnorePropagationLoss", createCommand<Cmd::SetSpoofTxIgnorePropagationLoss>},
+  {"", "SetSpoofTxIgnoreRxAntennaGainPattern", createCommand<Cmd::SetSpoofTxIgnoreRxAntennaGainPattern>},
+  {"", "SetSpoofTxIgnoreRxAntennaPatterns", createCommand<Cmd::SetSpoofTxIgnoreRxAntennaPatterns>},
+  {"", "SetSpoofTxIgnoreRxAntennaPhasePattern", createCommand<Cmd::SetSpoofTxIgnoreRxAntennaPhasePattern>},
+  {"", "SetSpoofTxRefPower", createCommand<Cmd::SetSpoofTxRefPower>},
+  {"", "SetSpoofTxRemoteAddress", createCommand<Cmd::SetSpoofTxRemoteAddress>},
+  {"", "SetSpoofTxUseManualPropagationLoss", createCommand<Cmd::SetSpoofTxUseManualPropagationLoss>},
+  {"", "SetSpoofTxVehicleType", createCommand<Cmd::SetSpoofTxVehicleType>},
+  {"", "SetStartTimeMode", createCommand<Cmd::SetStartTimeMode>},
+  {"", "SetStartTimeOffset", createCommand<Cmd::SetStartTimeOffset>},
+  {"", "SetStatusLogMaxEntriesCount", createCommand<Cmd::SetStatusLogMaxEntriesCount>},
+  {"", "SetStatusLogMaxEntriesCountMode", createCommand<Cmd::SetStatusLogMaxEntriesCountMode>},
+  {"", "SetStreamingBuffer", createCommand<Cmd::SetStreamingBuffer>},
+  {"", "SetSyncClient", createCommand<Cmd::SetSyncClient>},
+  {"", "SetSyncServer", createCommand<Cmd::SetSyncServer>},
+  {"", "SetSyncTime", createCommand<Cmd::SetSyncTime>},
+  {"", "SetSyncTimeMainInstance", createCommand<Cmd::SetSyncTimeMainInstance>},
+  {"", "SetSyncTimeMaster", createCommand<Cmd::SetSyncTimeMaster>},
+  {"", "SetTransmitMessage2InSbasMessage0", createCommand<Cmd::SetTransmitMessage2InSbasMessage0>},
+  {"", "SetTransmittedPrnForSV", createCommand<Cmd::SetTransmittedPrnForSV>},
+  {"", "SetTropoModel", createCommand<Cmd::SetTropoModel>},
+  {"", "SetUdreiForEachSV", createCommand<Cmd::SetUdreiForEachSV>},
+  {"", "SetUdreiForSV", createCommand<Cmd::SetUdreiForSV>},
+  {"", "SetUsingVelocityInSbasMessage25", createCommand<Cmd::SetUsingVelocityInSbasMessage25>},
+  {"", "SetVehicleAntennaGain", createCommand<Cmd::SetVehicleAntennaGain>},
+  {"", "SetVehicleAntennaGainCSV", createCommand<Cmd::SetVehicleAntennaGainCSV>},
+  {"", "SetVehicleAntennaOffset", createCommand<Cmd::SetVehicleAntennaOffset>},
+  {"", "SetVehicleAntennaPhaseOffset", createCommand<Cmd::SetVehicleAntennaPhaseOffset>},
+  {"", "SetVehicleAntennaPhaseOffsetCSV", createCommand<Cmd::SetVehicleAntennaPhaseOffsetCSV>},
+  {"", "SetVehicleTrajectory", createCommand<Cmd::SetVehicleTrajectory>},
+  {"", "SetVehicleTrajectoryCircular", createCommand<Cmd::SetVehicleTrajectoryCircular>},
+  {"", "SetVehicleTrajectoryFix", createCommand<Cmd::SetVehicleTrajectoryFix>},
+  {"", "SetVehicleTrajectoryFixEcef", createCommand<Cmd::SetVehicleTrajectoryFixEcef>},
+  {"", "SetVehicleTrajectoryOrbit", createCommand<Cmd::SetVehicleTrajectoryOrbit>},
+  {"", "SetVehicleType", createCommand<Cmd::SetVehicleType>},
+  {"", "SetWFAntennaElementEnabled", createCommand<Cmd::SetWFAntennaElementEnabled>},
+  {"", "SetWFAntennaElementModel", createCommand<Cmd::SetWFAntennaElementModel>},
+  {"", "SetWFAntennaElementOffset", createCommand<Cmd::SetWFAntennaElementOffset>},
+  {"", "SetWFAntennaElementPhasePatternOffset", createCommand<Cmd::SetWFAntennaElementPhasePatternOffset>},
+  {"", "SetWFAntennaGain", createCommand<Cmd::SetWFAntennaGain>},
+  {"", "SetWFAntennaOffset", createCommand<Cmd::SetWFAntennaOffset>},
+  {"", "SetWFElement", createCommand<Cmd::SetWFElement>},
+  {"", "SetWavefrontJamCalibrationState", createCommand<Cmd::SetWavefrontJamCalibrationState>},
+  {"", "ShowMapAnalysis", createCommand<Cmd::ShowMapAnalysis>},
+  {"", "SimulationElapsedTimeResult", createCommand<Cmd::SimulationElapsedTimeResult>},
+  {"", "SimulatorStateResult", createCommand<Cmd::SimulatorStateResult>},
+  {"", "Start", createCommand<Cmd::Start>},
+  {"", "StartPPS", createCommand<Cmd::StartPPS>},
+  {"", "Stop", createCommand<Cmd::Stop>},
+  {"", "StopMainInstanceWhenWorkerInstanceStop", createCommand<Cmd::StopMainInstanceWhenWorkerInstanceStop>},
+  {"", "StopMasterWhenSlaveStop", createCommand<Cmd::StopMasterWhenSlaveStop>},
+  {"", "StopWhenCommandFail", createCommand<Cmd::StopWhenCommandFail>},
+  {"", "SuccessResult", createCommand<Cmd::SuccessResult>},
+  {"", "SwapSbasServiceMessageRegionGroup", createCommand<Cmd::SwapSbasServiceMessageRegionGroup>},
+  {"", "TestEncryptionLibrary", createCommand<Cmd::TestEncryptionLibrary>},
+  {"", "UndoCmd", createCommand<Cmd::UndoCmd>},
+  {"", "UnlockGUI", createCommand<Cmd::UnlockGUI>},
+  {"", "VersionResult", createCommand<Cmd::VersionResult>},
+  {"", "WaitAndResetPPS", createCommand<Cmd::WaitAndResetPPS>},
+  {"", "WaitSimulatorState", createCommand<Cmd::WaitSimulatorState>},
+}};
+
+constexpr CommandRegistry<Entries.size()> Registry(Entries);
+} // namespace
+
+const CommandRegistryEntry* findRegisteredCommand(std::string_view targetId, std::string_view cmdName)
+{
+  return Registry.find(targetId, cmdName);
+}
+
+std::span<const CommandRegistryEntry> registeredCommands()
+{
+  return Registry.entries();
+}
+
+} // namespace Sdx
@@ -1,8 +1,10 @@
 #include "command_result.h"
 
 #include <rapidjson/document.h>
+#include <rapidjson/reader.h>
 #include <rapidjson/writer.h>
 
+#include "command_factory.h"
 #include "date_time.h"
 
 namespace Sdx
@@ -12,6 +14,50 @@ namespace Sdx
 //
 const std::string CommandResult::RelatedCommand("RelatedCommand");
 
+namespace
+{
+// Stops reading the serialized command as soon as its top level uuid is found
+struct UuidReader : public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, UuidReader>
+{
+  bool Default()
+  {
+    isUuid = false;
+    return true;
+  }
+
+  bool StartObject()
+  {
+    isUuid = false;
+    ++depth;
+    return true;
+  }
+
+  bool EndObject(rapidjson::SizeType)
+  {
+    --depth;
+    return true;
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool)
+  {
+    isUuid = depth == 1 && CommandBase::CmdUuidKey.compare(0, std::string::npos, str, length) == 0;
+    return true;
+  }
+
+  bool String(const char* str, rapidjson::SizeType length, bool)
+  {
+    if (!isUuid)
+      return Default();
+    uuid.assign(str, length);
+    return false;
+  }
+
+  std::string uuid;
+  int depth = 0;
+  bool isUuid = false;
+};
+} // namespace
+
 CommandResult::CommandResult(const std::string& cmdName, const std::string& targetId) : CommandBase(cmdName, targetId)
 {
 }
@@ -20,10 +66,9 @@ CommandResult::CommandResult(const std::string& cmdName, const std::string& targ
   CommandBase(cmdName, targetId),
   m_relatedCommand(relatedCmd)
 {
+  const std::string relatedCmdStr = relatedCmd->toString();
   rapidjson::Value value;
-  value.SetString(relatedCmd->toString().c_str(),
-                  static_cast<rapidjson::SizeType>(relatedCmd->toString().size()),
-                  m_values.GetAllocator());
+  value.SetString(relatedCmdStr.c_str(), static_cast<rapidjson::SizeType>(relatedCmdStr.size()), m_values.GetAllocator());
   setValue(RelatedCommand, value);
 }
 
@@ -34,12 +79,14 @@ bool CommandResult::isValid() const
 
 double CommandResult::timestamp() const
 {
-  return m_relatedCommand->timestamp();
+  CommandBasePtr relatedCmd = relatedCommand();
+  return relatedCmd ? relatedCmd->timestamp() : 0;
 }
 
 Sdx::DateTime CommandResult::gpsTimestamp() const
 {
-  return m_relatedCommand->gpsTimestamp();
+  CommandBasePtr relatedCmd = relatedCommand();
+  return relatedCmd ? relatedCmd->gpsTimestamp() : Sdx::DateTime();
 }
 
 void CommandResult::setTimestamp(double)
@@ -82,13 +129,44 @@ std::string CommandResult::message() const
     return toReadableCommand();
 }
 
+CommandBasePtr CommandResult::relatedCommand() const
+{
+  std::lock_guard<std::mutex> lock(m_relatedCommandMutex);
+  if (!m_relatedCommand)
+  {
+    const rapidjson::Value& serializedCommand = value(RelatedCommand);
+    if (serializedCommand.IsString())
+      m_relatedCommand = CommandFactory::instance()->createCommand(serializedCommand.GetString());
+  }
+  return m_relatedCommand;
+}
+
+std::string CommandResult::relatedCommandUuid() const
+{
+  {
+    std::lock_guard<std::mutex> lock(m_relatedCommandMutex);
+    if (m_relatedCommand)
+      return m_relatedCommand->uuid();
+  }
+
+  const rapidjson::Value& serializedCommand = value(RelatedCommand);
+  if (!serializedCommand.IsString())
+    return std::string();
+
+  UuidReader handler;
+  rapidjson::Reader reader;
+  rapidjson::StringStream stream(serializedCommand.GetString());
+  reader.Parse(stream, handler);
+  return handler.uuid;
+}
+
 void CommandResult::setRelatedCommand(CommandBasePtr relatedCommand)
 {
+  std::lock_guard<std::mutex> lock(m_relatedCommandMutex);
   m_relatedCommand = std::move(relatedCommand);
+  const std::string relatedCmdStr = m_relatedCommand->toString();
   rapidjson::Value value;
-  value.SetString(m_relatedCommand->toString().c_str(),
-                  static_cast<rapidjson::SizeType>(m_relatedCommand->toString().size()),
-                  m_values.GetAllocator());
+  value.SetString(relatedCmdStr.c_str(), static_cast<rapidjson::SizeType>(relatedCmdStr.size()), m_values.GetAllocator());
   setValue(RelatedCommand, value);
 }
 
@@ -1,6 +1,8 @@
 #ifndef COMMANDRESULT_H
 #define COMMANDRESULT_H
 
+#include <mutex>
+
 #include "command_base.h"
 
 namespace Sdx
@@ -29,12 +31,17 @@ public:
   virtual bool isValid() const;
   static CommandResultPtr dynamicCast(CommandBasePtr ptr);
 
+  // Timestamps of the related command, the defaults of CommandBase if it can't be parsed
   virtual double timestamp() const;
   virtual Sdx::DateTime gpsTimestamp() const;
   virtual void setTimestamp(double);
   virtual void setGpsTimestamp(const Sdx::DateTime& gpsTimestamp);
 
-  inline CommandBasePtr relatedCommand() const { return m_relatedCommand; }
+  // The related command of a received result is parsed the first time it is requested. CommandFactory only checks
+  // that its uuid can be read, so this returns nullptr if the related command is unknown or invalid.
+  CommandBasePtr relatedCommand() const;
+  // Reads the uuid of the related command without parsing the whole command
+  std::string relatedCommandUuid() const;
 
   virtual std::string toReadableCommand(bool includeName = true) const;
 
@@ -45,7 +52,8 @@ public:
   void setRelatedCommand(CommandBasePtr relatedCommand);
 
 private:
-  CommandBasePtr m_relatedCommand;
+  mutable std::mutex m_relatedCommandMutex;
+  mutable CommandBasePtr m_relatedCommand;
   friend class CommandFactory;
 };
 } // namespace Sdx
@@ -26,6 +26,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(AddDataSet);
     REGISTER_COMMAND_TO_FACTORY_IMPL(AddDataSet);
 
+    namespace
+    {
+      // Fields of AddDataSet, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t PathField = 1;
+      constexpr std::size_t RolloverField = 2;
+      constexpr std::size_t DataSetNameField = 3;
+    }
+
 
     AddDataSet::AddDataSet()
       : CommandBase(CmdName, TargetId)
@@ -55,10 +64,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<std::optional<int>>::is_valid(m_values["Rollover"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<std::optional<int>>::is_valid(field(RolloverField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -80,48 +89,48 @@ namespace Sdx
 
     std::string AddDataSet::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void AddDataSet::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string AddDataSet::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void AddDataSet::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> AddDataSet::rollover() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["Rollover"]);
+      return parse_json<std::optional<int>>::parse(field(RolloverField));
     }
 
     void AddDataSet::setRollover(const std::optional<int>& rollover)
     {
-      m_values.AddMember("Rollover", parse_json<std::optional<int>>::format(rollover, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RolloverField, parse_json<std::optional<int>>::format(rollover, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> AddDataSet::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void AddDataSet::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(AddEmptySVAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(AddEmptySVAntennaModel);
 
+    namespace
+    {
+      // Fields of AddEmptySVAntennaModel, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+      constexpr std::size_t SystemField = 1;
+    }
+
 
     AddEmptySVAntennaModel::AddEmptySVAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
-          && parse_json<std::string>::is_valid(m_values["System"])
+          && parse_json<std::string>::is_valid(field(NameField))
+          && parse_json<std::string>::is_valid(field(SystemField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string AddEmptySVAntennaModel::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void AddEmptySVAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
 
     std::string AddEmptySVAntennaModel::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void AddEmptySVAntennaModel::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(AddEmptyVehicleAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(AddEmptyVehicleAntennaModel);
 
+    namespace
+    {
+      // Fields of AddEmptyVehicleAntennaModel, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+    }
+
 
     AddEmptyVehicleAntennaModel::AddEmptyVehicleAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
+          && parse_json<std::string>::is_valid(field(NameField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string AddEmptyVehicleAntennaModel::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void AddEmptyVehicleAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -26,6 +26,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(AddSVPhasePatternOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(AddSVPhasePatternOffset);
 
+    namespace
+    {
+      // Fields of AddSVPhasePatternOffset, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t SystemField = 1;
+      constexpr std::size_t OffsetField = 2;
+      constexpr std::size_t AntennaNameField = 3;
+    }
+
 
     AddSVPhasePatternOffset::AddSVPhasePatternOffset()
       : CommandBase(CmdName, TargetId)
@@ -55,10 +64,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::GNSSBand>::is_valid(m_values["Band"])
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<double>::is_valid(m_values["Offset"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["AntennaName"])
+          && parse_json<Sdx::GNSSBand>::is_valid(field(BandField))
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<double>::is_valid(field(OffsetField))
+          && parse_json<std::optional<std::string>>::is_valid(field(AntennaNameField))
         ;
 
     }
@@ -80,48 +89,48 @@ namespace Sdx
 
     Sdx::GNSSBand AddSVPhasePatternOffset::band() const
     {
-      return parse_json<Sdx::GNSSBand>::parse(m_values["Band"]);
+      return parse_json<Sdx::GNSSBand>::parse(field(BandField));
     }
 
     void AddSVPhasePatternOffset::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
 
     std::string AddSVPhasePatternOffset::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void AddSVPhasePatternOffset::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     double AddSVPhasePatternOffset::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void AddSVPhasePatternOffset::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> AddSVPhasePatternOffset::antennaName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["AntennaName"]);
+      return fieldValue<std::optional<std::string>>(AntennaNameField);
     }
 
     void AddSVPhasePatternOffset::setAntennaName(const std::optional<std::string>& antennaName)
     {
-      m_values.AddMember("AntennaName", parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaNameField, parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()));
     }
 
 
@@ -29,6 +29,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(AddSpoofTx);
     REGISTER_COMMAND_TO_FACTORY_IMPL(AddSpoofTx);
 
+    namespace
+    {
+      // Fields of AddSpoofTx, indices in fieldNames()
+      constexpr std::size_t UsualNameField = 0;
+      constexpr std::size_t EnabledField = 1;
+      constexpr std::size_t AddressField = 2;
+      constexpr std::size_t InstanceIdField = 3;
+      constexpr std::size_t IdField = 4;
+    }
+
 
     AddSpoofTx::AddSpoofTx()
       : CommandBase(CmdName, TargetId)
@@ -59,11 +69,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["UsualName"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::string>::is_valid(m_values["Address"])
-          && parse_json<int>::is_valid(m_values["InstanceId"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(UsualNameField))
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::string>::is_valid(field(AddressField))
+          && parse_json<int>::is_valid(field(InstanceIdField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -85,60 +95,60 @@ namespace Sdx
 
     std::string AddSpoofTx::usualName() const
     {
-      return parse_json<std::string>::parse(m_values["UsualName"]);
+      return fieldValue<std::string>(UsualNameField);
     }
 
     void AddSpoofTx::setUsualName(const std::string& usualName)
     {
-      m_values.AddMember("UsualName", parse_json<std::string>::format(usualName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UsualNameField, parse_json<std::string>::format(usualName, m_values.GetAllocator()));
     }
 
 
 
     bool AddSpoofTx::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void AddSpoofTx::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::string AddSpoofTx::address() const
     {
-      return parse_json<std::string>::parse(m_values["Address"]);
+      return fieldValue<std::string>(AddressField);
     }
 
     void AddSpoofTx::setAddress(const std::string& address)
     {
-      m_values.AddMember("Address", parse_json<std::string>::format(address, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AddressField, parse_json<std::string>::format(address, m_values.GetAllocator()));
     }
 
 
 
     int AddSpoofTx::instanceId() const
     {
-      return parse_json<int>::parse(m_values["InstanceId"]);
+      return parse_json<int>::parse(field(InstanceIdField));
     }
 
     void AddSpoofTx::setInstanceId(int instanceId)
     {
-      m_values.AddMember("InstanceId", parse_json<int>::format(instanceId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(InstanceIdField, parse_json<int>::format(instanceId, m_values.GetAllocator()));
     }
 
 
 
     std::string AddSpoofTx::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void AddSpoofTx::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(AddVehicleGainPatternOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(AddVehicleGainPatternOffset);
 
+    namespace
+    {
+      // Fields of AddVehicleGainPatternOffset, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t OffsetField = 1;
+      constexpr std::size_t AntennaNameField = 2;
+    }
+
 
     AddVehicleGainPatternOffset::AddVehicleGainPatternOffset()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::GNSSBand>::is_valid(m_values["Band"])
-          && parse_json<double>::is_valid(m_values["Offset"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["AntennaName"])
+          && parse_json<Sdx::GNSSBand>::is_valid(field(BandField))
+          && parse_json<double>::is_valid(field(OffsetField))
+          && parse_json<std::optional<std::string>>::is_valid(field(AntennaNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     Sdx::GNSSBand AddVehicleGainPatternOffset::band() const
     {
-      return parse_json<Sdx::GNSSBand>::parse(m_values["Band"]);
+      return parse_json<Sdx::GNSSBand>::parse(field(BandField));
     }
 
     void AddVehicleGainPatternOffset::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
 
     double AddVehicleGainPatternOffset::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void AddVehicleGainPatternOffset::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> AddVehicleGainPatternOffset::antennaName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["AntennaName"]);
+      return fieldValue<std::optional<std::string>>(AntennaNameField);
     }
 
     void AddVehicleGainPatternOffset::setAntennaName(const std::optional<std::string>& antennaName)
     {
-      m_values.AddMember("AntennaName", parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaNameField, parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()));
     }
 
 
@@ -26,6 +26,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(BeginSpoofTxTrackDefinition);
     REGISTER_COMMAND_TO_FACTORY_IMPL(BeginSpoofTxTrackDefinition);
 
+    namespace
+    {
+      // Fields of BeginSpoofTxTrackDefinition, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+    }
+
 
     BeginSpoofTxTrackDefinition::BeginSpoofTxTrackDefinition()
       : CommandBase(CmdName, TargetId)
@@ -52,7 +58,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,12 +80,12 @@ namespace Sdx
 
     std::string BeginSpoofTxTrackDefinition::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void BeginSpoofTxTrackDefinition::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -30,6 +30,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(CalibFunction);
     REGISTER_COMMAND_TO_FACTORY_IMPL(CalibFunction);
 
+    namespace
+    {
+      // Fields of CalibFunction, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t SignalField = 1;
+      constexpr std::size_t EnableSVField = 2;
+      constexpr std::size_t EnableDopplerField = 3;
+      constexpr std::size_t PhaseOffetField = 4;
+    }
+
 
     CalibFunction::CalibFunction()
       : CommandBase(CmdName, TargetId)
@@ -60,11 +70,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<bool>::is_valid(m_values["EnableSV"])
-          && parse_json<bool>::is_valid(m_values["EnableDoppler"])
-          && parse_json<double>::is_valid(m_values["PhaseOffet"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<bool>::is_valid(field(EnableSVField))
+          && parse_json<bool>::is_valid(field(EnableDopplerField))
+          && parse_json<double>::is_valid(field(PhaseOffetField))
         ;
 
     }
@@ -86,60 +96,60 @@ namespace Sdx
 
     int CalibFunction::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void CalibFunction::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::string CalibFunction::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void CalibFunction::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     bool CalibFunction::enableSV() const
     {
-      return parse_json<bool>::parse(m_values["EnableSV"]);
+      return parse_json<bool>::parse(field(EnableSVField));
     }
 
     void CalibFunction::setEnableSV(bool enableSV)
     {
-      m_values.AddMember("EnableSV", parse_json<bool>::format(enableSV, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnableSVField, parse_json<bool>::format(enableSV, m_values.GetAllocator()));
     }
 
 
 
     bool CalibFunction::enableDoppler() const
     {
-      return parse_json<bool>::parse(m_values["EnableDoppler"]);
+      return parse_json<bool>::parse(field(EnableDopplerField));
     }
 
     void CalibFunction::setEnableDoppler(bool enableDoppler)
     {
-      m_values.AddMember("EnableDoppler", parse_json<bool>::format(enableDoppler, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnableDopplerField, parse_json<bool>::format(enableDoppler, m_values.GetAllocator()));
     }
 
 
 
     double CalibFunction::phaseOffet() const
     {
-      return parse_json<double>::parse(m_values["PhaseOffet"]);
+      return parse_json<double>::parse(field(PhaseOffetField));
     }
 
     void CalibFunction::setPhaseOffet(double phaseOffet)
     {
-      m_values.AddMember("PhaseOffet", parse_json<double>::format(phaseOffet, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffetField, parse_json<double>::format(phaseOffet, m_values.GetAllocator()));
     }
 
 
@@ -26,6 +26,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(CalibratePilotOutput);
     REGISTER_COMMAND_TO_FACTORY_IMPL(CalibratePilotOutput);
 
+    namespace
+    {
+      // Fields of CalibratePilotOutput, indices in fieldNames()
+      constexpr std::size_t OutputIdxField = 0;
+      constexpr std::size_t PowerField = 1;
+      constexpr std::size_t TimeField = 2;
+      constexpr std::size_t CarrierPhaseField = 3;
+    }
+
 
     CalibratePilotOutput::CalibratePilotOutput()
       : CommandBase(CmdName, TargetId)
@@ -55,10 +64,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["OutputIdx"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<double>::is_valid(m_values["Time"])
-          && parse_json<double>::is_valid(m_values["CarrierPhase"])
+          && parse_json<int>::is_valid(field(OutputIdxField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<double>::is_valid(field(TimeField))
+          && parse_json<double>::is_valid(field(CarrierPhaseField))
         ;
 
     }
@@ -80,48 +89,48 @@ namespace Sdx
 
     int CalibratePilotOutput::outputIdx() const
     {
-      return parse_json<int>::parse(m_values["OutputIdx"]);
+      return parse_json<int>::parse(field(OutputIdxField));
     }
 
     void CalibratePilotOutput::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputIdxField, parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
 
     double CalibratePilotOutput::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void CalibratePilotOutput::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     double CalibratePilotOutput::time() const
     {
-      return parse_json<double>::parse(m_values["Time"]);
+      return parse_json<double>::parse(field(TimeField));
     }
 
     void CalibratePilotOutput::setTime(double time)
     {
-      m_values.AddMember("Time", parse_json<double>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<double>::format(time, m_values.GetAllocator()));
     }
 
 
 
     double CalibratePilotOutput::carrierPhase() const
     {
-      return parse_json<double>::parse(m_values["CarrierPhase"]);
+      return parse_json<double>::parse(field(CarrierPhaseField));
     }
 
     void CalibratePilotOutput::setCarrierPhase(double carrierPhase)
     {
-      m_values.AddMember("CarrierPhase", parse_json<double>::format(carrierPhase, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CarrierPhaseField, parse_json<double>::format(carrierPhase, m_values.GetAllocator()));
     }
 
 
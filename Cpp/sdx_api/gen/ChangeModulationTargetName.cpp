@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ChangeModulationTargetName);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ChangeModulationTargetName);
 
+    namespace
+    {
+      // Fields of ChangeModulationTargetName, indices in fieldNames()
+      constexpr std::size_t TargetNameField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     ChangeModulationTargetName::ChangeModulationTargetName()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["TargetName"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(TargetNameField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string ChangeModulationTargetName::targetName() const
     {
-      return parse_json<std::string>::parse(m_values["TargetName"]);
+      return fieldValue<std::string>(TargetNameField);
     }
 
     void ChangeModulationTargetName::setTargetName(const std::string& targetName)
     {
-      m_values.AddMember("TargetName", parse_json<std::string>::format(targetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TargetNameField, parse_json<std::string>::format(targetName, m_values.GetAllocator()));
     }
 
 
 
     std::string ChangeModulationTargetName::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void ChangeModulationTargetName::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
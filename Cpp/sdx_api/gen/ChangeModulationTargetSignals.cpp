@@ -33,6 +33,20 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ChangeModulationTargetSignals);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ChangeModulationTargetSignals);
 
+    namespace
+    {
+      // Fields of ChangeModulationTargetSignals, indices in fieldNames()
+      constexpr std::size_t OutputField = 0;
+      constexpr std::size_t MinRateField = 1;
+      constexpr std::size_t MaxRateField = 2;
+      constexpr std::size_t BandField = 3;
+      constexpr std::size_t SignalField = 4;
+      constexpr std::size_t GainField = 5;
+      constexpr std::size_t GaussianNoiseField = 6;
+      constexpr std::size_t IdField = 7;
+      constexpr std::size_t CentralFrequencyField = 8;
+    }
+
 
     ChangeModulationTargetSignals::ChangeModulationTargetSignals()
       : CommandBase(CmdName, TargetId)
@@ -67,15 +81,15 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Output"])
-          && parse_json<int>::is_valid(m_values["MinRate"])
-          && parse_json<int>::is_valid(m_values["MaxRate"])
-          && parse_json<std::string>::is_valid(m_values["Band"])
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["Gain"])
-          && parse_json<bool>::is_valid(m_values["GaussianNoise"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::optional<double>>::is_valid(m_values["CentralFrequency"])
+          && parse_json<int>::is_valid(field(OutputField))
+          && parse_json<int>::is_valid(field(MinRateField))
+          && parse_json<int>::is_valid(field(MaxRateField))
+          && parse_json<std::string>::is_valid(field(BandField))
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(GainField))
+          && parse_json<bool>::is_valid(field(GaussianNoiseField))
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::optional<double>>::is_valid(field(CentralFrequencyField))
         ;
 
     }
@@ -97,108 +111,108 @@ namespace Sdx
 
     int ChangeModulationTargetSignals::output() const
     {
-      return parse_json<int>::parse(m_values["Output"]);
+      return parse_json<int>::parse(field(OutputField));
     }
 
     void ChangeModulationTargetSignals::setOutput(int output)
     {
-      m_values.AddMember("Output", parse_json<int>::format(output, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputField, parse_json<int>::format(output, m_values.GetAllocator()));
     }
 
 
 
     int ChangeModulationTargetSignals::minRate() const
     {
-      return parse_json<int>::parse(m_values["MinRate"]);
+      return parse_json<int>::parse(field(MinRateField));
     }
 
     void ChangeModulationTargetSignals::setMinRate(int minRate)
     {
-      m_values.AddMember("MinRate", parse_json<int>::format(minRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MinRateField, parse_json<int>::format(minRate, m_values.GetAllocator()));
     }
 
 
 
     int ChangeModulationTargetSignals::maxRate() const
     {
-      return parse_json<int>::parse(m_values["MaxRate"]);
+      return parse_json<int>::parse(field(MaxRateField));
     }
 
     void ChangeModulationTargetSignals::setMaxRate(int maxRate)
     {
-      m_values.AddMember("MaxRate", parse_json<int>::format(maxRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MaxRateField, parse_json<int>::format(maxRate, m_values.GetAllocator()));
     }
 
 
 
     std::string ChangeModulationTargetSignals::band() const
     {
-      return parse_json<std::string>::parse(m_values["Band"]);
+      return fieldValue<std::string>(BandField);
     }
 
     void ChangeModulationTargetSignals::setBand(const std::string& band)
     {
-      m_values.AddMember("Band", parse_json<std::string>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<std::string>::format(band, m_values.GetAllocator()));
     }
 
 
 
     std::string ChangeModulationTargetSignals::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void ChangeModulationTargetSignals::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int ChangeModulationTargetSignals::gain() const
     {
-      return parse_json<int>::parse(m_values["Gain"]);
+      return parse_json<int>::parse(field(GainField));
     }
 
     void ChangeModulationTargetSignals::setGain(int gain)
     {
-      m_values.AddMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainField, parse_json<int>::format(gain, m_values.GetAllocator()));
     }
 
 
 
     bool ChangeModulationTargetSignals::gaussianNoise() const
     {
-      return parse_json<bool>::parse(m_values["GaussianNoise"]);
+      return parse_json<bool>::parse(field(GaussianNoiseField));
     }
 
     void ChangeModulationTargetSignals::setGaussianNoise(bool gaussianNoise)
     {
-      m_values.AddMember("GaussianNoise", parse_json<bool>::format(gaussianNoise, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GaussianNoiseField, parse_json<bool>::format(gaussianNoise, m_values.GetAllocator()));
     }
 
 
 
     std::string ChangeModulationTargetSignals::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void ChangeModulationTargetSignals::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::optional<double> ChangeModulationTargetSignals::centralFrequency() const
     {
-      return parse_json<std::optional<double>>::parse(m_values["CentralFrequency"]);
+      return parse_json<std::optional<double>>::parse(field(CentralFrequencyField));
     }
 
     void ChangeModulationTargetSignals::setCentralFrequency(const std::optional<double>& centralFrequency)
     {
-      m_values.AddMember("CentralFrequency", parse_json<std::optional<double>>::format(centralFrequency, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFrequencyField, parse_json<std::optional<double>>::format(centralFrequency, m_values.GetAllocator()));
     }
 
 
@@ -28,6 +28,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ClearAllMessageModifications);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ClearAllMessageModifications);
 
+    namespace
+    {
+      // Fields of ClearAllMessageModifications, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+    }
+
 
     ClearAllMessageModifications::ClearAllMessageModifications()
       : CommandBase(CmdName, TargetId)
@@ -54,7 +60,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
+          && parse_json<std::string>::is_valid(field(SignalField))
         ;
 
     }
@@ -76,12 +82,12 @@ namespace Sdx
 
     std::string ClearAllMessageModifications::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void ClearAllMessageModifications::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ClearAllMessageModificationsForNavMsgFamily);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ClearAllMessageModificationsForNavMsgFamily);
 
+    namespace
+    {
+      // Fields of ClearAllMessageModificationsForNavMsgFamily, indices in fieldNames()
+      constexpr std::size_t NavMsgFamilyField = 0;
+    }
+
 
     ClearAllMessageModificationsForNavMsgFamily::ClearAllMessageModificationsForNavMsgFamily()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["NavMsgFamily"])
+          && parse_json<std::string>::is_valid(field(NavMsgFamilyField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string ClearAllMessageModificationsForNavMsgFamily::navMsgFamily() const
     {
-      return parse_json<std::string>::parse(m_values["NavMsgFamily"]);
+      return fieldValue<std::string>(NavMsgFamilyField);
     }
 
     void ClearAllMessageModificationsForNavMsgFamily::setNavMsgFamily(const std::string& navMsgFamily)
     {
-      m_values.AddMember("NavMsgFamily", parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NavMsgFamilyField, parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()));
     }
 
 
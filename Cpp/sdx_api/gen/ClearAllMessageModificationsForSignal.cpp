@@ -26,6 +26,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ClearAllMessageModificationsForSignal);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ClearAllMessageModificationsForSignal);
 
+    namespace
+    {
+      // Fields of ClearAllMessageModificationsForSignal, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+    }
+
 
     ClearAllMessageModificationsForSignal::ClearAllMessageModificationsForSignal()
       : CommandBase(CmdName, TargetId)
@@ -52,7 +58,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
+          && parse_json<std::string>::is_valid(field(SignalField))
         ;
 
     }
@@ -74,12 +80,12 @@ namespace Sdx
 
     std::string ClearAllMessageModificationsForSignal::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void ClearAllMessageModificationsForSignal::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ClearAllSbasServiceMessageRegionGroup);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ClearAllSbasServiceMessageRegionGroup);
 
+    namespace
+    {
+      // Fields of ClearAllSbasServiceMessageRegionGroup, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+    }
+
 
     ClearAllSbasServiceMessageRegionGroup::ClearAllSbasServiceMessageRegionGroup()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string ClearAllSbasServiceMessageRegionGroup::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void ClearAllSbasServiceMessageRegionGroup::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
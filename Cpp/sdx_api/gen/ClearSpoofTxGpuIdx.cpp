@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ClearSpoofTxGpuIdx);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ClearSpoofTxGpuIdx);
 
+    namespace
+    {
+      // Fields of ClearSpoofTxGpuIdx, indices in fieldNames()
+      constexpr std::size_t SignalIdField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     ClearSpoofTxGpuIdx::ClearSpoofTxGpuIdx()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SignalId"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(SignalIdField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int ClearSpoofTxGpuIdx::signalId() const
     {
-      return parse_json<int>::parse(m_values["SignalId"]);
+      return parse_json<int>::parse(field(SignalIdField));
     }
 
     void ClearSpoofTxGpuIdx::setSignalId(int signalId)
     {
-      m_values.AddMember("SignalId", parse_json<int>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<int>::format(signalId, m_values.GetAllocator()));
     }
 
 
 
     std::string ClearSpoofTxGpuIdx::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void ClearSpoofTxGpuIdx::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(CommandGroup);
     REGISTER_COMMAND_TO_FACTORY_IMPL(CommandGroup);
 
+    namespace
+    {
+      // Fields of CommandGroup, indices in fieldNames()
+      constexpr std::size_t CommandsField = 0;
+    }
+
 
     CommandGroup::CommandGroup()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<Sdx::CommandBasePtr>>::is_valid(m_values["Commands"])
+          && parse_json<std::vector<Sdx::CommandBasePtr>>::is_valid(field(CommandsField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<Sdx::CommandBasePtr> CommandGroup::commands() const
     {
-      return parse_json<std::vector<Sdx::CommandBasePtr>>::parse(m_values["Commands"]);
+      return fieldValue<std::vector<Sdx::CommandBasePtr>>(CommandsField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::CommandBasePtr>> CommandGroup::commandsPtr() const
+    {
+      return sharedValue<std::vector<Sdx::CommandBasePtr>>(CommandsField);
     }
 
     void CommandGroup::setCommands(const std::vector<Sdx::CommandBasePtr>& commands)
     {
-      m_values.AddMember("Commands", parse_json<std::vector<Sdx::CommandBasePtr>>::format(commands, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CommandsField, parse_json<std::vector<Sdx::CommandBasePtr>>::format(commands, m_values.GetAllocator()));
     }
 
 
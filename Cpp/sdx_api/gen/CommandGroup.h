@@ -44,6 +44,7 @@ namespace Sdx
 
       // **** commands ****
       std::vector<Sdx::CommandBasePtr> commands() const;
+      std::shared_ptr<const std::vector<Sdx::CommandBasePtr>> commandsPtr() const;
       void setCommands(const std::vector<Sdx::CommandBasePtr>& commands);
     };
     
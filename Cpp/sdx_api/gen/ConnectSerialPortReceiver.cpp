@@ -28,6 +28,17 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ConnectSerialPortReceiver);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ConnectSerialPortReceiver);
 
+    namespace
+    {
+      // Fields of ConnectSerialPortReceiver, indices in fieldNames()
+      constexpr std::size_t PortField = 0;
+      constexpr std::size_t BaudRateField = 1;
+      constexpr std::size_t DataBitsField = 2;
+      constexpr std::size_t ParityField = 3;
+      constexpr std::size_t StopBitsField = 4;
+      constexpr std::size_t FlowControlField = 5;
+    }
+
 
     ConnectSerialPortReceiver::ConnectSerialPortReceiver()
       : CommandBase(CmdName, TargetId)
@@ -59,12 +70,12 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Port"])
-          && parse_json<std::optional<int>>::is_valid(m_values["BaudRate"])
-          && parse_json<std::optional<int>>::is_valid(m_values["DataBits"])
-          && parse_json<std::optional<Sdx::SerialPortParity>>::is_valid(m_values["Parity"])
-          && parse_json<std::optional<int>>::is_valid(m_values["StopBits"])
-          && parse_json<std::optional<Sdx::SerialPortFlowControl>>::is_valid(m_values["FlowControl"])
+          && parse_json<std::string>::is_valid(field(PortField))
+          && parse_json<std::optional<int>>::is_valid(field(BaudRateField))
+          && parse_json<std::optional<int>>::is_valid(field(DataBitsField))
+          && parse_json<std::optional<Sdx::SerialPortParity>>::is_valid(field(ParityField))
+          && parse_json<std::optional<int>>::is_valid(field(StopBitsField))
+          && parse_json<std::optional<Sdx::SerialPortFlowControl>>::is_valid(field(FlowControlField))
         ;
 
     }
@@ -86,72 +97,72 @@ namespace Sdx
 
     std::string ConnectSerialPortReceiver::port() const
     {
-      return parse_json<std::string>::parse(m_values["Port"]);
+      return fieldValue<std::string>(PortField);
     }
 
     void ConnectSerialPortReceiver::setPort(const std::string& port)
     {
-      m_values.AddMember("Port", parse_json<std::string>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PortField, parse_json<std::string>::format(port, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> ConnectSerialPortReceiver::baudRate() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["BaudRate"]);
+      return parse_json<std::optional<int>>::parse(field(BaudRateField));
     }
 
     void ConnectSerialPortReceiver::setBaudRate(const std::optional<int>& baudRate)
     {
-      m_values.AddMember("BaudRate", parse_json<std::optional<int>>::format(baudRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BaudRateField, parse_json<std::optional<int>>::format(baudRate, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> ConnectSerialPortReceiver::dataBits() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["DataBits"]);
+      return parse_json<std::optional<int>>::parse(field(DataBitsField));
     }
 
     void ConnectSerialPortReceiver::setDataBits(const std::optional<int>& dataBits)
     {
-      m_values.AddMember("DataBits", parse_json<std::optional<int>>::format(dataBits, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataBitsField, parse_json<std::optional<int>>::format(dataBits, m_values.GetAllocator()));
     }
 
 
 
     std::optional<Sdx::SerialPortParity> ConnectSerialPortReceiver::parity() const
     {
-      return parse_json<std::optional<Sdx::SerialPortParity>>::parse(m_values["Parity"]);
+      return parse_json<std::optional<Sdx::SerialPortParity>>::parse(field(ParityField));
     }
 
     void ConnectSerialPortReceiver::setParity(const std::optional<Sdx::SerialPortParity>& parity)
     {
-      m_values.AddMember("Parity", parse_json<std::optional<Sdx::SerialPortParity>>::format(parity, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParityField, parse_json<std::optional<Sdx::SerialPortParity>>::format(parity, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> ConnectSerialPortReceiver::stopBits() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["StopBits"]);
+      return parse_json<std::optional<int>>::parse(field(StopBitsField));
     }
 
     void ConnectSerialPortReceiver::setStopBits(const std::optional<int>& stopBits)
     {
-      m_values.AddMember("StopBits", parse_json<std::optional<int>>::format(stopBits, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopBitsField, parse_json<std::optional<int>>::format(stopBits, m_values.GetAllocator()));
     }
 
 
 
     std::optional<Sdx::SerialPortFlowControl> ConnectSerialPortReceiver::flowControl() const
     {
-      return parse_json<std::optional<Sdx::SerialPortFlowControl>>::parse(m_values["FlowControl"]);
+      return parse_json<std::optional<Sdx::SerialPortFlowControl>>::parse(field(FlowControlField));
     }
 
     void ConnectSerialPortReceiver::setFlowControl(const std::optional<Sdx::SerialPortFlowControl>& flowControl)
     {
-      m_values.AddMember("FlowControl", parse_json<std::optional<Sdx::SerialPortFlowControl>>::format(flowControl, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FlowControlField, parse_json<std::optional<Sdx::SerialPortFlowControl>>::format(flowControl, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(CopySVAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(CopySVAntennaModel);
 
+    namespace
+    {
+      // Fields of CopySVAntennaModel, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+      constexpr std::size_t CopyNameField = 1;
+      constexpr std::size_t SystemField = 2;
+    }
+
 
     CopySVAntennaModel::CopySVAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
-          && parse_json<std::string>::is_valid(m_values["CopyName"])
-          && parse_json<std::string>::is_valid(m_values["System"])
+          && parse_json<std::string>::is_valid(field(NameField))
+          && parse_json<std::string>::is_valid(field(CopyNameField))
+          && parse_json<std::string>::is_valid(field(SystemField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string CopySVAntennaModel::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void CopySVAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
 
     std::string CopySVAntennaModel::copyName() const
     {
-      return parse_json<std::string>::parse(m_values["CopyName"]);
+      return fieldValue<std::string>(CopyNameField);
     }
 
     void CopySVAntennaModel::setCopyName(const std::string& copyName)
     {
-      m_values.AddMember("CopyName", parse_json<std::string>::format(copyName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CopyNameField, parse_json<std::string>::format(copyName, m_values.GetAllocator()));
     }
 
 
 
     std::string CopySVAntennaModel::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void CopySVAntennaModel::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(CopyVehicleAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(CopyVehicleAntennaModel);
 
+    namespace
+    {
+      // Fields of CopyVehicleAntennaModel, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+      constexpr std::size_t CopyNameField = 1;
+    }
+
 
     CopyVehicleAntennaModel::CopyVehicleAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
-          && parse_json<std::string>::is_valid(m_values["CopyName"])
+          && parse_json<std::string>::is_valid(field(NameField))
+          && parse_json<std::string>::is_valid(field(CopyNameField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string CopyVehicleAntennaModel::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void CopyVehicleAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
 
     std::string CopyVehicleAntennaModel::copyName() const
     {
-      return parse_json<std::string>::parse(m_values["CopyName"]);
+      return fieldValue<std::string>(CopyNameField);
     }
 
     void CopyVehicleAntennaModel::setCopyName(const std::string& copyName)
     {
-      m_values.AddMember("CopyName", parse_json<std::string>::format(copyName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CopyNameField, parse_json<std::string>::format(copyName, m_values.GetAllocator()));
     }
 
 
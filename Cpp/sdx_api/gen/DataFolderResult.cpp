@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(DataFolderResult);
 
+    namespace
+    {
+      // Fields of DataFolderResult, indices in fieldNames()
+      constexpr std::size_t FolderField = 0;
+    }
+
 
     DataFolderResult::DataFolderResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Folder"])
+          && parse_json<std::string>::is_valid(field(FolderField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string DataFolderResult::folder() const
     {
-      return parse_json<std::string>::parse(m_values["Folder"]);
+      return fieldValue<std::string>(FolderField);
     }
 
     void DataFolderResult::setFolder(const std::string& folder)
     {
-      m_values.AddMember("Folder", parse_json<std::string>::format(folder, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FolderField, parse_json<std::string>::format(folder, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableAutomaticGpuAllocation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableAutomaticGpuAllocation);
 
+    namespace
+    {
+      // Fields of EnableAutomaticGpuAllocation, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+    }
+
 
     EnableAutomaticGpuAllocation::EnableAutomaticGpuAllocation()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool EnableAutomaticGpuAllocation::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableAutomaticGpuAllocation::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableCnav2Pages);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableCnav2Pages);
 
+    namespace
+    {
+      // Fields of EnableCnav2Pages, indices in fieldNames()
+      constexpr std::size_t MessagesField = 0;
+    }
+
 
     EnableCnav2Pages::EnableCnav2Pages()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<int>>::is_valid(m_values["Messages"])
+          && parse_json<std::vector<int>>::is_valid(field(MessagesField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<int> EnableCnav2Pages::messages() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Messages"]);
+      return fieldValue<std::vector<int>>(MessagesField);
+    }
+
+    std::shared_ptr<const std::vector<int>> EnableCnav2Pages::messagesPtr() const
+    {
+      return sharedValue<std::vector<int>>(MessagesField);
     }
 
     void EnableCnav2Pages::setMessages(const std::vector<int>& messages)
     {
-      m_values.AddMember("Messages", parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MessagesField, parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()));
     }
 
 
@@ -44,6 +44,7 @@ namespace Sdx
 
       // **** messages ****
       std::vector<int> messages() const;
+      std::shared_ptr<const std::vector<int>> messagesPtr() const;
       void setMessages(const std::vector<int>& messages);
     };
     
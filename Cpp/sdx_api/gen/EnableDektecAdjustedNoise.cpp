@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableDektecAdjustedNoise);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableDektecAdjustedNoise);
 
+    namespace
+    {
+      // Fields of EnableDektecAdjustedNoise, indices in fieldNames()
+      constexpr std::size_t EnableField = 0;
+    }
+
 
     EnableDektecAdjustedNoise::EnableDektecAdjustedNoise()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enable"])
+          && parse_json<bool>::is_valid(field(EnableField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool EnableDektecAdjustedNoise::enable() const
     {
-      return parse_json<bool>::parse(m_values["Enable"]);
+      return parse_json<bool>::parse(field(EnableField));
     }
 
     void EnableDektecAdjustedNoise::setEnable(bool enable)
     {
-      m_values.AddMember("Enable", parse_json<bool>::format(enable, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnableField, parse_json<bool>::format(enable, m_values.GetAllocator()));
     }
 
 
@@ -51,6 +51,7 @@ namespace Sdx
 
       // **** enabled ****
       std::vector<bool> enabled() const;
+      std::shared_ptr<const std::vector<bool>> enabledPtr() const;
       void setEnabled(const std::vector<bool>& enabled);
     };
     
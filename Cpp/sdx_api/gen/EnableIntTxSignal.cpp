@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableIntTxSignal);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableIntTxSignal);
 
+    namespace
+    {
+      // Fields of EnableIntTxSignal, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t TransmitterIdField = 1;
+      constexpr std::size_t SignalIdField = 2;
+    }
+
 
     EnableIntTxSignal::EnableIntTxSignal()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     bool EnableIntTxSignal::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableIntTxSignal::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::string EnableIntTxSignal::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void EnableIntTxSignal::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string EnableIntTxSignal::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void EnableIntTxSignal::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
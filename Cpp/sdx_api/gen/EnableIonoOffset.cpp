@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableIonoOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableIonoOffset);
 
+    namespace
+    {
+      // Fields of EnableIonoOffset, indices in fieldNames()
+      constexpr std::size_t IsEnabledField = 0;
+    }
+
 
     EnableIonoOffset::EnableIonoOffset()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsEnabled"])
+          && parse_json<bool>::is_valid(field(IsEnabledField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool EnableIonoOffset::isEnabled() const
     {
-      return parse_json<bool>::parse(m_values["IsEnabled"]);
+      return parse_json<bool>::parse(field(IsEnabledField));
     }
 
     void EnableIonoOffset::setIsEnabled(bool isEnabled)
     {
-      m_values.AddMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsEnabledField, parse_json<bool>::format(isEnabled, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableLogNmea);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableLogNmea);
 
+    namespace
+    {
+      // Fields of EnableLogNmea, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t SerialPortEnabledField = 1;
+    }
+
 
     EnableLogNmea::EnableLogNmea()
       : CommandBase(CmdName, TargetId)
@@ -52,8 +59,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["SerialPortEnabled"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::optional<bool>>::is_valid(field(SerialPortEnabledField))
         ;
 
     }
@@ -75,24 +82,24 @@ namespace Sdx
 
     bool EnableLogNmea::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableLogNmea::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> EnableLogNmea::serialPortEnabled() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["SerialPortEnabled"]);
+      return parse_json<std::optional<bool>>::parse(field(SerialPortEnabledField));
     }
 
     void EnableLogNmea::setSerialPortEnabled(const std::optional<bool>& serialPortEnabled)
     {
-      m_values.AddMember("SerialPortEnabled", parse_json<std::optional<bool>>::format(serialPortEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SerialPortEnabledField, parse_json<std::optional<bool>>::format(serialPortEnabled, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableLosForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableLosForEachSV);
 
+    namespace
+    {
+      // Fields of EnableLosForEachSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t EnabledField = 1;
+    }
+
 
     EnableLosForEachSV::EnableLosForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::string EnableLosForEachSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void EnableLosForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> EnableLosForEachSV::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> EnableLosForEachSV::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void EnableLosForEachSV::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableMainInstanceSync);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableMainInstanceSync);
 
+    namespace
+    {
+      // Fields of EnableMainInstanceSync, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+    }
+
 
     EnableMainInstanceSync::EnableMainInstanceSync()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     bool EnableMainInstanceSync::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableMainInstanceSync::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableOsnmaForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableOsnmaForEachSV);
 
+    namespace
+    {
+      // Fields of EnableOsnmaForEachSV, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+    }
+
 
     EnableOsnmaForEachSV::EnableOsnmaForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<bool> EnableOsnmaForEachSV::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> EnableOsnmaForEachSV::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void EnableOsnmaForEachSV::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
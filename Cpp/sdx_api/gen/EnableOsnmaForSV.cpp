@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableOsnmaForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableOsnmaForSV);
 
+    namespace
+    {
+      // Fields of EnableOsnmaForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t EnabledField = 1;
+    }
+
 
     EnableOsnmaForSV::EnableOsnmaForSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int EnableOsnmaForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void EnableOsnmaForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool EnableOsnmaForSV::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableOsnmaForSV::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnablePYCodeForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnablePYCodeForEachSV);
 
+    namespace
+    {
+      // Fields of EnablePYCodeForEachSV, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t EnabledField = 1;
+    }
+
 
     EnablePYCodeForEachSV::EnablePYCodeForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::string EnablePYCodeForEachSV::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void EnablePYCodeForEachSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> EnablePYCodeForEachSV::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> EnablePYCodeForEachSV::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void EnablePYCodeForEachSV::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
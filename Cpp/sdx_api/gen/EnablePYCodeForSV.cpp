@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnablePYCodeForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnablePYCodeForSV);
 
+    namespace
+    {
+      // Fields of EnablePYCodeForSV, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t EnabledField = 2;
+    }
+
 
     EnablePYCodeForSV::EnablePYCodeForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string EnablePYCodeForSV::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void EnablePYCodeForSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int EnablePYCodeForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void EnablePYCodeForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool EnablePYCodeForSV::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnablePYCodeForSV::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
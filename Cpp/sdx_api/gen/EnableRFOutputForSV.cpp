@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableRFOutputForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableRFOutputForSV);
 
+    namespace
+    {
+      // Fields of EnableRFOutputForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t EnabledField = 2;
+    }
+
 
     EnableRFOutputForSV::EnableRFOutputForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string EnableRFOutputForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void EnableRFOutputForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int EnableRFOutputForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void EnableRFOutputForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool EnableRFOutputForSV::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableRFOutputForSV::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
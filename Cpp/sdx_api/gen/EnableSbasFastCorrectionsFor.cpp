@@ -26,6 +26,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableSbasFastCorrectionsFor);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableSbasFastCorrectionsFor);
 
+    namespace
+    {
+      // Fields of EnableSbasFastCorrectionsFor, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t IsEnabledField = 1;
+      constexpr std::size_t ErrorTypeField = 2;
+    }
+
 
     EnableSbasFastCorrectionsFor::EnableSbasFastCorrectionsFor()
       : CommandBase(CmdName, TargetId)
@@ -54,9 +62,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<bool>::is_valid(m_values["IsEnabled"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["ErrorType"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<bool>::is_valid(field(IsEnabledField))
+          && parse_json<std::optional<std::string>>::is_valid(field(ErrorTypeField))
         ;
 
     }
@@ -78,36 +86,36 @@ namespace Sdx
 
     std::string EnableSbasFastCorrectionsFor::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void EnableSbasFastCorrectionsFor::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     bool EnableSbasFastCorrectionsFor::isEnabled() const
     {
-      return parse_json<bool>::parse(m_values["IsEnabled"]);
+      return parse_json<bool>::parse(field(IsEnabledField));
     }
 
     void EnableSbasFastCorrectionsFor::setIsEnabled(bool isEnabled)
     {
-      m_values.AddMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsEnabledField, parse_json<bool>::format(isEnabled, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> EnableSbasFastCorrectionsFor::errorType() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["ErrorType"]);
+      return fieldValue<std::optional<std::string>>(ErrorTypeField);
     }
 
     void EnableSbasFastCorrectionsFor::setErrorType(const std::optional<std::string>& errorType)
     {
-      m_values.AddMember("ErrorType", parse_json<std::optional<std::string>>::format(errorType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ErrorTypeField, parse_json<std::optional<std::string>>::format(errorType, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableSbasLongTermCorrectionsFor);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableSbasLongTermCorrectionsFor);
 
+    namespace
+    {
+      // Fields of EnableSbasLongTermCorrectionsFor, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t IsEnabledField = 1;
+    }
+
 
     EnableSbasLongTermCorrectionsFor::EnableSbasLongTermCorrectionsFor()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<bool>::is_valid(m_values["IsEnabled"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<bool>::is_valid(field(IsEnabledField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string EnableSbasLongTermCorrectionsFor::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void EnableSbasLongTermCorrectionsFor::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     bool EnableSbasLongTermCorrectionsFor::isEnabled() const
     {
-      return parse_json<bool>::parse(m_values["IsEnabled"]);
+      return parse_json<bool>::parse(field(IsEnabledField));
     }
 
     void EnableSbasLongTermCorrectionsFor::setIsEnabled(bool isEnabled)
     {
-      m_values.AddMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsEnabledField, parse_json<bool>::format(isEnabled, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableSbasMessages);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableSbasMessages);
 
+    namespace
+    {
+      // Fields of EnableSbasMessages, indices in fieldNames()
+      constexpr std::size_t MessagesField = 0;
+    }
+
 
     EnableSbasMessages::EnableSbasMessages()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<int>>::is_valid(m_values["Messages"])
+          && parse_json<std::vector<int>>::is_valid(field(MessagesField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<int> EnableSbasMessages::messages() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Messages"]);
+      return fieldValue<std::vector<int>>(MessagesField);
+    }
+
+    std::shared_ptr<const std::vector<int>> EnableSbasMessages::messagesPtr() const
+    {
+      return sharedValue<std::vector<int>>(MessagesField);
     }
 
     void EnableSbasMessages::setMessages(const std::vector<int>& messages)
     {
-      m_values.AddMember("Messages", parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MessagesField, parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()));
     }
 
 
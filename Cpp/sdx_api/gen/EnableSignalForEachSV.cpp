@@ -28,6 +28,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableSignalForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableSignalForEachSV);
 
+    namespace
+    {
+      // Fields of EnableSignalForEachSV, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t EnabledField = 1;
+    }
+
 
     EnableSignalForEachSV::EnableSignalForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -55,8 +62,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
         ;
 
     }
@@ -78,24 +85,29 @@ namespace Sdx
 
     std::string EnableSignalForEachSV::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void EnableSignalForEachSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> EnableSignalForEachSV::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> EnableSignalForEachSV::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void EnableSignalForEachSV::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
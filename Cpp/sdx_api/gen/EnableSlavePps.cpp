@@ -26,6 +26,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableSlavePps);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableSlavePps);
 
+    namespace
+    {
+      // Fields of EnableSlavePps, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+    }
+
 
     EnableSlavePps::EnableSlavePps()
       : CommandBase(CmdName, TargetId)
@@ -52,7 +58,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -74,12 +80,12 @@ namespace Sdx
 
     bool EnableSlavePps::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableSlavePps::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableSpoofTxTrajectorySmoothing);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableSpoofTxTrajectorySmoothing);
 
+    namespace
+    {
+      // Fields of EnableSpoofTxTrajectorySmoothing, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     EnableSpoofTxTrajectorySmoothing::EnableSpoofTxTrajectorySmoothing()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     bool EnableSpoofTxTrajectorySmoothing::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableSpoofTxTrajectorySmoothing::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::string EnableSpoofTxTrajectorySmoothing::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void EnableSpoofTxTrajectorySmoothing::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(EnableWorkerInstanceSync);
     REGISTER_COMMAND_TO_FACTORY_IMPL(EnableWorkerInstanceSync);
 
+    namespace
+    {
+      // Fields of EnableWorkerInstanceSync, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+    }
+
 
     EnableWorkerInstanceSync::EnableWorkerInstanceSync()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     bool EnableWorkerInstanceSync::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void EnableWorkerInstanceSync::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
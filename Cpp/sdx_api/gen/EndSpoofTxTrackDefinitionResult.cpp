@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(EndSpoofTxTrackDefinitionResult);
 
+    namespace
+    {
+      // Fields of EndSpoofTxTrackDefinitionResult, indices in fieldNames()
+      constexpr std::size_t CountField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     EndSpoofTxTrackDefinitionResult::EndSpoofTxTrackDefinitionResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Count"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(CountField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     int EndSpoofTxTrackDefinitionResult::count() const
     {
-      return parse_json<int>::parse(m_values["Count"]);
+      return parse_json<int>::parse(field(CountField));
     }
 
     void EndSpoofTxTrackDefinitionResult::setCount(int count)
     {
-      m_values.AddMember("Count", parse_json<int>::format(count, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CountField, parse_json<int>::format(count, m_values.GetAllocator()));
     }
 
 
 
     std::string EndSpoofTxTrackDefinitionResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void EndSpoofTxTrackDefinitionResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(EndTrackDefinitionResult);
 
+    namespace
+    {
+      // Fields of EndTrackDefinitionResult, indices in fieldNames()
+      constexpr std::size_t CountField = 0;
+    }
+
 
     EndTrackDefinitionResult::EndTrackDefinitionResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Count"])
+          && parse_json<int>::is_valid(field(CountField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int EndTrackDefinitionResult::count() const
     {
-      return parse_json<int>::parse(m_values["Count"]);
+      return parse_json<int>::parse(field(CountField));
     }
 
     void EndTrackDefinitionResult::setCount(int count)
     {
-      m_values.AddMember("Count", parse_json<int>::format(count, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CountField, parse_json<int>::format(count, m_values.GetAllocator()));
     }
 
 
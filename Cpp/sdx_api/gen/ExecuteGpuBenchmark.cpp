@@ -27,6 +27,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExecuteGpuBenchmark);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExecuteGpuBenchmark);
 
+    namespace
+    {
+      // Fields of ExecuteGpuBenchmark, indices in fieldNames()
+      constexpr std::size_t DurationMsField = 0;
+      constexpr std::size_t SystemSvCountDictField = 1;
+      constexpr std::size_t EchoCountField = 2;
+    }
+
 
     ExecuteGpuBenchmark::ExecuteGpuBenchmark()
       : CommandBase(CmdName, TargetId)
@@ -55,9 +63,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["DurationMs"])
-          && parse_json<std::map<std::string, int>>::is_valid(m_values["SystemSvCountDict"])
-          && parse_json<int>::is_valid(m_values["EchoCount"])
+          && parse_json<int>::is_valid(field(DurationMsField))
+          && parse_json<std::map<std::string, int>>::is_valid(field(SystemSvCountDictField))
+          && parse_json<int>::is_valid(field(EchoCountField))
         ;
 
     }
@@ -79,36 +87,41 @@ namespace Sdx
 
     int ExecuteGpuBenchmark::durationMs() const
     {
-      return parse_json<int>::parse(m_values["DurationMs"]);
+      return parse_json<int>::parse(field(DurationMsField));
     }
 
     void ExecuteGpuBenchmark::setDurationMs(int durationMs)
     {
-      m_values.AddMember("DurationMs", parse_json<int>::format(durationMs, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DurationMsField, parse_json<int>::format(durationMs, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, int> ExecuteGpuBenchmark::systemSvCountDict() const
     {
-      return parse_json<std::map<std::string, int>>::parse(m_values["SystemSvCountDict"]);
+      return fieldValue<std::map<std::string, int>>(SystemSvCountDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, int>> ExecuteGpuBenchmark::systemSvCountDictPtr() const
+    {
+      return sharedValue<std::map<std::string, int>>(SystemSvCountDictField);
     }
 
     void ExecuteGpuBenchmark::setSystemSvCountDict(const std::map<std::string, int>& systemSvCountDict)
     {
-      m_values.AddMember("SystemSvCountDict", parse_json<std::map<std::string, int>>::format(systemSvCountDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemSvCountDictField, parse_json<std::map<std::string, int>>::format(systemSvCountDict, m_values.GetAllocator()));
     }
 
 
 
     int ExecuteGpuBenchmark::echoCount() const
     {
-      return parse_json<int>::parse(m_values["EchoCount"]);
+      return parse_json<int>::parse(field(EchoCountField));
     }
 
     void ExecuteGpuBenchmark::setEchoCount(int echoCount)
     {
-      m_values.AddMember("EchoCount", parse_json<int>::format(echoCount, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EchoCountField, parse_json<int>::format(echoCount, m_values.GetAllocator()));
     }
 
 
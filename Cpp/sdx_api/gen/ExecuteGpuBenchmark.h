@@ -54,6 +54,7 @@ namespace Sdx
 
       // **** systemSvCountDict ****
       std::map<std::string, int> systemSvCountDict() const;
+      std::shared_ptr<const std::map<std::string, int>> systemSvCountDictPtr() const;
       void setSystemSvCountDict(const std::map<std::string, int>& systemSvCountDict);
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExecuteGpuBenchmarkResult);
 
+    namespace
+    {
+      // Fields of ExecuteGpuBenchmarkResult, indices in fieldNames()
+      constexpr std::size_t ScoreField = 0;
+    }
+
 
     ExecuteGpuBenchmarkResult::ExecuteGpuBenchmarkResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Score"])
+          && parse_json<double>::is_valid(field(ScoreField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     double ExecuteGpuBenchmarkResult::score() const
     {
-      return parse_json<double>::parse(m_values["Score"]);
+      return parse_json<double>::parse(field(ScoreField));
     }
 
     void ExecuteGpuBenchmarkResult::setScore(double score)
     {
-      m_values.AddMember("Score", parse_json<double>::format(score, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ScoreField, parse_json<double>::format(score, m_values.GetAllocator()));
     }
 
 
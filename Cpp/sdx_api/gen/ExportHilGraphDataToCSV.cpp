@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportHilGraphDataToCSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportHilGraphDataToCSV);
 
+    namespace
+    {
+      // Fields of ExportHilGraphDataToCSV, indices in fieldNames()
+      constexpr std::size_t PathField = 0;
+      constexpr std::size_t OverwritingField = 1;
+    }
+
 
     ExportHilGraphDataToCSV::ExportHilGraphDataToCSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<bool>::is_valid(m_values["Overwriting"])
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<bool>::is_valid(field(OverwritingField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string ExportHilGraphDataToCSV::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ExportHilGraphDataToCSV::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     bool ExportHilGraphDataToCSV::overwriting() const
     {
-      return parse_json<bool>::parse(m_values["Overwriting"]);
+      return parse_json<bool>::parse(field(OverwritingField));
     }
 
     void ExportHilGraphDataToCSV::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwritingField, parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
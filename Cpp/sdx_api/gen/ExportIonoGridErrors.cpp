@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportIonoGridErrors);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportIonoGridErrors);
 
+    namespace
+    {
+      // Fields of ExportIonoGridErrors, indices in fieldNames()
+      constexpr std::size_t OverwritingField = 0;
+      constexpr std::size_t PathField = 1;
+    }
+
 
     ExportIonoGridErrors::ExportIonoGridErrors()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Overwriting"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
+          && parse_json<bool>::is_valid(field(OverwritingField))
+          && parse_json<std::string>::is_valid(field(PathField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     bool ExportIonoGridErrors::overwriting() const
     {
-      return parse_json<bool>::parse(m_values["Overwriting"]);
+      return parse_json<bool>::parse(field(OverwritingField));
     }
 
     void ExportIonoGridErrors::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwritingField, parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportIonoGridErrors::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ExportIonoGridErrors::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
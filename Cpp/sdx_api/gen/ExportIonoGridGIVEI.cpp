@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportIonoGridGIVEI);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportIonoGridGIVEI);
 
+    namespace
+    {
+      // Fields of ExportIonoGridGIVEI, indices in fieldNames()
+      constexpr std::size_t OverwritingField = 0;
+      constexpr std::size_t PathField = 1;
+      constexpr std::size_t ServiceProviderField = 2;
+    }
+
 
     ExportIonoGridGIVEI::ExportIonoGridGIVEI()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Overwriting"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["ServiceProvider"])
+          && parse_json<bool>::is_valid(field(OverwritingField))
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<std::optional<std::string>>::is_valid(field(ServiceProviderField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     bool ExportIonoGridGIVEI::overwriting() const
     {
-      return parse_json<bool>::parse(m_values["Overwriting"]);
+      return parse_json<bool>::parse(field(OverwritingField));
     }
 
     void ExportIonoGridGIVEI::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwritingField, parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportIonoGridGIVEI::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ExportIonoGridGIVEI::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> ExportIonoGridGIVEI::serviceProvider() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::optional<std::string>>(ServiceProviderField);
     }
 
     void ExportIonoGridGIVEI::setServiceProvider(const std::optional<std::string>& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
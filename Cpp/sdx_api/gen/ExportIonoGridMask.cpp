@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportIonoGridMask);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportIonoGridMask);
 
+    namespace
+    {
+      // Fields of ExportIonoGridMask, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t OverwritingField = 1;
+      constexpr std::size_t PathField = 2;
+    }
+
 
     ExportIonoGridMask::ExportIonoGridMask()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<bool>::is_valid(m_values["Overwriting"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<bool>::is_valid(field(OverwritingField))
+          && parse_json<std::string>::is_valid(field(PathField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string ExportIonoGridMask::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void ExportIonoGridMask::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     bool ExportIonoGridMask::overwriting() const
     {
-      return parse_json<bool>::parse(m_values["Overwriting"]);
+      return parse_json<bool>::parse(field(OverwritingField));
     }
 
     void ExportIonoGridMask::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwritingField, parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportIonoGridMask::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ExportIonoGridMask::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
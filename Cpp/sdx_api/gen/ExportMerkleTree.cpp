@@ -26,6 +26,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportMerkleTree);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportMerkleTree);
 
+    namespace
+    {
+      // Fields of ExportMerkleTree, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t PublicKeyIndexesField = 1;
+      constexpr std::size_t FilePathField = 2;
+      constexpr std::size_t OverwriteFileField = 3;
+    }
+
 
     ExportMerkleTree::ExportMerkleTree()
       : CommandBase(CmdName, TargetId)
@@ -55,10 +64,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::vector<int>>::is_valid(m_values["PublicKeyIndexes"])
-          && parse_json<std::string>::is_valid(m_values["FilePath"])
-          && parse_json<bool>::is_valid(m_values["OverwriteFile"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::vector<int>>::is_valid(field(PublicKeyIndexesField))
+          && parse_json<std::string>::is_valid(field(FilePathField))
+          && parse_json<bool>::is_valid(field(OverwriteFileField))
         ;
 
     }
@@ -80,48 +89,53 @@ namespace Sdx
 
     std::string ExportMerkleTree::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void ExportMerkleTree::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> ExportMerkleTree::publicKeyIndexes() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["PublicKeyIndexes"]);
+      return fieldValue<std::vector<int>>(PublicKeyIndexesField);
+    }
+
+    std::shared_ptr<const std::vector<int>> ExportMerkleTree::publicKeyIndexesPtr() const
+    {
+      return sharedValue<std::vector<int>>(PublicKeyIndexesField);
     }
 
     void ExportMerkleTree::setPublicKeyIndexes(const std::vector<int>& publicKeyIndexes)
     {
-      m_values.AddMember("PublicKeyIndexes", parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PublicKeyIndexesField, parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportMerkleTree::filePath() const
     {
-      return parse_json<std::string>::parse(m_values["FilePath"]);
+      return fieldValue<std::string>(FilePathField);
     }
 
     void ExportMerkleTree::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilePathField, parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
 
     bool ExportMerkleTree::overwriteFile() const
     {
-      return parse_json<bool>::parse(m_values["OverwriteFile"]);
+      return parse_json<bool>::parse(field(OverwriteFileField));
     }
 
     void ExportMerkleTree::setOverwriteFile(bool overwriteFile)
     {
-      m_values.AddMember("OverwriteFile", parse_json<bool>::format(overwriteFile, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwriteFileField, parse_json<bool>::format(overwriteFile, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportMessageSequenceToCSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportMessageSequenceToCSV);
 
+    namespace
+    {
+      // Fields of ExportMessageSequenceToCSV, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t PathField = 1;
+      constexpr std::size_t OverwritingField = 2;
+    }
+
 
     ExportMessageSequenceToCSV::ExportMessageSequenceToCSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<bool>::is_valid(m_values["Overwriting"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<bool>::is_valid(field(OverwritingField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string ExportMessageSequenceToCSV::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void ExportMessageSequenceToCSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportMessageSequenceToCSV::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ExportMessageSequenceToCSV::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     bool ExportMessageSequenceToCSV::overwriting() const
     {
-      return parse_json<bool>::parse(m_values["Overwriting"]);
+      return parse_json<bool>::parse(field(OverwritingField));
     }
 
     void ExportMessageSequenceToCSV::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwritingField, parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
@@ -26,6 +26,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportSVAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportSVAntennaModel);
 
+    namespace
+    {
+      // Fields of ExportSVAntennaModel, indices in fieldNames()
+      constexpr std::size_t AntennaNameField = 0;
+      constexpr std::size_t SystemField = 1;
+      constexpr std::size_t FilePathField = 2;
+      constexpr std::size_t OverwritingField = 3;
+    }
+
 
     ExportSVAntennaModel::ExportSVAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -55,10 +64,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["AntennaName"])
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["FilePath"])
-          && parse_json<bool>::is_valid(m_values["Overwriting"])
+          && parse_json<std::string>::is_valid(field(AntennaNameField))
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(FilePathField))
+          && parse_json<bool>::is_valid(field(OverwritingField))
         ;
 
     }
@@ -80,48 +89,48 @@ namespace Sdx
 
     std::string ExportSVAntennaModel::antennaName() const
     {
-      return parse_json<std::string>::parse(m_values["AntennaName"]);
+      return fieldValue<std::string>(AntennaNameField);
     }
 
     void ExportSVAntennaModel::setAntennaName(const std::string& antennaName)
     {
-      m_values.AddMember("AntennaName", parse_json<std::string>::format(antennaName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaNameField, parse_json<std::string>::format(antennaName, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportSVAntennaModel::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void ExportSVAntennaModel::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportSVAntennaModel::filePath() const
     {
-      return parse_json<std::string>::parse(m_values["FilePath"]);
+      return fieldValue<std::string>(FilePathField);
     }
 
     void ExportSVAntennaModel::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilePathField, parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
 
     bool ExportSVAntennaModel::overwriting() const
     {
-      return parse_json<bool>::parse(m_values["Overwriting"]);
+      return parse_json<bool>::parse(field(OverwritingField));
     }
 
     void ExportSVAntennaModel::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwritingField, parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
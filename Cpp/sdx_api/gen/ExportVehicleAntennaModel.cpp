@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportVehicleAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportVehicleAntennaModel);
 
+    namespace
+    {
+      // Fields of ExportVehicleAntennaModel, indices in fieldNames()
+      constexpr std::size_t AntennaNameField = 0;
+      constexpr std::size_t FilePathField = 1;
+      constexpr std::size_t OverwritingField = 2;
+    }
+
 
     ExportVehicleAntennaModel::ExportVehicleAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["AntennaName"])
-          && parse_json<std::string>::is_valid(m_values["FilePath"])
-          && parse_json<bool>::is_valid(m_values["Overwriting"])
+          && parse_json<std::string>::is_valid(field(AntennaNameField))
+          && parse_json<std::string>::is_valid(field(FilePathField))
+          && parse_json<bool>::is_valid(field(OverwritingField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string ExportVehicleAntennaModel::antennaName() const
     {
-      return parse_json<std::string>::parse(m_values["AntennaName"]);
+      return fieldValue<std::string>(AntennaNameField);
     }
 
     void ExportVehicleAntennaModel::setAntennaName(const std::string& antennaName)
     {
-      m_values.AddMember("AntennaName", parse_json<std::string>::format(antennaName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaNameField, parse_json<std::string>::format(antennaName, m_values.GetAllocator()));
     }
 
 
 
     std::string ExportVehicleAntennaModel::filePath() const
     {
-      return parse_json<std::string>::parse(m_values["FilePath"]);
+      return fieldValue<std::string>(FilePathField);
     }
 
     void ExportVehicleAntennaModel::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilePathField, parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
 
     bool ExportVehicleAntennaModel::overwriting() const
     {
-      return parse_json<bool>::parse(m_values["Overwriting"]);
+      return parse_json<bool>::parse(field(OverwritingField));
     }
 
     void ExportVehicleAntennaModel::setOverwriting(bool overwriting)
     {
-      m_values.AddMember("Overwriting", parse_json<bool>::format(overwriting, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwritingField, parse_json<bool>::format(overwriting, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ExportWFAntenna);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ExportWFAntenna);
 
+    namespace
+    {
+      // Fields of ExportWFAntenna, indices in fieldNames()
+      constexpr std::size_t FilePathField = 0;
+      constexpr std::size_t OverwriteFileField = 1;
+    }
+
 
     ExportWFAntenna::ExportWFAntenna()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["FilePath"])
-          && parse_json<bool>::is_valid(m_values["OverwriteFile"])
+          && parse_json<std::string>::is_valid(field(FilePathField))
+          && parse_json<bool>::is_valid(field(OverwriteFileField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string ExportWFAntenna::filePath() const
     {
-      return parse_json<std::string>::parse(m_values["FilePath"]);
+      return fieldValue<std::string>(FilePathField);
     }
 
     void ExportWFAntenna::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilePathField, parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
 
     bool ExportWFAntenna::overwriteFile() const
     {
-      return parse_json<bool>::parse(m_values["OverwriteFile"]);
+      return parse_json<bool>::parse(field(OverwriteFileField));
     }
 
     void ExportWFAntenna::setOverwriteFile(bool overwriteFile)
     {
-      m_values.AddMember("OverwriteFile", parse_json<bool>::format(overwriteFile, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwriteFileField, parse_json<bool>::format(overwriteFile, m_values.GetAllocator()));
     }
 
 
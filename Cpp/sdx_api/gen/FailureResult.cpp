@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(FailureResult);
 
+    namespace
+    {
+      // Fields of FailureResult, indices in fieldNames()
+      constexpr std::size_t ErrorMsgField = 0;
+    }
+
 
     FailureResult::FailureResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ErrorMsg"])
+          && parse_json<std::string>::is_valid(field(ErrorMsgField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string FailureResult::errorMsg() const
     {
-      return parse_json<std::string>::parse(m_values["ErrorMsg"]);
+      return parse_json<std::string>::parse(field(ErrorMsgField));
     }
 
     void FailureResult::setErrorMsg(const std::string& errorMsg)
     {
-      m_values.AddMember("ErrorMsg", parse_json<std::string>::format(errorMsg, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ErrorMsgField, parse_json<std::string>::format(errorMsg, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetActiveDataSetResult);
 
+    namespace
+    {
+      // Fields of GetActiveDataSetResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t DataSetNameField = 1;
+    }
+
 
     GetActiveDataSetResult::GetActiveDataSetResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetActiveDataSetResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetActiveDataSetResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string GetActiveDataSetResult::dataSetName() const
     {
-      return parse_json<std::string>::parse(m_values["DataSetName"]);
+      return fieldValue<std::string>(DataSetNameField);
     }
 
     void GetActiveDataSetResult::setDataSetName(const std::string& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::string>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAgeOfDataBeiDouResult);
 
+    namespace
+    {
+      // Fields of GetAgeOfDataBeiDouResult, indices in fieldNames()
+      constexpr std::size_t ClockField = 0;
+      constexpr std::size_t EphemerisField = 1;
+      constexpr std::size_t OverrideRinexField = 2;
+    }
+
 
     GetAgeOfDataBeiDouResult::GetAgeOfDataBeiDouResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Clock"])
-          && parse_json<int>::is_valid(m_values["Ephemeris"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["OverrideRinex"])
+          && parse_json<int>::is_valid(field(ClockField))
+          && parse_json<int>::is_valid(field(EphemerisField))
+          && parse_json<std::optional<bool>>::is_valid(field(OverrideRinexField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     int GetAgeOfDataBeiDouResult::clock() const
     {
-      return parse_json<int>::parse(m_values["Clock"]);
+      return parse_json<int>::parse(field(ClockField));
     }
 
     void GetAgeOfDataBeiDouResult::setClock(int clock)
     {
-      m_values.AddMember("Clock", parse_json<int>::format(clock, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ClockField, parse_json<int>::format(clock, m_values.GetAllocator()));
     }
 
 
 
     int GetAgeOfDataBeiDouResult::ephemeris() const
     {
-      return parse_json<int>::parse(m_values["Ephemeris"]);
+      return parse_json<int>::parse(field(EphemerisField));
     }
 
     void GetAgeOfDataBeiDouResult::setEphemeris(int ephemeris)
     {
-      m_values.AddMember("Ephemeris", parse_json<int>::format(ephemeris, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EphemerisField, parse_json<int>::format(ephemeris, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> GetAgeOfDataBeiDouResult::overrideRinex() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["OverrideRinex"]);
+      return parse_json<std::optional<bool>>::parse(field(OverrideRinexField));
     }
 
     void GetAgeOfDataBeiDouResult::setOverrideRinex(const std::optional<bool>& overrideRinex)
     {
-      m_values.AddMember("OverrideRinex", parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverrideRinexField, parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()));
     }
 
 
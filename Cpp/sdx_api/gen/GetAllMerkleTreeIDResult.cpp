@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllMerkleTreeIDResult);
 
+    namespace
+    {
+      // Fields of GetAllMerkleTreeIDResult, indices in fieldNames()
+      constexpr std::size_t IdsField = 0;
+    }
+
 
     GetAllMerkleTreeIDResult::GetAllMerkleTreeIDResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["Ids"])
+          && parse_json<std::vector<std::string>>::is_valid(field(IdsField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<std::string> GetAllMerkleTreeIDResult::ids() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["Ids"]);
+      return fieldValue<std::vector<std::string>>(IdsField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetAllMerkleTreeIDResult::idsPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(IdsField);
     }
 
     void GetAllMerkleTreeIDResult::setIds(const std::vector<std::string>& ids)
     {
-      m_values.AddMember("Ids", parse_json<std::vector<std::string>>::format(ids, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdsField, parse_json<std::vector<std::string>>::format(ids, m_values.GetAllocator()));
     }
 
 
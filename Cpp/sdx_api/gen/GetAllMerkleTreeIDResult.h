@@ -47,6 +47,7 @@ namespace Sdx
 
       // **** ids ****
       std::vector<std::string> ids() const;
+      std::shared_ptr<const std::vector<std::string>> idsPtr() const;
       void setIds(const std::vector<std::string>& ids);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetAllMerkleTreeIDResult);
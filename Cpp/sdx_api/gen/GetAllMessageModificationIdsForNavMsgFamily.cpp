@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetAllMessageModificationIdsForNavMsgFamily);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllMessageModificationIdsForNavMsgFamily);
 
+    namespace
+    {
+      // Fields of GetAllMessageModificationIdsForNavMsgFamily, indices in fieldNames()
+      constexpr std::size_t NavMsgFamilyField = 0;
+      constexpr std::size_t SvIdField = 1;
+    }
+
 
     GetAllMessageModificationIdsForNavMsgFamily::GetAllMessageModificationIdsForNavMsgFamily()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["NavMsgFamily"])
-          && parse_json<int>::is_valid(m_values["SvId"])
+          && parse_json<std::string>::is_valid(field(NavMsgFamilyField))
+          && parse_json<int>::is_valid(field(SvIdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetAllMessageModificationIdsForNavMsgFamily::navMsgFamily() const
     {
-      return parse_json<std::string>::parse(m_values["NavMsgFamily"]);
+      return fieldValue<std::string>(NavMsgFamilyField);
     }
 
     void GetAllMessageModificationIdsForNavMsgFamily::setNavMsgFamily(const std::string& navMsgFamily)
     {
-      m_values.AddMember("NavMsgFamily", parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NavMsgFamilyField, parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()));
     }
 
 
 
     int GetAllMessageModificationIdsForNavMsgFamily::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetAllMessageModificationIdsForNavMsgFamily::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
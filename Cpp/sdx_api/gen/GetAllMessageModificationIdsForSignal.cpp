@@ -27,6 +27,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetAllMessageModificationIdsForSignal);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllMessageModificationIdsForSignal);
 
+    namespace
+    {
+      // Fields of GetAllMessageModificationIdsForSignal, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t SvIdField = 1;
+    }
+
 
     GetAllMessageModificationIdsForSignal::GetAllMessageModificationIdsForSignal()
       : CommandBase(CmdName, TargetId)
@@ -54,8 +61,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["SvId"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(SvIdField))
         ;
 
     }
@@ -77,24 +84,24 @@ namespace Sdx
 
     std::string GetAllMessageModificationIdsForSignal::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetAllMessageModificationIdsForSignal::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int GetAllMessageModificationIdsForSignal::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetAllMessageModificationIdsForSignal::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetAllMultipathForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllMultipathForSV);
 
+    namespace
+    {
+      // Fields of GetAllMultipathForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+    }
+
 
     GetAllMultipathForSV::GetAllMultipathForSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetAllMultipathForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetAllMultipathForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetAllMultipathForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetAllMultipathForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
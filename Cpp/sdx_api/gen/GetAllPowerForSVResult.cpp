@@ -32,6 +32,16 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllPowerForSVResult);
 
+    namespace
+    {
+      // Fields of GetAllPowerForSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t NominalPowerField = 2;
+      constexpr std::size_t GlobalOffsetField = 3;
+      constexpr std::size_t SignalPowerDictField = 4;
+    }
+
 
     GetAllPowerForSVResult::GetAllPowerForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -79,11 +89,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<double>::is_valid(m_values["NominalPower"])
-          && parse_json<double>::is_valid(m_values["GlobalOffset"])
-          && parse_json<std::map<std::string, Sdx::SignalPower>>::is_valid(m_values["SignalPowerDict"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<double>::is_valid(field(NominalPowerField))
+          && parse_json<double>::is_valid(field(GlobalOffsetField))
+          && parse_json<std::map<std::string, Sdx::SignalPower>>::is_valid(field(SignalPowerDictField))
         ;
 
     }
@@ -99,60 +109,65 @@ namespace Sdx
 
     std::string GetAllPowerForSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetAllPowerForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetAllPowerForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetAllPowerForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     double GetAllPowerForSVResult::nominalPower() const
     {
-      return parse_json<double>::parse(m_values["NominalPower"]);
+      return parse_json<double>::parse(field(NominalPowerField));
     }
 
     void GetAllPowerForSVResult::setNominalPower(double nominalPower)
     {
-      m_values.AddMember("NominalPower", parse_json<double>::format(nominalPower, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NominalPowerField, parse_json<double>::format(nominalPower, m_values.GetAllocator()));
     }
 
 
 
     double GetAllPowerForSVResult::globalOffset() const
     {
-      return parse_json<double>::parse(m_values["GlobalOffset"]);
+      return parse_json<double>::parse(field(GlobalOffsetField));
     }
 
     void GetAllPowerForSVResult::setGlobalOffset(double globalOffset)
     {
-      m_values.AddMember("GlobalOffset", parse_json<double>::format(globalOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GlobalOffsetField, parse_json<double>::format(globalOffset, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, Sdx::SignalPower> GetAllPowerForSVResult::signalPowerDict() const
     {
-      return parse_json<std::map<std::string, Sdx::SignalPower>>::parse(m_values["SignalPowerDict"]);
+      return fieldValue<std::map<std::string, Sdx::SignalPower>>(SignalPowerDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, Sdx::SignalPower>> GetAllPowerForSVResult::signalPowerDictPtr() const
+    {
+      return sharedValue<std::map<std::string, Sdx::SignalPower>>(SignalPowerDictField);
     }
 
     void GetAllPowerForSVResult::setSignalPowerDict(const std::map<std::string, Sdx::SignalPower>& signalPowerDict)
     {
-      m_values.AddMember("SignalPowerDict", parse_json<std::map<std::string, Sdx::SignalPower>>::format(signalPowerDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalPowerDictField, parse_json<std::map<std::string, Sdx::SignalPower>>::format(signalPowerDict, m_values.GetAllocator()));
     }
 
 
@@ -78,6 +78,7 @@ namespace Sdx
 
       // **** signalPowerDict ****
       std::map<std::string, Sdx::SignalPower> signalPowerDict() const;
+      std::shared_ptr<const std::map<std::string, Sdx::SignalPower>> signalPowerDictPtr() const;
       void setSignalPowerDict(const std::map<std::string, Sdx::SignalPower>& signalPowerDict);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetAllPowerForSVResult);
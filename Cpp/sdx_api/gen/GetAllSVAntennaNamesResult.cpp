@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllSVAntennaNamesResult);
 
+    namespace
+    {
+      // Fields of GetAllSVAntennaNamesResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t AntennaNamesField = 1;
+    }
+
 
     GetAllSVAntennaNamesResult::GetAllSVAntennaNamesResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["AntennaNames"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<std::string>>::is_valid(field(AntennaNamesField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetAllSVAntennaNamesResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetAllSVAntennaNamesResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetAllSVAntennaNamesResult::antennaNames() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["AntennaNames"]);
+      return fieldValue<std::vector<std::string>>(AntennaNamesField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetAllSVAntennaNamesResult::antennaNamesPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(AntennaNamesField);
     }
 
     void GetAllSVAntennaNamesResult::setAntennaNames(const std::vector<std::string>& antennaNames)
     {
-      m_values.AddMember("AntennaNames", parse_json<std::vector<std::string>>::format(antennaNames, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaNamesField, parse_json<std::vector<std::string>>::format(antennaNames, m_values.GetAllocator()));
     }
 
 
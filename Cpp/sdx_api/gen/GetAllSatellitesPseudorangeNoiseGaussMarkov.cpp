@@ -26,6 +26,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetAllSatellitesPseudorangeNoiseGaussMarkov);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllSatellitesPseudorangeNoiseGaussMarkov);
 
+    namespace
+    {
+      // Fields of GetAllSatellitesPseudorangeNoiseGaussMarkov, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ProcessField = 1;
+    }
+
 
     GetAllSatellitesPseudorangeNoiseGaussMarkov::GetAllSatellitesPseudorangeNoiseGaussMarkov()
       : CommandBase(CmdName, TargetId)
@@ -53,8 +60,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Process"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(ProcessField))
         ;
 
     }
@@ -76,24 +83,24 @@ namespace Sdx
 
     std::string GetAllSatellitesPseudorangeNoiseGaussMarkov::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetAllSatellitesPseudorangeNoiseGaussMarkov::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetAllSatellitesPseudorangeNoiseGaussMarkov::process() const
     {
-      return parse_json<int>::parse(m_values["Process"]);
+      return parse_json<int>::parse(field(ProcessField));
     }
 
     void GetAllSatellitesPseudorangeNoiseGaussMarkov::setProcess(int process)
     {
-      m_values.AddMember("Process", parse_json<int>::format(process, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ProcessField, parse_json<int>::format(process, m_values.GetAllocator()));
     }
 
 
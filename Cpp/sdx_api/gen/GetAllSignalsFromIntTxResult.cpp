@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllSignalsFromIntTxResult);
 
+    namespace
+    {
+      // Fields of GetAllSignalsFromIntTxResult, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t IdsSignalField = 1;
+    }
+
 
     GetAllSignalsFromIntTxResult::GetAllSignalsFromIntTxResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["IdsSignal"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::vector<std::string>>::is_valid(field(IdsSignalField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetAllSignalsFromIntTxResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetAllSignalsFromIntTxResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetAllSignalsFromIntTxResult::idsSignal() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["IdsSignal"]);
+      return fieldValue<std::vector<std::string>>(IdsSignalField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetAllSignalsFromIntTxResult::idsSignalPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(IdsSignalField);
     }
 
     void GetAllSignalsFromIntTxResult::setIdsSignal(const std::vector<std::string>& idsSignal)
     {
-      m_values.AddMember("IdsSignal", parse_json<std::vector<std::string>>::format(idsSignal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdsSignalField, parse_json<std::vector<std::string>>::format(idsSignal, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetAllVehicleAntennaNamesResult);
 
+    namespace
+    {
+      // Fields of GetAllVehicleAntennaNamesResult, indices in fieldNames()
+      constexpr std::size_t AntennaNamesField = 0;
+    }
+
 
     GetAllVehicleAntennaNamesResult::GetAllVehicleAntennaNamesResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["AntennaNames"])
+          && parse_json<std::vector<std::string>>::is_valid(field(AntennaNamesField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<std::string> GetAllVehicleAntennaNamesResult::antennaNames() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["AntennaNames"]);
+      return fieldValue<std::vector<std::string>>(AntennaNamesField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetAllVehicleAntennaNamesResult::antennaNamesPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(AntennaNamesField);
     }
 
     void GetAllVehicleAntennaNamesResult::setAntennaNames(const std::vector<std::string>& antennaNames)
     {
-      m_values.AddMember("AntennaNames", parse_json<std::vector<std::string>>::format(antennaNames, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaNamesField, parse_json<std::vector<std::string>>::format(antennaNames, m_values.GetAllocator()));
     }
 
 
@@ -47,6 +47,7 @@ namespace Sdx
 
       // **** antennaNames ****
       std::vector<std::string> antennaNames() const;
+      std::shared_ptr<const std::vector<std::string>> antennaNamesPtr() const;
       void setAntennaNames(const std::vector<std::string>& antennaNames);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetAllVehicleAntennaNamesResult);
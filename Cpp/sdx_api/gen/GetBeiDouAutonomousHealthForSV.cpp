@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetBeiDouAutonomousHealthForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetBeiDouAutonomousHealthForSV);
 
+    namespace
+    {
+      // Fields of GetBeiDouAutonomousHealthForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t DataSetNameField = 1;
+    }
+
 
     GetBeiDouAutonomousHealthForSV::GetBeiDouAutonomousHealthForSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int GetBeiDouAutonomousHealthForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetBeiDouAutonomousHealthForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetBeiDouAutonomousHealthForSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetBeiDouAutonomousHealthForSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetBeiDouCNavHealthInfoForSVResult);
 
+    namespace
+    {
+      // Fields of GetBeiDouCNavHealthInfoForSVResult, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t HealthField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     GetBeiDouCNavHealthInfoForSVResult::GetBeiDouCNavHealthInfoForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["Health"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(HealthField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     int GetBeiDouCNavHealthInfoForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetBeiDouCNavHealthInfoForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetBeiDouCNavHealthInfoForSVResult::health() const
     {
-      return parse_json<int>::parse(m_values["Health"]);
+      return parse_json<int>::parse(field(HealthField));
     }
 
     void GetBeiDouCNavHealthInfoForSVResult::setHealth(int health)
     {
-      m_values.AddMember("Health", parse_json<int>::format(health, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HealthField, parse_json<int>::format(health, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetBeiDouCNavHealthInfoForSVResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetBeiDouCNavHealthInfoForSVResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
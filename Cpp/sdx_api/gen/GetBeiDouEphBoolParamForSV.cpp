@@ -33,6 +33,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetBeiDouEphBoolParamForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetBeiDouEphBoolParamForSV);
 
+    namespace
+    {
+      // Fields of GetBeiDouEphBoolParamForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t ParamNameField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     GetBeiDouEphBoolParamForSV::GetBeiDouEphBoolParamForSV()
       : CommandBase(CmdName, TargetId)
@@ -61,9 +69,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -87,36 +95,36 @@ namespace Sdx
 
     int GetBeiDouEphBoolParamForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetBeiDouEphBoolParamForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetBeiDouEphBoolParamForSV::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetBeiDouEphBoolParamForSV::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetBeiDouEphBoolParamForSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetBeiDouEphBoolParamForSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
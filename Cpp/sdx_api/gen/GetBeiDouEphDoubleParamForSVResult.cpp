@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetBeiDouEphDoubleParamForSVResult);
 
+    namespace
+    {
+      // Fields of GetBeiDouEphDoubleParamForSVResult, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t ParamNameField = 1;
+      constexpr std::size_t ValField = 2;
+      constexpr std::size_t DataSetNameField = 3;
+    }
+
 
     GetBeiDouEphDoubleParamForSVResult::GetBeiDouEphDoubleParamForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && parse_json<double>::is_valid(m_values["Val"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && parse_json<double>::is_valid(field(ValField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -89,48 +98,48 @@ namespace Sdx
 
     int GetBeiDouEphDoubleParamForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetBeiDouEphDoubleParamForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetBeiDouEphDoubleParamForSVResult::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetBeiDouEphDoubleParamForSVResult::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
 
     double GetBeiDouEphDoubleParamForSVResult::val() const
     {
-      return parse_json<double>::parse(m_values["Val"]);
+      return parse_json<double>::parse(field(ValField));
     }
 
     void GetBeiDouEphDoubleParamForSVResult::setVal(double val)
     {
-      m_values.AddMember("Val", parse_json<double>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ValField, parse_json<double>::format(val, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetBeiDouEphDoubleParamForSVResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetBeiDouEphDoubleParamForSVResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -30,6 +30,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetBeiDouEphemerisBoolParams);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetBeiDouEphemerisBoolParams);
 
+    namespace
+    {
+      // Fields of GetBeiDouEphemerisBoolParams, indices in fieldNames()
+      constexpr std::size_t ParamNameField = 0;
+      constexpr std::size_t DataSetNameField = 1;
+    }
+
 
     GetBeiDouEphemerisBoolParams::GetBeiDouEphemerisBoolParams()
       : CommandBase(CmdName, TargetId)
@@ -57,8 +64,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -82,24 +89,24 @@ namespace Sdx
 
     std::string GetBeiDouEphemerisBoolParams::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetBeiDouEphemerisBoolParams::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetBeiDouEphemerisBoolParams::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetBeiDouEphemerisBoolParams::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
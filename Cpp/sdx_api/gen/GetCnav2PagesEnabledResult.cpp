@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetCnav2PagesEnabledResult);
 
+    namespace
+    {
+      // Fields of GetCnav2PagesEnabledResult, indices in fieldNames()
+      constexpr std::size_t MessagesField = 0;
+    }
+
 
     GetCnav2PagesEnabledResult::GetCnav2PagesEnabledResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<int>>::is_valid(m_values["Messages"])
+          && parse_json<std::vector<int>>::is_valid(field(MessagesField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<int> GetCnav2PagesEnabledResult::messages() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Messages"]);
+      return fieldValue<std::vector<int>>(MessagesField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetCnav2PagesEnabledResult::messagesPtr() const
+    {
+      return sharedValue<std::vector<int>>(MessagesField);
     }
 
     void GetCnav2PagesEnabledResult::setMessages(const std::vector<int>& messages)
     {
-      m_values.AddMember("Messages", parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MessagesField, parse_json<std::vector<int>>::format(messages, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetComputerSystemTimeSinceEpochAtPps0Result);
 
+    namespace
+    {
+      // Fields of GetComputerSystemTimeSinceEpochAtPps0Result, indices in fieldNames()
+      constexpr std::size_t MillisecondsField = 0;
+    }
+
 
     GetComputerSystemTimeSinceEpochAtPps0Result::GetComputerSystemTimeSinceEpochAtPps0Result()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Milliseconds"])
+          && parse_json<double>::is_valid(field(MillisecondsField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     double GetComputerSystemTimeSinceEpochAtPps0Result::milliseconds() const
     {
-      return parse_json<double>::parse(m_values["Milliseconds"]);
+      return parse_json<double>::parse(field(MillisecondsField));
     }
 
     void GetComputerSystemTimeSinceEpochAtPps0Result::setMilliseconds(double milliseconds)
     {
-      m_values.AddMember("Milliseconds", parse_json<double>::format(milliseconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MillisecondsField, parse_json<double>::format(milliseconds, m_values.GetAllocator()));
     }
 
 
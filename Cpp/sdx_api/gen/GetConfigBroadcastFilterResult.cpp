@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetConfigBroadcastFilterResult);
 
+    namespace
+    {
+      // Fields of GetConfigBroadcastFilterResult, indices in fieldNames()
+      constexpr std::size_t FilterField = 0;
+    }
+
 
     GetConfigBroadcastFilterResult::GetConfigBroadcastFilterResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<Sdx::ConfigFilter>>::is_valid(m_values["Filter"])
+          && parse_json<std::vector<Sdx::ConfigFilter>>::is_valid(field(FilterField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<Sdx::ConfigFilter> GetConfigBroadcastFilterResult::filter() const
     {
-      return parse_json<std::vector<Sdx::ConfigFilter>>::parse(m_values["Filter"]);
+      return fieldValue<std::vector<Sdx::ConfigFilter>>(FilterField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::ConfigFilter>> GetConfigBroadcastFilterResult::filterPtr() const
+    {
+      return sharedValue<std::vector<Sdx::ConfigFilter>>(FilterField);
     }
 
     void GetConfigBroadcastFilterResult::setFilter(const std::vector<Sdx::ConfigFilter>& filter)
     {
-      m_values.AddMember("Filter", parse_json<std::vector<Sdx::ConfigFilter>>::format(filter, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilterField, parse_json<std::vector<Sdx::ConfigFilter>>::format(filter, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetConfigBroadcastOnStartResult);
 
+    namespace
+    {
+      // Fields of GetConfigBroadcastOnStartResult, indices in fieldNames()
+      constexpr std::size_t BroadcastOnStartField = 0;
+    }
+
 
     GetConfigBroadcastOnStartResult::GetConfigBroadcastOnStartResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["BroadcastOnStart"])
+          && parse_json<bool>::is_valid(field(BroadcastOnStartField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool GetConfigBroadcastOnStartResult::broadcastOnStart() const
     {
-      return parse_json<bool>::parse(m_values["BroadcastOnStart"]);
+      return parse_json<bool>::parse(field(BroadcastOnStartField));
     }
 
     void GetConfigBroadcastOnStartResult::setBroadcastOnStart(bool broadcastOnStart)
     {
-      m_values.AddMember("BroadcastOnStart", parse_json<bool>::format(broadcastOnStart, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BroadcastOnStartField, parse_json<bool>::format(broadcastOnStart, m_values.GetAllocator()));
     }
 
 
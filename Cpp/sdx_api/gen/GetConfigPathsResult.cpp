@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetConfigPathsResult);
 
+    namespace
+    {
+      // Fields of GetConfigPathsResult, indices in fieldNames()
+      constexpr std::size_t PathsField = 0;
+    }
+
 
     GetConfigPathsResult::GetConfigPathsResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["Paths"])
+          && parse_json<std::vector<std::string>>::is_valid(field(PathsField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<std::string> GetConfigPathsResult::paths() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["Paths"]);
+      return fieldValue<std::vector<std::string>>(PathsField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetConfigPathsResult::pathsPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(PathsField);
     }
 
     void GetConfigPathsResult::setPaths(const std::vector<std::string>& paths)
     {
-      m_values.AddMember("Paths", parse_json<std::vector<std::string>>::format(paths, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathsField, parse_json<std::vector<std::string>>::format(paths, m_values.GetAllocator()));
     }
 
 
@@ -47,6 +47,7 @@ namespace Sdx
 
       // **** paths ****
       std::vector<std::string> paths() const;
+      std::shared_ptr<const std::vector<std::string>> pathsPtr() const;
       void setPaths(const std::vector<std::string>& paths);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetConfigPathsResult);
@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetConstellationParameterForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetConstellationParameterForEachSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ParamNameField = 1;
+      constexpr std::size_t ValField = 2;
+      constexpr std::size_t DataSetNameField = 3;
+    }
+
 
     GetConstellationParameterForEachSVResult::GetConstellationParameterForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -132,10 +141,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && (parse_json<std::vector<double>>::is_valid(m_values["Val"]) || parse_json<std::vector<int>>::is_valid(m_values["Val"]) || parse_json<std::vector<bool>>::is_valid(m_values["Val"]))
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && (parse_json<std::vector<double>>::is_valid(field(ValField)) || parse_json<std::vector<int>>::is_valid(field(ValField)) || parse_json<std::vector<bool>>::is_valid(field(ValField)))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -151,24 +160,24 @@ namespace Sdx
 
     std::string GetConstellationParameterForEachSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetConstellationParameterForEachSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string GetConstellationParameterForEachSVResult::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetConstellationParameterForEachSVResult::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
@@ -176,25 +185,25 @@ namespace Sdx
     template<typename Type>
     Type GetConstellationParameterForEachSVResult::val() const
     {
-      return parse_json<Type>::parse(m_values["Val"]);
+      return parse_json<Type>::parse(field(ValField));
     }
 
     template<typename Type>
     void GetConstellationParameterForEachSVResult::setVal(Type val)
     {
-      m_values.AddMember("Val", parse_json<Type>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ValField, parse_json<Type>::format(val, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetConstellationParameterForEachSVResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetConstellationParameterForEachSVResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -26,6 +26,16 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetConstellationParameterForSVResult);
 
+    namespace
+    {
+      // Fields of GetConstellationParameterForSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t ParamNameField = 2;
+      constexpr std::size_t ValField = 3;
+      constexpr std::size_t DataSetNameField = 4;
+    }
+
 
     GetConstellationParameterForSVResult::GetConstellationParameterForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -139,11 +149,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && (parse_json<double>::is_valid(m_values["Val"]) || parse_json<int>::is_valid(m_values["Val"]) || parse_json<bool>::is_valid(m_values["Val"]))
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && (parse_json<double>::is_valid(field(ValField)) || parse_json<int>::is_valid(field(ValField)) || parse_json<bool>::is_valid(field(ValField)))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -159,36 +169,36 @@ namespace Sdx
 
     std::string GetConstellationParameterForSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetConstellationParameterForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetConstellationParameterForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetConstellationParameterForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetConstellationParameterForSVResult::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetConstellationParameterForSVResult::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
@@ -196,25 +206,25 @@ namespace Sdx
     template<typename Type>
     Type GetConstellationParameterForSVResult::val() const
     {
-      return parse_json<Type>::parse(m_values["Val"]);
+      return parse_json<Type>::parse(field(ValField));
     }
 
     template<typename Type>
     void GetConstellationParameterForSVResult::setVal(Type val)
     {
-      m_values.AddMember("Val", parse_json<Type>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ValField, parse_json<Type>::format(val, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetConstellationParameterForSVResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetConstellationParameterForSVResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetCurrentConfigPathResult);
 
+    namespace
+    {
+      // Fields of GetCurrentConfigPathResult, indices in fieldNames()
+      constexpr std::size_t ConfigPathField = 0;
+    }
+
 
     GetCurrentConfigPathResult::GetCurrentConfigPathResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ConfigPath"])
+          && parse_json<std::string>::is_valid(field(ConfigPathField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetCurrentConfigPathResult::configPath() const
     {
-      return parse_json<std::string>::parse(m_values["ConfigPath"]);
+      return fieldValue<std::string>(ConfigPathField);
     }
 
     void GetCurrentConfigPathResult::setConfigPath(const std::string& configPath)
     {
-      m_values.AddMember("ConfigPath", parse_json<std::string>::format(configPath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ConfigPathField, parse_json<std::string>::format(configPath, m_values.GetAllocator()));
     }
 
 
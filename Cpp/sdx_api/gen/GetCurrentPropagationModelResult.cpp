@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetCurrentPropagationModelResult);
 
+    namespace
+    {
+      // Fields of GetCurrentPropagationModelResult, indices in fieldNames()
+      constexpr std::size_t ModelField = 0;
+    }
+
 
     GetCurrentPropagationModelResult::GetCurrentPropagationModelResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::PropagationModelType>::is_valid(m_values["Model"])
+          && parse_json<Sdx::PropagationModelType>::is_valid(field(ModelField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     Sdx::PropagationModelType GetCurrentPropagationModelResult::model() const
     {
-      return parse_json<Sdx::PropagationModelType>::parse(m_values["Model"]);
+      return parse_json<Sdx::PropagationModelType>::parse(field(ModelField));
     }
 
     void GetCurrentPropagationModelResult::setModel(const Sdx::PropagationModelType& model)
     {
-      m_values.AddMember("Model", parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModelField, parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetDataSetAssignation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetDataSetAssignation);
 
+    namespace
+    {
+      // Fields of GetDataSetAssignation, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t DataSetTypeField = 1;
+    }
+
 
     GetDataSetAssignation::GetDataSetAssignation()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["DataSetType"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(DataSetTypeField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetDataSetAssignation::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetDataSetAssignation::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string GetDataSetAssignation::dataSetType() const
     {
-      return parse_json<std::string>::parse(m_values["DataSetType"]);
+      return fieldValue<std::string>(DataSetTypeField);
     }
 
     void GetDataSetAssignation::setDataSetType(const std::string& dataSetType)
     {
-      m_values.AddMember("DataSetType", parse_json<std::string>::format(dataSetType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetTypeField, parse_json<std::string>::format(dataSetType, m_values.GetAllocator()));
     }
 
 
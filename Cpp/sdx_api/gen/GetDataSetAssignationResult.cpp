@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetDataSetAssignationResult);
 
+    namespace
+    {
+      // Fields of GetDataSetAssignationResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t DataSetTypeField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     GetDataSetAssignationResult::GetDataSetAssignationResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["DataSetType"])
-          && parse_json<std::string>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(DataSetTypeField))
+          && parse_json<std::string>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     std::string GetDataSetAssignationResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetDataSetAssignationResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string GetDataSetAssignationResult::dataSetType() const
     {
-      return parse_json<std::string>::parse(m_values["DataSetType"]);
+      return fieldValue<std::string>(DataSetTypeField);
     }
 
     void GetDataSetAssignationResult::setDataSetType(const std::string& dataSetType)
     {
-      m_values.AddMember("DataSetType", parse_json<std::string>::format(dataSetType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetTypeField, parse_json<std::string>::format(dataSetType, m_values.GetAllocator()));
     }
 
 
 
     std::string GetDataSetAssignationResult::dataSetName() const
     {
-      return parse_json<std::string>::parse(m_values["DataSetName"]);
+      return fieldValue<std::string>(DataSetNameField);
     }
 
     void GetDataSetAssignationResult::setDataSetName(const std::string& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::string>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
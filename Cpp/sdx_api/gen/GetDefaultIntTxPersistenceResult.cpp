@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetDefaultIntTxPersistenceResult);
 
+    namespace
+    {
+      // Fields of GetDefaultIntTxPersistenceResult, indices in fieldNames()
+      constexpr std::size_t DefaultValueField = 0;
+    }
+
 
     GetDefaultIntTxPersistenceResult::GetDefaultIntTxPersistenceResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["DefaultValue"])
+          && parse_json<bool>::is_valid(field(DefaultValueField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool GetDefaultIntTxPersistenceResult::defaultValue() const
     {
-      return parse_json<bool>::parse(m_values["DefaultValue"]);
+      return parse_json<bool>::parse(field(DefaultValueField));
     }
 
     void GetDefaultIntTxPersistenceResult::setDefaultValue(bool defaultValue)
     {
-      m_values.AddMember("DefaultValue", parse_json<bool>::format(defaultValue, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DefaultValueField, parse_json<bool>::format(defaultValue, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetDefaultVehicleAntennaModelResult);
 
+    namespace
+    {
+      // Fields of GetDefaultVehicleAntennaModelResult, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+    }
+
 
     GetDefaultVehicleAntennaModelResult::GetDefaultVehicleAntennaModelResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
+          && parse_json<std::string>::is_valid(field(NameField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetDefaultVehicleAntennaModelResult::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void GetDefaultVehicleAntennaModelResult::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetDurationResult);
 
+    namespace
+    {
+      // Fields of GetDurationResult, indices in fieldNames()
+      constexpr std::size_t SecondField = 0;
+    }
+
 
     GetDurationResult::GetDurationResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Second"])
+          && parse_json<int>::is_valid(field(SecondField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetDurationResult::second() const
     {
-      return parse_json<int>::parse(m_values["Second"]);
+      return parse_json<int>::parse(field(SecondField));
     }
 
     void GetDurationResult::setSecond(int second)
     {
-      m_values.AddMember("Second", parse_json<int>::format(second, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SecondField, parse_json<int>::format(second, m_values.GetAllocator()));
     }
 
 
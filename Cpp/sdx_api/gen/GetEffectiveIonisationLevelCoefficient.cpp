@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetEffectiveIonisationLevelCoefficient);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetEffectiveIonisationLevelCoefficient);
 
+    namespace
+    {
+      // Fields of GetEffectiveIonisationLevelCoefficient, indices in fieldNames()
+      constexpr std::size_t IndexField = 0;
+    }
+
 
     GetEffectiveIonisationLevelCoefficient::GetEffectiveIonisationLevelCoefficient()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Index"])
+          && parse_json<int>::is_valid(field(IndexField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int GetEffectiveIonisationLevelCoefficient::index() const
     {
-      return parse_json<int>::parse(m_values["Index"]);
+      return parse_json<int>::parse(field(IndexField));
     }
 
     void GetEffectiveIonisationLevelCoefficient::setIndex(int index)
     {
-      m_values.AddMember("Index", parse_json<int>::format(index, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexField, parse_json<int>::format(index, m_values.GetAllocator()));
     }
 
 
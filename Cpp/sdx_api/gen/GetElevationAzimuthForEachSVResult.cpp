@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetElevationAzimuthForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetElevationAzimuthForEachSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ElevationAzimuthsField = 1;
+    }
+
 
     GetElevationAzimuthForEachSVResult::GetElevationAzimuthForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<std::optional<Sdx::ElevationAzimuth>>>::is_valid(m_values["ElevationAzimuths"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<std::optional<Sdx::ElevationAzimuth>>>::is_valid(field(ElevationAzimuthsField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetElevationAzimuthForEachSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetElevationAzimuthForEachSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::optional<Sdx::ElevationAzimuth>> GetElevationAzimuthForEachSVResult::elevationAzimuths() const
     {
-      return parse_json<std::vector<std::optional<Sdx::ElevationAzimuth>>>::parse(m_values["ElevationAzimuths"]);
+      return fieldValue<std::vector<std::optional<Sdx::ElevationAzimuth>>>(ElevationAzimuthsField);
+    }
+
+    std::shared_ptr<const std::vector<std::optional<Sdx::ElevationAzimuth>>> GetElevationAzimuthForEachSVResult::elevationAzimuthsPtr() const
+    {
+      return sharedValue<std::vector<std::optional<Sdx::ElevationAzimuth>>>(ElevationAzimuthsField);
     }
 
     void GetElevationAzimuthForEachSVResult::setElevationAzimuths(const std::vector<std::optional<Sdx::ElevationAzimuth>>& elevationAzimuths)
     {
-      m_values.AddMember("ElevationAzimuths", parse_json<std::vector<std::optional<Sdx::ElevationAzimuth>>>::format(elevationAzimuths, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElevationAzimuthsField, parse_json<std::vector<std::optional<Sdx::ElevationAzimuth>>>::format(elevationAzimuths, m_values.GetAllocator()));
     }
 
 
@@ -55,6 +55,7 @@ namespace Sdx
 
       // **** elevationAzimuths ****
       std::vector<std::optional<Sdx::ElevationAzimuth>> elevationAzimuths() const;
+      std::shared_ptr<const std::vector<std::optional<Sdx::ElevationAzimuth>>> elevationAzimuthsPtr() const;
       void setElevationAzimuths(const std::vector<std::optional<Sdx::ElevationAzimuth>>& elevationAzimuths);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetElevationAzimuthForEachSVResult);
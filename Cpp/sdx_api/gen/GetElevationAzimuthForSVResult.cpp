@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetElevationAzimuthForSVResult);
 
+    namespace
+    {
+      // Fields of GetElevationAzimuthForSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t ElevationAzimuthField = 2;
+    }
+
 
     GetElevationAzimuthForSVResult::GetElevationAzimuthForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::optional<Sdx::ElevationAzimuth>>::is_valid(m_values["ElevationAzimuth"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::optional<Sdx::ElevationAzimuth>>::is_valid(field(ElevationAzimuthField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     std::string GetElevationAzimuthForSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetElevationAzimuthForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetElevationAzimuthForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetElevationAzimuthForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::optional<Sdx::ElevationAzimuth> GetElevationAzimuthForSVResult::elevationAzimuth() const
     {
-      return parse_json<std::optional<Sdx::ElevationAzimuth>>::parse(m_values["ElevationAzimuth"]);
+      return parse_json<std::optional<Sdx::ElevationAzimuth>>::parse(field(ElevationAzimuthField));
     }
 
     void GetElevationAzimuthForSVResult::setElevationAzimuth(const std::optional<Sdx::ElevationAzimuth>& elevationAzimuth)
     {
-      m_values.AddMember("ElevationAzimuth", parse_json<std::optional<Sdx::ElevationAzimuth>>::format(elevationAzimuth, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElevationAzimuthField, parse_json<std::optional<Sdx::ElevationAzimuth>>::format(elevationAzimuth, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetElevationMaskBelowResult);
 
+    namespace
+    {
+      // Fields of GetElevationMaskBelowResult, indices in fieldNames()
+      constexpr std::size_t AngleField = 0;
+    }
+
 
     GetElevationMaskBelowResult::GetElevationMaskBelowResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Angle"])
+          && parse_json<double>::is_valid(field(AngleField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     double GetElevationMaskBelowResult::angle() const
     {
-      return parse_json<double>::parse(m_values["Angle"]);
+      return parse_json<double>::parse(field(AngleField));
     }
 
     void GetElevationMaskBelowResult::setAngle(double angle)
     {
-      m_values.AddMember("Angle", parse_json<double>::format(angle, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AngleField, parse_json<double>::format(angle, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetEnabledSignalsForSVResult);
 
+    namespace
+    {
+      // Fields of GetEnabledSignalsForSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t SignalArrayField = 2;
+    }
+
 
     GetEnabledSignalsForSVResult::GetEnabledSignalsForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
         ;
 
     }
@@ -85,36 +93,41 @@ namespace Sdx
 
     std::string GetEnabledSignalsForSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetEnabledSignalsForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetEnabledSignalsForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetEnabledSignalsForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetEnabledSignalsForSVResult::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetEnabledSignalsForSVResult::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetEnabledSignalsForSVResult::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
@@ -59,6 +59,7 @@ namespace Sdx
 
       // **** signalArray ****
       std::vector<std::string> signalArray() const;
+      std::shared_ptr<const std::vector<std::string>> signalArrayPtr() const;
       void setSignalArray(const std::vector<std::string>& signalArray);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetEnabledSignalsForSVResult);
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetEncryptionLibraryPathResult);
 
+    namespace
+    {
+      // Fields of GetEncryptionLibraryPathResult, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+      constexpr std::size_t PathField = 1;
+    }
+
 
     GetEncryptionLibraryPathResult::GetEncryptionLibraryPathResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::EncryptionSignalType>::is_valid(m_values["Type"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
+          && parse_json<Sdx::EncryptionSignalType>::is_valid(field(TypeField))
+          && parse_json<std::string>::is_valid(field(PathField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     Sdx::EncryptionSignalType GetEncryptionLibraryPathResult::type() const
     {
-      return parse_json<Sdx::EncryptionSignalType>::parse(m_values["Type"]);
+      return parse_json<Sdx::EncryptionSignalType>::parse(field(TypeField));
     }
 
     void GetEncryptionLibraryPathResult::setType(const Sdx::EncryptionSignalType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::EncryptionSignalType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<Sdx::EncryptionSignalType>::format(type, m_values.GetAllocator()));
     }
 
 
 
     std::string GetEncryptionLibraryPathResult::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void GetEncryptionLibraryPathResult::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetEngineLatencyResult);
 
+    namespace
+    {
+      // Fields of GetEngineLatencyResult, indices in fieldNames()
+      constexpr std::size_t LatencyField = 0;
+    }
+
 
     GetEngineLatencyResult::GetEngineLatencyResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Latency"])
+          && parse_json<int>::is_valid(field(LatencyField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetEngineLatencyResult::latency() const
     {
-      return parse_json<int>::parse(m_values["Latency"]);
+      return parse_json<int>::parse(field(LatencyField));
     }
 
     void GetEngineLatencyResult::setLatency(int latency)
     {
-      m_values.AddMember("Latency", parse_json<int>::format(latency, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LatencyField, parse_json<int>::format(latency, m_values.GetAllocator()));
     }
 
 
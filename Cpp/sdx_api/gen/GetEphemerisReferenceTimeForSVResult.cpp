@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetEphemerisReferenceTimeForSVResult);
 
+    namespace
+    {
+      // Fields of GetEphemerisReferenceTimeForSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t TimeField = 2;
+      constexpr std::size_t DataSetNameField = 3;
+    }
+
 
     GetEphemerisReferenceTimeForSVResult::GetEphemerisReferenceTimeForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Time"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<Sdx::DateTime>::is_valid(field(TimeField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -89,48 +98,48 @@ namespace Sdx
 
     std::string GetEphemerisReferenceTimeForSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetEphemerisReferenceTimeForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetEphemerisReferenceTimeForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetEphemerisReferenceTimeForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     Sdx::DateTime GetEphemerisReferenceTimeForSVResult::time() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Time"]);
+      return parse_json<Sdx::DateTime>::parse(field(TimeField));
     }
 
     void GetEphemerisReferenceTimeForSVResult::setTime(const Sdx::DateTime& time)
     {
-      m_values.AddMember("Time", parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetEphemerisReferenceTimeForSVResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetEphemerisReferenceTimeForSVResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
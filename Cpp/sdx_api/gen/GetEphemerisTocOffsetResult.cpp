@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetEphemerisTocOffsetResult);
 
+    namespace
+    {
+      // Fields of GetEphemerisTocOffsetResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t OffsetField = 1;
+    }
+
 
     GetEphemerisTocOffsetResult::GetEphemerisTocOffsetResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(OffsetField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetEphemerisTocOffsetResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetEphemerisTocOffsetResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetEphemerisTocOffsetResult::offset() const
     {
-      return parse_json<int>::parse(m_values["Offset"]);
+      return parse_json<int>::parse(field(OffsetField));
     }
 
     void GetEphemerisTocOffsetResult::setOffset(int offset)
     {
-      m_values.AddMember("Offset", parse_json<int>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<int>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -28,6 +28,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGalileoEphDoubleParamForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGalileoEphDoubleParamForEachSV);
 
+    namespace
+    {
+      // Fields of GetGalileoEphDoubleParamForEachSV, indices in fieldNames()
+      constexpr std::size_t ParamNameField = 0;
+      constexpr std::size_t DataSetNameField = 1;
+    }
+
 
     GetGalileoEphDoubleParamForEachSV::GetGalileoEphDoubleParamForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -55,8 +62,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -80,24 +87,24 @@ namespace Sdx
 
     std::string GetGalileoEphDoubleParamForEachSV::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetGalileoEphDoubleParamForEachSV::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetGalileoEphDoubleParamForEachSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetGalileoEphDoubleParamForEachSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGalileoFnavSatelliteK);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGalileoFnavSatelliteK);
 
+    namespace
+    {
+      // Fields of GetGalileoFnavSatelliteK, indices in fieldNames()
+      constexpr std::size_t PrnField = 0;
+    }
+
 
     GetGalileoFnavSatelliteK::GetGalileoFnavSatelliteK()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Prn"])
+          && parse_json<int>::is_valid(field(PrnField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int GetGalileoFnavSatelliteK::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void GetGalileoFnavSatelliteK::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGalileoFnavSatelliteKResult);
 
+    namespace
+    {
+      // Fields of GetGalileoFnavSatelliteKResult, indices in fieldNames()
+      constexpr std::size_t PrnField = 0;
+      constexpr std::size_t KField = 1;
+    }
+
 
     GetGalileoFnavSatelliteKResult::GetGalileoFnavSatelliteKResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Prn"])
-          && parse_json<int>::is_valid(m_values["K"])
+          && parse_json<int>::is_valid(field(PrnField))
+          && parse_json<int>::is_valid(field(KField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     int GetGalileoFnavSatelliteKResult::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void GetGalileoFnavSatelliteKResult::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
 
     int GetGalileoFnavSatelliteKResult::k() const
     {
-      return parse_json<int>::parse(m_values["K"]);
+      return parse_json<int>::parse(field(KField));
     }
 
     void GetGalileoFnavSatelliteKResult::setK(int k)
     {
-      m_values.AddMember("K", parse_json<int>::format(k, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(KField, parse_json<int>::format(k, m_values.GetAllocator()));
     }
 
 
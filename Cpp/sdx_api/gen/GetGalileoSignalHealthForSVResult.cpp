@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGalileoSignalHealthForSVResult);
 
+    namespace
+    {
+      // Fields of GetGalileoSignalHealthForSVResult, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t ComponentField = 1;
+      constexpr std::size_t HealthField = 2;
+      constexpr std::size_t DataSetNameField = 3;
+    }
+
 
     GetGalileoSignalHealthForSVResult::GetGalileoSignalHealthForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::string>::is_valid(m_values["Component"])
-          && parse_json<int>::is_valid(m_values["Health"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::string>::is_valid(field(ComponentField))
+          && parse_json<int>::is_valid(field(HealthField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -89,48 +98,48 @@ namespace Sdx
 
     int GetGalileoSignalHealthForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetGalileoSignalHealthForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetGalileoSignalHealthForSVResult::component() const
     {
-      return parse_json<std::string>::parse(m_values["Component"]);
+      return fieldValue<std::string>(ComponentField);
     }
 
     void GetGalileoSignalHealthForSVResult::setComponent(const std::string& component)
     {
-      m_values.AddMember("Component", parse_json<std::string>::format(component, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ComponentField, parse_json<std::string>::format(component, m_values.GetAllocator()));
     }
 
 
 
     int GetGalileoSignalHealthForSVResult::health() const
     {
-      return parse_json<int>::parse(m_values["Health"]);
+      return parse_json<int>::parse(field(HealthField));
     }
 
     void GetGalileoSignalHealthForSVResult::setHealth(int health)
     {
-      m_values.AddMember("Health", parse_json<int>::format(health, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HealthField, parse_json<int>::format(health, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetGalileoSignalHealthForSVResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetGalileoSignalHealthForSVResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGaussianNoisePowerDensityOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGaussianNoisePowerDensityOffset);
 
+    namespace
+    {
+      // Fields of GetGaussianNoisePowerDensityOffset, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t OutputIdxField = 1;
+    }
+
 
     GetGaussianNoisePowerDensityOffset::GetGaussianNoisePowerDensityOffset()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<int>::is_valid(m_values["OutputIdx"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<int>::is_valid(field(OutputIdxField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetGaussianNoisePowerDensityOffset::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetGaussianNoisePowerDensityOffset::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     int GetGaussianNoisePowerDensityOffset::outputIdx() const
     {
-      return parse_json<int>::parse(m_values["OutputIdx"]);
+      return parse_json<int>::parse(field(OutputIdxField));
     }
 
     void GetGaussianNoisePowerDensityOffset::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputIdxField, parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
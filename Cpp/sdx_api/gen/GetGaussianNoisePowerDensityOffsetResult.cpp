@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGaussianNoisePowerDensityOffsetResult);
 
+    namespace
+    {
+      // Fields of GetGaussianNoisePowerDensityOffsetResult, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t OutputIdxField = 1;
+      constexpr std::size_t PowerDensityOffsetField = 2;
+    }
+
 
     GetGaussianNoisePowerDensityOffsetResult::GetGaussianNoisePowerDensityOffsetResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<int>::is_valid(m_values["OutputIdx"])
-          && parse_json<double>::is_valid(m_values["PowerDensityOffset"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<int>::is_valid(field(OutputIdxField))
+          && parse_json<double>::is_valid(field(PowerDensityOffsetField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     std::string GetGaussianNoisePowerDensityOffsetResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetGaussianNoisePowerDensityOffsetResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     int GetGaussianNoisePowerDensityOffsetResult::outputIdx() const
     {
-      return parse_json<int>::parse(m_values["OutputIdx"]);
+      return parse_json<int>::parse(field(OutputIdxField));
     }
 
     void GetGaussianNoisePowerDensityOffsetResult::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputIdxField, parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
 
     double GetGaussianNoisePowerDensityOffsetResult::powerDensityOffset() const
     {
-      return parse_json<double>::parse(m_values["PowerDensityOffset"]);
+      return parse_json<double>::parse(field(PowerDensityOffsetField));
     }
 
     void GetGaussianNoisePowerDensityOffsetResult::setPowerDensityOffset(double powerDensityOffset)
     {
-      m_values.AddMember("PowerDensityOffset", parse_json<double>::format(powerDensityOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerDensityOffsetField, parse_json<double>::format(powerDensityOffset, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlobalPowerOffsetResult);
 
+    namespace
+    {
+      // Fields of GetGlobalPowerOffsetResult, indices in fieldNames()
+      constexpr std::size_t OffsetField = 0;
+    }
+
 
     GetGlobalPowerOffsetResult::GetGlobalPowerOffsetResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Offset"])
+          && parse_json<double>::is_valid(field(OffsetField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     double GetGlobalPowerOffsetResult::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void GetGlobalPowerOffsetResult::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
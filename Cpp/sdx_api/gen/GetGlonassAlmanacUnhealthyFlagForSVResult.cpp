@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlonassAlmanacUnhealthyFlagForSVResult);
 
+    namespace
+    {
+      // Fields of GetGlonassAlmanacUnhealthyFlagForSVResult, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t HealthField = 1;
+    }
+
 
     GetGlonassAlmanacUnhealthyFlagForSVResult::GetGlonassAlmanacUnhealthyFlagForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["Health"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(HealthField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     int GetGlonassAlmanacUnhealthyFlagForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetGlonassAlmanacUnhealthyFlagForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool GetGlonassAlmanacUnhealthyFlagForSVResult::health() const
     {
-      return parse_json<bool>::parse(m_values["Health"]);
+      return parse_json<bool>::parse(field(HealthField));
     }
 
     void GetGlonassAlmanacUnhealthyFlagForSVResult::setHealth(bool health)
     {
-      m_values.AddMember("Health", parse_json<bool>::format(health, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HealthField, parse_json<bool>::format(health, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGlonassDoubleParams);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlonassDoubleParams);
 
+    namespace
+    {
+      // Fields of GetGlonassDoubleParams, indices in fieldNames()
+      constexpr std::size_t ParamNameField = 0;
+    }
+
 
     GetGlonassDoubleParams::GetGlonassDoubleParams()
       : CommandBase(CmdName, TargetId)
@@ -51,7 +57,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
+          && parse_json<std::string>::is_valid(field(ParamNameField))
         ;
 
     }
@@ -73,12 +79,12 @@ namespace Sdx
 
     std::string GetGlonassDoubleParams::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetGlonassDoubleParams::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGlonassEphDoubleParamForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlonassEphDoubleParamForEachSV);
 
+    namespace
+    {
+      // Fields of GetGlonassEphDoubleParamForEachSV, indices in fieldNames()
+      constexpr std::size_t ParamNameField = 0;
+    }
+
 
     GetGlonassEphDoubleParamForEachSV::GetGlonassEphDoubleParamForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
+          && parse_json<std::string>::is_valid(field(ParamNameField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string GetGlonassEphDoubleParamForEachSV::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetGlonassEphDoubleParamForEachSV::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
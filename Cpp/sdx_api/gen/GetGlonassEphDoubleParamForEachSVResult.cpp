@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlonassEphDoubleParamForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetGlonassEphDoubleParamForEachSVResult, indices in fieldNames()
+      constexpr std::size_t ParamNameField = 0;
+      constexpr std::size_t ValField = 1;
+    }
+
 
     GetGlonassEphDoubleParamForEachSVResult::GetGlonassEphDoubleParamForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Val"])
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && parse_json<std::vector<double>>::is_valid(field(ValField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetGlonassEphDoubleParamForEachSVResult::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetGlonassEphDoubleParamForEachSVResult::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> GetGlonassEphDoubleParamForEachSVResult::val() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Val"]);
+      return fieldValue<std::vector<double>>(ValField);
+    }
+
+    std::shared_ptr<const std::vector<double>> GetGlonassEphDoubleParamForEachSVResult::valPtr() const
+    {
+      return sharedValue<std::vector<double>>(ValField);
     }
 
     void GetGlonassEphDoubleParamForEachSVResult::setVal(const std::vector<double>& val)
     {
-      m_values.AddMember("Val", parse_json<std::vector<double>>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ValField, parse_json<std::vector<double>>::format(val, m_values.GetAllocator()));
     }
 
 
@@ -54,6 +54,7 @@ namespace Sdx
 
       // **** val ****
       std::vector<double> val() const;
+      std::shared_ptr<const std::vector<double>> valPtr() const;
       void setVal(const std::vector<double>& val);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGlonassEphDoubleParamForEachSVResult);
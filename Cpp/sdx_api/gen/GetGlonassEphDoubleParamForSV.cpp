@@ -36,6 +36,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGlonassEphDoubleParamForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlonassEphDoubleParamForSV);
 
+    namespace
+    {
+      // Fields of GetGlonassEphDoubleParamForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t ParamNameField = 1;
+    }
+
 
     GetGlonassEphDoubleParamForSV::GetGlonassEphDoubleParamForSV()
       : CommandBase(CmdName, TargetId)
@@ -63,8 +70,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::string>::is_valid(field(ParamNameField))
         ;
 
     }
@@ -86,24 +93,24 @@ namespace Sdx
 
     int GetGlonassEphDoubleParamForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetGlonassEphDoubleParamForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetGlonassEphDoubleParamForSV::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetGlonassEphDoubleParamForSV::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGlonassEphemerisHealthFlagForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlonassEphemerisHealthFlagForSV);
 
+    namespace
+    {
+      // Fields of GetGlonassEphemerisHealthFlagForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+    }
+
 
     GetGlonassEphemerisHealthFlagForSV::GetGlonassEphemerisHealthFlagForSV()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
+          && parse_json<int>::is_valid(field(SvIdField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int GetGlonassEphemerisHealthFlagForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetGlonassEphemerisHealthFlagForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
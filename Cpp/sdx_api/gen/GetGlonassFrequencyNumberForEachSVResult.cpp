@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGlonassFrequencyNumberForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetGlonassFrequencyNumberForEachSVResult, indices in fieldNames()
+      constexpr std::size_t FrequencyNumberField = 0;
+    }
+
 
     GetGlonassFrequencyNumberForEachSVResult::GetGlonassFrequencyNumberForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<int>>::is_valid(m_values["FrequencyNumber"])
+          && parse_json<std::vector<int>>::is_valid(field(FrequencyNumberField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<int> GetGlonassFrequencyNumberForEachSVResult::frequencyNumber() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["FrequencyNumber"]);
+      return fieldValue<std::vector<int>>(FrequencyNumberField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetGlonassFrequencyNumberForEachSVResult::frequencyNumberPtr() const
+    {
+      return sharedValue<std::vector<int>>(FrequencyNumberField);
     }
 
     void GetGlonassFrequencyNumberForEachSVResult::setFrequencyNumber(const std::vector<int>& frequencyNumber)
     {
-      m_values.AddMember("FrequencyNumber", parse_json<std::vector<int>>::format(frequencyNumber, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FrequencyNumberField, parse_json<std::vector<int>>::format(frequencyNumber, m_values.GetAllocator()));
     }
 
 
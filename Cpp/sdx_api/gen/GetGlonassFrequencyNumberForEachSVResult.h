@@ -46,6 +46,7 @@ namespace Sdx
 
       // **** frequencyNumber ****
       std::vector<int> frequencyNumber() const;
+      std::shared_ptr<const std::vector<int>> frequencyNumberPtr() const;
       void setFrequencyNumber(const std::vector<int>& frequencyNumber);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGlonassFrequencyNumberForEachSVResult);
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGpsConfigurationForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGpsConfigurationForEachSV);
 
+    namespace
+    {
+      // Fields of GetGpsConfigurationForEachSV, indices in fieldNames()
+      constexpr std::size_t DataSetNameField = 0;
+    }
+
 
     GetGpsConfigurationForEachSV::GetGpsConfigurationForEachSV(const std::optional<std::string>& dataSetName)
       : CommandBase(CmdName, TargetId)
@@ -45,7 +51,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -67,12 +73,12 @@ namespace Sdx
 
     std::optional<std::string> GetGpsConfigurationForEachSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetGpsConfigurationForEachSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
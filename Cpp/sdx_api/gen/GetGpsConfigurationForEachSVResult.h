@@ -50,6 +50,7 @@ namespace Sdx
 
       // **** svConfigs ****
       std::vector<int> svConfigs() const;
+      std::shared_ptr<const std::vector<int>> svConfigsPtr() const;
       void setSvConfigs(const std::vector<int>& svConfigs);
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGpsEphBoolParamForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetGpsEphBoolParamForEachSVResult, indices in fieldNames()
+      constexpr std::size_t ParamNameField = 0;
+      constexpr std::size_t ValField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     GetGpsEphBoolParamForEachSVResult::GetGpsEphBoolParamForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ParamName"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Val"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(ParamNameField))
+          && parse_json<std::vector<bool>>::is_valid(field(ValField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -85,36 +93,41 @@ namespace Sdx
 
     std::string GetGpsEphBoolParamForEachSVResult::paramName() const
     {
-      return parse_json<std::string>::parse(m_values["ParamName"]);
+      return fieldValue<std::string>(ParamNameField);
     }
 
     void GetGpsEphBoolParamForEachSVResult::setParamName(const std::string& paramName)
     {
-      m_values.AddMember("ParamName", parse_json<std::string>::format(paramName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamNameField, parse_json<std::string>::format(paramName, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> GetGpsEphBoolParamForEachSVResult::val() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Val"]);
+      return fieldValue<std::vector<bool>>(ValField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> GetGpsEphBoolParamForEachSVResult::valPtr() const
+    {
+      return sharedValue<std::vector<bool>>(ValField);
     }
 
     void GetGpsEphBoolParamForEachSVResult::setVal(const std::vector<bool>& val)
     {
-      m_values.AddMember("Val", parse_json<std::vector<bool>>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ValField, parse_json<std::vector<bool>>::format(val, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetGpsEphBoolParamForEachSVResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetGpsEphBoolParamForEachSVResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGpsSVConfigurationForAllSat);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGpsSVConfigurationForAllSat);
 
+    namespace
+    {
+      // Fields of GetGpsSVConfigurationForAllSat, indices in fieldNames()
+      constexpr std::size_t DataSetNameField = 0;
+    }
+
 
     GetGpsSVConfigurationForAllSat::GetGpsSVConfigurationForAllSat(const std::optional<std::string>& dataSetName)
       : CommandBase(CmdName, TargetId)
@@ -47,7 +53,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -69,12 +75,12 @@ namespace Sdx
 
     std::optional<std::string> GetGpsSVConfigurationForAllSat::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetGpsSVConfigurationForAllSat::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
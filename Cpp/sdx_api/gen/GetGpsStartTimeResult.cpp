@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGpsStartTimeResult);
 
+    namespace
+    {
+      // Fields of GetGpsStartTimeResult, indices in fieldNames()
+      constexpr std::size_t StartTimeField = 0;
+      constexpr std::size_t LeapSecondField = 1;
+    }
+
 
     GetGpsStartTimeResult::GetGpsStartTimeResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::DateTime>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["LeapSecond"])
+          && parse_json<Sdx::DateTime>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(LeapSecondField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     Sdx::DateTime GetGpsStartTimeResult::startTime() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["StartTime"]);
+      return parse_json<Sdx::DateTime>::parse(field(StartTimeField));
     }
 
     void GetGpsStartTimeResult::setStartTime(const Sdx::DateTime& startTime)
     {
-      m_values.AddMember("StartTime", parse_json<Sdx::DateTime>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<Sdx::DateTime>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int GetGpsStartTimeResult::leapSecond() const
     {
-      return parse_json<int>::parse(m_values["LeapSecond"]);
+      return parse_json<int>::parse(field(LeapSecondField));
     }
 
     void GetGpsStartTimeResult::setLeapSecond(int leapSecond)
     {
-      m_values.AddMember("LeapSecond", parse_json<int>::format(leapSecond, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LeapSecondField, parse_json<int>::format(leapSecond, m_values.GetAllocator()));
     }
 
 
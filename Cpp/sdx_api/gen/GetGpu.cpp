@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetGpu);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetGpu);
 
+    namespace
+    {
+      // Fields of GetGpu, indices in fieldNames()
+      constexpr std::size_t OutputField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     GetGpu::GetGpu()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Output"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(OutputField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int GetGpu::output() const
     {
-      return parse_json<int>::parse(m_values["Output"]);
+      return parse_json<int>::parse(field(OutputField));
     }
 
     void GetGpu::setOutput(int output)
     {
-      m_values.AddMember("Output", parse_json<int>::format(output, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputField, parse_json<int>::format(output, m_values.GetAllocator()));
     }
 
 
 
     std::string GetGpu::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetGpu::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
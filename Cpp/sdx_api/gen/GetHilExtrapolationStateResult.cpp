@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetHilExtrapolationStateResult);
 
+    namespace
+    {
+      // Fields of GetHilExtrapolationStateResult, indices in fieldNames()
+      constexpr std::size_t StateField = 0;
+      constexpr std::size_t ElapsedTimeField = 1;
+    }
+
 
     GetHilExtrapolationStateResult::GetHilExtrapolationStateResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::HilExtrapolationState>::is_valid(m_values["State"])
-          && parse_json<int>::is_valid(m_values["ElapsedTime"])
+          && parse_json<Sdx::HilExtrapolationState>::is_valid(field(StateField))
+          && parse_json<int>::is_valid(field(ElapsedTimeField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     Sdx::HilExtrapolationState GetHilExtrapolationStateResult::state() const
     {
-      return parse_json<Sdx::HilExtrapolationState>::parse(m_values["State"]);
+      return parse_json<Sdx::HilExtrapolationState>::parse(field(StateField));
     }
 
     void GetHilExtrapolationStateResult::setState(const Sdx::HilExtrapolationState& state)
     {
-      m_values.AddMember("State", parse_json<Sdx::HilExtrapolationState>::format(state, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StateField, parse_json<Sdx::HilExtrapolationState>::format(state, m_values.GetAllocator()));
     }
 
 
 
     int GetHilExtrapolationStateResult::elapsedTime() const
     {
-      return parse_json<int>::parse(m_values["ElapsedTime"]);
+      return parse_json<int>::parse(field(ElapsedTimeField));
     }
 
     void GetHilExtrapolationStateResult::setElapsedTime(int elapsedTime)
     {
-      m_values.AddMember("ElapsedTime", parse_json<int>::format(elapsedTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElapsedTimeField, parse_json<int>::format(elapsedTime, m_values.GetAllocator()));
     }
 
 
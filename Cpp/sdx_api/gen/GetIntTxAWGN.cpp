@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIntTxAWGN);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxAWGN);
 
+    namespace
+    {
+      // Fields of GetIntTxAWGN, indices in fieldNames()
+      constexpr std::size_t TransmitterIdField = 0;
+      constexpr std::size_t SignalIdField = 1;
+    }
+
 
     GetIntTxAWGN::GetIntTxAWGN()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetIntTxAWGN::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void GetIntTxAWGN::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxAWGN::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void GetIntTxAWGN::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
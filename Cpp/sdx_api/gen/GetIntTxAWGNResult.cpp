@@ -29,6 +29,19 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxAWGNResult);
 
+    namespace
+    {
+      // Fields of GetIntTxAWGNResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t CentralFreqField = 1;
+      constexpr std::size_t PowerField = 2;
+      constexpr std::size_t BandwidthField = 3;
+      constexpr std::size_t TransmitterIdField = 4;
+      constexpr std::size_t SignalIdField = 5;
+      constexpr std::size_t SeedField = 6;
+      constexpr std::size_t GroupField = 7;
+    }
+
 
     GetIntTxAWGNResult::GetIntTxAWGNResult()
       : CommandResult(CmdName, TargetId)
@@ -82,14 +95,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<double>::is_valid(m_values["CentralFreq"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<double>::is_valid(m_values["Bandwidth"])
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
-          && parse_json<std::optional<int>>::is_valid(m_values["Seed"])
-          && parse_json<std::optional<int>>::is_valid(m_values["Group"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<double>::is_valid(field(CentralFreqField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<double>::is_valid(field(BandwidthField))
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
+          && parse_json<std::optional<int>>::is_valid(field(SeedField))
+          && parse_json<std::optional<int>>::is_valid(field(GroupField))
         ;
 
     }
@@ -105,96 +118,96 @@ namespace Sdx
 
     bool GetIntTxAWGNResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetIntTxAWGNResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAWGNResult::centralFreq() const
     {
-      return parse_json<double>::parse(m_values["CentralFreq"]);
+      return parse_json<double>::parse(field(CentralFreqField));
     }
 
     void GetIntTxAWGNResult::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqField, parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAWGNResult::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void GetIntTxAWGNResult::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAWGNResult::bandwidth() const
     {
-      return parse_json<double>::parse(m_values["Bandwidth"]);
+      return parse_json<double>::parse(field(BandwidthField));
     }
 
     void GetIntTxAWGNResult::setBandwidth(double bandwidth)
     {
-      m_values.AddMember("Bandwidth", parse_json<double>::format(bandwidth, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandwidthField, parse_json<double>::format(bandwidth, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxAWGNResult::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void GetIntTxAWGNResult::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxAWGNResult::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void GetIntTxAWGNResult::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> GetIntTxAWGNResult::seed() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["Seed"]);
+      return parse_json<std::optional<int>>::parse(field(SeedField));
     }
 
     void GetIntTxAWGNResult::setSeed(const std::optional<int>& seed)
     {
-      m_values.AddMember("Seed", parse_json<std::optional<int>>::format(seed, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SeedField, parse_json<std::optional<int>>::format(seed, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> GetIntTxAWGNResult::group() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["Group"]);
+      return parse_json<std::optional<int>>::parse(field(GroupField));
     }
 
     void GetIntTxAWGNResult::setGroup(const std::optional<int>& group)
     {
-      m_values.AddMember("Group", parse_json<std::optional<int>>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GroupField, parse_json<std::optional<int>>::format(group, m_values.GetAllocator()));
     }
 
 
@@ -28,6 +28,18 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxAntennaOffsetResult);
 
+    namespace
+    {
+      // Fields of GetIntTxAntennaOffsetResult, indices in fieldNames()
+      constexpr std::size_t XField = 0;
+      constexpr std::size_t YField = 1;
+      constexpr std::size_t ZField = 2;
+      constexpr std::size_t YawField = 3;
+      constexpr std::size_t PitchField = 4;
+      constexpr std::size_t RollField = 5;
+      constexpr std::size_t IdField = 6;
+    }
+
 
     GetIntTxAntennaOffsetResult::GetIntTxAntennaOffsetResult()
       : CommandResult(CmdName, TargetId)
@@ -79,13 +91,13 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["X"])
-          && parse_json<double>::is_valid(m_values["Y"])
-          && parse_json<double>::is_valid(m_values["Z"])
-          && parse_json<double>::is_valid(m_values["Yaw"])
-          && parse_json<double>::is_valid(m_values["Pitch"])
-          && parse_json<double>::is_valid(m_values["Roll"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<double>::is_valid(field(XField))
+          && parse_json<double>::is_valid(field(YField))
+          && parse_json<double>::is_valid(field(ZField))
+          && parse_json<double>::is_valid(field(YawField))
+          && parse_json<double>::is_valid(field(PitchField))
+          && parse_json<double>::is_valid(field(RollField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -101,84 +113,84 @@ namespace Sdx
 
     double GetIntTxAntennaOffsetResult::x() const
     {
-      return parse_json<double>::parse(m_values["X"]);
+      return parse_json<double>::parse(field(XField));
     }
 
     void GetIntTxAntennaOffsetResult::setX(double x)
     {
-      m_values.AddMember("X", parse_json<double>::format(x, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(XField, parse_json<double>::format(x, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAntennaOffsetResult::y() const
     {
-      return parse_json<double>::parse(m_values["Y"]);
+      return parse_json<double>::parse(field(YField));
     }
 
     void GetIntTxAntennaOffsetResult::setY(double y)
     {
-      m_values.AddMember("Y", parse_json<double>::format(y, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(YField, parse_json<double>::format(y, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAntennaOffsetResult::z() const
     {
-      return parse_json<double>::parse(m_values["Z"]);
+      return parse_json<double>::parse(field(ZField));
     }
 
     void GetIntTxAntennaOffsetResult::setZ(double z)
     {
-      m_values.AddMember("Z", parse_json<double>::format(z, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ZField, parse_json<double>::format(z, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAntennaOffsetResult::yaw() const
     {
-      return parse_json<double>::parse(m_values["Yaw"]);
+      return parse_json<double>::parse(field(YawField));
     }
 
     void GetIntTxAntennaOffsetResult::setYaw(double yaw)
     {
-      m_values.AddMember("Yaw", parse_json<double>::format(yaw, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(YawField, parse_json<double>::format(yaw, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAntennaOffsetResult::pitch() const
     {
-      return parse_json<double>::parse(m_values["Pitch"]);
+      return parse_json<double>::parse(field(PitchField));
     }
 
     void GetIntTxAntennaOffsetResult::setPitch(double pitch)
     {
-      m_values.AddMember("Pitch", parse_json<double>::format(pitch, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PitchField, parse_json<double>::format(pitch, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxAntennaOffsetResult::roll() const
     {
-      return parse_json<double>::parse(m_values["Roll"]);
+      return parse_json<double>::parse(field(RollField));
     }
 
     void GetIntTxAntennaOffsetResult::setRoll(double roll)
     {
-      m_values.AddMember("Roll", parse_json<double>::format(roll, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RollField, parse_json<double>::format(roll, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxAntennaOffsetResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetIntTxAntennaOffsetResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
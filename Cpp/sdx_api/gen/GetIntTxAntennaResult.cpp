@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxAntennaResult);
 
+    namespace
+    {
+      // Fields of GetIntTxAntennaResult, indices in fieldNames()
+      constexpr std::size_t GainField = 0;
+      constexpr std::size_t TypeField = 1;
+      constexpr std::size_t IdField = 2;
+    }
+
 
     GetIntTxAntennaResult::GetIntTxAntennaResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["Gain"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["Type"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GainField))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(TypeField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -85,36 +93,41 @@ namespace Sdx
 
     std::vector<std::vector<double>> GetIntTxAntennaResult::gain() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["Gain"]);
+      return fieldValue<std::vector<std::vector<double>>>(GainField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetIntTxAntennaResult::gainPtr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GainField);
     }
 
     void GetIntTxAntennaResult::setGain(const std::vector<std::vector<double>>& gain)
     {
-      m_values.AddMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainField, parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetIntTxAntennaResult::type() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["Type"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(TypeField));
     }
 
     void GetIntTxAntennaResult::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxAntennaResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetIntTxAntennaResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
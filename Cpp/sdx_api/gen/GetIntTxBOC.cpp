@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIntTxBOC);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxBOC);
 
+    namespace
+    {
+      // Fields of GetIntTxBOC, indices in fieldNames()
+      constexpr std::size_t TransmitterIdField = 0;
+      constexpr std::size_t SignalIdField = 1;
+    }
+
 
     GetIntTxBOC::GetIntTxBOC()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetIntTxBOC::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void GetIntTxBOC::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxBOC::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void GetIntTxBOC::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
@@ -31,6 +31,21 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxBOCResult);
 
+    namespace
+    {
+      // Fields of GetIntTxBOCResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t CentralFreqField = 1;
+      constexpr std::size_t PowerField = 2;
+      constexpr std::size_t CodeRateField = 3;
+      constexpr std::size_t CodeLengthMsField = 4;
+      constexpr std::size_t SubCarrierRateField = 5;
+      constexpr std::size_t CosinePhaseBocField = 6;
+      constexpr std::size_t TransmitterIdField = 7;
+      constexpr std::size_t SignalIdField = 8;
+      constexpr std::size_t GroupField = 9;
+    }
+
 
     GetIntTxBOCResult::GetIntTxBOCResult()
       : CommandResult(CmdName, TargetId)
@@ -88,16 +103,16 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<double>::is_valid(m_values["CentralFreq"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<int>::is_valid(m_values["CodeRate"])
-          && parse_json<int>::is_valid(m_values["CodeLengthMs"])
-          && parse_json<int>::is_valid(m_values["SubCarrierRate"])
-          && parse_json<bool>::is_valid(m_values["CosinePhaseBoc"])
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
-          && parse_json<std::optional<int>>::is_valid(m_values["Group"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<double>::is_valid(field(CentralFreqField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<int>::is_valid(field(CodeRateField))
+          && parse_json<int>::is_valid(field(CodeLengthMsField))
+          && parse_json<int>::is_valid(field(SubCarrierRateField))
+          && parse_json<bool>::is_valid(field(CosinePhaseBocField))
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
+          && parse_json<std::optional<int>>::is_valid(field(GroupField))
         ;
 
     }
@@ -113,120 +128,120 @@ namespace Sdx
 
     bool GetIntTxBOCResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetIntTxBOCResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxBOCResult::centralFreq() const
     {
-      return parse_json<double>::parse(m_values["CentralFreq"]);
+      return parse_json<double>::parse(field(CentralFreqField));
     }
 
     void GetIntTxBOCResult::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqField, parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxBOCResult::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void GetIntTxBOCResult::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     int GetIntTxBOCResult::codeRate() const
     {
-      return parse_json<int>::parse(m_values["CodeRate"]);
+      return parse_json<int>::parse(field(CodeRateField));
     }
 
     void GetIntTxBOCResult::setCodeRate(int codeRate)
     {
-      m_values.AddMember("CodeRate", parse_json<int>::format(codeRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CodeRateField, parse_json<int>::format(codeRate, m_values.GetAllocator()));
     }
 
 
 
     int GetIntTxBOCResult::codeLengthMs() const
     {
-      return parse_json<int>::parse(m_values["CodeLengthMs"]);
+      return parse_json<int>::parse(field(CodeLengthMsField));
     }
 
     void GetIntTxBOCResult::setCodeLengthMs(int codeLengthMs)
     {
-      m_values.AddMember("CodeLengthMs", parse_json<int>::format(codeLengthMs, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CodeLengthMsField, parse_json<int>::format(codeLengthMs, m_values.GetAllocator()));
     }
 
 
 
     int GetIntTxBOCResult::subCarrierRate() const
     {
-      return parse_json<int>::parse(m_values["SubCarrierRate"]);
+      return parse_json<int>::parse(field(SubCarrierRateField));
     }
 
     void GetIntTxBOCResult::setSubCarrierRate(int subCarrierRate)
     {
-      m_values.AddMember("SubCarrierRate", parse_json<int>::format(subCarrierRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SubCarrierRateField, parse_json<int>::format(subCarrierRate, m_values.GetAllocator()));
     }
 
 
 
     bool GetIntTxBOCResult::cosinePhaseBoc() const
     {
-      return parse_json<bool>::parse(m_values["CosinePhaseBoc"]);
+      return parse_json<bool>::parse(field(CosinePhaseBocField));
     }
 
     void GetIntTxBOCResult::setCosinePhaseBoc(bool cosinePhaseBoc)
     {
-      m_values.AddMember("CosinePhaseBoc", parse_json<bool>::format(cosinePhaseBoc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CosinePhaseBocField, parse_json<bool>::format(cosinePhaseBoc, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxBOCResult::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void GetIntTxBOCResult::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxBOCResult::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void GetIntTxBOCResult::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> GetIntTxBOCResult::group() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["Group"]);
+      return parse_json<std::optional<int>>::parse(field(GroupField));
     }
 
     void GetIntTxBOCResult::setGroup(const std::optional<int>& group)
     {
-      m_values.AddMember("Group", parse_json<std::optional<int>>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GroupField, parse_json<std::optional<int>>::format(group, m_values.GetAllocator()));
     }
 
 
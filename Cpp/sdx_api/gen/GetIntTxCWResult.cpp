@@ -28,6 +28,18 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxCWResult);
 
+    namespace
+    {
+      // Fields of GetIntTxCWResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t CentralFreqField = 1;
+      constexpr std::size_t PowerField = 2;
+      constexpr std::size_t TransmitterIdField = 3;
+      constexpr std::size_t SignalIdField = 4;
+      constexpr std::size_t InitialPhaseOffsetField = 5;
+      constexpr std::size_t GroupField = 6;
+    }
+
 
     GetIntTxCWResult::GetIntTxCWResult()
       : CommandResult(CmdName, TargetId)
@@ -79,13 +91,13 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<double>::is_valid(m_values["CentralFreq"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
-          && parse_json<std::optional<double>>::is_valid(m_values["InitialPhaseOffset"])
-          && parse_json<std::optional<int>>::is_valid(m_values["Group"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<double>::is_valid(field(CentralFreqField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
+          && parse_json<std::optional<double>>::is_valid(field(InitialPhaseOffsetField))
+          && parse_json<std::optional<int>>::is_valid(field(GroupField))
         ;
 
     }
@@ -101,84 +113,84 @@ namespace Sdx
 
     bool GetIntTxCWResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetIntTxCWResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxCWResult::centralFreq() const
     {
-      return parse_json<double>::parse(m_values["CentralFreq"]);
+      return parse_json<double>::parse(field(CentralFreqField));
     }
 
     void GetIntTxCWResult::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqField, parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxCWResult::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void GetIntTxCWResult::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxCWResult::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void GetIntTxCWResult::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxCWResult::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void GetIntTxCWResult::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
 
     std::optional<double> GetIntTxCWResult::initialPhaseOffset() const
     {
-      return parse_json<std::optional<double>>::parse(m_values["InitialPhaseOffset"]);
+      return parse_json<std::optional<double>>::parse(field(InitialPhaseOffsetField));
     }
 
     void GetIntTxCWResult::setInitialPhaseOffset(const std::optional<double>& initialPhaseOffset)
     {
-      m_values.AddMember("InitialPhaseOffset", parse_json<std::optional<double>>::format(initialPhaseOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(InitialPhaseOffsetField, parse_json<std::optional<double>>::format(initialPhaseOffset, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> GetIntTxCWResult::group() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["Group"]);
+      return parse_json<std::optional<int>>::parse(field(GroupField));
     }
 
     void GetIntTxCWResult::setGroup(const std::optional<int>& group)
     {
-      m_values.AddMember("Group", parse_json<std::optional<int>>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GroupField, parse_json<std::optional<int>>::format(group, m_values.GetAllocator()));
     }
 
 
@@ -29,6 +29,19 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxChirpResult);
 
+    namespace
+    {
+      // Fields of GetIntTxChirpResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t CentralFreqField = 1;
+      constexpr std::size_t PowerField = 2;
+      constexpr std::size_t BandwidthField = 3;
+      constexpr std::size_t SweepTimeField = 4;
+      constexpr std::size_t TransmitterIdField = 5;
+      constexpr std::size_t SignalIdField = 6;
+      constexpr std::size_t GroupField = 7;
+    }
+
 
     GetIntTxChirpResult::GetIntTxChirpResult()
       : CommandResult(CmdName, TargetId)
@@ -82,14 +95,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<double>::is_valid(m_values["CentralFreq"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<double>::is_valid(m_values["Bandwidth"])
-          && parse_json<double>::is_valid(m_values["SweepTime"])
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
-          && parse_json<std::optional<int>>::is_valid(m_values["Group"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<double>::is_valid(field(CentralFreqField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<double>::is_valid(field(BandwidthField))
+          && parse_json<double>::is_valid(field(SweepTimeField))
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
+          && parse_json<std::optional<int>>::is_valid(field(GroupField))
         ;
 
     }
@@ -105,96 +118,96 @@ namespace Sdx
 
     bool GetIntTxChirpResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetIntTxChirpResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxChirpResult::centralFreq() const
     {
-      return parse_json<double>::parse(m_values["CentralFreq"]);
+      return parse_json<double>::parse(field(CentralFreqField));
     }
 
     void GetIntTxChirpResult::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqField, parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxChirpResult::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void GetIntTxChirpResult::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxChirpResult::bandwidth() const
     {
-      return parse_json<double>::parse(m_values["Bandwidth"]);
+      return parse_json<double>::parse(field(BandwidthField));
     }
 
     void GetIntTxChirpResult::setBandwidth(double bandwidth)
     {
-      m_values.AddMember("Bandwidth", parse_json<double>::format(bandwidth, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandwidthField, parse_json<double>::format(bandwidth, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxChirpResult::sweepTime() const
     {
-      return parse_json<double>::parse(m_values["SweepTime"]);
+      return parse_json<double>::parse(field(SweepTimeField));
     }
 
     void GetIntTxChirpResult::setSweepTime(double sweepTime)
     {
-      m_values.AddMember("SweepTime", parse_json<double>::format(sweepTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SweepTimeField, parse_json<double>::format(sweepTime, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxChirpResult::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void GetIntTxChirpResult::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxChirpResult::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void GetIntTxChirpResult::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> GetIntTxChirpResult::group() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["Group"]);
+      return parse_json<std::optional<int>>::parse(field(GroupField));
     }
 
     void GetIntTxChirpResult::setGroup(const std::optional<int>& group)
     {
-      m_values.AddMember("Group", parse_json<std::optional<int>>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GroupField, parse_json<std::optional<int>>::format(group, m_values.GetAllocator()));
     }
 
 
@@ -28,6 +28,18 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxFixResult);
 
+    namespace
+    {
+      // Fields of GetIntTxFixResult, indices in fieldNames()
+      constexpr std::size_t LatField = 0;
+      constexpr std::size_t LonField = 1;
+      constexpr std::size_t AltField = 2;
+      constexpr std::size_t YawField = 3;
+      constexpr std::size_t PitchField = 4;
+      constexpr std::size_t RollField = 5;
+      constexpr std::size_t IdField = 6;
+    }
+
 
     GetIntTxFixResult::GetIntTxFixResult()
       : CommandResult(CmdName, TargetId)
@@ -79,13 +91,13 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Lat"])
-          && parse_json<double>::is_valid(m_values["Lon"])
-          && parse_json<double>::is_valid(m_values["Alt"])
-          && parse_json<double>::is_valid(m_values["Yaw"])
-          && parse_json<double>::is_valid(m_values["Pitch"])
-          && parse_json<double>::is_valid(m_values["Roll"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<double>::is_valid(field(LatField))
+          && parse_json<double>::is_valid(field(LonField))
+          && parse_json<double>::is_valid(field(AltField))
+          && parse_json<double>::is_valid(field(YawField))
+          && parse_json<double>::is_valid(field(PitchField))
+          && parse_json<double>::is_valid(field(RollField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -101,84 +113,84 @@ namespace Sdx
 
     double GetIntTxFixResult::lat() const
     {
-      return parse_json<double>::parse(m_values["Lat"]);
+      return parse_json<double>::parse(field(LatField));
     }
 
     void GetIntTxFixResult::setLat(double lat)
     {
-      m_values.AddMember("Lat", parse_json<double>::format(lat, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LatField, parse_json<double>::format(lat, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxFixResult::lon() const
     {
-      return parse_json<double>::parse(m_values["Lon"]);
+      return parse_json<double>::parse(field(LonField));
     }
 
     void GetIntTxFixResult::setLon(double lon)
     {
-      m_values.AddMember("Lon", parse_json<double>::format(lon, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LonField, parse_json<double>::format(lon, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxFixResult::alt() const
     {
-      return parse_json<double>::parse(m_values["Alt"]);
+      return parse_json<double>::parse(field(AltField));
     }
 
     void GetIntTxFixResult::setAlt(double alt)
     {
-      m_values.AddMember("Alt", parse_json<double>::format(alt, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AltField, parse_json<double>::format(alt, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxFixResult::yaw() const
     {
-      return parse_json<double>::parse(m_values["Yaw"]);
+      return parse_json<double>::parse(field(YawField));
     }
 
     void GetIntTxFixResult::setYaw(double yaw)
     {
-      m_values.AddMember("Yaw", parse_json<double>::format(yaw, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(YawField, parse_json<double>::format(yaw, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxFixResult::pitch() const
     {
-      return parse_json<double>::parse(m_values["Pitch"]);
+      return parse_json<double>::parse(field(PitchField));
     }
 
     void GetIntTxFixResult::setPitch(double pitch)
     {
-      m_values.AddMember("Pitch", parse_json<double>::format(pitch, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PitchField, parse_json<double>::format(pitch, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxFixResult::roll() const
     {
-      return parse_json<double>::parse(m_values["Roll"]);
+      return parse_json<double>::parse(field(RollField));
     }
 
     void GetIntTxFixResult::setRoll(double roll)
     {
-      m_values.AddMember("Roll", parse_json<double>::format(roll, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RollField, parse_json<double>::format(roll, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxFixResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetIntTxFixResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxHiddenOnMapResult);
 
+    namespace
+    {
+      // Fields of GetIntTxHiddenOnMapResult, indices in fieldNames()
+      constexpr std::size_t HiddenOnMapField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     GetIntTxHiddenOnMapResult::GetIntTxHiddenOnMapResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["HiddenOnMap"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(HiddenOnMapField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     bool GetIntTxHiddenOnMapResult::hiddenOnMap() const
     {
-      return parse_json<bool>::parse(m_values["HiddenOnMap"]);
+      return parse_json<bool>::parse(field(HiddenOnMapField));
     }
 
     void GetIntTxHiddenOnMapResult::setHiddenOnMap(bool hiddenOnMap)
     {
-      m_values.AddMember("HiddenOnMap", parse_json<bool>::format(hiddenOnMap, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HiddenOnMapField, parse_json<bool>::format(hiddenOnMap, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxHiddenOnMapResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetIntTxHiddenOnMapResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
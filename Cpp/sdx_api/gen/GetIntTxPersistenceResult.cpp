@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxPersistenceResult);
 
+    namespace
+    {
+      // Fields of GetIntTxPersistenceResult, indices in fieldNames()
+      constexpr std::size_t PersistenceField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     GetIntTxPersistenceResult::GetIntTxPersistenceResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Persistence"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(PersistenceField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     bool GetIntTxPersistenceResult::persistence() const
     {
-      return parse_json<bool>::parse(m_values["Persistence"]);
+      return parse_json<bool>::parse(field(PersistenceField));
     }
 
     void GetIntTxPersistenceResult::setPersistence(bool persistence)
     {
-      m_values.AddMember("Persistence", parse_json<bool>::format(persistence, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PersistenceField, parse_json<bool>::format(persistence, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxPersistenceResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetIntTxPersistenceResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
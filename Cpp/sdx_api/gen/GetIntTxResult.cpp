@@ -27,6 +27,17 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIntTxResult);
 
+    namespace
+    {
+      // Fields of GetIntTxResult, indices in fieldNames()
+      constexpr std::size_t UsualNameField = 0;
+      constexpr std::size_t EnabledField = 1;
+      constexpr std::size_t GroupField = 2;
+      constexpr std::size_t DynamicField = 3;
+      constexpr std::size_t PowerField = 4;
+      constexpr std::size_t IdField = 5;
+    }
+
 
     GetIntTxResult::GetIntTxResult()
       : CommandResult(CmdName, TargetId)
@@ -76,12 +87,12 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["UsualName"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<int>::is_valid(m_values["Group"])
-          && parse_json<bool>::is_valid(m_values["Dynamic"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(UsualNameField))
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<int>::is_valid(field(GroupField))
+          && parse_json<bool>::is_valid(field(DynamicField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -97,72 +108,72 @@ namespace Sdx
 
     std::string GetIntTxResult::usualName() const
     {
-      return parse_json<std::string>::parse(m_values["UsualName"]);
+      return fieldValue<std::string>(UsualNameField);
     }
 
     void GetIntTxResult::setUsualName(const std::string& usualName)
     {
-      m_values.AddMember("UsualName", parse_json<std::string>::format(usualName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UsualNameField, parse_json<std::string>::format(usualName, m_values.GetAllocator()));
     }
 
 
 
     bool GetIntTxResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetIntTxResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     int GetIntTxResult::group() const
     {
-      return parse_json<int>::parse(m_values["Group"]);
+      return parse_json<int>::parse(field(GroupField));
     }
 
     void GetIntTxResult::setGroup(int group)
     {
-      m_values.AddMember("Group", parse_json<int>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GroupField, parse_json<int>::format(group, m_values.GetAllocator()));
     }
 
 
 
     bool GetIntTxResult::dynamic() const
     {
-      return parse_json<bool>::parse(m_values["Dynamic"]);
+      return parse_json<bool>::parse(field(DynamicField));
     }
 
     void GetIntTxResult::setDynamic(bool dynamic)
     {
-      m_values.AddMember("Dynamic", parse_json<bool>::format(dynamic, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DynamicField, parse_json<bool>::format(dynamic, m_values.GetAllocator()));
     }
 
 
 
     double GetIntTxResult::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void GetIntTxResult::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     std::string GetIntTxResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetIntTxResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetInterModulation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetInterModulation);
 
+    namespace
+    {
+      // Fields of GetInterModulation, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+    }
+
 
     GetInterModulation::GetInterModulation()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<Sdx::SignalWithComponent>>::is_valid(m_values["SignalArray"])
+          && parse_json<std::vector<Sdx::SignalWithComponent>>::is_valid(field(SignalArrayField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<Sdx::SignalWithComponent> GetInterModulation::signalArray() const
     {
-      return parse_json<std::vector<Sdx::SignalWithComponent>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<Sdx::SignalWithComponent>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::SignalWithComponent>> GetInterModulation::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<Sdx::SignalWithComponent>>(SignalArrayField);
     }
 
     void GetInterModulation::setSignalArray(const std::vector<Sdx::SignalWithComponent>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetInterModulationResult);
 
+    namespace
+    {
+      // Fields of GetInterModulationResult, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t CoefficientField = 1;
+    }
+
 
     GetInterModulationResult::GetInterModulationResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<Sdx::SignalWithComponent>>::is_valid(m_values["SignalArray"])
-          && parse_json<double>::is_valid(m_values["Coefficient"])
+          && parse_json<std::vector<Sdx::SignalWithComponent>>::is_valid(field(SignalArrayField))
+          && parse_json<double>::is_valid(field(CoefficientField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::vector<Sdx::SignalWithComponent> GetInterModulationResult::signalArray() const
     {
-      return parse_json<std::vector<Sdx::SignalWithComponent>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<Sdx::SignalWithComponent>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::SignalWithComponent>> GetInterModulationResult::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<Sdx::SignalWithComponent>>(SignalArrayField);
     }
 
     void GetInterModulationResult::setSignalArray(const std::vector<Sdx::SignalWithComponent>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     double GetInterModulationResult::coefficient() const
     {
-      return parse_json<double>::parse(m_values["Coefficient"]);
+      return parse_json<double>::parse(field(CoefficientField));
     }
 
     void GetInterModulationResult::setCoefficient(double coefficient)
     {
-      m_values.AddMember("Coefficient", parse_json<double>::format(coefficient, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CoefficientField, parse_json<double>::format(coefficient, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoBdgimAlphaResult);
 
+    namespace
+    {
+      // Fields of GetIonoBdgimAlphaResult, indices in fieldNames()
+      constexpr std::size_t IndexField = 0;
+      constexpr std::size_t ValField = 1;
+    }
+
 
     GetIonoBdgimAlphaResult::GetIonoBdgimAlphaResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Index"])
-          && parse_json<double>::is_valid(m_values["Val"])
+          && parse_json<int>::is_valid(field(IndexField))
+          && parse_json<double>::is_valid(field(ValField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     int GetIonoBdgimAlphaResult::index() const
     {
-      return parse_json<int>::parse(m_values["Index"]);
+      return parse_json<int>::parse(field(IndexField));
     }
 
     void GetIonoBdgimAlphaResult::setIndex(int index)
     {
-      m_values.AddMember("Index", parse_json<int>::format(index, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexField, parse_json<int>::format(index, m_values.GetAllocator()));
     }
 
 
 
     double GetIonoBdgimAlphaResult::val() const
     {
-      return parse_json<double>::parse(m_values["Val"]);
+      return parse_json<double>::parse(field(ValField));
     }
 
     void GetIonoBdgimAlphaResult::setVal(double val)
     {
-      m_values.AddMember("Val", parse_json<double>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ValField, parse_json<double>::format(val, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoBeta);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoBeta);
 
+    namespace
+    {
+      // Fields of GetIonoBeta, indices in fieldNames()
+      constexpr std::size_t IndexField = 0;
+    }
+
 
     GetIonoBeta::GetIonoBeta()
       : CommandBase(CmdName, TargetId)
@@ -53,7 +59,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Index"])
+          && parse_json<int>::is_valid(field(IndexField))
         ;
 
     }
@@ -75,12 +81,12 @@ namespace Sdx
 
     int GetIonoBeta::index() const
     {
-      return parse_json<int>::parse(m_values["Index"]);
+      return parse_json<int>::parse(field(IndexField));
     }
 
     void GetIonoBeta::setIndex(int index)
     {
-      m_values.AddMember("Index", parse_json<int>::format(index, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexField, parse_json<int>::format(index, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridError);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridError);
 
+    namespace
+    {
+      // Fields of GetIonoGridError, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t PointField = 1;
+    }
+
 
     GetIonoGridError::GetIonoGridError()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Band"])
-          && parse_json<int>::is_valid(m_values["Point"])
+          && parse_json<int>::is_valid(field(BandField))
+          && parse_json<int>::is_valid(field(PointField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int GetIonoGridError::band() const
     {
-      return parse_json<int>::parse(m_values["Band"]);
+      return parse_json<int>::parse(field(BandField));
     }
 
     void GetIonoGridError::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridError::point() const
     {
-      return parse_json<int>::parse(m_values["Point"]);
+      return parse_json<int>::parse(field(PointField));
     }
 
     void GetIonoGridError::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PointField, parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
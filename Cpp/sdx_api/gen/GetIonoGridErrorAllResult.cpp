@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridErrorAllResult);
 
+    namespace
+    {
+      // Fields of GetIonoGridErrorAllResult, indices in fieldNames()
+      constexpr std::size_t GridField = 0;
+    }
+
 
     GetIonoGridErrorAllResult::GetIonoGridErrorAllResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["Grid"])
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GridField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<std::vector<double>> GetIonoGridErrorAllResult::grid() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["Grid"]);
+      return fieldValue<std::vector<std::vector<double>>>(GridField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetIonoGridErrorAllResult::gridPtr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GridField);
     }
 
     void GetIonoGridErrorAllResult::setGrid(const std::vector<std::vector<double>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GridField, parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()));
     }
 
 
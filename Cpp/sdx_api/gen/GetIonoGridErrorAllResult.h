@@ -46,6 +46,7 @@ namespace Sdx
 
       // **** grid ****
       std::vector<std::vector<double>> grid() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gridPtr() const;
       void setGrid(const std::vector<std::vector<double>>& grid);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridErrorAllResult);
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridErrorResult);
 
+    namespace
+    {
+      // Fields of GetIonoGridErrorResult, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t PointField = 1;
+      constexpr std::size_t ErrorField = 2;
+    }
+
 
     GetIonoGridErrorResult::GetIonoGridErrorResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Band"])
-          && parse_json<int>::is_valid(m_values["Point"])
-          && parse_json<double>::is_valid(m_values["Error"])
+          && parse_json<int>::is_valid(field(BandField))
+          && parse_json<int>::is_valid(field(PointField))
+          && parse_json<double>::is_valid(field(ErrorField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     int GetIonoGridErrorResult::band() const
     {
-      return parse_json<int>::parse(m_values["Band"]);
+      return parse_json<int>::parse(field(BandField));
     }
 
     void GetIonoGridErrorResult::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridErrorResult::point() const
     {
-      return parse_json<int>::parse(m_values["Point"]);
+      return parse_json<int>::parse(field(PointField));
     }
 
     void GetIonoGridErrorResult::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PointField, parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
 
     double GetIonoGridErrorResult::error() const
     {
-      return parse_json<double>::parse(m_values["Error"]);
+      return parse_json<double>::parse(field(ErrorField));
     }
 
     void GetIonoGridErrorResult::setError(double error)
     {
-      m_values.AddMember("Error", parse_json<double>::format(error, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ErrorField, parse_json<double>::format(error, m_values.GetAllocator()));
     }
 
 
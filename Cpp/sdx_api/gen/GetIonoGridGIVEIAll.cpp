@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridGIVEIAll);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridGIVEIAll);
 
+    namespace
+    {
+      // Fields of GetIonoGridGIVEIAll, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+    }
+
 
     GetIonoGridGIVEIAll::GetIonoGridGIVEIAll(const std::optional<std::string>& serviceProvider)
       : CommandBase(CmdName, TargetId)
@@ -45,7 +51,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::optional<std::string>>::is_valid(m_values["ServiceProvider"])
+          && parse_json<std::optional<std::string>>::is_valid(field(ServiceProviderField))
         ;
 
     }
@@ -67,12 +73,12 @@ namespace Sdx
 
     std::optional<std::string> GetIonoGridGIVEIAll::serviceProvider() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::optional<std::string>>(ServiceProviderField);
     }
 
     void GetIonoGridGIVEIAll::setServiceProvider(const std::optional<std::string>& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
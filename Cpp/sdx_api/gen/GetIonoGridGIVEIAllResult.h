@@ -49,6 +49,7 @@ namespace Sdx
 
       // **** grid ****
       std::vector<std::vector<int>> grid() const;
+      std::shared_ptr<const std::vector<std::vector<int>>> gridPtr() const;
       void setGrid(const std::vector<std::vector<int>>& grid);
 
 
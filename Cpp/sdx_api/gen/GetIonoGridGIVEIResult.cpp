@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridGIVEIResult);
 
+    namespace
+    {
+      // Fields of GetIonoGridGIVEIResult, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t PointField = 1;
+      constexpr std::size_t GiveIField = 2;
+      constexpr std::size_t ServiceProviderField = 3;
+    }
+
 
     GetIonoGridGIVEIResult::GetIonoGridGIVEIResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Band"])
-          && parse_json<int>::is_valid(m_values["Point"])
-          && parse_json<int>::is_valid(m_values["GiveI"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["ServiceProvider"])
+          && parse_json<int>::is_valid(field(BandField))
+          && parse_json<int>::is_valid(field(PointField))
+          && parse_json<int>::is_valid(field(GiveIField))
+          && parse_json<std::optional<std::string>>::is_valid(field(ServiceProviderField))
         ;
 
     }
@@ -89,48 +98,48 @@ namespace Sdx
 
     int GetIonoGridGIVEIResult::band() const
     {
-      return parse_json<int>::parse(m_values["Band"]);
+      return parse_json<int>::parse(field(BandField));
     }
 
     void GetIonoGridGIVEIResult::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridGIVEIResult::point() const
     {
-      return parse_json<int>::parse(m_values["Point"]);
+      return parse_json<int>::parse(field(PointField));
     }
 
     void GetIonoGridGIVEIResult::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PointField, parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridGIVEIResult::giveI() const
     {
-      return parse_json<int>::parse(m_values["GiveI"]);
+      return parse_json<int>::parse(field(GiveIField));
     }
 
     void GetIonoGridGIVEIResult::setGiveI(int giveI)
     {
-      m_values.AddMember("GiveI", parse_json<int>::format(giveI, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GiveIField, parse_json<int>::format(giveI, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetIonoGridGIVEIResult::serviceProvider() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::optional<std::string>>(ServiceProviderField);
     }
 
     void GetIonoGridGIVEIResult::setServiceProvider(const std::optional<std::string>& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
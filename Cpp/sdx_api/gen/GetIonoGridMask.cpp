@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridMask);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridMask);
 
+    namespace
+    {
+      // Fields of GetIonoGridMask, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t BandField = 1;
+      constexpr std::size_t PointField = 2;
+    }
+
 
     GetIonoGridMask::GetIonoGridMask()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<int>::is_valid(m_values["Band"])
-          && parse_json<int>::is_valid(m_values["Point"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<int>::is_valid(field(BandField))
+          && parse_json<int>::is_valid(field(PointField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string GetIonoGridMask::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void GetIonoGridMask::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridMask::band() const
     {
-      return parse_json<int>::parse(m_values["Band"]);
+      return parse_json<int>::parse(field(BandField));
     }
 
     void GetIonoGridMask::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridMask::point() const
     {
-      return parse_json<int>::parse(m_values["Point"]);
+      return parse_json<int>::parse(field(PointField));
     }
 
     void GetIonoGridMask::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PointField, parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridMaskAll);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridMaskAll);
 
+    namespace
+    {
+      // Fields of GetIonoGridMaskAll, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+    }
+
 
     GetIonoGridMaskAll::GetIonoGridMaskAll()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string GetIonoGridMaskAll::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void GetIonoGridMaskAll::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridMaskAllResult);
 
+    namespace
+    {
+      // Fields of GetIonoGridMaskAllResult, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t GridField = 1;
+    }
+
 
     GetIonoGridMaskAllResult::GetIonoGridMaskAllResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<std::vector<std::vector<bool>>>::is_valid(m_values["Grid"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<std::vector<std::vector<bool>>>::is_valid(field(GridField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetIonoGridMaskAllResult::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void GetIonoGridMaskAllResult::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<bool>> GetIonoGridMaskAllResult::grid() const
     {
-      return parse_json<std::vector<std::vector<bool>>>::parse(m_values["Grid"]);
+      return fieldValue<std::vector<std::vector<bool>>>(GridField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<bool>>> GetIonoGridMaskAllResult::gridPtr() const
+    {
+      return sharedValue<std::vector<std::vector<bool>>>(GridField);
     }
 
     void GetIonoGridMaskAllResult::setGrid(const std::vector<std::vector<bool>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<bool>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GridField, parse_json<std::vector<std::vector<bool>>>::format(grid, m_values.GetAllocator()));
     }
 
 
@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** grid ****
       std::vector<std::vector<bool>> grid() const;
+      std::shared_ptr<const std::vector<std::vector<bool>>> gridPtr() const;
       void setGrid(const std::vector<std::vector<bool>>& grid);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetIonoGridMaskAllResult);
@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIonoGridMaskResult);
 
+    namespace
+    {
+      // Fields of GetIonoGridMaskResult, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t BandField = 1;
+      constexpr std::size_t PointField = 2;
+      constexpr std::size_t FlagField = 3;
+    }
+
 
     GetIonoGridMaskResult::GetIonoGridMaskResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<int>::is_valid(m_values["Band"])
-          && parse_json<int>::is_valid(m_values["Point"])
-          && parse_json<bool>::is_valid(m_values["Flag"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<int>::is_valid(field(BandField))
+          && parse_json<int>::is_valid(field(PointField))
+          && parse_json<bool>::is_valid(field(FlagField))
         ;
 
     }
@@ -89,48 +98,48 @@ namespace Sdx
 
     std::string GetIonoGridMaskResult::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void GetIonoGridMaskResult::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridMaskResult::band() const
     {
-      return parse_json<int>::parse(m_values["Band"]);
+      return parse_json<int>::parse(field(BandField));
     }
 
     void GetIonoGridMaskResult::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
 
     int GetIonoGridMaskResult::point() const
     {
-      return parse_json<int>::parse(m_values["Point"]);
+      return parse_json<int>::parse(field(PointField));
     }
 
     void GetIonoGridMaskResult::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PointField, parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
 
     bool GetIonoGridMaskResult::flag() const
     {
-      return parse_json<bool>::parse(m_values["Flag"]);
+      return parse_json<bool>::parse(field(FlagField));
     }
 
     void GetIonoGridMaskResult::setFlag(bool flag)
     {
-      m_values.AddMember("Flag", parse_json<bool>::format(flag, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FlagField, parse_json<bool>::format(flag, m_values.GetAllocator()));
     }
 
 
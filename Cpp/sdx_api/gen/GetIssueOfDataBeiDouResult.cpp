@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIssueOfDataBeiDouResult);
 
+    namespace
+    {
+      // Fields of GetIssueOfDataBeiDouResult, indices in fieldNames()
+      constexpr std::size_t ClockField = 0;
+      constexpr std::size_t EphemerisField = 1;
+    }
+
 
     GetIssueOfDataBeiDouResult::GetIssueOfDataBeiDouResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Clock"])
-          && parse_json<int>::is_valid(m_values["Ephemeris"])
+          && parse_json<int>::is_valid(field(ClockField))
+          && parse_json<int>::is_valid(field(EphemerisField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     int GetIssueOfDataBeiDouResult::clock() const
     {
-      return parse_json<int>::parse(m_values["Clock"]);
+      return parse_json<int>::parse(field(ClockField));
     }
 
     void GetIssueOfDataBeiDouResult::setClock(int clock)
     {
-      m_values.AddMember("Clock", parse_json<int>::format(clock, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ClockField, parse_json<int>::format(clock, m_values.GetAllocator()));
     }
 
 
 
     int GetIssueOfDataBeiDouResult::ephemeris() const
     {
-      return parse_json<int>::parse(m_values["Ephemeris"]);
+      return parse_json<int>::parse(field(EphemerisField));
     }
 
     void GetIssueOfDataBeiDouResult::setEphemeris(int ephemeris)
     {
-      m_values.AddMember("Ephemeris", parse_json<int>::format(ephemeris, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EphemerisField, parse_json<int>::format(ephemeris, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIssueOfDataGalileoResult);
 
+    namespace
+    {
+      // Fields of GetIssueOfDataGalileoResult, indices in fieldNames()
+      constexpr std::size_t NavigationField = 0;
+      constexpr std::size_t AlmanacField = 1;
+      constexpr std::size_t OverrideRinexField = 2;
+    }
+
 
     GetIssueOfDataGalileoResult::GetIssueOfDataGalileoResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Navigation"])
-          && parse_json<int>::is_valid(m_values["Almanac"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["OverrideRinex"])
+          && parse_json<int>::is_valid(field(NavigationField))
+          && parse_json<int>::is_valid(field(AlmanacField))
+          && parse_json<std::optional<bool>>::is_valid(field(OverrideRinexField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     int GetIssueOfDataGalileoResult::navigation() const
     {
-      return parse_json<int>::parse(m_values["Navigation"]);
+      return parse_json<int>::parse(field(NavigationField));
     }
 
     void GetIssueOfDataGalileoResult::setNavigation(int navigation)
     {
-      m_values.AddMember("Navigation", parse_json<int>::format(navigation, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NavigationField, parse_json<int>::format(navigation, m_values.GetAllocator()));
     }
 
 
 
     int GetIssueOfDataGalileoResult::almanac() const
     {
-      return parse_json<int>::parse(m_values["Almanac"]);
+      return parse_json<int>::parse(field(AlmanacField));
     }
 
     void GetIssueOfDataGalileoResult::setAlmanac(int almanac)
     {
-      m_values.AddMember("Almanac", parse_json<int>::format(almanac, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AlmanacField, parse_json<int>::format(almanac, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> GetIssueOfDataGalileoResult::overrideRinex() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["OverrideRinex"]);
+      return parse_json<std::optional<bool>>::parse(field(OverrideRinexField));
     }
 
     void GetIssueOfDataGalileoResult::setOverrideRinex(const std::optional<bool>& overrideRinex)
     {
-      m_values.AddMember("OverrideRinex", parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverrideRinexField, parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetIssueOfDataNavICResult);
 
+    namespace
+    {
+      // Fields of GetIssueOfDataNavICResult, indices in fieldNames()
+      constexpr std::size_t EphemerisAndClockField = 0;
+      constexpr std::size_t OverrideRinexField = 1;
+    }
+
 
     GetIssueOfDataNavICResult::GetIssueOfDataNavICResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["EphemerisAndClock"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["OverrideRinex"])
+          && parse_json<int>::is_valid(field(EphemerisAndClockField))
+          && parse_json<std::optional<bool>>::is_valid(field(OverrideRinexField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     int GetIssueOfDataNavICResult::ephemerisAndClock() const
     {
-      return parse_json<int>::parse(m_values["EphemerisAndClock"]);
+      return parse_json<int>::parse(field(EphemerisAndClockField));
     }
 
     void GetIssueOfDataNavICResult::setEphemerisAndClock(int ephemerisAndClock)
     {
-      m_values.AddMember("EphemerisAndClock", parse_json<int>::format(ephemerisAndClock, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EphemerisAndClockField, parse_json<int>::format(ephemerisAndClock, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> GetIssueOfDataNavICResult::overrideRinex() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["OverrideRinex"]);
+      return parse_json<std::optional<bool>>::parse(field(OverrideRinexField));
     }
 
     void GetIssueOfDataNavICResult::setOverrideRinex(const std::optional<bool>& overrideRinex)
     {
-      m_values.AddMember("OverrideRinex", parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverrideRinexField, parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()));
     }
 
 
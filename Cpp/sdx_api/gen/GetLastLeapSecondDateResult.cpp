@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetLastLeapSecondDateResult);
 
+    namespace
+    {
+      // Fields of GetLastLeapSecondDateResult, indices in fieldNames()
+      constexpr std::size_t DateField = 0;
+    }
+
 
     GetLastLeapSecondDateResult::GetLastLeapSecondDateResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::Date>::is_valid(m_values["Date"])
+          && parse_json<Sdx::Date>::is_valid(field(DateField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     Sdx::Date GetLastLeapSecondDateResult::date() const
     {
-      return parse_json<Sdx::Date>::parse(m_values["Date"]);
+      return parse_json<Sdx::Date>::parse(field(DateField));
     }
 
     void GetLastLeapSecondDateResult::setDate(const Sdx::Date& date)
     {
-      m_values.AddMember("Date", parse_json<Sdx::Date>::format(date, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DateField, parse_json<Sdx::Date>::format(date, m_values.GetAllocator()));
     }
 
 
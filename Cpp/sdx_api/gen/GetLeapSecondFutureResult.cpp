@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetLeapSecondFutureResult);
 
+    namespace
+    {
+      // Fields of GetLeapSecondFutureResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t SecondsField = 1;
+      constexpr std::size_t DateField = 2;
+    }
+
 
     GetLeapSecondFutureResult::GetLeapSecondFutureResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<int>::is_valid(m_values["Seconds"])
-          && parse_json<Sdx::Date>::is_valid(m_values["Date"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<int>::is_valid(field(SecondsField))
+          && parse_json<Sdx::Date>::is_valid(field(DateField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     bool GetLeapSecondFutureResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetLeapSecondFutureResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     int GetLeapSecondFutureResult::seconds() const
     {
-      return parse_json<int>::parse(m_values["Seconds"]);
+      return parse_json<int>::parse(field(SecondsField));
     }
 
     void GetLeapSecondFutureResult::setSeconds(int seconds)
     {
-      m_values.AddMember("Seconds", parse_json<int>::format(seconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SecondsField, parse_json<int>::format(seconds, m_values.GetAllocator()));
     }
 
 
 
     Sdx::Date GetLeapSecondFutureResult::date() const
     {
-      return parse_json<Sdx::Date>::parse(m_values["Date"]);
+      return parse_json<Sdx::Date>::parse(field(DateField));
     }
 
     void GetLeapSecondFutureResult::setDate(const Sdx::Date& date)
     {
-      m_values.AddMember("Date", parse_json<Sdx::Date>::format(date, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DateField, parse_json<Sdx::Date>::format(date, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMainInstanceStatusResult);
 
+    namespace
+    {
+      // Fields of GetMainInstanceStatusResult, indices in fieldNames()
+      constexpr std::size_t IsMainInstanceField = 0;
+      constexpr std::size_t WorkerInstanceConnectedField = 1;
+      constexpr std::size_t PortField = 2;
+    }
+
 
     GetMainInstanceStatusResult::GetMainInstanceStatusResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsMainInstance"])
-          && parse_json<int>::is_valid(m_values["WorkerInstanceConnected"])
-          && parse_json<int>::is_valid(m_values["Port"])
+          && parse_json<bool>::is_valid(field(IsMainInstanceField))
+          && parse_json<int>::is_valid(field(WorkerInstanceConnectedField))
+          && parse_json<int>::is_valid(field(PortField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     bool GetMainInstanceStatusResult::isMainInstance() const
     {
-      return parse_json<bool>::parse(m_values["IsMainInstance"]);
+      return parse_json<bool>::parse(field(IsMainInstanceField));
     }
 
     void GetMainInstanceStatusResult::setIsMainInstance(bool isMainInstance)
     {
-      m_values.AddMember("IsMainInstance", parse_json<bool>::format(isMainInstance, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsMainInstanceField, parse_json<bool>::format(isMainInstance, m_values.GetAllocator()));
     }
 
 
 
     int GetMainInstanceStatusResult::workerInstanceConnected() const
     {
-      return parse_json<int>::parse(m_values["WorkerInstanceConnected"]);
+      return parse_json<int>::parse(field(WorkerInstanceConnectedField));
     }
 
     void GetMainInstanceStatusResult::setWorkerInstanceConnected(int workerInstanceConnected)
     {
-      m_values.AddMember("WorkerInstanceConnected", parse_json<int>::format(workerInstanceConnected, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(WorkerInstanceConnectedField, parse_json<int>::format(workerInstanceConnected, m_values.GetAllocator()));
     }
 
 
 
     int GetMainInstanceStatusResult::port() const
     {
-      return parse_json<int>::parse(m_values["Port"]);
+      return parse_json<int>::parse(field(PortField));
     }
 
     void GetMainInstanceStatusResult::setPort(int port)
     {
-      m_values.AddMember("Port", parse_json<int>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PortField, parse_json<int>::format(port, m_values.GetAllocator()));
     }
 
 
@@ -30,6 +30,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetManualPowerOffsetForSVResult);
 
+    namespace
+    {
+      // Fields of GetManualPowerOffsetForSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t SignalPowerOffsetDictField = 2;
+    }
+
 
     GetManualPowerOffsetForSVResult::GetManualPowerOffsetForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -73,9 +81,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::map<std::string, double>>::is_valid(m_values["SignalPowerOffsetDict"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::map<std::string, double>>::is_valid(field(SignalPowerOffsetDictField))
         ;
 
     }
@@ -91,36 +99,41 @@ namespace Sdx
 
     std::string GetManualPowerOffsetForSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetManualPowerOffsetForSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetManualPowerOffsetForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetManualPowerOffsetForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, double> GetManualPowerOffsetForSVResult::signalPowerOffsetDict() const
     {
-      return parse_json<std::map<std::string, double>>::parse(m_values["SignalPowerOffsetDict"]);
+      return fieldValue<std::map<std::string, double>>(SignalPowerOffsetDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, double>> GetManualPowerOffsetForSVResult::signalPowerOffsetDictPtr() const
+    {
+      return sharedValue<std::map<std::string, double>>(SignalPowerOffsetDictField);
     }
 
     void GetManualPowerOffsetForSVResult::setSignalPowerOffsetDict(const std::map<std::string, double>& signalPowerOffsetDict)
     {
-      m_values.AddMember("SignalPowerOffsetDict", parse_json<std::map<std::string, double>>::format(signalPowerOffsetDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalPowerOffsetDictField, parse_json<std::map<std::string, double>>::format(signalPowerOffsetDict, m_values.GetAllocator()));
     }
 
 
@@ -65,6 +65,7 @@ namespace Sdx
 
       // **** signalPowerOffsetDict ****
       std::map<std::string, double> signalPowerOffsetDict() const;
+      std::shared_ptr<const std::map<std::string, double>> signalPowerOffsetDictPtr() const;
       void setSignalPowerOffsetDict(const std::map<std::string, double>& signalPowerOffsetDict);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetManualPowerOffsetForSVResult);
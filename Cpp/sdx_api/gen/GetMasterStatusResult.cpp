@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMasterStatusResult);
 
+    namespace
+    {
+      // Fields of GetMasterStatusResult, indices in fieldNames()
+      constexpr std::size_t IsMasterField = 0;
+      constexpr std::size_t SlaveConnectedField = 1;
+      constexpr std::size_t PortField = 2;
+    }
+
 
     GetMasterStatusResult::GetMasterStatusResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsMaster"])
-          && parse_json<int>::is_valid(m_values["SlaveConnected"])
-          && parse_json<int>::is_valid(m_values["Port"])
+          && parse_json<bool>::is_valid(field(IsMasterField))
+          && parse_json<int>::is_valid(field(SlaveConnectedField))
+          && parse_json<int>::is_valid(field(PortField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     bool GetMasterStatusResult::isMaster() const
     {
-      return parse_json<bool>::parse(m_values["IsMaster"]);
+      return parse_json<bool>::parse(field(IsMasterField));
     }
 
     void GetMasterStatusResult::setIsMaster(bool isMaster)
     {
-      m_values.AddMember("IsMaster", parse_json<bool>::format(isMaster, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsMasterField, parse_json<bool>::format(isMaster, m_values.GetAllocator()));
     }
 
 
 
     int GetMasterStatusResult::slaveConnected() const
     {
-      return parse_json<int>::parse(m_values["SlaveConnected"]);
+      return parse_json<int>::parse(field(SlaveConnectedField));
     }
 
     void GetMasterStatusResult::setSlaveConnected(int slaveConnected)
     {
-      m_values.AddMember("SlaveConnected", parse_json<int>::format(slaveConnected, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SlaveConnectedField, parse_json<int>::format(slaveConnected, m_values.GetAllocator()));
     }
 
 
 
     int GetMasterStatusResult::port() const
     {
-      return parse_json<int>::parse(m_values["Port"]);
+      return parse_json<int>::parse(field(PortField));
     }
 
     void GetMasterStatusResult::setPort(int port)
     {
-      m_values.AddMember("Port", parse_json<int>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PortField, parse_json<int>::format(port, m_values.GetAllocator()));
     }
 
 
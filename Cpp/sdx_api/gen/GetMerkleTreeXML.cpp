@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetMerkleTreeXML);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMerkleTreeXML);
 
+    namespace
+    {
+      // Fields of GetMerkleTreeXML, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t PublicKeyIndexesField = 1;
+    }
+
 
     GetMerkleTreeXML::GetMerkleTreeXML()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::vector<int>>::is_valid(m_values["PublicKeyIndexes"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::vector<int>>::is_valid(field(PublicKeyIndexesField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::string GetMerkleTreeXML::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMerkleTreeXML::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> GetMerkleTreeXML::publicKeyIndexes() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["PublicKeyIndexes"]);
+      return fieldValue<std::vector<int>>(PublicKeyIndexesField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetMerkleTreeXML::publicKeyIndexesPtr() const
+    {
+      return sharedValue<std::vector<int>>(PublicKeyIndexesField);
     }
 
     void GetMerkleTreeXML::setPublicKeyIndexes(const std::vector<int>& publicKeyIndexes)
     {
-      m_values.AddMember("PublicKeyIndexes", parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PublicKeyIndexesField, parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMerkleTreeXMLResult);
 
+    namespace
+    {
+      // Fields of GetMerkleTreeXMLResult, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t PublicKeyIndexesField = 1;
+      constexpr std::size_t MerkleTreeXMLField = 2;
+    }
+
 
     GetMerkleTreeXMLResult::GetMerkleTreeXMLResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::vector<int>>::is_valid(m_values["PublicKeyIndexes"])
-          && parse_json<std::string>::is_valid(m_values["MerkleTreeXML"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::vector<int>>::is_valid(field(PublicKeyIndexesField))
+          && parse_json<std::string>::is_valid(field(MerkleTreeXMLField))
         ;
 
     }
@@ -85,36 +93,41 @@ namespace Sdx
 
     std::string GetMerkleTreeXMLResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMerkleTreeXMLResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> GetMerkleTreeXMLResult::publicKeyIndexes() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["PublicKeyIndexes"]);
+      return fieldValue<std::vector<int>>(PublicKeyIndexesField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetMerkleTreeXMLResult::publicKeyIndexesPtr() const
+    {
+      return sharedValue<std::vector<int>>(PublicKeyIndexesField);
     }
 
     void GetMerkleTreeXMLResult::setPublicKeyIndexes(const std::vector<int>& publicKeyIndexes)
     {
-      m_values.AddMember("PublicKeyIndexes", parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PublicKeyIndexesField, parse_json<std::vector<int>>::format(publicKeyIndexes, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMerkleTreeXMLResult::merkleTreeXML() const
     {
-      return parse_json<std::string>::parse(m_values["MerkleTreeXML"]);
+      return fieldValue<std::string>(MerkleTreeXMLField);
     }
 
     void GetMerkleTreeXMLResult::setMerkleTreeXML(const std::string& merkleTreeXML)
     {
-      m_values.AddMember("MerkleTreeXML", parse_json<std::string>::format(merkleTreeXML, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MerkleTreeXMLField, parse_json<std::string>::format(merkleTreeXML, m_values.GetAllocator()));
     }
 
 
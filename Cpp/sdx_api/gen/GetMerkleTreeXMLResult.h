@@ -54,6 +54,7 @@ namespace Sdx
 
       // **** publicKeyIndexes ****
       std::vector<int> publicKeyIndexes() const;
+      std::shared_ptr<const std::vector<int>> publicKeyIndexesPtr() const;
       void setPublicKeyIndexes(const std::vector<int>& publicKeyIndexes);
 
 
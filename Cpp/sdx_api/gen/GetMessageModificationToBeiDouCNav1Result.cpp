@@ -30,6 +30,20 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMessageModificationToBeiDouCNav1Result);
 
+    namespace
+    {
+      // Fields of GetMessageModificationToBeiDouCNav1Result, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t StartTimeField = 2;
+      constexpr std::size_t StopTimeField = 3;
+      constexpr std::size_t PageField = 4;
+      constexpr std::size_t ConditionField = 5;
+      constexpr std::size_t UpdateCRCField = 6;
+      constexpr std::size_t BitModificationsField = 7;
+      constexpr std::size_t IdField = 8;
+    }
+
 
     GetMessageModificationToBeiDouCNav1Result::GetMessageModificationToBeiDouCNav1Result()
       : CommandResult(CmdName, TargetId)
@@ -85,15 +99,15 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<int>::is_valid(m_values["Page"])
-          && parse_json<std::string>::is_valid(m_values["Condition"])
-          && parse_json<bool>::is_valid(m_values["UpdateCRC"])
-          && parse_json<std::string>::is_valid(m_values["BitModifications"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<int>::is_valid(field(PageField))
+          && parse_json<std::string>::is_valid(field(ConditionField))
+          && parse_json<bool>::is_valid(field(UpdateCRCField))
+          && parse_json<std::string>::is_valid(field(BitModificationsField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -109,108 +123,113 @@ namespace Sdx
 
     std::vector<std::string> GetMessageModificationToBeiDouCNav1Result::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetMessageModificationToBeiDouCNav1Result::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouCNav1Result::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouCNav1Result::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouCNav1Result::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouCNav1Result::page() const
     {
-      return parse_json<int>::parse(m_values["Page"]);
+      return parse_json<int>::parse(field(PageField));
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setPage(int page)
     {
-      m_values.AddMember("Page", parse_json<int>::format(page, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PageField, parse_json<int>::format(page, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToBeiDouCNav1Result::condition() const
     {
-      return parse_json<std::string>::parse(m_values["Condition"]);
+      return fieldValue<std::string>(ConditionField);
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setCondition(const std::string& condition)
     {
-      m_values.AddMember("Condition", parse_json<std::string>::format(condition, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ConditionField, parse_json<std::string>::format(condition, m_values.GetAllocator()));
     }
 
 
 
     bool GetMessageModificationToBeiDouCNav1Result::updateCRC() const
     {
-      return parse_json<bool>::parse(m_values["UpdateCRC"]);
+      return parse_json<bool>::parse(field(UpdateCRCField));
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setUpdateCRC(bool updateCRC)
     {
-      m_values.AddMember("UpdateCRC", parse_json<bool>::format(updateCRC, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UpdateCRCField, parse_json<bool>::format(updateCRC, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToBeiDouCNav1Result::bitModifications() const
     {
-      return parse_json<std::string>::parse(m_values["BitModifications"]);
+      return fieldValue<std::string>(BitModificationsField);
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setBitModifications(const std::string& bitModifications)
     {
-      m_values.AddMember("BitModifications", parse_json<std::string>::format(bitModifications, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BitModificationsField, parse_json<std::string>::format(bitModifications, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToBeiDouCNav1Result::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMessageModificationToBeiDouCNav1Result::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -31,6 +31,21 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMessageModificationToBeiDouD1NavResult);
 
+    namespace
+    {
+      // Fields of GetMessageModificationToBeiDouD1NavResult, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t StartTimeField = 2;
+      constexpr std::size_t StopTimeField = 3;
+      constexpr std::size_t SubframeField = 4;
+      constexpr std::size_t PageField = 5;
+      constexpr std::size_t WordField = 6;
+      constexpr std::size_t UpdateParityField = 7;
+      constexpr std::size_t WordModificationField = 8;
+      constexpr std::size_t IdField = 9;
+    }
+
 
     GetMessageModificationToBeiDouD1NavResult::GetMessageModificationToBeiDouD1NavResult()
       : CommandResult(CmdName, TargetId)
@@ -88,16 +103,16 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<int>::is_valid(m_values["Subframe"])
-          && parse_json<int>::is_valid(m_values["Page"])
-          && parse_json<int>::is_valid(m_values["Word"])
-          && parse_json<bool>::is_valid(m_values["UpdateParity"])
-          && parse_json<std::string>::is_valid(m_values["WordModification"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<int>::is_valid(field(SubframeField))
+          && parse_json<int>::is_valid(field(PageField))
+          && parse_json<int>::is_valid(field(WordField))
+          && parse_json<bool>::is_valid(field(UpdateParityField))
+          && parse_json<std::string>::is_valid(field(WordModificationField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -113,120 +128,125 @@ namespace Sdx
 
     std::vector<std::string> GetMessageModificationToBeiDouD1NavResult::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetMessageModificationToBeiDouD1NavResult::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouD1NavResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouD1NavResult::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouD1NavResult::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouD1NavResult::subframe() const
     {
-      return parse_json<int>::parse(m_values["Subframe"]);
+      return parse_json<int>::parse(field(SubframeField));
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setSubframe(int subframe)
     {
-      m_values.AddMember("Subframe", parse_json<int>::format(subframe, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SubframeField, parse_json<int>::format(subframe, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouD1NavResult::page() const
     {
-      return parse_json<int>::parse(m_values["Page"]);
+      return parse_json<int>::parse(field(PageField));
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setPage(int page)
     {
-      m_values.AddMember("Page", parse_json<int>::format(page, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PageField, parse_json<int>::format(page, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToBeiDouD1NavResult::word() const
     {
-      return parse_json<int>::parse(m_values["Word"]);
+      return parse_json<int>::parse(field(WordField));
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setWord(int word)
     {
-      m_values.AddMember("Word", parse_json<int>::format(word, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(WordField, parse_json<int>::format(word, m_values.GetAllocator()));
     }
 
 
 
     bool GetMessageModificationToBeiDouD1NavResult::updateParity() const
     {
-      return parse_json<bool>::parse(m_values["UpdateParity"]);
+      return parse_json<bool>::parse(field(UpdateParityField));
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setUpdateParity(bool updateParity)
     {
-      m_values.AddMember("UpdateParity", parse_json<bool>::format(updateParity, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UpdateParityField, parse_json<bool>::format(updateParity, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToBeiDouD1NavResult::wordModification() const
     {
-      return parse_json<std::string>::parse(m_values["WordModification"]);
+      return fieldValue<std::string>(WordModificationField);
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setWordModification(const std::string& wordModification)
     {
-      m_values.AddMember("WordModification", parse_json<std::string>::format(wordModification, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(WordModificationField, parse_json<std::string>::format(wordModification, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToBeiDouD1NavResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMessageModificationToBeiDouD1NavResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -28,6 +28,18 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMessageModificationToGalileoCNavResult);
 
+    namespace
+    {
+      // Fields of GetMessageModificationToGalileoCNavResult, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t StartTimeField = 2;
+      constexpr std::size_t StopTimeField = 3;
+      constexpr std::size_t UpdateCRCField = 4;
+      constexpr std::size_t BitModificationsField = 5;
+      constexpr std::size_t IdField = 6;
+    }
+
 
     GetMessageModificationToGalileoCNavResult::GetMessageModificationToGalileoCNavResult()
       : CommandResult(CmdName, TargetId)
@@ -79,13 +91,13 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<bool>::is_valid(m_values["UpdateCRC"])
-          && parse_json<std::string>::is_valid(m_values["BitModifications"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<bool>::is_valid(field(UpdateCRCField))
+          && parse_json<std::string>::is_valid(field(BitModificationsField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -101,84 +113,89 @@ namespace Sdx
 
     std::vector<std::string> GetMessageModificationToGalileoCNavResult::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetMessageModificationToGalileoCNavResult::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetMessageModificationToGalileoCNavResult::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoCNavResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetMessageModificationToGalileoCNavResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoCNavResult::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void GetMessageModificationToGalileoCNavResult::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoCNavResult::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void GetMessageModificationToGalileoCNavResult::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     bool GetMessageModificationToGalileoCNavResult::updateCRC() const
     {
-      return parse_json<bool>::parse(m_values["UpdateCRC"]);
+      return parse_json<bool>::parse(field(UpdateCRCField));
     }
 
     void GetMessageModificationToGalileoCNavResult::setUpdateCRC(bool updateCRC)
     {
-      m_values.AddMember("UpdateCRC", parse_json<bool>::format(updateCRC, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UpdateCRCField, parse_json<bool>::format(updateCRC, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToGalileoCNavResult::bitModifications() const
     {
-      return parse_json<std::string>::parse(m_values["BitModifications"]);
+      return fieldValue<std::string>(BitModificationsField);
     }
 
     void GetMessageModificationToGalileoCNavResult::setBitModifications(const std::string& bitModifications)
     {
-      m_values.AddMember("BitModifications", parse_json<std::string>::format(bitModifications, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BitModificationsField, parse_json<std::string>::format(bitModifications, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToGalileoCNavResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMessageModificationToGalileoCNavResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -31,6 +31,21 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMessageModificationToGalileoFNavResult);
 
+    namespace
+    {
+      // Fields of GetMessageModificationToGalileoFNavResult, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t StartTimeField = 2;
+      constexpr std::size_t StopTimeField = 3;
+      constexpr std::size_t SubframeField = 4;
+      constexpr std::size_t PageField = 5;
+      constexpr std::size_t ConditionField = 6;
+      constexpr std::size_t UpdateCRCField = 7;
+      constexpr std::size_t BitModificationsField = 8;
+      constexpr std::size_t IdField = 9;
+    }
+
 
     GetMessageModificationToGalileoFNavResult::GetMessageModificationToGalileoFNavResult()
       : CommandResult(CmdName, TargetId)
@@ -88,16 +103,16 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<int>::is_valid(m_values["Subframe"])
-          && parse_json<int>::is_valid(m_values["Page"])
-          && parse_json<std::string>::is_valid(m_values["Condition"])
-          && parse_json<bool>::is_valid(m_values["UpdateCRC"])
-          && parse_json<std::string>::is_valid(m_values["BitModifications"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<int>::is_valid(field(SubframeField))
+          && parse_json<int>::is_valid(field(PageField))
+          && parse_json<std::string>::is_valid(field(ConditionField))
+          && parse_json<bool>::is_valid(field(UpdateCRCField))
+          && parse_json<std::string>::is_valid(field(BitModificationsField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -113,120 +128,125 @@ namespace Sdx
 
     std::vector<std::string> GetMessageModificationToGalileoFNavResult::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetMessageModificationToGalileoFNavResult::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetMessageModificationToGalileoFNavResult::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoFNavResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetMessageModificationToGalileoFNavResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoFNavResult::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void GetMessageModificationToGalileoFNavResult::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoFNavResult::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void GetMessageModificationToGalileoFNavResult::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoFNavResult::subframe() const
     {
-      return parse_json<int>::parse(m_values["Subframe"]);
+      return parse_json<int>::parse(field(SubframeField));
     }
 
     void GetMessageModificationToGalileoFNavResult::setSubframe(int subframe)
     {
-      m_values.AddMember("Subframe", parse_json<int>::format(subframe, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SubframeField, parse_json<int>::format(subframe, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGalileoFNavResult::page() const
     {
-      return parse_json<int>::parse(m_values["Page"]);
+      return parse_json<int>::parse(field(PageField));
     }
 
     void GetMessageModificationToGalileoFNavResult::setPage(int page)
     {
-      m_values.AddMember("Page", parse_json<int>::format(page, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PageField, parse_json<int>::format(page, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToGalileoFNavResult::condition() const
     {
-      return parse_json<std::string>::parse(m_values["Condition"]);
+      return fieldValue<std::string>(ConditionField);
     }
 
     void GetMessageModificationToGalileoFNavResult::setCondition(const std::string& condition)
     {
-      m_values.AddMember("Condition", parse_json<std::string>::format(condition, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ConditionField, parse_json<std::string>::format(condition, m_values.GetAllocator()));
     }
 
 
 
     bool GetMessageModificationToGalileoFNavResult::updateCRC() const
     {
-      return parse_json<bool>::parse(m_values["UpdateCRC"]);
+      return parse_json<bool>::parse(field(UpdateCRCField));
     }
 
     void GetMessageModificationToGalileoFNavResult::setUpdateCRC(bool updateCRC)
     {
-      m_values.AddMember("UpdateCRC", parse_json<bool>::format(updateCRC, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UpdateCRCField, parse_json<bool>::format(updateCRC, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToGalileoFNavResult::bitModifications() const
     {
-      return parse_json<std::string>::parse(m_values["BitModifications"]);
+      return fieldValue<std::string>(BitModificationsField);
     }
 
     void GetMessageModificationToGalileoFNavResult::setBitModifications(const std::string& bitModifications)
     {
-      m_values.AddMember("BitModifications", parse_json<std::string>::format(bitModifications, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BitModificationsField, parse_json<std::string>::format(bitModifications, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToGalileoFNavResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMessageModificationToGalileoFNavResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -30,6 +30,20 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMessageModificationToGlonassNavResult);
 
+    namespace
+    {
+      // Fields of GetMessageModificationToGlonassNavResult, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t StartTimeField = 2;
+      constexpr std::size_t StopTimeField = 3;
+      constexpr std::size_t FrameField = 4;
+      constexpr std::size_t StringNumberField = 5;
+      constexpr std::size_t UpdateHammingCodeField = 6;
+      constexpr std::size_t StringModificationField = 7;
+      constexpr std::size_t IdField = 8;
+    }
+
 
     GetMessageModificationToGlonassNavResult::GetMessageModificationToGlonassNavResult()
       : CommandResult(CmdName, TargetId)
@@ -85,15 +99,15 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<int>::is_valid(m_values["Frame"])
-          && parse_json<int>::is_valid(m_values["StringNumber"])
-          && parse_json<bool>::is_valid(m_values["UpdateHammingCode"])
-          && parse_json<std::string>::is_valid(m_values["StringModification"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<int>::is_valid(field(FrameField))
+          && parse_json<int>::is_valid(field(StringNumberField))
+          && parse_json<bool>::is_valid(field(UpdateHammingCodeField))
+          && parse_json<std::string>::is_valid(field(StringModificationField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -109,108 +123,113 @@ namespace Sdx
 
     std::vector<std::string> GetMessageModificationToGlonassNavResult::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetMessageModificationToGlonassNavResult::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetMessageModificationToGlonassNavResult::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGlonassNavResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetMessageModificationToGlonassNavResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGlonassNavResult::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void GetMessageModificationToGlonassNavResult::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGlonassNavResult::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void GetMessageModificationToGlonassNavResult::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGlonassNavResult::frame() const
     {
-      return parse_json<int>::parse(m_values["Frame"]);
+      return parse_json<int>::parse(field(FrameField));
     }
 
     void GetMessageModificationToGlonassNavResult::setFrame(int frame)
     {
-      m_values.AddMember("Frame", parse_json<int>::format(frame, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FrameField, parse_json<int>::format(frame, m_values.GetAllocator()));
     }
 
 
 
     int GetMessageModificationToGlonassNavResult::stringNumber() const
     {
-      return parse_json<int>::parse(m_values["StringNumber"]);
+      return parse_json<int>::parse(field(StringNumberField));
     }
 
     void GetMessageModificationToGlonassNavResult::setStringNumber(int stringNumber)
     {
-      m_values.AddMember("StringNumber", parse_json<int>::format(stringNumber, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StringNumberField, parse_json<int>::format(stringNumber, m_values.GetAllocator()));
     }
 
 
 
     bool GetMessageModificationToGlonassNavResult::updateHammingCode() const
     {
-      return parse_json<bool>::parse(m_values["UpdateHammingCode"]);
+      return parse_json<bool>::parse(field(UpdateHammingCodeField));
     }
 
     void GetMessageModificationToGlonassNavResult::setUpdateHammingCode(bool updateHammingCode)
     {
-      m_values.AddMember("UpdateHammingCode", parse_json<bool>::format(updateHammingCode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UpdateHammingCodeField, parse_json<bool>::format(updateHammingCode, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToGlonassNavResult::stringModification() const
     {
-      return parse_json<std::string>::parse(m_values["StringModification"]);
+      return fieldValue<std::string>(StringModificationField);
     }
 
     void GetMessageModificationToGlonassNavResult::setStringModification(const std::string& stringModification)
     {
-      m_values.AddMember("StringModification", parse_json<std::string>::format(stringModification, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StringModificationField, parse_json<std::string>::format(stringModification, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMessageModificationToGlonassNavResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMessageModificationToGlonassNavResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -54,6 +54,7 @@ namespace Sdx
 
       // **** signalArray ****
       std::vector<std::string> signalArray() const;
+      std::shared_ptr<const std::vector<std::string>> signalArrayPtr() const;
       void setSignalArray(const std::vector<std::string>& signalArray);
 
 
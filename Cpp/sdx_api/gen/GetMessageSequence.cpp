@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetMessageSequence);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMessageSequence);
 
+    namespace
+    {
+      // Fields of GetMessageSequence, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+    }
+
 
     GetMessageSequence::GetMessageSequence()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
+          && parse_json<std::string>::is_valid(field(SignalField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string GetMessageSequence::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetMessageSequence::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMessageSequenceResult);
 
+    namespace
+    {
+      // Fields of GetMessageSequenceResult, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t SequenceField = 1;
+    }
+
 
     GetMessageSequenceResult::GetMessageSequenceResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::vector<int>>::is_valid(m_values["Sequence"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::vector<int>>::is_valid(field(SequenceField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetMessageSequenceResult::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetMessageSequenceResult::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> GetMessageSequenceResult::sequence() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Sequence"]);
+      return fieldValue<std::vector<int>>(SequenceField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetMessageSequenceResult::sequencePtr() const
+    {
+      return sharedValue<std::vector<int>>(SequenceField);
     }
 
     void GetMessageSequenceResult::setSequence(const std::vector<int>& sequence)
     {
-      m_values.AddMember("Sequence", parse_json<std::vector<int>>::format(sequence, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SequenceField, parse_json<std::vector<int>>::format(sequence, m_values.GetAllocator()));
     }
 
 
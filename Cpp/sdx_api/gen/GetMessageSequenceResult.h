@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** sequence ****
       std::vector<int> sequence() const;
+      std::shared_ptr<const std::vector<int>> sequencePtr() const;
       void setSequence(const std::vector<int>& sequence);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetMessageSequenceResult);
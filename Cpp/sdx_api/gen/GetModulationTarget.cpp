@@ -25,6 +25,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetModulationTarget);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetModulationTarget);
 
+    namespace
+    {
+      // Fields of GetModulationTarget, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+    }
+
 
     GetModulationTarget::GetModulationTarget()
       : CommandBase(CmdName, TargetId)
@@ -51,7 +57,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -73,12 +79,12 @@ namespace Sdx
 
     std::string GetModulationTarget::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetModulationTarget::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
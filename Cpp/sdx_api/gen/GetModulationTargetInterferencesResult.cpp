@@ -29,6 +29,19 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetModulationTargetInterferencesResult);
 
+    namespace
+    {
+      // Fields of GetModulationTargetInterferencesResult, indices in fieldNames()
+      constexpr std::size_t OutputField = 0;
+      constexpr std::size_t MinRateField = 1;
+      constexpr std::size_t MaxRateField = 2;
+      constexpr std::size_t GroupField = 3;
+      constexpr std::size_t CentralFreqField = 4;
+      constexpr std::size_t GainField = 5;
+      constexpr std::size_t IdField = 6;
+      constexpr std::size_t SignalField = 7;
+    }
+
 
     GetModulationTargetInterferencesResult::GetModulationTargetInterferencesResult()
       : CommandResult(CmdName, TargetId)
@@ -82,14 +95,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Output"])
-          && parse_json<int>::is_valid(m_values["MinRate"])
-          && parse_json<int>::is_valid(m_values["MaxRate"])
-          && parse_json<int>::is_valid(m_values["Group"])
-          && parse_json<double>::is_valid(m_values["CentralFreq"])
-          && parse_json<int>::is_valid(m_values["Gain"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["Signal"])
+          && parse_json<int>::is_valid(field(OutputField))
+          && parse_json<int>::is_valid(field(MinRateField))
+          && parse_json<int>::is_valid(field(MaxRateField))
+          && parse_json<int>::is_valid(field(GroupField))
+          && parse_json<double>::is_valid(field(CentralFreqField))
+          && parse_json<int>::is_valid(field(GainField))
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::optional<std::string>>::is_valid(field(SignalField))
         ;
 
     }
@@ -105,96 +118,96 @@ namespace Sdx
 
     int GetModulationTargetInterferencesResult::output() const
     {
-      return parse_json<int>::parse(m_values["Output"]);
+      return parse_json<int>::parse(field(OutputField));
     }
 
     void GetModulationTargetInterferencesResult::setOutput(int output)
     {
-      m_values.AddMember("Output", parse_json<int>::format(output, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputField, parse_json<int>::format(output, m_values.GetAllocator()));
     }
 
 
 
     int GetModulationTargetInterferencesResult::minRate() const
     {
-      return parse_json<int>::parse(m_values["MinRate"]);
+      return parse_json<int>::parse(field(MinRateField));
     }
 
     void GetModulationTargetInterferencesResult::setMinRate(int minRate)
     {
-      m_values.AddMember("MinRate", parse_json<int>::format(minRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MinRateField, parse_json<int>::format(minRate, m_values.GetAllocator()));
     }
 
 
 
     int GetModulationTargetInterferencesResult::maxRate() const
     {
-      return parse_json<int>::parse(m_values["MaxRate"]);
+      return parse_json<int>::parse(field(MaxRateField));
     }
 
     void GetModulationTargetInterferencesResult::setMaxRate(int maxRate)
     {
-      m_values.AddMember("MaxRate", parse_json<int>::format(maxRate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MaxRateField, parse_json<int>::format(maxRate, m_values.GetAllocator()));
     }
 
 
 
     int GetModulationTargetInterferencesResult::group() const
     {
-      return parse_json<int>::parse(m_values["Group"]);
+      return parse_json<int>::parse(field(GroupField));
     }
 
     void GetModulationTargetInterferencesResult::setGroup(int group)
     {
-      m_values.AddMember("Group", parse_json<int>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GroupField, parse_json<int>::format(group, m_values.GetAllocator()));
     }
 
 
 
     double GetModulationTargetInterferencesResult::centralFreq() const
     {
-      return parse_json<double>::parse(m_values["CentralFreq"]);
+      return parse_json<double>::parse(field(CentralFreqField));
     }
 
     void GetModulationTargetInterferencesResult::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqField, parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
 
     int GetModulationTargetInterferencesResult::gain() const
     {
-      return parse_json<int>::parse(m_values["Gain"]);
+      return parse_json<int>::parse(field(GainField));
     }
 
     void GetModulationTargetInterferencesResult::setGain(int gain)
     {
-      m_values.AddMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainField, parse_json<int>::format(gain, m_values.GetAllocator()));
     }
 
 
 
     std::string GetModulationTargetInterferencesResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetModulationTargetInterferencesResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetModulationTargetInterferencesResult::signal() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["Signal"]);
+      return fieldValue<std::optional<std::string>>(SignalField);
     }
 
     void GetModulationTargetInterferencesResult::setSignal(const std::optional<std::string>& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::optional<std::string>>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::optional<std::string>>::format(signal, m_values.GetAllocator()));
     }
 
 
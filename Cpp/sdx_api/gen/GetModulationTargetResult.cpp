@@ -26,6 +26,16 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetModulationTargetResult);
 
+    namespace
+    {
+      // Fields of GetModulationTargetResult, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+      constexpr std::size_t PathField = 1;
+      constexpr std::size_t AddressField = 2;
+      constexpr std::size_t ClockIsExternalField = 3;
+      constexpr std::size_t IdField = 4;
+    }
+
 
     GetModulationTargetResult::GetModulationTargetResult()
       : CommandResult(CmdName, TargetId)
@@ -73,11 +83,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Type"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<std::string>::is_valid(m_values["Address"])
-          && parse_json<bool>::is_valid(m_values["ClockIsExternal"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(TypeField))
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<std::string>::is_valid(field(AddressField))
+          && parse_json<bool>::is_valid(field(ClockIsExternalField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -93,60 +103,60 @@ namespace Sdx
 
     std::string GetModulationTargetResult::type() const
     {
-      return parse_json<std::string>::parse(m_values["Type"]);
+      return fieldValue<std::string>(TypeField);
     }
 
     void GetModulationTargetResult::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
 
     std::string GetModulationTargetResult::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void GetModulationTargetResult::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     std::string GetModulationTargetResult::address() const
     {
-      return parse_json<std::string>::parse(m_values["Address"]);
+      return fieldValue<std::string>(AddressField);
     }
 
     void GetModulationTargetResult::setAddress(const std::string& address)
     {
-      m_values.AddMember("Address", parse_json<std::string>::format(address, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AddressField, parse_json<std::string>::format(address, m_values.GetAllocator()));
     }
 
 
 
     bool GetModulationTargetResult::clockIsExternal() const
     {
-      return parse_json<bool>::parse(m_values["ClockIsExternal"]);
+      return parse_json<bool>::parse(field(ClockIsExternalField));
     }
 
     void GetModulationTargetResult::setClockIsExternal(bool clockIsExternal)
     {
-      m_values.AddMember("ClockIsExternal", parse_json<bool>::format(clockIsExternal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ClockIsExternalField, parse_json<bool>::format(clockIsExternal, m_values.GetAllocator()));
     }
 
 
 
     std::string GetModulationTargetResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetModulationTargetResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
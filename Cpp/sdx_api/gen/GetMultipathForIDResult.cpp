@@ -33,6 +33,20 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetMultipathForIDResult);
 
+    namespace
+    {
+      // Fields of GetMultipathForIDResult, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t SystemField = 1;
+      constexpr std::size_t SignalField = 2;
+      constexpr std::size_t SvIdField = 3;
+      constexpr std::size_t PowerLossField = 4;
+      constexpr std::size_t PseudorangeField = 5;
+      constexpr std::size_t DopplerField = 6;
+      constexpr std::size_t CarrierPhaseField = 7;
+      constexpr std::size_t EchoField = 8;
+    }
+
 
     GetMultipathForIDResult::GetMultipathForIDResult()
       : CommandResult(CmdName, TargetId)
@@ -88,15 +102,15 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<double>::is_valid(m_values["PowerLoss"])
-          && parse_json<double>::is_valid(m_values["Pseudorange"])
-          && parse_json<double>::is_valid(m_values["Doppler"])
-          && parse_json<double>::is_valid(m_values["CarrierPhase"])
-          && parse_json<int>::is_valid(m_values["Echo"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<double>::is_valid(field(PowerLossField))
+          && parse_json<double>::is_valid(field(PseudorangeField))
+          && parse_json<double>::is_valid(field(DopplerField))
+          && parse_json<double>::is_valid(field(CarrierPhaseField))
+          && parse_json<int>::is_valid(field(EchoField))
         ;
 
     }
@@ -112,108 +126,108 @@ namespace Sdx
 
     std::string GetMultipathForIDResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetMultipathForIDResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMultipathForIDResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetMultipathForIDResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string GetMultipathForIDResult::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetMultipathForIDResult::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int GetMultipathForIDResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetMultipathForIDResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     double GetMultipathForIDResult::powerLoss() const
     {
-      return parse_json<double>::parse(m_values["PowerLoss"]);
+      return parse_json<double>::parse(field(PowerLossField));
     }
 
     void GetMultipathForIDResult::setPowerLoss(double powerLoss)
     {
-      m_values.AddMember("PowerLoss", parse_json<double>::format(powerLoss, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerLossField, parse_json<double>::format(powerLoss, m_values.GetAllocator()));
     }
 
 
 
     double GetMultipathForIDResult::pseudorange() const
     {
-      return parse_json<double>::parse(m_values["Pseudorange"]);
+      return parse_json<double>::parse(field(PseudorangeField));
     }
 
     void GetMultipathForIDResult::setPseudorange(double pseudorange)
     {
-      m_values.AddMember("Pseudorange", parse_json<double>::format(pseudorange, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PseudorangeField, parse_json<double>::format(pseudorange, m_values.GetAllocator()));
     }
 
 
 
     double GetMultipathForIDResult::doppler() const
     {
-      return parse_json<double>::parse(m_values["Doppler"]);
+      return parse_json<double>::parse(field(DopplerField));
     }
 
     void GetMultipathForIDResult::setDoppler(double doppler)
     {
-      m_values.AddMember("Doppler", parse_json<double>::format(doppler, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DopplerField, parse_json<double>::format(doppler, m_values.GetAllocator()));
     }
 
 
 
     double GetMultipathForIDResult::carrierPhase() const
     {
-      return parse_json<double>::parse(m_values["CarrierPhase"]);
+      return parse_json<double>::parse(field(CarrierPhaseField));
     }
 
     void GetMultipathForIDResult::setCarrierPhase(double carrierPhase)
     {
-      m_values.AddMember("CarrierPhase", parse_json<double>::format(carrierPhase, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CarrierPhaseField, parse_json<double>::format(carrierPhase, m_values.GetAllocator()));
     }
 
 
 
     int GetMultipathForIDResult::echo() const
     {
-      return parse_json<int>::parse(m_values["Echo"]);
+      return parse_json<int>::parse(field(EchoField));
     }
 
     void GetMultipathForIDResult::setEcho(int echo)
     {
-      m_values.AddMember("Echo", parse_json<int>::format(echo, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EchoField, parse_json<int>::format(echo, m_values.GetAllocator()));
     }
 
 
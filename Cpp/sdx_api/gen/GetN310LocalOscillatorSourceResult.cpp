@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetN310LocalOscillatorSourceResult);
 
+    namespace
+    {
+      // Fields of GetN310LocalOscillatorSourceResult, indices in fieldNames()
+      constexpr std::size_t IsExternalField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     GetN310LocalOscillatorSourceResult::GetN310LocalOscillatorSourceResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsExternal"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(IsExternalField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     bool GetN310LocalOscillatorSourceResult::isExternal() const
     {
-      return parse_json<bool>::parse(m_values["IsExternal"]);
+      return parse_json<bool>::parse(field(IsExternalField));
     }
 
     void GetN310LocalOscillatorSourceResult::setIsExternal(bool isExternal)
     {
-      m_values.AddMember("IsExternal", parse_json<bool>::format(isExternal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsExternalField, parse_json<bool>::format(isExternal, m_values.GetAllocator()));
     }
 
 
 
     std::string GetN310LocalOscillatorSourceResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetN310LocalOscillatorSourceResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetNmeaLoggerSentencesResult);
 
+    namespace
+    {
+      // Fields of GetNmeaLoggerSentencesResult, indices in fieldNames()
+      constexpr std::size_t SentencesField = 0;
+    }
+
 
     GetNmeaLoggerSentencesResult::GetNmeaLoggerSentencesResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["Sentences"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SentencesField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<std::string> GetNmeaLoggerSentencesResult::sentences() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["Sentences"]);
+      return fieldValue<std::vector<std::string>>(SentencesField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetNmeaLoggerSentencesResult::sentencesPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SentencesField);
     }
 
     void GetNmeaLoggerSentencesResult::setSentences(const std::vector<std::string>& sentences)
     {
-      m_values.AddMember("Sentences", parse_json<std::vector<std::string>>::format(sentences, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SentencesField, parse_json<std::vector<std::string>>::format(sentences, m_values.GetAllocator()));
     }
 
 
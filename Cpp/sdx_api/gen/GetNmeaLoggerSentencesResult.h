@@ -47,6 +47,7 @@ namespace Sdx
 
       // **** sentences ****
       std::vector<std::string> sentences() const;
+      std::shared_ptr<const std::vector<std::string>> sentencesPtr() const;
       void setSentences(const std::vector<std::string>& sentences);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetNmeaLoggerSentencesResult);
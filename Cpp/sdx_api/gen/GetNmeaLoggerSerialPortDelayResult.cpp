@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetNmeaLoggerSerialPortDelayResult);
 
+    namespace
+    {
+      // Fields of GetNmeaLoggerSerialPortDelayResult, indices in fieldNames()
+      constexpr std::size_t DelayField = 0;
+    }
+
 
     GetNmeaLoggerSerialPortDelayResult::GetNmeaLoggerSerialPortDelayResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Delay"])
+          && parse_json<int>::is_valid(field(DelayField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetNmeaLoggerSerialPortDelayResult::delay() const
     {
-      return parse_json<int>::parse(m_values["Delay"]);
+      return parse_json<int>::parse(field(DelayField));
     }
 
     void GetNmeaLoggerSerialPortDelayResult::setDelay(int delay)
     {
-      m_values.AddMember("Delay", parse_json<int>::format(delay, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DelayField, parse_json<int>::format(delay, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetNtpServerResult);
 
+    namespace
+    {
+      // Fields of GetNtpServerResult, indices in fieldNames()
+      constexpr std::size_t AddressField = 0;
+      constexpr std::size_t PortField = 1;
+    }
+
 
     GetNtpServerResult::GetNtpServerResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Address"])
-          && parse_json<std::optional<int>>::is_valid(m_values["Port"])
+          && parse_json<std::string>::is_valid(field(AddressField))
+          && parse_json<std::optional<int>>::is_valid(field(PortField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetNtpServerResult::address() const
     {
-      return parse_json<std::string>::parse(m_values["Address"]);
+      return fieldValue<std::string>(AddressField);
     }
 
     void GetNtpServerResult::setAddress(const std::string& address)
     {
-      m_values.AddMember("Address", parse_json<std::string>::format(address, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AddressField, parse_json<std::string>::format(address, m_values.GetAllocator()));
     }
 
 
 
     std::optional<int> GetNtpServerResult::port() const
     {
-      return parse_json<std::optional<int>>::parse(m_values["Port"]);
+      return parse_json<std::optional<int>>::parse(field(PortField));
     }
 
     void GetNtpServerResult::setPort(const std::optional<int>& port)
     {
-      m_values.AddMember("Port", parse_json<std::optional<int>>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PortField, parse_json<std::optional<int>>::format(port, m_values.GetAllocator()));
     }
 
 
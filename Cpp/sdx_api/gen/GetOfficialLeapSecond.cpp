@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetOfficialLeapSecond);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetOfficialLeapSecond);
 
+    namespace
+    {
+      // Fields of GetOfficialLeapSecond, indices in fieldNames()
+      constexpr std::size_t DateField = 0;
+    }
+
 
     GetOfficialLeapSecond::GetOfficialLeapSecond()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Date"])
+          && parse_json<Sdx::DateTime>::is_valid(field(DateField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     Sdx::DateTime GetOfficialLeapSecond::date() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Date"]);
+      return parse_json<Sdx::DateTime>::parse(field(DateField));
     }
 
     void GetOfficialLeapSecond::setDate(const Sdx::DateTime& date)
     {
-      m_values.AddMember("Date", parse_json<Sdx::DateTime>::format(date, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DateField, parse_json<Sdx::DateTime>::format(date, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetOfficialLeapSecondResult);
 
+    namespace
+    {
+      // Fields of GetOfficialLeapSecondResult, indices in fieldNames()
+      constexpr std::size_t LeapSecondField = 0;
+    }
+
 
     GetOfficialLeapSecondResult::GetOfficialLeapSecondResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["LeapSecond"])
+          && parse_json<int>::is_valid(field(LeapSecondField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetOfficialLeapSecondResult::leapSecond() const
     {
-      return parse_json<int>::parse(m_values["LeapSecond"]);
+      return parse_json<int>::parse(field(LeapSecondField));
     }
 
     void GetOfficialLeapSecondResult::setLeapSecond(int leapSecond)
     {
-      m_values.AddMember("LeapSecond", parse_json<int>::format(leapSecond, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LeapSecondField, parse_json<int>::format(leapSecond, m_values.GetAllocator()));
     }
 
 
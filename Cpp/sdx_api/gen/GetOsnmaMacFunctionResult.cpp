@@ -23,6 +23,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetOsnmaMacFunctionResult);
 
+    namespace
+    {
+      // Fields of GetOsnmaMacFunctionResult, indices in fieldNames()
+      constexpr std::size_t MacFunctionField = 0;
+    }
+
 
     GetOsnmaMacFunctionResult::GetOsnmaMacFunctionResult()
       : CommandResult(CmdName, TargetId)
@@ -62,7 +68,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["MacFunction"])
+          && parse_json<std::string>::is_valid(field(MacFunctionField))
         ;
 
     }
@@ -78,12 +84,12 @@ namespace Sdx
 
     std::string GetOsnmaMacFunctionResult::macFunction() const
     {
-      return parse_json<std::string>::parse(m_values["MacFunction"]);
+      return fieldValue<std::string>(MacFunctionField);
     }
 
     void GetOsnmaMacFunctionResult::setMacFunction(const std::string& macFunction)
     {
-      m_values.AddMember("MacFunction", parse_json<std::string>::format(macFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MacFunctionField, parse_json<std::string>::format(macFunction, m_values.GetAllocator()));
     }
 
 
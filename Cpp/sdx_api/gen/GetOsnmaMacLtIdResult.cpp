@@ -23,6 +23,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetOsnmaMacLtIdResult);
 
+    namespace
+    {
+      // Fields of GetOsnmaMacLtIdResult, indices in fieldNames()
+      constexpr std::size_t MacLtIdField = 0;
+    }
+
 
     GetOsnmaMacLtIdResult::GetOsnmaMacLtIdResult()
       : CommandResult(CmdName, TargetId)
@@ -62,7 +68,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["MacLtId"])
+          && parse_json<int>::is_valid(field(MacLtIdField))
         ;
 
     }
@@ -78,12 +84,12 @@ namespace Sdx
 
     int GetOsnmaMacLtIdResult::macLtId() const
     {
-      return parse_json<int>::parse(m_values["MacLtId"]);
+      return parse_json<int>::parse(field(MacLtIdField));
     }
 
     void GetOsnmaMacLtIdResult::setMacLtId(int macLtId)
     {
-      m_values.AddMember("MacLtId", parse_json<int>::format(macLtId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MacLtIdField, parse_json<int>::format(macLtId, m_values.GetAllocator()));
     }
 
 
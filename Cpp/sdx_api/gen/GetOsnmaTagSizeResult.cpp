@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetOsnmaTagSizeResult);
 
+    namespace
+    {
+      // Fields of GetOsnmaTagSizeResult, indices in fieldNames()
+      constexpr std::size_t TagSizeField = 0;
+    }
+
 
     GetOsnmaTagSizeResult::GetOsnmaTagSizeResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["TagSize"])
+          && parse_json<int>::is_valid(field(TagSizeField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetOsnmaTagSizeResult::tagSize() const
     {
-      return parse_json<int>::parse(m_values["TagSize"]);
+      return parse_json<int>::parse(field(TagSizeField));
     }
 
     void GetOsnmaTagSizeResult::setTagSize(int tagSize)
     {
-      m_values.AddMember("TagSize", parse_json<int>::format(tagSize, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TagSizeField, parse_json<int>::format(tagSize, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetOsnmaTeslaHashFunctionResult);
 
+    namespace
+    {
+      // Fields of GetOsnmaTeslaHashFunctionResult, indices in fieldNames()
+      constexpr std::size_t HashFunctionField = 0;
+    }
+
 
     GetOsnmaTeslaHashFunctionResult::GetOsnmaTeslaHashFunctionResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["HashFunction"])
+          && parse_json<std::string>::is_valid(field(HashFunctionField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetOsnmaTeslaHashFunctionResult::hashFunction() const
     {
-      return parse_json<std::string>::parse(m_values["HashFunction"]);
+      return fieldValue<std::string>(HashFunctionField);
     }
 
     void GetOsnmaTeslaHashFunctionResult::setHashFunction(const std::string& hashFunction)
     {
-      m_values.AddMember("HashFunction", parse_json<std::string>::format(hashFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HashFunctionField, parse_json<std::string>::format(hashFunction, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetOsnmaTeslaKeySizeResult);
 
+    namespace
+    {
+      // Fields of GetOsnmaTeslaKeySizeResult, indices in fieldNames()
+      constexpr std::size_t KeySizeField = 0;
+    }
+
 
     GetOsnmaTeslaKeySizeResult::GetOsnmaTeslaKeySizeResult()
       : CommandResult(CmdName, TargetId)
@@ -62,7 +68,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["KeySize"])
+          && parse_json<int>::is_valid(field(KeySizeField))
         ;
 
     }
@@ -78,12 +84,12 @@ namespace Sdx
 
     int GetOsnmaTeslaKeySizeResult::keySize() const
     {
-      return parse_json<int>::parse(m_values["KeySize"]);
+      return parse_json<int>::parse(field(KeySizeField));
     }
 
     void GetOsnmaTeslaKeySizeResult::setKeySize(int keySize)
     {
-      m_values.AddMember("KeySize", parse_json<int>::format(keySize, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(KeySizeField, parse_json<int>::format(keySize, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPerturbationsForAllSat);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPerturbationsForAllSat);
 
+    namespace
+    {
+      // Fields of GetPerturbationsForAllSat, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t DataSetNameField = 1;
+    }
+
 
     GetPerturbationsForAllSat::GetPerturbationsForAllSat()
       : CommandBase(CmdName, TargetId)
@@ -52,8 +59,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -75,24 +82,24 @@ namespace Sdx
 
     std::string GetPerturbationsForAllSat::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetPerturbationsForAllSat::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetPerturbationsForAllSat::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetPerturbationsForAllSat::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
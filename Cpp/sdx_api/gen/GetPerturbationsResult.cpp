@@ -30,6 +30,20 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPerturbationsResult);
 
+    namespace
+    {
+      // Fields of GetPerturbationsResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t CrsField = 2;
+      constexpr std::size_t CrcField = 3;
+      constexpr std::size_t CisField = 4;
+      constexpr std::size_t CicField = 5;
+      constexpr std::size_t CusField = 6;
+      constexpr std::size_t CucField = 7;
+      constexpr std::size_t DataSetNameField = 8;
+    }
+
 
     GetPerturbationsResult::GetPerturbationsResult()
       : CommandResult(CmdName, TargetId)
@@ -85,15 +99,15 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<double>::is_valid(m_values["Crs"])
-          && parse_json<double>::is_valid(m_values["Crc"])
-          && parse_json<double>::is_valid(m_values["Cis"])
-          && parse_json<double>::is_valid(m_values["Cic"])
-          && parse_json<double>::is_valid(m_values["Cus"])
-          && parse_json<double>::is_valid(m_values["Cuc"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<double>::is_valid(field(CrsField))
+          && parse_json<double>::is_valid(field(CrcField))
+          && parse_json<double>::is_valid(field(CisField))
+          && parse_json<double>::is_valid(field(CicField))
+          && parse_json<double>::is_valid(field(CusField))
+          && parse_json<double>::is_valid(field(CucField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -109,108 +123,108 @@ namespace Sdx
 
     std::string GetPerturbationsResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetPerturbationsResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetPerturbationsResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetPerturbationsResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     double GetPerturbationsResult::crs() const
     {
-      return parse_json<double>::parse(m_values["Crs"]);
+      return parse_json<double>::parse(field(CrsField));
     }
 
     void GetPerturbationsResult::setCrs(double crs)
     {
-      m_values.AddMember("Crs", parse_json<double>::format(crs, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CrsField, parse_json<double>::format(crs, m_values.GetAllocator()));
     }
 
 
 
     double GetPerturbationsResult::crc() const
     {
-      return parse_json<double>::parse(m_values["Crc"]);
+      return parse_json<double>::parse(field(CrcField));
     }
 
     void GetPerturbationsResult::setCrc(double crc)
     {
-      m_values.AddMember("Crc", parse_json<double>::format(crc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CrcField, parse_json<double>::format(crc, m_values.GetAllocator()));
     }
 
 
 
     double GetPerturbationsResult::cis() const
     {
-      return parse_json<double>::parse(m_values["Cis"]);
+      return parse_json<double>::parse(field(CisField));
     }
 
     void GetPerturbationsResult::setCis(double cis)
     {
-      m_values.AddMember("Cis", parse_json<double>::format(cis, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CisField, parse_json<double>::format(cis, m_values.GetAllocator()));
     }
 
 
 
     double GetPerturbationsResult::cic() const
     {
-      return parse_json<double>::parse(m_values["Cic"]);
+      return parse_json<double>::parse(field(CicField));
     }
 
     void GetPerturbationsResult::setCic(double cic)
     {
-      m_values.AddMember("Cic", parse_json<double>::format(cic, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CicField, parse_json<double>::format(cic, m_values.GetAllocator()));
     }
 
 
 
     double GetPerturbationsResult::cus() const
     {
-      return parse_json<double>::parse(m_values["Cus"]);
+      return parse_json<double>::parse(field(CusField));
     }
 
     void GetPerturbationsResult::setCus(double cus)
     {
-      m_values.AddMember("Cus", parse_json<double>::format(cus, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CusField, parse_json<double>::format(cus, m_values.GetAllocator()));
     }
 
 
 
     double GetPerturbationsResult::cuc() const
     {
-      return parse_json<double>::parse(m_values["Cuc"]);
+      return parse_json<double>::parse(field(CucField));
     }
 
     void GetPerturbationsResult::setCuc(double cuc)
     {
-      m_values.AddMember("Cuc", parse_json<double>::format(cuc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CucField, parse_json<double>::format(cuc, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetPerturbationsResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void GetPerturbationsResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPluginsResult);
 
+    namespace
+    {
+      // Fields of GetPluginsResult, indices in fieldNames()
+      constexpr std::size_t PluginsField = 0;
+    }
+
 
     GetPluginsResult::GetPluginsResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["Plugins"])
+          && parse_json<std::vector<std::string>>::is_valid(field(PluginsField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<std::string> GetPluginsResult::plugins() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["Plugins"]);
+      return fieldValue<std::vector<std::string>>(PluginsField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetPluginsResult::pluginsPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(PluginsField);
     }
 
     void GetPluginsResult::setPlugins(const std::vector<std::string>& plugins)
     {
-      m_values.AddMember("Plugins", parse_json<std::vector<std::string>>::format(plugins, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PluginsField, parse_json<std::vector<std::string>>::format(plugins, m_values.GetAllocator()));
     }
 
 
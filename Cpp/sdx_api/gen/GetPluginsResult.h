@@ -47,6 +47,7 @@ namespace Sdx
 
       // **** plugins ****
       std::vector<std::string> plugins() const;
+      std::shared_ptr<const std::vector<std::string>> pluginsPtr() const;
       void setPlugins(const std::vector<std::string>& plugins);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPluginsResult);
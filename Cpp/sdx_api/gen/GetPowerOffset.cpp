@@ -29,6 +29,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPowerOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPowerOffset);
 
+    namespace
+    {
+      // Fields of GetPowerOffset, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+    }
+
 
     GetPowerOffset::GetPowerOffset()
       : CommandBase(CmdName, TargetId)
@@ -55,7 +61,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
+          && parse_json<std::string>::is_valid(field(SignalField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetPowerOffset::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetPowerOffset::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPowerSbasOffsetResult);
 
+    namespace
+    {
+      // Fields of GetPowerSbasOffsetResult, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t OffsetField = 1;
+    }
+
 
     GetPowerSbasOffsetResult::GetPowerSbasOffsetResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<double>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<double>::is_valid(field(OffsetField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetPowerSbasOffsetResult::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void GetPowerSbasOffsetResult::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     double GetPowerSbasOffsetResult::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void GetPowerSbasOffsetResult::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** prn ****
       std::vector<int> prn() const;
+      std::shared_ptr<const std::vector<int>> prnPtr() const;
       void setPrn(const std::vector<int>& prn);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPrnForEachSVResult);
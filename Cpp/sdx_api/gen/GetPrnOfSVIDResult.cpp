@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPrnOfSVIDResult);
 
+    namespace
+    {
+      // Fields of GetPrnOfSVIDResult, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t PrnField = 2;
+    }
+
 
     GetPrnOfSVIDResult::GetPrnOfSVIDResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["Prn"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(PrnField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     std::string GetPrnOfSVIDResult::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetPrnOfSVIDResult::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int GetPrnOfSVIDResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetPrnOfSVIDResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetPrnOfSVIDResult::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void GetPrnOfSVIDResult::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPropagationModelParameters);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPropagationModelParameters);
 
+    namespace
+    {
+      // Fields of GetPropagationModelParameters, indices in fieldNames()
+      constexpr std::size_t ModelField = 0;
+      constexpr std::size_t ParamArrayField = 1;
+    }
+
 
     GetPropagationModelParameters::GetPropagationModelParameters()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::PropagationModelType>::is_valid(m_values["Model"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["ParamArray"])
+          && parse_json<Sdx::PropagationModelType>::is_valid(field(ModelField))
+          && parse_json<std::vector<std::string>>::is_valid(field(ParamArrayField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     Sdx::PropagationModelType GetPropagationModelParameters::model() const
     {
-      return parse_json<Sdx::PropagationModelType>::parse(m_values["Model"]);
+      return parse_json<Sdx::PropagationModelType>::parse(field(ModelField));
     }
 
     void GetPropagationModelParameters::setModel(const Sdx::PropagationModelType& model)
     {
-      m_values.AddMember("Model", parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModelField, parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetPropagationModelParameters::paramArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["ParamArray"]);
+      return fieldValue<std::vector<std::string>>(ParamArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetPropagationModelParameters::paramArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(ParamArrayField);
     }
 
     void GetPropagationModelParameters::setParamArray(const std::vector<std::string>& paramArray)
     {
-      m_values.AddMember("ParamArray", parse_json<std::vector<std::string>>::format(paramArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamArrayField, parse_json<std::vector<std::string>>::format(paramArray, m_values.GetAllocator()));
     }
 
 
@@ -52,6 +52,7 @@ namespace Sdx
 
       // **** paramArray ****
       std::vector<std::string> paramArray() const;
+      std::shared_ptr<const std::vector<std::string>> paramArrayPtr() const;
       void setParamArray(const std::vector<std::string>& paramArray);
     };
     
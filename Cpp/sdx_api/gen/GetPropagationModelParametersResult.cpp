@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPropagationModelParametersResult);
 
+    namespace
+    {
+      // Fields of GetPropagationModelParametersResult, indices in fieldNames()
+      constexpr std::size_t ModelField = 0;
+      constexpr std::size_t ParamValueDictField = 1;
+    }
+
 
     GetPropagationModelParametersResult::GetPropagationModelParametersResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::PropagationModelType>::is_valid(m_values["Model"])
-          && parse_json<std::map<std::string, double>>::is_valid(m_values["ParamValueDict"])
+          && parse_json<Sdx::PropagationModelType>::is_valid(field(ModelField))
+          && parse_json<std::map<std::string, double>>::is_valid(field(ParamValueDictField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     Sdx::PropagationModelType GetPropagationModelParametersResult::model() const
     {
-      return parse_json<Sdx::PropagationModelType>::parse(m_values["Model"]);
+      return parse_json<Sdx::PropagationModelType>::parse(field(ModelField));
     }
 
     void GetPropagationModelParametersResult::setModel(const Sdx::PropagationModelType& model)
     {
-      m_values.AddMember("Model", parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModelField, parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, double> GetPropagationModelParametersResult::paramValueDict() const
     {
-      return parse_json<std::map<std::string, double>>::parse(m_values["ParamValueDict"]);
+      return fieldValue<std::map<std::string, double>>(ParamValueDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, double>> GetPropagationModelParametersResult::paramValueDictPtr() const
+    {
+      return sharedValue<std::map<std::string, double>>(ParamValueDictField);
     }
 
     void GetPropagationModelParametersResult::setParamValueDict(const std::map<std::string, double>& paramValueDict)
     {
-      m_values.AddMember("ParamValueDict", parse_json<std::map<std::string, double>>::format(paramValueDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamValueDictField, parse_json<std::map<std::string, double>>::format(paramValueDict, m_values.GetAllocator()));
     }
 
 
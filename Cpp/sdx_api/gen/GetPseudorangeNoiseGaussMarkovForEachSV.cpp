@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPseudorangeNoiseGaussMarkovForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPseudorangeNoiseGaussMarkovForEachSV);
 
+    namespace
+    {
+      // Fields of GetPseudorangeNoiseGaussMarkovForEachSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ProcessField = 1;
+    }
+
 
     GetPseudorangeNoiseGaussMarkovForEachSV::GetPseudorangeNoiseGaussMarkovForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Process"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(ProcessField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetPseudorangeNoiseGaussMarkovForEachSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetPseudorangeNoiseGaussMarkovForEachSV::process() const
     {
-      return parse_json<int>::parse(m_values["Process"]);
+      return parse_json<int>::parse(field(ProcessField));
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSV::setProcess(int process)
     {
-      m_values.AddMember("Process", parse_json<int>::format(process, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ProcessField, parse_json<int>::format(process, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,17 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPseudorangeNoiseGaussMarkovForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetPseudorangeNoiseGaussMarkovForEachSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ProcessField = 1;
+      constexpr std::size_t EnabledField = 2;
+      constexpr std::size_t SigmaField = 3;
+      constexpr std::size_t TimeField = 4;
+      constexpr std::size_t SeedField = 5;
+    }
+
 
     GetPseudorangeNoiseGaussMarkovForEachSVResult::GetPseudorangeNoiseGaussMarkovForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -76,12 +87,12 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Process"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Sigma"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Time"])
-          && parse_json<std::vector<int>>::is_valid(m_values["Seed"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(ProcessField))
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
+          && parse_json<std::vector<double>>::is_valid(field(SigmaField))
+          && parse_json<std::vector<double>>::is_valid(field(TimeField))
+          && parse_json<std::vector<int>>::is_valid(field(SeedField))
         ;
 
     }
@@ -97,72 +108,92 @@ namespace Sdx
 
     std::string GetPseudorangeNoiseGaussMarkovForEachSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetPseudorangeNoiseGaussMarkovForEachSVResult::process() const
     {
-      return parse_json<int>::parse(m_values["Process"]);
+      return parse_json<int>::parse(field(ProcessField));
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSVResult::setProcess(int process)
     {
-      m_values.AddMember("Process", parse_json<int>::format(process, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ProcessField, parse_json<int>::format(process, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> GetPseudorangeNoiseGaussMarkovForEachSVResult::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> GetPseudorangeNoiseGaussMarkovForEachSVResult::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSVResult::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> GetPseudorangeNoiseGaussMarkovForEachSVResult::sigma() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Sigma"]);
+      return fieldValue<std::vector<double>>(SigmaField);
+    }
+
+    std::shared_ptr<const std::vector<double>> GetPseudorangeNoiseGaussMarkovForEachSVResult::sigmaPtr() const
+    {
+      return sharedValue<std::vector<double>>(SigmaField);
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSVResult::setSigma(const std::vector<double>& sigma)
     {
-      m_values.AddMember("Sigma", parse_json<std::vector<double>>::format(sigma, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SigmaField, parse_json<std::vector<double>>::format(sigma, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> GetPseudorangeNoiseGaussMarkovForEachSVResult::time() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Time"]);
+      return fieldValue<std::vector<double>>(TimeField);
+    }
+
+    std::shared_ptr<const std::vector<double>> GetPseudorangeNoiseGaussMarkovForEachSVResult::timePtr() const
+    {
+      return sharedValue<std::vector<double>>(TimeField);
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSVResult::setTime(const std::vector<double>& time)
     {
-      m_values.AddMember("Time", parse_json<std::vector<double>>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<std::vector<double>>::format(time, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> GetPseudorangeNoiseGaussMarkovForEachSVResult::seed() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Seed"]);
+      return fieldValue<std::vector<int>>(SeedField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetPseudorangeNoiseGaussMarkovForEachSVResult::seedPtr() const
+    {
+      return sharedValue<std::vector<int>>(SeedField);
     }
 
     void GetPseudorangeNoiseGaussMarkovForEachSVResult::setSeed(const std::vector<int>& seed)
     {
-      m_values.AddMember("Seed", parse_json<std::vector<int>>::format(seed, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SeedField, parse_json<std::vector<int>>::format(seed, m_values.GetAllocator()));
     }
 
 
@@ -63,21 +63,25 @@ namespace Sdx
 
       // **** enabled ****
       std::vector<bool> enabled() const;
+      std::shared_ptr<const std::vector<bool>> enabledPtr() const;
       void setEnabled(const std::vector<bool>& enabled);
 
 
       // **** sigma ****
       std::vector<double> sigma() const;
+      std::shared_ptr<const std::vector<double>> sigmaPtr() const;
       void setSigma(const std::vector<double>& sigma);
 
 
       // **** time ****
       std::vector<double> time() const;
+      std::shared_ptr<const std::vector<double>> timePtr() const;
       void setTime(const std::vector<double>& time);
 
 
       // **** seed ****
       std::vector<int> seed() const;
+      std::shared_ptr<const std::vector<int>> seedPtr() const;
       void setSeed(const std::vector<int>& seed);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPseudorangeNoiseGaussMarkovForEachSVResult);
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPseudorangeNoiseOffsetForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetPseudorangeNoiseOffsetForEachSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t EnabledField = 1;
+      constexpr std::size_t OffsetField = 2;
+    }
+
 
     GetPseudorangeNoiseOffsetForEachSVResult::GetPseudorangeNoiseOffsetForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
+          && parse_json<std::vector<double>>::is_valid(field(OffsetField))
         ;
 
     }
@@ -85,36 +93,46 @@ namespace Sdx
 
     std::string GetPseudorangeNoiseOffsetForEachSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetPseudorangeNoiseOffsetForEachSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> GetPseudorangeNoiseOffsetForEachSVResult::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> GetPseudorangeNoiseOffsetForEachSVResult::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void GetPseudorangeNoiseOffsetForEachSVResult::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> GetPseudorangeNoiseOffsetForEachSVResult::offset() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Offset"]);
+      return fieldValue<std::vector<double>>(OffsetField);
+    }
+
+    std::shared_ptr<const std::vector<double>> GetPseudorangeNoiseOffsetForEachSVResult::offsetPtr() const
+    {
+      return sharedValue<std::vector<double>>(OffsetField);
     }
 
     void GetPseudorangeNoiseOffsetForEachSVResult::setOffset(const std::vector<double>& offset)
     {
-      m_values.AddMember("Offset", parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()));
     }
 
 
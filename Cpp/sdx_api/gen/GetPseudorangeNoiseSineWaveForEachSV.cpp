@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPseudorangeNoiseSineWaveForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPseudorangeNoiseSineWaveForEachSV);
 
+    namespace
+    {
+      // Fields of GetPseudorangeNoiseSineWaveForEachSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SineWaveField = 1;
+    }
+
 
     GetPseudorangeNoiseSineWaveForEachSV::GetPseudorangeNoiseSineWaveForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SineWave"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SineWaveField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetPseudorangeNoiseSineWaveForEachSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetPseudorangeNoiseSineWaveForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetPseudorangeNoiseSineWaveForEachSV::sineWave() const
     {
-      return parse_json<int>::parse(m_values["SineWave"]);
+      return parse_json<int>::parse(field(SineWaveField));
     }
 
     void GetPseudorangeNoiseSineWaveForEachSV::setSineWave(int sineWave)
     {
-      m_values.AddMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SineWaveField, parse_json<int>::format(sineWave, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPseudorangeNoiseSineWaveForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPseudorangeNoiseSineWaveForSV);
 
+    namespace
+    {
+      // Fields of GetPseudorangeNoiseSineWaveForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t SineWaveField = 2;
+    }
+
 
     GetPseudorangeNoiseSineWaveForSV::GetPseudorangeNoiseSineWaveForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["SineWave"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(SineWaveField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string GetPseudorangeNoiseSineWaveForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetPseudorangeNoiseSineWaveForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetPseudorangeNoiseSineWaveForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetPseudorangeNoiseSineWaveForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int GetPseudorangeNoiseSineWaveForSV::sineWave() const
     {
-      return parse_json<int>::parse(m_values["SineWave"]);
+      return parse_json<int>::parse(field(SineWaveField));
     }
 
     void GetPseudorangeNoiseSineWaveForSV::setSineWave(int sineWave)
     {
-      m_values.AddMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SineWaveField, parse_json<int>::format(sineWave, m_values.GetAllocator()));
     }
 
 
@@ -36,6 +36,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetPseudorangeRampForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetPseudorangeRampForSV);
 
+    namespace
+    {
+      // Fields of GetPseudorangeRampForSV, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+    }
+
 
     GetPseudorangeRampForSV::GetPseudorangeRampForSV()
       : CommandBase(CmdName, TargetId)
@@ -62,7 +68,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -84,12 +90,12 @@ namespace Sdx
 
     std::string GetPseudorangeRampForSV::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetPseudorangeRampForSV::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,17 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetQzssL1SAugmentationResult);
 
+    namespace
+    {
+      // Fields of GetQzssL1SAugmentationResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t PrnField = 1;
+      constexpr std::size_t AugmentIODField = 2;
+      constexpr std::size_t AugmentPRCField = 3;
+      constexpr std::size_t PrcField = 4;
+      constexpr std::size_t IdField = 5;
+    }
+
 
     GetQzssL1SAugmentationResult::GetQzssL1SAugmentationResult()
       : CommandResult(CmdName, TargetId)
@@ -76,12 +87,12 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Prn"])
-          && parse_json<bool>::is_valid(m_values["AugmentIOD"])
-          && parse_json<bool>::is_valid(m_values["AugmentPRC"])
-          && parse_json<double>::is_valid(m_values["Prc"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(PrnField))
+          && parse_json<bool>::is_valid(field(AugmentIODField))
+          && parse_json<bool>::is_valid(field(AugmentPRCField))
+          && parse_json<double>::is_valid(field(PrcField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -97,72 +108,72 @@ namespace Sdx
 
     std::string GetQzssL1SAugmentationResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetQzssL1SAugmentationResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int GetQzssL1SAugmentationResult::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void GetQzssL1SAugmentationResult::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
 
     bool GetQzssL1SAugmentationResult::augmentIOD() const
     {
-      return parse_json<bool>::parse(m_values["AugmentIOD"]);
+      return parse_json<bool>::parse(field(AugmentIODField));
     }
 
     void GetQzssL1SAugmentationResult::setAugmentIOD(bool augmentIOD)
     {
-      m_values.AddMember("AugmentIOD", parse_json<bool>::format(augmentIOD, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AugmentIODField, parse_json<bool>::format(augmentIOD, m_values.GetAllocator()));
     }
 
 
 
     bool GetQzssL1SAugmentationResult::augmentPRC() const
     {
-      return parse_json<bool>::parse(m_values["AugmentPRC"]);
+      return parse_json<bool>::parse(field(AugmentPRCField));
     }
 
     void GetQzssL1SAugmentationResult::setAugmentPRC(bool augmentPRC)
     {
-      m_values.AddMember("AugmentPRC", parse_json<bool>::format(augmentPRC, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AugmentPRCField, parse_json<bool>::format(augmentPRC, m_values.GetAllocator()));
     }
 
 
 
     double GetQzssL1SAugmentationResult::prc() const
     {
-      return parse_json<double>::parse(m_values["Prc"]);
+      return parse_json<double>::parse(field(PrcField));
     }
 
     void GetQzssL1SAugmentationResult::setPrc(double prc)
     {
-      m_values.AddMember("Prc", parse_json<double>::format(prc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrcField, parse_json<double>::format(prc, m_values.GetAllocator()));
     }
 
 
 
     std::string GetQzssL1SAugmentationResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetQzssL1SAugmentationResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
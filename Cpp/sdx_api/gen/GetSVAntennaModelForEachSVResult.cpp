@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSVAntennaModelForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetSVAntennaModelForEachSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t AntennaModelNamesField = 1;
+    }
+
 
     GetSVAntennaModelForEachSVResult::GetSVAntennaModelForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["AntennaModelNames"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<std::string>>::is_valid(field(AntennaModelNamesField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetSVAntennaModelForEachSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetSVAntennaModelForEachSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetSVAntennaModelForEachSVResult::antennaModelNames() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["AntennaModelNames"]);
+      return fieldValue<std::vector<std::string>>(AntennaModelNamesField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetSVAntennaModelForEachSVResult::antennaModelNamesPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(AntennaModelNamesField);
     }
 
     void GetSVAntennaModelForEachSVResult::setAntennaModelNames(const std::vector<std::string>& antennaModelNames)
     {
-      m_values.AddMember("AntennaModelNames", parse_json<std::vector<std::string>>::format(antennaModelNames, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaModelNamesField, parse_json<std::vector<std::string>>::format(antennaModelNames, m_values.GetAllocator()));
     }
 
 
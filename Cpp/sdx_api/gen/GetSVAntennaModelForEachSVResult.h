@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** antennaModelNames ****
       std::vector<std::string> antennaModelNames() const;
+      std::shared_ptr<const std::vector<std::string>> antennaModelNamesPtr() const;
       void setAntennaModelNames(const std::vector<std::string>& antennaModelNames);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSVAntennaModelForEachSVResult);
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSVAntennaPhaseOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSVAntennaPhaseOffset);
 
+    namespace
+    {
+      // Fields of GetSVAntennaPhaseOffset, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t SystemField = 1;
+      constexpr std::size_t NameField = 2;
+    }
+
 
     GetSVAntennaPhaseOffset::GetSVAntennaPhaseOffset()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::GNSSBand>::is_valid(m_values["Band"])
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["Name"])
+          && parse_json<Sdx::GNSSBand>::is_valid(field(BandField))
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::optional<std::string>>::is_valid(field(NameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     Sdx::GNSSBand GetSVAntennaPhaseOffset::band() const
     {
-      return parse_json<Sdx::GNSSBand>::parse(m_values["Band"]);
+      return parse_json<Sdx::GNSSBand>::parse(field(BandField));
     }
 
     void GetSVAntennaPhaseOffset::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSVAntennaPhaseOffset::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetSVAntennaPhaseOffset::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetSVAntennaPhaseOffset::name() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["Name"]);
+      return fieldValue<std::optional<std::string>>(NameField);
     }
 
     void GetSVAntennaPhaseOffset::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
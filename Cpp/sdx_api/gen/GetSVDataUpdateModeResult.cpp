@@ -24,6 +24,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSVDataUpdateModeResult);
 
+    namespace
+    {
+      // Fields of GetSVDataUpdateModeResult, indices in fieldNames()
+      constexpr std::size_t ModeField = 0;
+    }
+
 
     GetSVDataUpdateModeResult::GetSVDataUpdateModeResult()
       : CommandResult(CmdName, TargetId)
@@ -63,7 +69,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::SVDataUpdateMode>::is_valid(m_values["Mode"])
+          && parse_json<Sdx::SVDataUpdateMode>::is_valid(field(ModeField))
         ;
 
     }
@@ -79,12 +85,12 @@ namespace Sdx
 
     Sdx::SVDataUpdateMode GetSVDataUpdateModeResult::mode() const
     {
-      return parse_json<Sdx::SVDataUpdateMode>::parse(m_values["Mode"]);
+      return parse_json<Sdx::SVDataUpdateMode>::parse(field(ModeField));
     }
 
     void GetSVDataUpdateModeResult::setMode(const Sdx::SVDataUpdateMode& mode)
     {
-      m_values.AddMember("Mode", parse_json<Sdx::SVDataUpdateMode>::format(mode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModeField, parse_json<Sdx::SVDataUpdateMode>::format(mode, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSVGainPatternOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSVGainPatternOffset);
 
+    namespace
+    {
+      // Fields of GetSVGainPatternOffset, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t SystemField = 1;
+      constexpr std::size_t AntennaNameField = 2;
+    }
+
 
     GetSVGainPatternOffset::GetSVGainPatternOffset()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::GNSSBand>::is_valid(m_values["Band"])
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["AntennaName"])
+          && parse_json<Sdx::GNSSBand>::is_valid(field(BandField))
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::optional<std::string>>::is_valid(field(AntennaNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     Sdx::GNSSBand GetSVGainPatternOffset::band() const
     {
-      return parse_json<Sdx::GNSSBand>::parse(m_values["Band"]);
+      return parse_json<Sdx::GNSSBand>::parse(field(BandField));
     }
 
     void GetSVGainPatternOffset::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSVGainPatternOffset::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetSVGainPatternOffset::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetSVGainPatternOffset::antennaName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["AntennaName"]);
+      return fieldValue<std::optional<std::string>>(AntennaNameField);
     }
 
     void GetSVGainPatternOffset::setAntennaName(const std::optional<std::string>& antennaName)
     {
-      m_values.AddMember("AntennaName", parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaNameField, parse_json<std::optional<std::string>>::format(antennaName, m_values.GetAllocator()));
     }
 
 
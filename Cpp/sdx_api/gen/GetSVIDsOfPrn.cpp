@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSVIDsOfPrn);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSVIDsOfPrn);
 
+    namespace
+    {
+      // Fields of GetSVIDsOfPrn, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t PrnField = 1;
+    }
+
 
     GetSVIDsOfPrn::GetSVIDsOfPrn()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["Prn"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(PrnField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetSVIDsOfPrn::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetSVIDsOfPrn::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int GetSVIDsOfPrn::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void GetSVIDsOfPrn::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
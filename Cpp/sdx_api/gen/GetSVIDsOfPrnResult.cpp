@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSVIDsOfPrnResult);
 
+    namespace
+    {
+      // Fields of GetSVIDsOfPrnResult, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t PrnField = 1;
+      constexpr std::size_t SvIdListField = 2;
+    }
+
 
     GetSVIDsOfPrnResult::GetSVIDsOfPrnResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["Prn"])
-          && parse_json<std::vector<int>>::is_valid(m_values["SvIdList"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(PrnField))
+          && parse_json<std::vector<int>>::is_valid(field(SvIdListField))
         ;
 
     }
@@ -85,36 +93,41 @@ namespace Sdx
 
     std::string GetSVIDsOfPrnResult::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetSVIDsOfPrnResult::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int GetSVIDsOfPrnResult::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void GetSVIDsOfPrnResult::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> GetSVIDsOfPrnResult::svIdList() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["SvIdList"]);
+      return fieldValue<std::vector<int>>(SvIdListField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetSVIDsOfPrnResult::svIdListPtr() const
+    {
+      return sharedValue<std::vector<int>>(SvIdListField);
     }
 
     void GetSVIDsOfPrnResult::setSvIdList(const std::vector<int>& svIdList)
     {
-      m_values.AddMember("SvIdList", parse_json<std::vector<int>>::format(svIdList, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdListField, parse_json<std::vector<int>>::format(svIdList, m_values.GetAllocator()));
     }
 
 
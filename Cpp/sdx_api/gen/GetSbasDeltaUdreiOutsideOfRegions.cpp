@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSbasDeltaUdreiOutsideOfRegions);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSbasDeltaUdreiOutsideOfRegions);
 
+    namespace
+    {
+      // Fields of GetSbasDeltaUdreiOutsideOfRegions, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+    }
+
 
     GetSbasDeltaUdreiOutsideOfRegions::GetSbasDeltaUdreiOutsideOfRegions()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string GetSbasDeltaUdreiOutsideOfRegions::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void GetSbasDeltaUdreiOutsideOfRegions::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSbasDeltaUdreiOutsideOfRegionsResult);
 
+    namespace
+    {
+      // Fields of GetSbasDeltaUdreiOutsideOfRegionsResult, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t DeltaUdreiField = 1;
+    }
+
 
     GetSbasDeltaUdreiOutsideOfRegionsResult::GetSbasDeltaUdreiOutsideOfRegionsResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<int>::is_valid(m_values["DeltaUdrei"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<int>::is_valid(field(DeltaUdreiField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetSbasDeltaUdreiOutsideOfRegionsResult::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void GetSbasDeltaUdreiOutsideOfRegionsResult::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     int GetSbasDeltaUdreiOutsideOfRegionsResult::deltaUdrei() const
     {
-      return parse_json<int>::parse(m_values["DeltaUdrei"]);
+      return parse_json<int>::parse(field(DeltaUdreiField));
     }
 
     void GetSbasDeltaUdreiOutsideOfRegionsResult::setDeltaUdrei(int deltaUdrei)
     {
-      m_values.AddMember("DeltaUdrei", parse_json<int>::format(deltaUdrei, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DeltaUdreiField, parse_json<int>::format(deltaUdrei, m_values.GetAllocator()));
     }
 
 
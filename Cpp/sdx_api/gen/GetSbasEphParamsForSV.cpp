@@ -28,6 +28,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSbasEphParamsForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSbasEphParamsForSV);
 
+    namespace
+    {
+      // Fields of GetSbasEphParamsForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t ParamArrayField = 1;
+    }
+
 
     GetSbasEphParamsForSV::GetSbasEphParamsForSV()
       : CommandBase(CmdName, TargetId)
@@ -55,8 +62,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["ParamArray"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::vector<std::string>>::is_valid(field(ParamArrayField))
         ;
 
     }
@@ -78,24 +85,29 @@ namespace Sdx
 
     int GetSbasEphParamsForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetSbasEphParamsForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetSbasEphParamsForSV::paramArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["ParamArray"]);
+      return fieldValue<std::vector<std::string>>(ParamArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetSbasEphParamsForSV::paramArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(ParamArrayField);
     }
 
     void GetSbasEphParamsForSV::setParamArray(const std::vector<std::string>& paramArray)
     {
-      m_values.AddMember("ParamArray", parse_json<std::vector<std::string>>::format(paramArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamArrayField, parse_json<std::vector<std::string>>::format(paramArray, m_values.GetAllocator()));
     }
 
 
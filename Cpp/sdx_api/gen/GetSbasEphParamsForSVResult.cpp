@@ -27,6 +27,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSbasEphParamsForSVResult);
 
+    namespace
+    {
+      // Fields of GetSbasEphParamsForSVResult, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t ParamValueDictField = 1;
+    }
+
 
     GetSbasEphParamsForSVResult::GetSbasEphParamsForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -68,8 +75,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::map<std::string, double>>::is_valid(m_values["ParamValueDict"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::map<std::string, double>>::is_valid(field(ParamValueDictField))
         ;
 
     }
@@ -85,24 +92,29 @@ namespace Sdx
 
     int GetSbasEphParamsForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetSbasEphParamsForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, double> GetSbasEphParamsForSVResult::paramValueDict() const
     {
-      return parse_json<std::map<std::string, double>>::parse(m_values["ParamValueDict"]);
+      return fieldValue<std::map<std::string, double>>(ParamValueDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, double>> GetSbasEphParamsForSVResult::paramValueDictPtr() const
+    {
+      return sharedValue<std::map<std::string, double>>(ParamValueDictField);
     }
 
     void GetSbasEphParamsForSVResult::setParamValueDict(const std::map<std::string, double>& paramValueDict)
     {
-      m_values.AddMember("ParamValueDict", parse_json<std::map<std::string, double>>::format(paramValueDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParamValueDictField, parse_json<std::map<std::string, double>>::format(paramValueDict, m_values.GetAllocator()));
     }
 
 
@@ -57,6 +57,7 @@ namespace Sdx
 
       // **** paramValueDict ****
       std::map<std::string, double> paramValueDict() const;
+      std::shared_ptr<const std::map<std::string, double>> paramValueDictPtr() const;
       void setParamValueDict(const std::map<std::string, double>& paramValueDict);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSbasEphParamsForSVResult);
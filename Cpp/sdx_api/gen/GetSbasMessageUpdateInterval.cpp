@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSbasMessageUpdateInterval);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSbasMessageUpdateInterval);
 
+    namespace
+    {
+      // Fields of GetSbasMessageUpdateInterval, indices in fieldNames()
+      constexpr std::size_t MessageField = 0;
+    }
+
 
     GetSbasMessageUpdateInterval::GetSbasMessageUpdateInterval()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Message"])
+          && parse_json<int>::is_valid(field(MessageField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int GetSbasMessageUpdateInterval::message() const
     {
-      return parse_json<int>::parse(m_values["Message"]);
+      return parse_json<int>::parse(field(MessageField));
     }
 
     void GetSbasMessageUpdateInterval::setMessage(int message)
     {
-      m_values.AddMember("Message", parse_json<int>::format(message, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MessageField, parse_json<int>::format(message, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSbasMessageUpdateIntervalResult);
 
+    namespace
+    {
+      // Fields of GetSbasMessageUpdateIntervalResult, indices in fieldNames()
+      constexpr std::size_t MessageField = 0;
+      constexpr std::size_t UpdateIntervalField = 1;
+    }
+
 
     GetSbasMessageUpdateIntervalResult::GetSbasMessageUpdateIntervalResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Message"])
-          && parse_json<int>::is_valid(m_values["UpdateInterval"])
+          && parse_json<int>::is_valid(field(MessageField))
+          && parse_json<int>::is_valid(field(UpdateIntervalField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     int GetSbasMessageUpdateIntervalResult::message() const
     {
-      return parse_json<int>::parse(m_values["Message"]);
+      return parse_json<int>::parse(field(MessageField));
     }
 
     void GetSbasMessageUpdateIntervalResult::setMessage(int message)
     {
-      m_values.AddMember("Message", parse_json<int>::format(message, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MessageField, parse_json<int>::format(message, m_values.GetAllocator()));
     }
 
 
 
     int GetSbasMessageUpdateIntervalResult::updateInterval() const
     {
-      return parse_json<int>::parse(m_values["UpdateInterval"]);
+      return parse_json<int>::parse(field(UpdateIntervalField));
     }
 
     void GetSbasMessageUpdateIntervalResult::setUpdateInterval(int updateInterval)
     {
-      m_values.AddMember("UpdateInterval", parse_json<int>::format(updateInterval, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UpdateIntervalField, parse_json<int>::format(updateInterval, m_values.GetAllocator()));
     }
 
 
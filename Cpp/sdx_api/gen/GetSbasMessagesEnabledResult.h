@@ -46,6 +46,7 @@ namespace Sdx
 
       // **** messages ****
       std::vector<int> messages() const;
+      std::shared_ptr<const std::vector<int>> messagesPtr() const;
       void setMessages(const std::vector<int>& messages);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSbasMessagesEnabledResult);
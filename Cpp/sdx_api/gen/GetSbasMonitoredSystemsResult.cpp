@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSbasMonitoredSystemsResult);
 
+    namespace
+    {
+      // Fields of GetSbasMonitoredSystemsResult, indices in fieldNames()
+      constexpr std::size_t SystemsField = 0;
+    }
+
 
     GetSbasMonitoredSystemsResult::GetSbasMonitoredSystemsResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["Systems"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SystemsField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<std::string> GetSbasMonitoredSystemsResult::systems() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["Systems"]);
+      return fieldValue<std::vector<std::string>>(SystemsField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetSbasMonitoredSystemsResult::systemsPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SystemsField);
     }
 
     void GetSbasMonitoredSystemsResult::setSystems(const std::vector<std::string>& systems)
     {
-      m_values.AddMember("Systems", parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemsField, parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()));
     }
 
 
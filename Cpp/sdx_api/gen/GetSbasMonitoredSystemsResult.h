@@ -47,6 +47,7 @@ namespace Sdx
 
       // **** systems ****
       std::vector<std::string> systems() const;
+      std::shared_ptr<const std::vector<std::string>> systemsPtr() const;
       void setSystems(const std::vector<std::string>& systems);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSbasMonitoredSystemsResult);
@@ -30,6 +30,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSignalFilterAssignation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSignalFilterAssignation);
 
+    namespace
+    {
+      // Fields of GetSignalFilterAssignation, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+    }
+
 
     GetSignalFilterAssignation::GetSignalFilterAssignation()
       : CommandBase(CmdName, TargetId)
@@ -56,7 +62,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
         ;
 
     }
@@ -78,12 +84,17 @@ namespace Sdx
 
     std::vector<std::string> GetSignalFilterAssignation::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetSignalFilterAssignation::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetSignalFilterAssignation::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
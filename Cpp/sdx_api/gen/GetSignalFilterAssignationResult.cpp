@@ -28,6 +28,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSignalFilterAssignationResult);
 
+    namespace
+    {
+      // Fields of GetSignalFilterAssignationResult, indices in fieldNames()
+      constexpr std::size_t SignalFilterDictField = 0;
+    }
+
 
     GetSignalFilterAssignationResult::GetSignalFilterAssignationResult()
       : CommandResult(CmdName, TargetId)
@@ -67,7 +73,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::map<std::string, std::string>>::is_valid(m_values["SignalFilterDict"])
+          && parse_json<std::map<std::string, std::string>>::is_valid(field(SignalFilterDictField))
         ;
 
     }
@@ -83,12 +89,17 @@ namespace Sdx
 
     std::map<std::string, std::string> GetSignalFilterAssignationResult::signalFilterDict() const
     {
-      return parse_json<std::map<std::string, std::string>>::parse(m_values["SignalFilterDict"]);
+      return fieldValue<std::map<std::string, std::string>>(SignalFilterDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, std::string>> GetSignalFilterAssignationResult::signalFilterDictPtr() const
+    {
+      return sharedValue<std::map<std::string, std::string>>(SignalFilterDictField);
     }
 
     void GetSignalFilterAssignationResult::setSignalFilterDict(const std::map<std::string, std::string>& signalFilterDict)
     {
-      m_values.AddMember("SignalFilterDict", parse_json<std::map<std::string, std::string>>::format(signalFilterDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalFilterDictField, parse_json<std::map<std::string, std::string>>::format(signalFilterDict, m_values.GetAllocator()));
     }
 
 
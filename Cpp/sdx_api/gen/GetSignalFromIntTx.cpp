@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSignalFromIntTx);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSignalFromIntTx);
 
+    namespace
+    {
+      // Fields of GetSignalFromIntTx, indices in fieldNames()
+      constexpr std::size_t IdTransmitterField = 0;
+      constexpr std::size_t SignalTypeField = 1;
+    }
+
 
     GetSignalFromIntTx::GetSignalFromIntTx()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["IdTransmitter"])
-          && parse_json<std::string>::is_valid(m_values["SignalType"])
+          && parse_json<std::string>::is_valid(field(IdTransmitterField))
+          && parse_json<std::string>::is_valid(field(SignalTypeField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string GetSignalFromIntTx::idTransmitter() const
     {
-      return parse_json<std::string>::parse(m_values["IdTransmitter"]);
+      return fieldValue<std::string>(IdTransmitterField);
     }
 
     void GetSignalFromIntTx::setIdTransmitter(const std::string& idTransmitter)
     {
-      m_values.AddMember("IdTransmitter", parse_json<std::string>::format(idTransmitter, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdTransmitterField, parse_json<std::string>::format(idTransmitter, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSignalFromIntTx::signalType() const
     {
-      return parse_json<std::string>::parse(m_values["SignalType"]);
+      return fieldValue<std::string>(SignalTypeField);
     }
 
     void GetSignalFromIntTx::setSignalType(const std::string& signalType)
     {
-      m_values.AddMember("SignalType", parse_json<std::string>::format(signalType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalTypeField, parse_json<std::string>::format(signalType, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSignalFromIntTxResult);
 
+    namespace
+    {
+      // Fields of GetSignalFromIntTxResult, indices in fieldNames()
+      constexpr std::size_t IdTransmitterField = 0;
+      constexpr std::size_t SignalTypeField = 1;
+      constexpr std::size_t IdsSignalField = 2;
+    }
+
 
     GetSignalFromIntTxResult::GetSignalFromIntTxResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["IdTransmitter"])
-          && parse_json<std::string>::is_valid(m_values["SignalType"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["IdsSignal"])
+          && parse_json<std::string>::is_valid(field(IdTransmitterField))
+          && parse_json<std::string>::is_valid(field(SignalTypeField))
+          && parse_json<std::vector<std::string>>::is_valid(field(IdsSignalField))
         ;
 
     }
@@ -85,36 +93,41 @@ namespace Sdx
 
     std::string GetSignalFromIntTxResult::idTransmitter() const
     {
-      return parse_json<std::string>::parse(m_values["IdTransmitter"]);
+      return fieldValue<std::string>(IdTransmitterField);
     }
 
     void GetSignalFromIntTxResult::setIdTransmitter(const std::string& idTransmitter)
     {
-      m_values.AddMember("IdTransmitter", parse_json<std::string>::format(idTransmitter, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdTransmitterField, parse_json<std::string>::format(idTransmitter, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSignalFromIntTxResult::signalType() const
     {
-      return parse_json<std::string>::parse(m_values["SignalType"]);
+      return fieldValue<std::string>(SignalTypeField);
     }
 
     void GetSignalFromIntTxResult::setSignalType(const std::string& signalType)
     {
-      m_values.AddMember("SignalType", parse_json<std::string>::format(signalType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalTypeField, parse_json<std::string>::format(signalType, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetSignalFromIntTxResult::idsSignal() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["IdsSignal"]);
+      return fieldValue<std::vector<std::string>>(IdsSignalField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetSignalFromIntTxResult::idsSignalPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(IdsSignalField);
     }
 
     void GetSignalFromIntTxResult::setIdsSignal(const std::vector<std::string>& idsSignal)
     {
-      m_values.AddMember("IdsSignal", parse_json<std::vector<std::string>>::format(idsSignal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdsSignalField, parse_json<std::vector<std::string>>::format(idsSignal, m_values.GetAllocator()));
     }
 
 
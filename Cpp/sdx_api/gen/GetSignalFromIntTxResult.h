@@ -59,6 +59,7 @@ namespace Sdx
 
       // **** idsSignal ****
       std::vector<std::string> idsSignal() const;
+      std::shared_ptr<const std::vector<std::string>> idsSignalPtr() const;
       void setIdsSignal(const std::vector<std::string>& idsSignal);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSignalFromIntTxResult);
@@ -27,6 +27,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSignalPowerOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSignalPowerOffset);
 
+    namespace
+    {
+      // Fields of GetSignalPowerOffset, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+    }
+
 
     GetSignalPowerOffset::GetSignalPowerOffset()
       : CommandBase(CmdName, TargetId)
@@ -53,7 +59,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
+          && parse_json<std::string>::is_valid(field(SignalField))
         ;
 
     }
@@ -75,12 +81,12 @@ namespace Sdx
 
     std::string GetSignalPowerOffset::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void GetSignalPowerOffset::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
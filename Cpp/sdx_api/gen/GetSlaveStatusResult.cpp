@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSlaveStatusResult);
 
+    namespace
+    {
+      // Fields of GetSlaveStatusResult, indices in fieldNames()
+      constexpr std::size_t IsSlaveField = 0;
+      constexpr std::size_t IsConnectedField = 1;
+      constexpr std::size_t HostNameField = 2;
+      constexpr std::size_t HostPortField = 3;
+    }
+
 
     GetSlaveStatusResult::GetSlaveStatusResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsSlave"])
-          && parse_json<bool>::is_valid(m_values["IsConnected"])
-          && parse_json<std::string>::is_valid(m_values["HostName"])
-          && parse_json<int>::is_valid(m_values["HostPort"])
+          && parse_json<bool>::is_valid(field(IsSlaveField))
+          && parse_json<bool>::is_valid(field(IsConnectedField))
+          && parse_json<std::string>::is_valid(field(HostNameField))
+          && parse_json<int>::is_valid(field(HostPortField))
         ;
 
     }
@@ -89,48 +98,48 @@ namespace Sdx
 
     bool GetSlaveStatusResult::isSlave() const
     {
-      return parse_json<bool>::parse(m_values["IsSlave"]);
+      return parse_json<bool>::parse(field(IsSlaveField));
     }
 
     void GetSlaveStatusResult::setIsSlave(bool isSlave)
     {
-      m_values.AddMember("IsSlave", parse_json<bool>::format(isSlave, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsSlaveField, parse_json<bool>::format(isSlave, m_values.GetAllocator()));
     }
 
 
 
     bool GetSlaveStatusResult::isConnected() const
     {
-      return parse_json<bool>::parse(m_values["IsConnected"]);
+      return parse_json<bool>::parse(field(IsConnectedField));
     }
 
     void GetSlaveStatusResult::setIsConnected(bool isConnected)
     {
-      m_values.AddMember("IsConnected", parse_json<bool>::format(isConnected, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsConnectedField, parse_json<bool>::format(isConnected, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSlaveStatusResult::hostName() const
     {
-      return parse_json<std::string>::parse(m_values["HostName"]);
+      return fieldValue<std::string>(HostNameField);
     }
 
     void GetSlaveStatusResult::setHostName(const std::string& hostName)
     {
-      m_values.AddMember("HostName", parse_json<std::string>::format(hostName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HostNameField, parse_json<std::string>::format(hostName, m_values.GetAllocator()));
     }
 
 
 
     int GetSlaveStatusResult::hostPort() const
     {
-      return parse_json<int>::parse(m_values["HostPort"]);
+      return parse_json<int>::parse(field(HostPortField));
     }
 
     void GetSlaveStatusResult::setHostPort(int hostPort)
     {
-      m_values.AddMember("HostPort", parse_json<int>::format(hostPort, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HostPortField, parse_json<int>::format(hostPort, m_values.GetAllocator()));
     }
 
 
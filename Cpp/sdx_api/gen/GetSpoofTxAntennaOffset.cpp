@@ -29,6 +29,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetSpoofTxAntennaOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSpoofTxAntennaOffset);
 
+    namespace
+    {
+      // Fields of GetSpoofTxAntennaOffset, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+    }
+
 
     GetSpoofTxAntennaOffset::GetSpoofTxAntennaOffset()
       : CommandBase(CmdName, TargetId)
@@ -55,7 +61,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetSpoofTxAntennaOffset::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetSpoofTxAntennaOffset::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
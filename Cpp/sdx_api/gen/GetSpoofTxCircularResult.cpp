@@ -29,6 +29,19 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSpoofTxCircularResult);
 
+    namespace
+    {
+      // Fields of GetSpoofTxCircularResult, indices in fieldNames()
+      constexpr std::size_t LatField = 0;
+      constexpr std::size_t LonField = 1;
+      constexpr std::size_t AltField = 2;
+      constexpr std::size_t RadiusField = 3;
+      constexpr std::size_t SpeedField = 4;
+      constexpr std::size_t ClockwiseField = 5;
+      constexpr std::size_t IdField = 6;
+      constexpr std::size_t OriginAngleField = 7;
+    }
+
 
     GetSpoofTxCircularResult::GetSpoofTxCircularResult()
       : CommandResult(CmdName, TargetId)
@@ -82,14 +95,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Lat"])
-          && parse_json<double>::is_valid(m_values["Lon"])
-          && parse_json<double>::is_valid(m_values["Alt"])
-          && parse_json<double>::is_valid(m_values["Radius"])
-          && parse_json<double>::is_valid(m_values["Speed"])
-          && parse_json<bool>::is_valid(m_values["Clockwise"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::optional<double>>::is_valid(m_values["OriginAngle"])
+          && parse_json<double>::is_valid(field(LatField))
+          && parse_json<double>::is_valid(field(LonField))
+          && parse_json<double>::is_valid(field(AltField))
+          && parse_json<double>::is_valid(field(RadiusField))
+          && parse_json<double>::is_valid(field(SpeedField))
+          && parse_json<bool>::is_valid(field(ClockwiseField))
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::optional<double>>::is_valid(field(OriginAngleField))
         ;
 
     }
@@ -105,96 +118,96 @@ namespace Sdx
 
     double GetSpoofTxCircularResult::lat() const
     {
-      return parse_json<double>::parse(m_values["Lat"]);
+      return parse_json<double>::parse(field(LatField));
     }
 
     void GetSpoofTxCircularResult::setLat(double lat)
     {
-      m_values.AddMember("Lat", parse_json<double>::format(lat, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LatField, parse_json<double>::format(lat, m_values.GetAllocator()));
     }
 
 
 
     double GetSpoofTxCircularResult::lon() const
     {
-      return parse_json<double>::parse(m_values["Lon"]);
+      return parse_json<double>::parse(field(LonField));
     }
 
     void GetSpoofTxCircularResult::setLon(double lon)
     {
-      m_values.AddMember("Lon", parse_json<double>::format(lon, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LonField, parse_json<double>::format(lon, m_values.GetAllocator()));
     }
 
 
 
     double GetSpoofTxCircularResult::alt() const
     {
-      return parse_json<double>::parse(m_values["Alt"]);
+      return parse_json<double>::parse(field(AltField));
     }
 
     void GetSpoofTxCircularResult::setAlt(double alt)
     {
-      m_values.AddMember("Alt", parse_json<double>::format(alt, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AltField, parse_json<double>::format(alt, m_values.GetAllocator()));
     }
 
 
 
     double GetSpoofTxCircularResult::radius() const
     {
-      return parse_json<double>::parse(m_values["Radius"]);
+      return parse_json<double>::parse(field(RadiusField));
     }
 
     void GetSpoofTxCircularResult::setRadius(double radius)
     {
-      m_values.AddMember("Radius", parse_json<double>::format(radius, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RadiusField, parse_json<double>::format(radius, m_values.GetAllocator()));
     }
 
 
 
     double GetSpoofTxCircularResult::speed() const
     {
-      return parse_json<double>::parse(m_values["Speed"]);
+      return parse_json<double>::parse(field(SpeedField));
     }
 
     void GetSpoofTxCircularResult::setSpeed(double speed)
     {
-      m_values.AddMember("Speed", parse_json<double>::format(speed, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SpeedField, parse_json<double>::format(speed, m_values.GetAllocator()));
     }
 
 
 
     bool GetSpoofTxCircularResult::clockwise() const
     {
-      return parse_json<bool>::parse(m_values["Clockwise"]);
+      return parse_json<bool>::parse(field(ClockwiseField));
     }
 
     void GetSpoofTxCircularResult::setClockwise(bool clockwise)
     {
-      m_values.AddMember("Clockwise", parse_json<bool>::format(clockwise, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ClockwiseField, parse_json<bool>::format(clockwise, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSpoofTxCircularResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetSpoofTxCircularResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::optional<double> GetSpoofTxCircularResult::originAngle() const
     {
-      return parse_json<std::optional<double>>::parse(m_values["OriginAngle"]);
+      return parse_json<std::optional<double>>::parse(field(OriginAngleField));
     }
 
     void GetSpoofTxCircularResult::setOriginAngle(const std::optional<double>& originAngle)
     {
-      m_values.AddMember("OriginAngle", parse_json<std::optional<double>>::format(originAngle, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OriginAngleField, parse_json<std::optional<double>>::format(originAngle, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSpoofTxColorResult);
 
+    namespace
+    {
+      // Fields of GetSpoofTxColorResult, indices in fieldNames()
+      constexpr std::size_t ColorField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     GetSpoofTxColorResult::GetSpoofTxColorResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Color"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(ColorField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetSpoofTxColorResult::color() const
     {
-      return parse_json<std::string>::parse(m_values["Color"]);
+      return fieldValue<std::string>(ColorField);
     }
 
     void GetSpoofTxColorResult::setColor(const std::string& color)
     {
-      m_values.AddMember("Color", parse_json<std::string>::format(color, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ColorField, parse_json<std::string>::format(color, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSpoofTxColorResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetSpoofTxColorResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSpoofTxRemoteAddressResult);
 
+    namespace
+    {
+      // Fields of GetSpoofTxRemoteAddressResult, indices in fieldNames()
+      constexpr std::size_t AddressField = 0;
+      constexpr std::size_t InstanceIdField = 1;
+      constexpr std::size_t IdField = 2;
+    }
+
 
     GetSpoofTxRemoteAddressResult::GetSpoofTxRemoteAddressResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Address"])
-          && parse_json<int>::is_valid(m_values["InstanceId"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(AddressField))
+          && parse_json<int>::is_valid(field(InstanceIdField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     std::string GetSpoofTxRemoteAddressResult::address() const
     {
-      return parse_json<std::string>::parse(m_values["Address"]);
+      return fieldValue<std::string>(AddressField);
     }
 
     void GetSpoofTxRemoteAddressResult::setAddress(const std::string& address)
     {
-      m_values.AddMember("Address", parse_json<std::string>::format(address, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AddressField, parse_json<std::string>::format(address, m_values.GetAllocator()));
     }
 
 
 
     int GetSpoofTxRemoteAddressResult::instanceId() const
     {
-      return parse_json<int>::parse(m_values["InstanceId"]);
+      return parse_json<int>::parse(field(InstanceIdField));
     }
 
     void GetSpoofTxRemoteAddressResult::setInstanceId(int instanceId)
     {
-      m_values.AddMember("InstanceId", parse_json<int>::format(instanceId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(InstanceIdField, parse_json<int>::format(instanceId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSpoofTxRemoteAddressResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetSpoofTxRemoteAddressResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -26,6 +26,16 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSpoofTxResult);
 
+    namespace
+    {
+      // Fields of GetSpoofTxResult, indices in fieldNames()
+      constexpr std::size_t UsualNameField = 0;
+      constexpr std::size_t EnabledField = 1;
+      constexpr std::size_t AddressField = 2;
+      constexpr std::size_t InstanceIdField = 3;
+      constexpr std::size_t IdField = 4;
+    }
+
 
     GetSpoofTxResult::GetSpoofTxResult()
       : CommandResult(CmdName, TargetId)
@@ -73,11 +83,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["UsualName"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::string>::is_valid(m_values["Address"])
-          && parse_json<int>::is_valid(m_values["InstanceId"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(UsualNameField))
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::string>::is_valid(field(AddressField))
+          && parse_json<int>::is_valid(field(InstanceIdField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -93,60 +103,60 @@ namespace Sdx
 
     std::string GetSpoofTxResult::usualName() const
     {
-      return parse_json<std::string>::parse(m_values["UsualName"]);
+      return fieldValue<std::string>(UsualNameField);
     }
 
     void GetSpoofTxResult::setUsualName(const std::string& usualName)
     {
-      m_values.AddMember("UsualName", parse_json<std::string>::format(usualName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UsualNameField, parse_json<std::string>::format(usualName, m_values.GetAllocator()));
     }
 
 
 
     bool GetSpoofTxResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetSpoofTxResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSpoofTxResult::address() const
     {
-      return parse_json<std::string>::parse(m_values["Address"]);
+      return fieldValue<std::string>(AddressField);
     }
 
     void GetSpoofTxResult::setAddress(const std::string& address)
     {
-      m_values.AddMember("Address", parse_json<std::string>::format(address, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AddressField, parse_json<std::string>::format(address, m_values.GetAllocator()));
     }
 
 
 
     int GetSpoofTxResult::instanceId() const
     {
-      return parse_json<int>::parse(m_values["InstanceId"]);
+      return parse_json<int>::parse(field(InstanceIdField));
     }
 
     void GetSpoofTxResult::setInstanceId(int instanceId)
     {
-      m_values.AddMember("InstanceId", parse_json<int>::format(instanceId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(InstanceIdField, parse_json<int>::format(instanceId, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSpoofTxResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetSpoofTxResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
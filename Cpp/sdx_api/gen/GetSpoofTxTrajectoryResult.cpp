@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSpoofTxTrajectoryResult);
 
+    namespace
+    {
+      // Fields of GetSpoofTxTrajectoryResult, indices in fieldNames()
+      constexpr std::size_t TrajectoryTypeField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     GetSpoofTxTrajectoryResult::GetSpoofTxTrajectoryResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["TrajectoryType"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(TrajectoryTypeField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetSpoofTxTrajectoryResult::trajectoryType() const
     {
-      return parse_json<std::string>::parse(m_values["TrajectoryType"]);
+      return fieldValue<std::string>(TrajectoryTypeField);
     }
 
     void GetSpoofTxTrajectoryResult::setTrajectoryType(const std::string& trajectoryType)
     {
-      m_values.AddMember("TrajectoryType", parse_json<std::string>::format(trajectoryType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TrajectoryTypeField, parse_json<std::string>::format(trajectoryType, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSpoofTxTrajectoryResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetSpoofTxTrajectoryResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
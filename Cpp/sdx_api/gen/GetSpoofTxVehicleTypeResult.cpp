@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSpoofTxVehicleTypeResult);
 
+    namespace
+    {
+      // Fields of GetSpoofTxVehicleTypeResult, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     GetSpoofTxVehicleTypeResult::GetSpoofTxVehicleTypeResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Type"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(TypeField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetSpoofTxVehicleTypeResult::type() const
     {
-      return parse_json<std::string>::parse(m_values["Type"]);
+      return fieldValue<std::string>(TypeField);
     }
 
     void GetSpoofTxVehicleTypeResult::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
 
     std::string GetSpoofTxVehicleTypeResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void GetSpoofTxVehicleTypeResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetStartTimeModeResult);
 
+    namespace
+    {
+      // Fields of GetStartTimeModeResult, indices in fieldNames()
+      constexpr std::size_t ModeField = 0;
+    }
+
 
     GetStartTimeModeResult::GetStartTimeModeResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Mode"])
+          && parse_json<std::string>::is_valid(field(ModeField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetStartTimeModeResult::mode() const
     {
-      return parse_json<std::string>::parse(m_values["Mode"]);
+      return fieldValue<std::string>(ModeField);
     }
 
     void GetStartTimeModeResult::setMode(const std::string& mode)
     {
-      m_values.AddMember("Mode", parse_json<std::string>::format(mode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModeField, parse_json<std::string>::format(mode, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetStartTimeOffsetResult);
 
+    namespace
+    {
+      // Fields of GetStartTimeOffsetResult, indices in fieldNames()
+      constexpr std::size_t OffsetField = 0;
+    }
+
 
     GetStartTimeOffsetResult::GetStartTimeOffsetResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Offset"])
+          && parse_json<int>::is_valid(field(OffsetField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetStartTimeOffsetResult::offset() const
     {
-      return parse_json<int>::parse(m_values["Offset"]);
+      return parse_json<int>::parse(field(OffsetField));
     }
 
     void GetStartTimeOffsetResult::setOffset(int offset)
     {
-      m_values.AddMember("Offset", parse_json<int>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<int>::format(offset, m_values.GetAllocator()));
     }
 
 
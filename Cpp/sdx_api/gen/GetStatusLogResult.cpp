@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetStatusLogResult);
 
+    namespace
+    {
+      // Fields of GetStatusLogResult, indices in fieldNames()
+      constexpr std::size_t RecordsField = 0;
+    }
+
 
     GetStatusLogResult::GetStatusLogResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<Sdx::LogRecord>>::is_valid(m_values["Records"])
+          && parse_json<std::vector<Sdx::LogRecord>>::is_valid(field(RecordsField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::vector<Sdx::LogRecord> GetStatusLogResult::records() const
     {
-      return parse_json<std::vector<Sdx::LogRecord>>::parse(m_values["Records"]);
+      return fieldValue<std::vector<Sdx::LogRecord>>(RecordsField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::LogRecord>> GetStatusLogResult::recordsPtr() const
+    {
+      return sharedValue<std::vector<Sdx::LogRecord>>(RecordsField);
     }
 
     void GetStatusLogResult::setRecords(const std::vector<Sdx::LogRecord>& records)
     {
-      m_values.AddMember("Records", parse_json<std::vector<Sdx::LogRecord>>::format(records, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RecordsField, parse_json<std::vector<Sdx::LogRecord>>::format(records, m_values.GetAllocator()));
     }
 
 
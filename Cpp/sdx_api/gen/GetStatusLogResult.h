@@ -47,6 +47,7 @@ namespace Sdx
 
       // **** records ****
       std::vector<Sdx::LogRecord> records() const;
+      std::shared_ptr<const std::vector<Sdx::LogRecord>> recordsPtr() const;
       void setRecords(const std::vector<Sdx::LogRecord>& records);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetStatusLogResult);
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetStreamingBufferResult);
 
+    namespace
+    {
+      // Fields of GetStreamingBufferResult, indices in fieldNames()
+      constexpr std::size_t SizeField = 0;
+    }
+
 
     GetStreamingBufferResult::GetStreamingBufferResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Size"])
+          && parse_json<int>::is_valid(field(SizeField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetStreamingBufferResult::size() const
     {
-      return parse_json<int>::parse(m_values["Size"]);
+      return parse_json<int>::parse(field(SizeField));
     }
 
     void GetStreamingBufferResult::setSize(int size)
     {
-      m_values.AddMember("Size", parse_json<int>::format(size, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SizeField, parse_json<int>::format(size, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetSyncTimeMainInstanceResult);
 
+    namespace
+    {
+      // Fields of GetSyncTimeMainInstanceResult, indices in fieldNames()
+      constexpr std::size_t TimeField = 0;
+    }
+
 
     GetSyncTimeMainInstanceResult::GetSyncTimeMainInstanceResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Time"])
+          && parse_json<double>::is_valid(field(TimeField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     double GetSyncTimeMainInstanceResult::time() const
     {
-      return parse_json<double>::parse(m_values["Time"]);
+      return parse_json<double>::parse(field(TimeField));
     }
 
     void GetSyncTimeMainInstanceResult::setTime(double time)
     {
-      m_values.AddMember("Time", parse_json<double>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<double>::format(time, m_values.GetAllocator()));
     }
 
 
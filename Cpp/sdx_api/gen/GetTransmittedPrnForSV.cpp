@@ -29,6 +29,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetTransmittedPrnForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetTransmittedPrnForSV);
 
+    namespace
+    {
+      // Fields of GetTransmittedPrnForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t SignalArrayField = 1;
+    }
+
 
     GetTransmittedPrnForSV::GetTransmittedPrnForSV()
       : CommandBase(CmdName, TargetId)
@@ -56,8 +63,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
         ;
 
     }
@@ -79,24 +86,29 @@ namespace Sdx
 
     int GetTransmittedPrnForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetTransmittedPrnForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> GetTransmittedPrnForSV::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> GetTransmittedPrnForSV::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void GetTransmittedPrnForSV::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
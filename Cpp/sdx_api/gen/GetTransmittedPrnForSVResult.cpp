@@ -28,6 +28,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetTransmittedPrnForSVResult);
 
+    namespace
+    {
+      // Fields of GetTransmittedPrnForSVResult, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t SignalPrnDictField = 1;
+    }
+
 
     GetTransmittedPrnForSVResult::GetTransmittedPrnForSVResult()
       : CommandResult(CmdName, TargetId)
@@ -69,8 +76,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::map<std::string, int>>::is_valid(m_values["SignalPrnDict"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::map<std::string, int>>::is_valid(field(SignalPrnDictField))
         ;
 
     }
@@ -86,24 +93,29 @@ namespace Sdx
 
     int GetTransmittedPrnForSVResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void GetTransmittedPrnForSVResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, int> GetTransmittedPrnForSVResult::signalPrnDict() const
     {
-      return parse_json<std::map<std::string, int>>::parse(m_values["SignalPrnDict"]);
+      return fieldValue<std::map<std::string, int>>(SignalPrnDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, int>> GetTransmittedPrnForSVResult::signalPrnDictPtr() const
+    {
+      return sharedValue<std::map<std::string, int>>(SignalPrnDictField);
     }
 
     void GetTransmittedPrnForSVResult::setSignalPrnDict(const std::map<std::string, int>& signalPrnDict)
     {
-      m_values.AddMember("SignalPrnDict", parse_json<std::map<std::string, int>>::format(signalPrnDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalPrnDictField, parse_json<std::map<std::string, int>>::format(signalPrnDict, m_values.GetAllocator()));
     }
 
 
@@ -58,6 +58,7 @@ namespace Sdx
 
       // **** signalPrnDict ****
       std::map<std::string, int> signalPrnDict() const;
+      std::shared_ptr<const std::map<std::string, int>> signalPrnDictPtr() const;
       void setSignalPrnDict(const std::map<std::string, int>& signalPrnDict);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetTransmittedPrnForSVResult);
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetTropoModelResult);
 
+    namespace
+    {
+      // Fields of GetTropoModelResult, indices in fieldNames()
+      constexpr std::size_t ModelField = 0;
+    }
+
 
     GetTropoModelResult::GetTropoModelResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Model"])
+          && parse_json<std::string>::is_valid(field(ModelField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetTropoModelResult::model() const
     {
-      return parse_json<std::string>::parse(m_values["Model"]);
+      return fieldValue<std::string>(ModelField);
     }
 
     void GetTropoModelResult::setModel(const std::string& model)
     {
-      m_values.AddMember("Model", parse_json<std::string>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModelField, parse_json<std::string>::format(model, m_values.GetAllocator()));
     }
 
 
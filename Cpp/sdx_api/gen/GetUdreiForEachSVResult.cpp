@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetUdreiForEachSVResult);
 
+    namespace
+    {
+      // Fields of GetUdreiForEachSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t UdreisField = 1;
+    }
+
 
     GetUdreiForEachSVResult::GetUdreiForEachSVResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<int>>::is_valid(m_values["Udreis"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<int>>::is_valid(field(UdreisField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetUdreiForEachSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetUdreiForEachSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> GetUdreiForEachSVResult::udreis() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Udreis"]);
+      return fieldValue<std::vector<int>>(UdreisField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetUdreiForEachSVResult::udreisPtr() const
+    {
+      return sharedValue<std::vector<int>>(UdreisField);
     }
 
     void GetUdreiForEachSVResult::setUdreis(const std::vector<int>& udreis)
     {
-      m_values.AddMember("Udreis", parse_json<std::vector<int>>::format(udreis, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UdreisField, parse_json<std::vector<int>>::format(udreis, m_values.GetAllocator()));
     }
 
 
@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** udreis ****
       std::vector<int> udreis() const;
+      std::shared_ptr<const std::vector<int>> udreisPtr() const;
       void setUdreis(const std::vector<int>& udreis);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetUdreiForEachSVResult);
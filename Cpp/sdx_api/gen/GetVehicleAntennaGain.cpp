@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetVehicleAntennaGain);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetVehicleAntennaGain);
 
+    namespace
+    {
+      // Fields of GetVehicleAntennaGain, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t NameField = 1;
+    }
+
 
     GetVehicleAntennaGain::GetVehicleAntennaGain()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::GNSSBand>::is_valid(m_values["Band"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["Name"])
+          && parse_json<Sdx::GNSSBand>::is_valid(field(BandField))
+          && parse_json<std::optional<std::string>>::is_valid(field(NameField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     Sdx::GNSSBand GetVehicleAntennaGain::band() const
     {
-      return parse_json<Sdx::GNSSBand>::parse(m_values["Band"]);
+      return parse_json<Sdx::GNSSBand>::parse(field(BandField));
     }
 
     void GetVehicleAntennaGain::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetVehicleAntennaGain::name() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["Name"]);
+      return fieldValue<std::optional<std::string>>(NameField);
     }
 
     void GetVehicleAntennaGain::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
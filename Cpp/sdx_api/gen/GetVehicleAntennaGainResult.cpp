@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetVehicleAntennaGainResult);
 
+    namespace
+    {
+      // Fields of GetVehicleAntennaGainResult, indices in fieldNames()
+      constexpr std::size_t GainField = 0;
+      constexpr std::size_t TypeField = 1;
+      constexpr std::size_t BandField = 2;
+      constexpr std::size_t NameField = 3;
+    }
+
 
     GetVehicleAntennaGainResult::GetVehicleAntennaGainResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["Gain"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["Type"])
-          && parse_json<Sdx::GNSSBand>::is_valid(m_values["Band"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["Name"])
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GainField))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(TypeField))
+          && parse_json<Sdx::GNSSBand>::is_valid(field(BandField))
+          && parse_json<std::optional<std::string>>::is_valid(field(NameField))
         ;
 
     }
@@ -89,48 +98,53 @@ namespace Sdx
 
     std::vector<std::vector<double>> GetVehicleAntennaGainResult::gain() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["Gain"]);
+      return fieldValue<std::vector<std::vector<double>>>(GainField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaGainResult::gainPtr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GainField);
     }
 
     void GetVehicleAntennaGainResult::setGain(const std::vector<std::vector<double>>& gain)
     {
-      m_values.AddMember("Gain", parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainField, parse_json<std::vector<std::vector<double>>>::format(gain, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaGainResult::type() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["Type"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(TypeField));
     }
 
     void GetVehicleAntennaGainResult::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
 
     Sdx::GNSSBand GetVehicleAntennaGainResult::band() const
     {
-      return parse_json<Sdx::GNSSBand>::parse(m_values["Band"]);
+      return parse_json<Sdx::GNSSBand>::parse(field(BandField));
     }
 
     void GetVehicleAntennaGainResult::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> GetVehicleAntennaGainResult::name() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["Name"]);
+      return fieldValue<std::optional<std::string>>(NameField);
     }
 
     void GetVehicleAntennaGainResult::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -58,6 +58,48 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetVehicleAntennaModelResult);
 
+    namespace
+    {
+      // Fields of GetVehicleAntennaModelResult, indices in fieldNames()
+      constexpr std::size_t GainL1Field = 0;
+      constexpr std::size_t GainTypeL1Field = 1;
+      constexpr std::size_t GainOffsetL1Field = 2;
+      constexpr std::size_t GainL2Field = 3;
+      constexpr std::size_t GainTypeL2Field = 4;
+      constexpr std::size_t GainOffsetL2Field = 5;
+      constexpr std::size_t GainL5Field = 6;
+      constexpr std::size_t GainTypeL5Field = 7;
+      constexpr std::size_t GainOffsetL5Field = 8;
+      constexpr std::size_t GainE6Field = 9;
+      constexpr std::size_t GainTypeE6Field = 10;
+      constexpr std::size_t GainOffsetE6Field = 11;
+      constexpr std::size_t GainSField = 12;
+      constexpr std::size_t GainTypeSField = 13;
+      constexpr std::size_t GainOffsetSField = 14;
+      constexpr std::size_t PhaseOffsetL1Field = 15;
+      constexpr std::size_t PhaseOffsetTypeL1Field = 16;
+      constexpr std::size_t PhasePatternOffsetL1Field = 17;
+      constexpr std::size_t PhaseOffsetL2Field = 18;
+      constexpr std::size_t PhaseOffsetTypeL2Field = 19;
+      constexpr std::size_t PhasePatternOffsetL2Field = 20;
+      constexpr std::size_t PhaseOffsetL5Field = 21;
+      constexpr std::size_t PhaseOffsetTypeL5Field = 22;
+      constexpr std::size_t PhasePatternOffsetL5Field = 23;
+      constexpr std::size_t PhaseOffsetE6Field = 24;
+      constexpr std::size_t PhaseOffsetTypeE6Field = 25;
+      constexpr std::size_t PhasePatternOffsetE6Field = 26;
+      constexpr std::size_t PhaseOffsetSField = 27;
+      constexpr std::size_t PhaseOffsetTypeSField = 28;
+      constexpr std::size_t PhasePatternOffsetSField = 29;
+      constexpr std::size_t XField = 30;
+      constexpr std::size_t YField = 31;
+      constexpr std::size_t ZField = 32;
+      constexpr std::size_t YawField = 33;
+      constexpr std::size_t PitchField = 34;
+      constexpr std::size_t RollField = 35;
+      constexpr std::size_t NameField = 36;
+    }
+
 
     GetVehicleAntennaModelResult::GetVehicleAntennaModelResult()
       : CommandResult(CmdName, TargetId)
@@ -169,43 +211,43 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["GainL1"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["GainTypeL1"])
-          && parse_json<double>::is_valid(m_values["GainOffsetL1"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["GainL2"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["GainTypeL2"])
-          && parse_json<double>::is_valid(m_values["GainOffsetL2"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["GainL5"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["GainTypeL5"])
-          && parse_json<double>::is_valid(m_values["GainOffsetL5"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["GainE6"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["GainTypeE6"])
-          && parse_json<double>::is_valid(m_values["GainOffsetE6"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["GainS"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["GainTypeS"])
-          && parse_json<double>::is_valid(m_values["GainOffsetS"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["PhaseOffsetL1"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["PhaseOffsetTypeL1"])
-          && parse_json<double>::is_valid(m_values["PhasePatternOffsetL1"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["PhaseOffsetL2"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["PhaseOffsetTypeL2"])
-          && parse_json<double>::is_valid(m_values["PhasePatternOffsetL2"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["PhaseOffsetL5"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["PhaseOffsetTypeL5"])
-          && parse_json<double>::is_valid(m_values["PhasePatternOffsetL5"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["PhaseOffsetE6"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["PhaseOffsetTypeE6"])
-          && parse_json<double>::is_valid(m_values["PhasePatternOffsetE6"])
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["PhaseOffsetS"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["PhaseOffsetTypeS"])
-          && parse_json<double>::is_valid(m_values["PhasePatternOffsetS"])
-          && parse_json<double>::is_valid(m_values["X"])
-          && parse_json<double>::is_valid(m_values["Y"])
-          && parse_json<double>::is_valid(m_values["Z"])
-          && parse_json<double>::is_valid(m_values["Yaw"])
-          && parse_json<double>::is_valid(m_values["Pitch"])
-          && parse_json<double>::is_valid(m_values["Roll"])
-          && parse_json<std::string>::is_valid(m_values["Name"])
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GainL1Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(GainTypeL1Field))
+          && parse_json<double>::is_valid(field(GainOffsetL1Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GainL2Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(GainTypeL2Field))
+          && parse_json<double>::is_valid(field(GainOffsetL2Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GainL5Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(GainTypeL5Field))
+          && parse_json<double>::is_valid(field(GainOffsetL5Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GainE6Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(GainTypeE6Field))
+          && parse_json<double>::is_valid(field(GainOffsetE6Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GainSField))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(GainTypeSField))
+          && parse_json<double>::is_valid(field(GainOffsetSField))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(PhaseOffsetL1Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(PhaseOffsetTypeL1Field))
+          && parse_json<double>::is_valid(field(PhasePatternOffsetL1Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(PhaseOffsetL2Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(PhaseOffsetTypeL2Field))
+          && parse_json<double>::is_valid(field(PhasePatternOffsetL2Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(PhaseOffsetL5Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(PhaseOffsetTypeL5Field))
+          && parse_json<double>::is_valid(field(PhasePatternOffsetL5Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(PhaseOffsetE6Field))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(PhaseOffsetTypeE6Field))
+          && parse_json<double>::is_valid(field(PhasePatternOffsetE6Field))
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(PhaseOffsetSField))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(PhaseOffsetTypeSField))
+          && parse_json<double>::is_valid(field(PhasePatternOffsetSField))
+          && parse_json<double>::is_valid(field(XField))
+          && parse_json<double>::is_valid(field(YField))
+          && parse_json<double>::is_valid(field(ZField))
+          && parse_json<double>::is_valid(field(YawField))
+          && parse_json<double>::is_valid(field(PitchField))
+          && parse_json<double>::is_valid(field(RollField))
+          && parse_json<std::string>::is_valid(field(NameField))
         ;
 
     }
@@ -221,444 +263,494 @@ namespace Sdx
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::gainL1() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["GainL1"]);
+      return fieldValue<std::vector<std::vector<double>>>(GainL1Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::gainL1Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GainL1Field);
     }
 
     void GetVehicleAntennaModelResult::setGainL1(const std::vector<std::vector<double>>& gainL1)
     {
-      m_values.AddMember("GainL1", parse_json<std::vector<std::vector<double>>>::format(gainL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainL1Field, parse_json<std::vector<std::vector<double>>>::format(gainL1, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::gainTypeL1() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["GainTypeL1"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(GainTypeL1Field));
     }
 
     void GetVehicleAntennaModelResult::setGainTypeL1(const Sdx::AntennaPatternType& gainTypeL1)
     {
-      m_values.AddMember("GainTypeL1", parse_json<Sdx::AntennaPatternType>::format(gainTypeL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainTypeL1Field, parse_json<Sdx::AntennaPatternType>::format(gainTypeL1, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::gainOffsetL1() const
     {
-      return parse_json<double>::parse(m_values["GainOffsetL1"]);
+      return parse_json<double>::parse(field(GainOffsetL1Field));
     }
 
     void GetVehicleAntennaModelResult::setGainOffsetL1(double gainOffsetL1)
     {
-      m_values.AddMember("GainOffsetL1", parse_json<double>::format(gainOffsetL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainOffsetL1Field, parse_json<double>::format(gainOffsetL1, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::gainL2() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["GainL2"]);
+      return fieldValue<std::vector<std::vector<double>>>(GainL2Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::gainL2Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GainL2Field);
     }
 
     void GetVehicleAntennaModelResult::setGainL2(const std::vector<std::vector<double>>& gainL2)
     {
-      m_values.AddMember("GainL2", parse_json<std::vector<std::vector<double>>>::format(gainL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainL2Field, parse_json<std::vector<std::vector<double>>>::format(gainL2, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::gainTypeL2() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["GainTypeL2"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(GainTypeL2Field));
     }
 
     void GetVehicleAntennaModelResult::setGainTypeL2(const Sdx::AntennaPatternType& gainTypeL2)
     {
-      m_values.AddMember("GainTypeL2", parse_json<Sdx::AntennaPatternType>::format(gainTypeL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainTypeL2Field, parse_json<Sdx::AntennaPatternType>::format(gainTypeL2, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::gainOffsetL2() const
     {
-      return parse_json<double>::parse(m_values["GainOffsetL2"]);
+      return parse_json<double>::parse(field(GainOffsetL2Field));
     }
 
     void GetVehicleAntennaModelResult::setGainOffsetL2(double gainOffsetL2)
     {
-      m_values.AddMember("GainOffsetL2", parse_json<double>::format(gainOffsetL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainOffsetL2Field, parse_json<double>::format(gainOffsetL2, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::gainL5() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["GainL5"]);
+      return fieldValue<std::vector<std::vector<double>>>(GainL5Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::gainL5Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GainL5Field);
     }
 
     void GetVehicleAntennaModelResult::setGainL5(const std::vector<std::vector<double>>& gainL5)
     {
-      m_values.AddMember("GainL5", parse_json<std::vector<std::vector<double>>>::format(gainL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainL5Field, parse_json<std::vector<std::vector<double>>>::format(gainL5, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::gainTypeL5() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["GainTypeL5"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(GainTypeL5Field));
     }
 
     void GetVehicleAntennaModelResult::setGainTypeL5(const Sdx::AntennaPatternType& gainTypeL5)
     {
-      m_values.AddMember("GainTypeL5", parse_json<Sdx::AntennaPatternType>::format(gainTypeL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainTypeL5Field, parse_json<Sdx::AntennaPatternType>::format(gainTypeL5, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::gainOffsetL5() const
     {
-      return parse_json<double>::parse(m_values["GainOffsetL5"]);
+      return parse_json<double>::parse(field(GainOffsetL5Field));
     }
 
     void GetVehicleAntennaModelResult::setGainOffsetL5(double gainOffsetL5)
     {
-      m_values.AddMember("GainOffsetL5", parse_json<double>::format(gainOffsetL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainOffsetL5Field, parse_json<double>::format(gainOffsetL5, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::gainE6() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["GainE6"]);
+      return fieldValue<std::vector<std::vector<double>>>(GainE6Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::gainE6Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GainE6Field);
     }
 
     void GetVehicleAntennaModelResult::setGainE6(const std::vector<std::vector<double>>& gainE6)
     {
-      m_values.AddMember("GainE6", parse_json<std::vector<std::vector<double>>>::format(gainE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainE6Field, parse_json<std::vector<std::vector<double>>>::format(gainE6, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::gainTypeE6() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["GainTypeE6"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(GainTypeE6Field));
     }
 
     void GetVehicleAntennaModelResult::setGainTypeE6(const Sdx::AntennaPatternType& gainTypeE6)
     {
-      m_values.AddMember("GainTypeE6", parse_json<Sdx::AntennaPatternType>::format(gainTypeE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainTypeE6Field, parse_json<Sdx::AntennaPatternType>::format(gainTypeE6, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::gainOffsetE6() const
     {
-      return parse_json<double>::parse(m_values["GainOffsetE6"]);
+      return parse_json<double>::parse(field(GainOffsetE6Field));
     }
 
     void GetVehicleAntennaModelResult::setGainOffsetE6(double gainOffsetE6)
     {
-      m_values.AddMember("GainOffsetE6", parse_json<double>::format(gainOffsetE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainOffsetE6Field, parse_json<double>::format(gainOffsetE6, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::gainS() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["GainS"]);
+      return fieldValue<std::vector<std::vector<double>>>(GainSField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::gainSPtr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GainSField);
     }
 
     void GetVehicleAntennaModelResult::setGainS(const std::vector<std::vector<double>>& gainS)
     {
-      m_values.AddMember("GainS", parse_json<std::vector<std::vector<double>>>::format(gainS, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainSField, parse_json<std::vector<std::vector<double>>>::format(gainS, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::gainTypeS() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["GainTypeS"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(GainTypeSField));
     }
 
     void GetVehicleAntennaModelResult::setGainTypeS(const Sdx::AntennaPatternType& gainTypeS)
     {
-      m_values.AddMember("GainTypeS", parse_json<Sdx::AntennaPatternType>::format(gainTypeS, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainTypeSField, parse_json<Sdx::AntennaPatternType>::format(gainTypeS, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::gainOffsetS() const
     {
-      return parse_json<double>::parse(m_values["GainOffsetS"]);
+      return parse_json<double>::parse(field(GainOffsetSField));
     }
 
     void GetVehicleAntennaModelResult::setGainOffsetS(double gainOffsetS)
     {
-      m_values.AddMember("GainOffsetS", parse_json<double>::format(gainOffsetS, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainOffsetSField, parse_json<double>::format(gainOffsetS, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::phaseOffsetL1() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["PhaseOffsetL1"]);
+      return fieldValue<std::vector<std::vector<double>>>(PhaseOffsetL1Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::phaseOffsetL1Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(PhaseOffsetL1Field);
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetL1(const std::vector<std::vector<double>>& phaseOffsetL1)
     {
-      m_values.AddMember("PhaseOffsetL1", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetL1Field, parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL1, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::phaseOffsetTypeL1() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["PhaseOffsetTypeL1"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(PhaseOffsetTypeL1Field));
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeL1(const Sdx::AntennaPatternType& phaseOffsetTypeL1)
     {
-      m_values.AddMember("PhaseOffsetTypeL1", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetTypeL1Field, parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL1, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::phasePatternOffsetL1() const
     {
-      return parse_json<double>::parse(m_values["PhasePatternOffsetL1"]);
+      return parse_json<double>::parse(field(PhasePatternOffsetL1Field));
     }
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetL1(double phasePatternOffsetL1)
     {
-      m_values.AddMember("PhasePatternOffsetL1", parse_json<double>::format(phasePatternOffsetL1, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhasePatternOffsetL1Field, parse_json<double>::format(phasePatternOffsetL1, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::phaseOffsetL2() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["PhaseOffsetL2"]);
+      return fieldValue<std::vector<std::vector<double>>>(PhaseOffsetL2Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::phaseOffsetL2Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(PhaseOffsetL2Field);
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetL2(const std::vector<std::vector<double>>& phaseOffsetL2)
     {
-      m_values.AddMember("PhaseOffsetL2", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetL2Field, parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL2, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::phaseOffsetTypeL2() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["PhaseOffsetTypeL2"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(PhaseOffsetTypeL2Field));
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeL2(const Sdx::AntennaPatternType& phaseOffsetTypeL2)
     {
-      m_values.AddMember("PhaseOffsetTypeL2", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetTypeL2Field, parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL2, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::phasePatternOffsetL2() const
     {
-      return parse_json<double>::parse(m_values["PhasePatternOffsetL2"]);
+      return parse_json<double>::parse(field(PhasePatternOffsetL2Field));
     }
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetL2(double phasePatternOffsetL2)
     {
-      m_values.AddMember("PhasePatternOffsetL2", parse_json<double>::format(phasePatternOffsetL2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhasePatternOffsetL2Field, parse_json<double>::format(phasePatternOffsetL2, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::phaseOffsetL5() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["PhaseOffsetL5"]);
+      return fieldValue<std::vector<std::vector<double>>>(PhaseOffsetL5Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::phaseOffsetL5Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(PhaseOffsetL5Field);
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetL5(const std::vector<std::vector<double>>& phaseOffsetL5)
     {
-      m_values.AddMember("PhaseOffsetL5", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetL5Field, parse_json<std::vector<std::vector<double>>>::format(phaseOffsetL5, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::phaseOffsetTypeL5() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["PhaseOffsetTypeL5"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(PhaseOffsetTypeL5Field));
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeL5(const Sdx::AntennaPatternType& phaseOffsetTypeL5)
     {
-      m_values.AddMember("PhaseOffsetTypeL5", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetTypeL5Field, parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeL5, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::phasePatternOffsetL5() const
     {
-      return parse_json<double>::parse(m_values["PhasePatternOffsetL5"]);
+      return parse_json<double>::parse(field(PhasePatternOffsetL5Field));
     }
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetL5(double phasePatternOffsetL5)
     {
-      m_values.AddMember("PhasePatternOffsetL5", parse_json<double>::format(phasePatternOffsetL5, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhasePatternOffsetL5Field, parse_json<double>::format(phasePatternOffsetL5, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::phaseOffsetE6() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["PhaseOffsetE6"]);
+      return fieldValue<std::vector<std::vector<double>>>(PhaseOffsetE6Field);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::phaseOffsetE6Ptr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(PhaseOffsetE6Field);
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetE6(const std::vector<std::vector<double>>& phaseOffsetE6)
     {
-      m_values.AddMember("PhaseOffsetE6", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetE6Field, parse_json<std::vector<std::vector<double>>>::format(phaseOffsetE6, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::phaseOffsetTypeE6() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["PhaseOffsetTypeE6"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(PhaseOffsetTypeE6Field));
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeE6(const Sdx::AntennaPatternType& phaseOffsetTypeE6)
     {
-      m_values.AddMember("PhaseOffsetTypeE6", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetTypeE6Field, parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeE6, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::phasePatternOffsetE6() const
     {
-      return parse_json<double>::parse(m_values["PhasePatternOffsetE6"]);
+      return parse_json<double>::parse(field(PhasePatternOffsetE6Field));
     }
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetE6(double phasePatternOffsetE6)
     {
-      m_values.AddMember("PhasePatternOffsetE6", parse_json<double>::format(phasePatternOffsetE6, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhasePatternOffsetE6Field, parse_json<double>::format(phasePatternOffsetE6, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::vector<double>> GetVehicleAntennaModelResult::phaseOffsetS() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["PhaseOffsetS"]);
+      return fieldValue<std::vector<std::vector<double>>>(PhaseOffsetSField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> GetVehicleAntennaModelResult::phaseOffsetSPtr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(PhaseOffsetSField);
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetS(const std::vector<std::vector<double>>& phaseOffsetS)
     {
-      m_values.AddMember("PhaseOffsetS", parse_json<std::vector<std::vector<double>>>::format(phaseOffsetS, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetSField, parse_json<std::vector<std::vector<double>>>::format(phaseOffsetS, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType GetVehicleAntennaModelResult::phaseOffsetTypeS() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["PhaseOffsetTypeS"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(PhaseOffsetTypeSField));
     }
 
     void GetVehicleAntennaModelResult::setPhaseOffsetTypeS(const Sdx::AntennaPatternType& phaseOffsetTypeS)
     {
-      m_values.AddMember("PhaseOffsetTypeS", parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeS, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetTypeSField, parse_json<Sdx::AntennaPatternType>::format(phaseOffsetTypeS, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::phasePatternOffsetS() const
     {
-      return parse_json<double>::parse(m_values["PhasePatternOffsetS"]);
+      return parse_json<double>::parse(field(PhasePatternOffsetSField));
     }
 
     void GetVehicleAntennaModelResult::setPhasePatternOffsetS(double phasePatternOffsetS)
     {
-      m_values.AddMember("PhasePatternOffsetS", parse_json<double>::format(phasePatternOffsetS, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhasePatternOffsetSField, parse_json<double>::format(phasePatternOffsetS, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::x() const
     {
-      return parse_json<double>::parse(m_values["X"]);
+      return parse_json<double>::parse(field(XField));
     }
 
     void GetVehicleAntennaModelResult::setX(double x)
     {
-      m_values.AddMember("X", parse_json<double>::format(x, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(XField, parse_json<double>::format(x, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::y() const
     {
-      return parse_json<double>::parse(m_values["Y"]);
+      return parse_json<double>::parse(field(YField));
     }
 
     void GetVehicleAntennaModelResult::setY(double y)
     {
-      m_values.AddMember("Y", parse_json<double>::format(y, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(YField, parse_json<double>::format(y, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::z() const
     {
-      return parse_json<double>::parse(m_values["Z"]);
+      return parse_json<double>::parse(field(ZField));
     }
 
     void GetVehicleAntennaModelResult::setZ(double z)
     {
-      m_values.AddMember("Z", parse_json<double>::format(z, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ZField, parse_json<double>::format(z, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::yaw() const
     {
-      return parse_json<double>::parse(m_values["Yaw"]);
+      return parse_json<double>::parse(field(YawField));
     }
 
     void GetVehicleAntennaModelResult::setYaw(double yaw)
     {
-      m_values.AddMember("Yaw", parse_json<double>::format(yaw, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(YawField, parse_json<double>::format(yaw, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::pitch() const
     {
-      return parse_json<double>::parse(m_values["Pitch"]);
+      return parse_json<double>::parse(field(PitchField));
     }
 
     void GetVehicleAntennaModelResult::setPitch(double pitch)
     {
-      m_values.AddMember("Pitch", parse_json<double>::format(pitch, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PitchField, parse_json<double>::format(pitch, m_values.GetAllocator()));
     }
 
 
 
     double GetVehicleAntennaModelResult::roll() const
     {
-      return parse_json<double>::parse(m_values["Roll"]);
+      return parse_json<double>::parse(field(RollField));
     }
 
     void GetVehicleAntennaModelResult::setRoll(double roll)
     {
-      m_values.AddMember("Roll", parse_json<double>::format(roll, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RollField, parse_json<double>::format(roll, m_values.GetAllocator()));
     }
 
 
 
     std::string GetVehicleAntennaModelResult::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void GetVehicleAntennaModelResult::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -84,6 +84,7 @@ namespace Sdx
 
       // **** gainL1 ****
       std::vector<std::vector<double>> gainL1() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gainL1Ptr() const;
       void setGainL1(const std::vector<std::vector<double>>& gainL1);
 
 
@@ -99,6 +100,7 @@ namespace Sdx
 
       // **** gainL2 ****
       std::vector<std::vector<double>> gainL2() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gainL2Ptr() const;
       void setGainL2(const std::vector<std::vector<double>>& gainL2);
 
 
@@ -114,6 +116,7 @@ namespace Sdx
 
       // **** gainL5 ****
       std::vector<std::vector<double>> gainL5() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gainL5Ptr() const;
       void setGainL5(const std::vector<std::vector<double>>& gainL5);
 
 
@@ -129,6 +132,7 @@ namespace Sdx
 
       // **** gainE6 ****
       std::vector<std::vector<double>> gainE6() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gainE6Ptr() const;
       void setGainE6(const std::vector<std::vector<double>>& gainE6);
 
 
@@ -144,6 +148,7 @@ namespace Sdx
 
       // **** gainS ****
       std::vector<std::vector<double>> gainS() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gainSPtr() const;
       void setGainS(const std::vector<std::vector<double>>& gainS);
 
 
@@ -159,6 +164,7 @@ namespace Sdx
 
       // **** phaseOffsetL1 ****
       std::vector<std::vector<double>> phaseOffsetL1() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> phaseOffsetL1Ptr() const;
       void setPhaseOffsetL1(const std::vector<std::vector<double>>& phaseOffsetL1);
 
 
@@ -174,6 +180,7 @@ namespace Sdx
 
       // **** phaseOffsetL2 ****
       std::vector<std::vector<double>> phaseOffsetL2() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> phaseOffsetL2Ptr() const;
       void setPhaseOffsetL2(const std::vector<std::vector<double>>& phaseOffsetL2);
 
 
@@ -189,6 +196,7 @@ namespace Sdx
 
       // **** phaseOffsetL5 ****
       std::vector<std::vector<double>> phaseOffsetL5() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> phaseOffsetL5Ptr() const;
       void setPhaseOffsetL5(const std::vector<std::vector<double>>& phaseOffsetL5);
 
 
@@ -204,6 +212,7 @@ namespace Sdx
 
       // **** phaseOffsetE6 ****
       std::vector<std::vector<double>> phaseOffsetE6() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> phaseOffsetE6Ptr() const;
       void setPhaseOffsetE6(const std::vector<std::vector<double>>& phaseOffsetE6);
 
 
@@ -219,6 +228,7 @@ namespace Sdx
 
       // **** phaseOffsetS ****
       std::vector<std::vector<double>> phaseOffsetS() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> phaseOffsetSPtr() const;
       void setPhaseOffsetS(const std::vector<std::vector<double>>& phaseOffsetS);
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetVehicleAntennaOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetVehicleAntennaOffset);
 
+    namespace
+    {
+      // Fields of GetVehicleAntennaOffset, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+    }
+
 
     GetVehicleAntennaOffset::GetVehicleAntennaOffset(const std::optional<std::string>& name)
       : CommandBase(CmdName, TargetId)
@@ -45,7 +51,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::optional<std::string>>::is_valid(m_values["Name"])
+          && parse_json<std::optional<std::string>>::is_valid(field(NameField))
         ;
 
     }
@@ -67,12 +73,12 @@ namespace Sdx
 
     std::optional<std::string> GetVehicleAntennaOffset::name() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["Name"]);
+      return fieldValue<std::optional<std::string>>(NameField);
     }
 
     void GetVehicleAntennaOffset::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** phaseOffset ****
       std::vector<std::vector<double>> phaseOffset() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> phaseOffsetPtr() const;
       void setPhaseOffset(const std::vector<std::vector<double>>& phaseOffset);
 
 
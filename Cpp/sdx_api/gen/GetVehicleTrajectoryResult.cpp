@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetVehicleTrajectoryResult);
 
+    namespace
+    {
+      // Fields of GetVehicleTrajectoryResult, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+    }
+
 
     GetVehicleTrajectoryResult::GetVehicleTrajectoryResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Type"])
+          && parse_json<std::string>::is_valid(field(TypeField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string GetVehicleTrajectoryResult::type() const
     {
-      return parse_json<std::string>::parse(m_values["Type"]);
+      return fieldValue<std::string>(TypeField);
     }
 
     void GetVehicleTrajectoryResult::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetVisibleSVResult);
 
+    namespace
+    {
+      // Fields of GetVisibleSVResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+    }
+
 
     GetVisibleSVResult::GetVisibleSVResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<int>>::is_valid(m_values["SvId"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<int>>::is_valid(field(SvIdField))
         ;
 
     }
@@ -81,24 +88,29 @@ namespace Sdx
 
     std::string GetVisibleSVResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void GetVisibleSVResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> GetVisibleSVResult::svId() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["SvId"]);
+      return fieldValue<std::vector<int>>(SvIdField);
+    }
+
+    std::shared_ptr<const std::vector<int>> GetVisibleSVResult::svIdPtr() const
+    {
+      return sharedValue<std::vector<int>>(SvIdField);
     }
 
     void GetVisibleSVResult::setSvId(const std::vector<int>& svId)
     {
-      m_values.AddMember("SvId", parse_json<std::vector<int>>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<std::vector<int>>::format(svId, m_values.GetAllocator()));
     }
 
 
@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** svId ****
       std::vector<int> svId() const;
+      std::shared_ptr<const std::vector<int>> svIdPtr() const;
       void setSvId(const std::vector<int>& svId);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(GetVisibleSVResult);
@@ -27,6 +27,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetWFAntennaElementModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetWFAntennaElementModel);
 
+    namespace
+    {
+      // Fields of GetWFAntennaElementModel, indices in fieldNames()
+      constexpr std::size_t ElementField = 0;
+    }
+
 
     GetWFAntennaElementModel::GetWFAntennaElementModel()
       : CommandBase(CmdName, TargetId)
@@ -53,7 +59,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Element"])
+          && parse_json<int>::is_valid(field(ElementField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetWFAntennaElementModel::element() const
     {
-      return parse_json<int>::parse(m_values["Element"]);
+      return parse_json<int>::parse(field(ElementField));
     }
 
     void GetWFAntennaElementModel::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElementField, parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetWFAntennaElementModelResult);
 
+    namespace
+    {
+      // Fields of GetWFAntennaElementModelResult, indices in fieldNames()
+      constexpr std::size_t AntennaModelNameField = 0;
+      constexpr std::size_t ElementField = 1;
+    }
+
 
     GetWFAntennaElementModelResult::GetWFAntennaElementModelResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["AntennaModelName"])
-          && parse_json<int>::is_valid(m_values["Element"])
+          && parse_json<std::string>::is_valid(field(AntennaModelNameField))
+          && parse_json<int>::is_valid(field(ElementField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string GetWFAntennaElementModelResult::antennaModelName() const
     {
-      return parse_json<std::string>::parse(m_values["AntennaModelName"]);
+      return fieldValue<std::string>(AntennaModelNameField);
     }
 
     void GetWFAntennaElementModelResult::setAntennaModelName(const std::string& antennaModelName)
     {
-      m_values.AddMember("AntennaModelName", parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaModelNameField, parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()));
     }
 
 
 
     int GetWFAntennaElementModelResult::element() const
     {
-      return parse_json<int>::parse(m_values["Element"]);
+      return parse_json<int>::parse(field(ElementField));
     }
 
     void GetWFAntennaElementModelResult::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElementField, parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetWFAntennaElementPhasePatternOffsetResult);
 
+    namespace
+    {
+      // Fields of GetWFAntennaElementPhasePatternOffsetResult, indices in fieldNames()
+      constexpr std::size_t PhaseOffsetField = 0;
+      constexpr std::size_t ElementField = 1;
+    }
+
 
     GetWFAntennaElementPhasePatternOffsetResult::GetWFAntennaElementPhasePatternOffsetResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["PhaseOffset"])
-          && parse_json<int>::is_valid(m_values["Element"])
+          && parse_json<double>::is_valid(field(PhaseOffsetField))
+          && parse_json<int>::is_valid(field(ElementField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     double GetWFAntennaElementPhasePatternOffsetResult::phaseOffset() const
     {
-      return parse_json<double>::parse(m_values["PhaseOffset"]);
+      return parse_json<double>::parse(field(PhaseOffsetField));
     }
 
     void GetWFAntennaElementPhasePatternOffsetResult::setPhaseOffset(double phaseOffset)
     {
-      m_values.AddMember("PhaseOffset", parse_json<double>::format(phaseOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetField, parse_json<double>::format(phaseOffset, m_values.GetAllocator()));
     }
 
 
 
     int GetWFAntennaElementPhasePatternOffsetResult::element() const
     {
-      return parse_json<int>::parse(m_values["Element"]);
+      return parse_json<int>::parse(field(ElementField));
     }
 
     void GetWFAntennaElementPhasePatternOffsetResult::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElementField, parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
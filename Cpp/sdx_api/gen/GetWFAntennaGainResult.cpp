@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetWFAntennaGainResult);
 
+    namespace
+    {
+      // Fields of GetWFAntennaGainResult, indices in fieldNames()
+      constexpr std::size_t GainField = 0;
+    }
+
 
     GetWFAntennaGainResult::GetWFAntennaGainResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Gain"])
+          && parse_json<int>::is_valid(field(GainField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int GetWFAntennaGainResult::gain() const
     {
-      return parse_json<int>::parse(m_values["Gain"]);
+      return parse_json<int>::parse(field(GainField));
     }
 
     void GetWFAntennaGainResult::setGain(int gain)
     {
-      m_values.AddMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainField, parse_json<int>::format(gain, m_values.GetAllocator()));
     }
 
 
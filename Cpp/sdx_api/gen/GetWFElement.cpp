@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(GetWFElement);
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetWFElement);
 
+    namespace
+    {
+      // Fields of GetWFElement, indices in fieldNames()
+      constexpr std::size_t ElementField = 0;
+    }
+
 
     GetWFElement::GetWFElement()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Element"])
+          && parse_json<int>::is_valid(field(ElementField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int GetWFElement::element() const
     {
-      return parse_json<int>::parse(m_values["Element"]);
+      return parse_json<int>::parse(field(ElementField));
     }
 
     void GetWFElement::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElementField, parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetWFElementResult);
 
+    namespace
+    {
+      // Fields of GetWFElementResult, indices in fieldNames()
+      constexpr std::size_t ElementField = 0;
+      constexpr std::size_t EnabledField = 1;
+      constexpr std::size_t AntennaModelNameField = 2;
+    }
+
 
     GetWFElementResult::GetWFElementResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Element"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::string>::is_valid(m_values["AntennaModelName"])
+          && parse_json<int>::is_valid(field(ElementField))
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::string>::is_valid(field(AntennaModelNameField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     int GetWFElementResult::element() const
     {
-      return parse_json<int>::parse(m_values["Element"]);
+      return parse_json<int>::parse(field(ElementField));
     }
 
     void GetWFElementResult::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElementField, parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
 
     bool GetWFElementResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void GetWFElementResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::string GetWFElementResult::antennaModelName() const
     {
-      return parse_json<std::string>::parse(m_values["AntennaModelName"]);
+      return fieldValue<std::string>(AntennaModelNameField);
     }
 
     void GetWFElementResult::setAntennaModelName(const std::string& antennaModelName)
     {
-      m_values.AddMember("AntennaModelName", parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaModelNameField, parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()));
     }
 
 
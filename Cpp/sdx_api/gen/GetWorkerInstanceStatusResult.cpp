@@ -25,6 +25,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(GetWorkerInstanceStatusResult);
 
+    namespace
+    {
+      // Fields of GetWorkerInstanceStatusResult, indices in fieldNames()
+      constexpr std::size_t IsWorkerInstanceField = 0;
+      constexpr std::size_t IsConnectedField = 1;
+      constexpr std::size_t HostNameField = 2;
+      constexpr std::size_t HostPortField = 3;
+    }
+
 
     GetWorkerInstanceStatusResult::GetWorkerInstanceStatusResult()
       : CommandResult(CmdName, TargetId)
@@ -70,10 +79,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsWorkerInstance"])
-          && parse_json<bool>::is_valid(m_values["IsConnected"])
-          && parse_json<std::string>::is_valid(m_values["HostName"])
-          && parse_json<int>::is_valid(m_values["HostPort"])
+          && parse_json<bool>::is_valid(field(IsWorkerInstanceField))
+          && parse_json<bool>::is_valid(field(IsConnectedField))
+          && parse_json<std::string>::is_valid(field(HostNameField))
+          && parse_json<int>::is_valid(field(HostPortField))
         ;
 
     }
@@ -89,48 +98,48 @@ namespace Sdx
 
     bool GetWorkerInstanceStatusResult::isWorkerInstance() const
     {
-      return parse_json<bool>::parse(m_values["IsWorkerInstance"]);
+      return parse_json<bool>::parse(field(IsWorkerInstanceField));
     }
 
     void GetWorkerInstanceStatusResult::setIsWorkerInstance(bool isWorkerInstance)
     {
-      m_values.AddMember("IsWorkerInstance", parse_json<bool>::format(isWorkerInstance, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsWorkerInstanceField, parse_json<bool>::format(isWorkerInstance, m_values.GetAllocator()));
     }
 
 
 
     bool GetWorkerInstanceStatusResult::isConnected() const
     {
-      return parse_json<bool>::parse(m_values["IsConnected"]);
+      return parse_json<bool>::parse(field(IsConnectedField));
     }
 
     void GetWorkerInstanceStatusResult::setIsConnected(bool isConnected)
     {
-      m_values.AddMember("IsConnected", parse_json<bool>::format(isConnected, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsConnectedField, parse_json<bool>::format(isConnected, m_values.GetAllocator()));
     }
 
 
 
     std::string GetWorkerInstanceStatusResult::hostName() const
     {
-      return parse_json<std::string>::parse(m_values["HostName"]);
+      return fieldValue<std::string>(HostNameField);
     }
 
     void GetWorkerInstanceStatusResult::setHostName(const std::string& hostName)
     {
-      m_values.AddMember("HostName", parse_json<std::string>::format(hostName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HostNameField, parse_json<std::string>::format(hostName, m_values.GetAllocator()));
     }
 
 
 
     int GetWorkerInstanceStatusResult::hostPort() const
     {
-      return parse_json<int>::parse(m_values["HostPort"]);
+      return parse_json<int>::parse(field(HostPortField));
     }
 
     void GetWorkerInstanceStatusResult::setHostPort(int hostPort)
     {
-      m_values.AddMember("HostPort", parse_json<int>::format(hostPort, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HostPortField, parse_json<int>::format(hostPort, m_values.GetAllocator()));
     }
 
 
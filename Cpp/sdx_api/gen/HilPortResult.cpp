@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(HilPortResult);
 
+    namespace
+    {
+      // Fields of HilPortResult, indices in fieldNames()
+      constexpr std::size_t PortField = 0;
+    }
+
 
     HilPortResult::HilPortResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Port"])
+          && parse_json<int>::is_valid(field(PortField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int HilPortResult::port() const
     {
-      return parse_json<int>::parse(m_values["Port"]);
+      return parse_json<int>::parse(field(PortField));
     }
 
     void HilPortResult::setPort(int port)
     {
-      m_values.AddMember("Port", parse_json<int>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PortField, parse_json<int>::format(port, m_values.GetAllocator()));
     }
 
 
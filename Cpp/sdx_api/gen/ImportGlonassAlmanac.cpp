@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ImportGlonassAlmanac);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ImportGlonassAlmanac);
 
+    namespace
+    {
+      // Fields of ImportGlonassAlmanac, indices in fieldNames()
+      constexpr std::size_t PathField = 0;
+    }
+
 
     ImportGlonassAlmanac::ImportGlonassAlmanac()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Path"])
+          && parse_json<std::string>::is_valid(field(PathField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string ImportGlonassAlmanac::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ImportGlonassAlmanac::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
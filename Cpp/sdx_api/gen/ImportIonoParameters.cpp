@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ImportIonoParameters);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ImportIonoParameters);
 
+    namespace
+    {
+      // Fields of ImportIonoParameters, indices in fieldNames()
+      constexpr std::size_t PathField = 0;
+      constexpr std::size_t TypeField = 1;
+    }
+
 
     ImportIonoParameters::ImportIonoParameters()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["Type"])
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<std::optional<std::string>>::is_valid(field(TypeField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string ImportIonoParameters::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ImportIonoParameters::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> ImportIonoParameters::type() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["Type"]);
+      return fieldValue<std::optional<std::string>>(TypeField);
     }
 
     void ImportIonoParameters::setType(const std::optional<std::string>& type)
     {
-      m_values.AddMember("Type", parse_json<std::optional<std::string>>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::optional<std::string>>::format(type, m_values.GetAllocator()));
     }
 
 
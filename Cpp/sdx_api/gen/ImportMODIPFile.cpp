@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ImportMODIPFile);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ImportMODIPFile);
 
+    namespace
+    {
+      // Fields of ImportMODIPFile, indices in fieldNames()
+      constexpr std::size_t PathField = 0;
+    }
+
 
     ImportMODIPFile::ImportMODIPFile()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Path"])
+          && parse_json<std::string>::is_valid(field(PathField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string ImportMODIPFile::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void ImportMODIPFile::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
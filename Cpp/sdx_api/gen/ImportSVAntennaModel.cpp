@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ImportSVAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ImportSVAntennaModel);
 
+    namespace
+    {
+      // Fields of ImportSVAntennaModel, indices in fieldNames()
+      constexpr std::size_t FilePathField = 0;
+      constexpr std::size_t SystemField = 1;
+    }
+
 
     ImportSVAntennaModel::ImportSVAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["FilePath"])
-          && parse_json<std::string>::is_valid(m_values["System"])
+          && parse_json<std::string>::is_valid(field(FilePathField))
+          && parse_json<std::string>::is_valid(field(SystemField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string ImportSVAntennaModel::filePath() const
     {
-      return parse_json<std::string>::parse(m_values["FilePath"]);
+      return fieldValue<std::string>(FilePathField);
     }
 
     void ImportSVAntennaModel::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilePathField, parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
 
     std::string ImportSVAntennaModel::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void ImportSVAntennaModel::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ImportWFAntenna);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ImportWFAntenna);
 
+    namespace
+    {
+      // Fields of ImportWFAntenna, indices in fieldNames()
+      constexpr std::size_t FilePathField = 0;
+    }
+
 
     ImportWFAntenna::ImportWFAntenna()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["FilePath"])
+          && parse_json<std::string>::is_valid(field(FilePathField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string ImportWFAntenna::filePath() const
     {
-      return parse_json<std::string>::parse(m_values["FilePath"]);
+      return fieldValue<std::string>(FilePathField);
     }
 
     void ImportWFAntenna::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilePathField, parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
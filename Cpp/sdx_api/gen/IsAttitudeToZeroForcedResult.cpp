@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsAttitudeToZeroForcedResult);
 
+    namespace
+    {
+      // Fields of IsAttitudeToZeroForcedResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+    }
+
 
     IsAttitudeToZeroForcedResult::IsAttitudeToZeroForcedResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsAttitudeToZeroForcedResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void IsAttitudeToZeroForcedResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
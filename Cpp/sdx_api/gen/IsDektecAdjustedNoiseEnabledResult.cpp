@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsDektecAdjustedNoiseEnabledResult);
 
+    namespace
+    {
+      // Fields of IsDektecAdjustedNoiseEnabledResult, indices in fieldNames()
+      constexpr std::size_t EnableField = 0;
+    }
+
 
     IsDektecAdjustedNoiseEnabledResult::IsDektecAdjustedNoiseEnabledResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enable"])
+          && parse_json<bool>::is_valid(field(EnableField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsDektecAdjustedNoiseEnabledResult::enable() const
     {
-      return parse_json<bool>::parse(m_values["Enable"]);
+      return parse_json<bool>::parse(field(EnableField));
     }
 
     void IsDektecAdjustedNoiseEnabledResult::setEnable(bool enable)
     {
-      m_values.AddMember("Enable", parse_json<bool>::format(enable, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnableField, parse_json<bool>::format(enable, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsDelayAppliedInSbasResult);
 
+    namespace
+    {
+      // Fields of IsDelayAppliedInSbasResult, indices in fieldNames()
+      constexpr std::size_t IsEnabledField = 0;
+    }
+
 
     IsDelayAppliedInSbasResult::IsDelayAppliedInSbasResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsEnabled"])
+          && parse_json<bool>::is_valid(field(IsEnabledField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsDelayAppliedInSbasResult::isEnabled() const
     {
-      return parse_json<bool>::parse(m_values["IsEnabled"]);
+      return parse_json<bool>::parse(field(IsEnabledField));
     }
 
     void IsDelayAppliedInSbasResult::setIsEnabled(bool isEnabled)
     {
-      m_values.AddMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsEnabledField, parse_json<bool>::format(isEnabled, m_values.GetAllocator()));
     }
 
 
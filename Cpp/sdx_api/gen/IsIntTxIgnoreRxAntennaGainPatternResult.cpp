@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsIntTxIgnoreRxAntennaGainPatternResult);
 
+    namespace
+    {
+      // Fields of IsIntTxIgnoreRxAntennaGainPatternResult, indices in fieldNames()
+      constexpr std::size_t IgnoreField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     IsIntTxIgnoreRxAntennaGainPatternResult::IsIntTxIgnoreRxAntennaGainPatternResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Ignore"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(IgnoreField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     bool IsIntTxIgnoreRxAntennaGainPatternResult::ignore() const
     {
-      return parse_json<bool>::parse(m_values["Ignore"]);
+      return parse_json<bool>::parse(field(IgnoreField));
     }
 
     void IsIntTxIgnoreRxAntennaGainPatternResult::setIgnore(bool ignore)
     {
-      m_values.AddMember("Ignore", parse_json<bool>::format(ignore, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IgnoreField, parse_json<bool>::format(ignore, m_values.GetAllocator()));
     }
 
 
 
     std::string IsIntTxIgnoreRxAntennaGainPatternResult::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void IsIntTxIgnoreRxAntennaGainPatternResult::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -53,6 +53,7 @@ namespace Sdx
 
       // **** enabled ****
       std::vector<bool> enabled() const;
+      std::shared_ptr<const std::vector<bool>> enabledPtr() const;
       void setEnabled(const std::vector<bool>& enabled);
     };
     REGISTER_COMMAND_TO_FACTORY_DECL(IsLOSEnabledForEachSVResult);
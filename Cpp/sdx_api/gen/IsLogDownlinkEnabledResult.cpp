@@ -24,6 +24,14 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsLogDownlinkEnabledResult);
 
+    namespace
+    {
+      // Fields of IsLogDownlinkEnabledResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t BeforeEncodingField = 1;
+      constexpr std::size_t AfterEncodingField = 2;
+    }
+
 
     IsLogDownlinkEnabledResult::IsLogDownlinkEnabledResult()
       : CommandResult(CmdName, TargetId)
@@ -67,9 +75,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["BeforeEncoding"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["AfterEncoding"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::optional<bool>>::is_valid(field(BeforeEncodingField))
+          && parse_json<std::optional<bool>>::is_valid(field(AfterEncodingField))
         ;
 
     }
@@ -85,36 +93,36 @@ namespace Sdx
 
     bool IsLogDownlinkEnabledResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void IsLogDownlinkEnabledResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> IsLogDownlinkEnabledResult::beforeEncoding() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["BeforeEncoding"]);
+      return parse_json<std::optional<bool>>::parse(field(BeforeEncodingField));
     }
 
     void IsLogDownlinkEnabledResult::setBeforeEncoding(const std::optional<bool>& beforeEncoding)
     {
-      m_values.AddMember("BeforeEncoding", parse_json<std::optional<bool>>::format(beforeEncoding, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BeforeEncodingField, parse_json<std::optional<bool>>::format(beforeEncoding, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> IsLogDownlinkEnabledResult::afterEncoding() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["AfterEncoding"]);
+      return parse_json<std::optional<bool>>::parse(field(AfterEncodingField));
     }
 
     void IsLogDownlinkEnabledResult::setAfterEncoding(const std::optional<bool>& afterEncoding)
     {
-      m_values.AddMember("AfterEncoding", parse_json<std::optional<bool>>::format(afterEncoding, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AfterEncodingField, parse_json<std::optional<bool>>::format(afterEncoding, m_values.GetAllocator()));
     }
 
 
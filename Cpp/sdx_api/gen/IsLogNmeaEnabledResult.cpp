@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsLogNmeaEnabledResult);
 
+    namespace
+    {
+      // Fields of IsLogNmeaEnabledResult, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t SerialPortEnabledField = 1;
+    }
+
 
     IsLogNmeaEnabledResult::IsLogNmeaEnabledResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["SerialPortEnabled"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::optional<bool>>::is_valid(field(SerialPortEnabledField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     bool IsLogNmeaEnabledResult::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void IsLogNmeaEnabledResult::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> IsLogNmeaEnabledResult::serialPortEnabled() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["SerialPortEnabled"]);
+      return parse_json<std::optional<bool>>::parse(field(SerialPortEnabledField));
     }
 
     void IsLogNmeaEnabledResult::setSerialPortEnabled(const std::optional<bool>& serialPortEnabled)
     {
-      m_values.AddMember("SerialPortEnabled", parse_json<std::optional<bool>>::format(serialPortEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SerialPortEnabledField, parse_json<std::optional<bool>>::format(serialPortEnabled, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsMapAnalysisEnabledResult);
 
+    namespace
+    {
+      // Fields of IsMapAnalysisEnabledResult, indices in fieldNames()
+      constexpr std::size_t ShowField = 0;
+    }
+
 
     IsMapAnalysisEnabledResult::IsMapAnalysisEnabledResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Show"])
+          && parse_json<bool>::is_valid(field(ShowField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsMapAnalysisEnabledResult::show() const
     {
-      return parse_json<bool>::parse(m_values["Show"]);
+      return parse_json<bool>::parse(field(ShowField));
     }
 
     void IsMapAnalysisEnabledResult::setShow(bool show)
     {
-      m_values.AddMember("Show", parse_json<bool>::format(show, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ShowField, parse_json<bool>::format(show, m_values.GetAllocator()));
     }
 
 
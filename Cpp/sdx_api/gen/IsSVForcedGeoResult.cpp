@@ -26,6 +26,16 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsSVForcedGeoResult);
 
+    namespace
+    {
+      // Fields of IsSVForcedGeoResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t IsGeoField = 2;
+      constexpr std::size_t LongitudeField = 3;
+      constexpr std::size_t DataSetNameField = 4;
+    }
+
 
     IsSVForcedGeoResult::IsSVForcedGeoResult()
       : CommandResult(CmdName, TargetId)
@@ -73,11 +83,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["IsGeo"])
-          && parse_json<double>::is_valid(m_values["Longitude"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(IsGeoField))
+          && parse_json<double>::is_valid(field(LongitudeField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -93,60 +103,60 @@ namespace Sdx
 
     std::string IsSVForcedGeoResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void IsSVForcedGeoResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int IsSVForcedGeoResult::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void IsSVForcedGeoResult::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool IsSVForcedGeoResult::isGeo() const
     {
-      return parse_json<bool>::parse(m_values["IsGeo"]);
+      return parse_json<bool>::parse(field(IsGeoField));
     }
 
     void IsSVForcedGeoResult::setIsGeo(bool isGeo)
     {
-      m_values.AddMember("IsGeo", parse_json<bool>::format(isGeo, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsGeoField, parse_json<bool>::format(isGeo, m_values.GetAllocator()));
     }
 
 
 
     double IsSVForcedGeoResult::longitude() const
     {
-      return parse_json<double>::parse(m_values["Longitude"]);
+      return parse_json<double>::parse(field(LongitudeField));
     }
 
     void IsSVForcedGeoResult::setLongitude(double longitude)
     {
-      m_values.AddMember("Longitude", parse_json<double>::format(longitude, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LongitudeField, parse_json<double>::format(longitude, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> IsSVForcedGeoResult::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void IsSVForcedGeoResult::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
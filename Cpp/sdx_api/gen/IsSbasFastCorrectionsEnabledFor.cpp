@@ -25,6 +25,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(IsSbasFastCorrectionsEnabledFor);
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsSbasFastCorrectionsEnabledFor);
 
+    namespace
+    {
+      // Fields of IsSbasFastCorrectionsEnabledFor, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ErrorTypeField = 1;
+    }
+
 
     IsSbasFastCorrectionsEnabledFor::IsSbasFastCorrectionsEnabledFor()
       : CommandBase(CmdName, TargetId)
@@ -52,8 +59,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["ErrorType"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::optional<std::string>>::is_valid(field(ErrorTypeField))
         ;
 
     }
@@ -75,24 +82,24 @@ namespace Sdx
 
     std::string IsSbasFastCorrectionsEnabledFor::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void IsSbasFastCorrectionsEnabledFor::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> IsSbasFastCorrectionsEnabledFor::errorType() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["ErrorType"]);
+      return fieldValue<std::optional<std::string>>(ErrorTypeField);
     }
 
     void IsSbasFastCorrectionsEnabledFor::setErrorType(const std::optional<std::string>& errorType)
     {
-      m_values.AddMember("ErrorType", parse_json<std::optional<std::string>>::format(errorType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ErrorTypeField, parse_json<std::optional<std::string>>::format(errorType, m_values.GetAllocator()));
     }
 
 
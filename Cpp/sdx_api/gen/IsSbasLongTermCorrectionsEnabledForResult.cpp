@@ -23,6 +23,13 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsSbasLongTermCorrectionsEnabledForResult);
 
+    namespace
+    {
+      // Fields of IsSbasLongTermCorrectionsEnabledForResult, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t IsEnabledField = 1;
+    }
+
 
     IsSbasLongTermCorrectionsEnabledForResult::IsSbasLongTermCorrectionsEnabledForResult()
       : CommandResult(CmdName, TargetId)
@@ -64,8 +71,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<bool>::is_valid(m_values["IsEnabled"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<bool>::is_valid(field(IsEnabledField))
         ;
 
     }
@@ -81,24 +88,24 @@ namespace Sdx
 
     std::string IsSbasLongTermCorrectionsEnabledForResult::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void IsSbasLongTermCorrectionsEnabledForResult::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     bool IsSbasLongTermCorrectionsEnabledForResult::isEnabled() const
     {
-      return parse_json<bool>::parse(m_values["IsEnabled"]);
+      return parse_json<bool>::parse(field(IsEnabledField));
     }
 
     void IsSbasLongTermCorrectionsEnabledForResult::setIsEnabled(bool isEnabled)
     {
-      m_values.AddMember("IsEnabled", parse_json<bool>::format(isEnabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsEnabledField, parse_json<bool>::format(isEnabled, m_values.GetAllocator()));
     }
 
 
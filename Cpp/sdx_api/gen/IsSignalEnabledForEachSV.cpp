@@ -27,6 +27,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(IsSignalEnabledForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsSignalEnabledForEachSV);
 
+    namespace
+    {
+      // Fields of IsSignalEnabledForEachSV, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+    }
+
 
     IsSignalEnabledForEachSV::IsSignalEnabledForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -53,7 +59,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
+          && parse_json<std::string>::is_valid(field(SignalField))
         ;
 
     }
@@ -75,12 +81,12 @@ namespace Sdx
 
     std::string IsSignalEnabledForEachSV::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void IsSignalEnabledForEachSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsSpectrumVisibleResult);
 
+    namespace
+    {
+      // Fields of IsSpectrumVisibleResult, indices in fieldNames()
+      constexpr std::size_t VisibleField = 0;
+    }
+
 
     IsSpectrumVisibleResult::IsSpectrumVisibleResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Visible"])
+          && parse_json<bool>::is_valid(field(VisibleField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsSpectrumVisibleResult::visible() const
     {
-      return parse_json<bool>::parse(m_values["Visible"]);
+      return parse_json<bool>::parse(field(VisibleField));
     }
 
     void IsSpectrumVisibleResult::setVisible(bool visible)
     {
-      m_values.AddMember("Visible", parse_json<bool>::format(visible, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(VisibleField, parse_json<bool>::format(visible, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsTrajectoryCompletedResult);
 
+    namespace
+    {
+      // Fields of IsTrajectoryCompletedResult, indices in fieldNames()
+      constexpr std::size_t IsCompletedField = 0;
+    }
+
 
     IsTrajectoryCompletedResult::IsTrajectoryCompletedResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsCompleted"])
+          && parse_json<bool>::is_valid(field(IsCompletedField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsTrajectoryCompletedResult::isCompleted() const
     {
-      return parse_json<bool>::parse(m_values["IsCompleted"]);
+      return parse_json<bool>::parse(field(IsCompletedField));
     }
 
     void IsTrajectoryCompletedResult::setIsCompleted(bool isCompleted)
     {
-      m_values.AddMember("IsCompleted", parse_json<bool>::format(isCompleted, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsCompletedField, parse_json<bool>::format(isCompleted, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsTransmitMessage2InSbasMessage0Result);
 
+    namespace
+    {
+      // Fields of IsTransmitMessage2InSbasMessage0Result, indices in fieldNames()
+      constexpr std::size_t TransmitMessage2Field = 0;
+    }
+
 
     IsTransmitMessage2InSbasMessage0Result::IsTransmitMessage2InSbasMessage0Result()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["TransmitMessage2"])
+          && parse_json<bool>::is_valid(field(TransmitMessage2Field))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsTransmitMessage2InSbasMessage0Result::transmitMessage2() const
     {
-      return parse_json<bool>::parse(m_values["TransmitMessage2"]);
+      return parse_json<bool>::parse(field(TransmitMessage2Field));
     }
 
     void IsTransmitMessage2InSbasMessage0Result::setTransmitMessage2(bool transmitMessage2)
     {
-      m_values.AddMember("TransmitMessage2", parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitMessage2Field, parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(IsUsingVelocityInSbasMessage25Result);
 
+    namespace
+    {
+      // Fields of IsUsingVelocityInSbasMessage25Result, indices in fieldNames()
+      constexpr std::size_t UseVelocityField = 0;
+    }
+
 
     IsUsingVelocityInSbasMessage25Result::IsUsingVelocityInSbasMessage25Result()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["UseVelocity"])
+          && parse_json<bool>::is_valid(field(UseVelocityField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     bool IsUsingVelocityInSbasMessage25Result::useVelocity() const
     {
-      return parse_json<bool>::parse(m_values["UseVelocity"]);
+      return parse_json<bool>::parse(field(UseVelocityField));
     }
 
     void IsUsingVelocityInSbasMessage25Result::setUseVelocity(bool useVelocity)
     {
-      m_values.AddMember("UseVelocity", parse_json<bool>::format(useVelocity, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UseVelocityField, parse_json<bool>::format(useVelocity, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(LogNmeaRateResult);
 
+    namespace
+    {
+      // Fields of LogNmeaRateResult, indices in fieldNames()
+      constexpr std::size_t RateField = 0;
+    }
+
 
     LogNmeaRateResult::LogNmeaRateResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Rate"])
+          && parse_json<int>::is_valid(field(RateField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int LogNmeaRateResult::rate() const
     {
-      return parse_json<int>::parse(m_values["Rate"]);
+      return parse_json<int>::parse(field(RateField));
     }
 
     void LogNmeaRateResult::setRate(int rate)
     {
-      m_values.AddMember("Rate", parse_json<int>::format(rate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RateField, parse_json<int>::format(rate, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(MessageSequenceImport);
     REGISTER_COMMAND_TO_FACTORY_IMPL(MessageSequenceImport);
 
+    namespace
+    {
+      // Fields of MessageSequenceImport, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t FilenameField = 1;
+    }
+
 
     MessageSequenceImport::MessageSequenceImport()
       : CommandBase(CmdName, TargetId)
@@ -52,8 +59,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::string>::is_valid(m_values["Filename"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::string>::is_valid(field(FilenameField))
         ;
 
     }
@@ -75,24 +82,24 @@ namespace Sdx
 
     std::string MessageSequenceImport::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void MessageSequenceImport::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::string MessageSequenceImport::filename() const
     {
-      return parse_json<std::string>::parse(m_values["Filename"]);
+      return fieldValue<std::string>(FilenameField);
     }
 
     void MessageSequenceImport::setFilename(const std::string& filename)
     {
-      m_values.AddMember("Filename", parse_json<std::string>::format(filename, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilenameField, parse_json<std::string>::format(filename, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(MessageSequenceInsert);
     REGISTER_COMMAND_TO_FACTORY_IMPL(MessageSequenceInsert);
 
+    namespace
+    {
+      // Fields of MessageSequenceInsert, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t IndexField = 1;
+      constexpr std::size_t TypeField = 2;
+    }
+
 
     MessageSequenceInsert::MessageSequenceInsert()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["Index"])
-          && parse_json<int>::is_valid(m_values["Type"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(IndexField))
+          && parse_json<int>::is_valid(field(TypeField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string MessageSequenceInsert::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void MessageSequenceInsert::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int MessageSequenceInsert::index() const
     {
-      return parse_json<int>::parse(m_values["Index"]);
+      return parse_json<int>::parse(field(IndexField));
     }
 
     void MessageSequenceInsert::setIndex(int index)
     {
-      m_values.AddMember("Index", parse_json<int>::format(index, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexField, parse_json<int>::format(index, m_values.GetAllocator()));
     }
 
 
 
     int MessageSequenceInsert::type() const
     {
-      return parse_json<int>::parse(m_values["Type"]);
+      return parse_json<int>::parse(field(TypeField));
     }
 
     void MessageSequenceInsert::setType(int type)
     {
-      m_values.AddMember("Type", parse_json<int>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<int>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(MessageSequenceRemove);
     REGISTER_COMMAND_TO_FACTORY_IMPL(MessageSequenceRemove);
 
+    namespace
+    {
+      // Fields of MessageSequenceRemove, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t IndexField = 1;
+    }
+
 
     MessageSequenceRemove::MessageSequenceRemove()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["Index"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(IndexField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string MessageSequenceRemove::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void MessageSequenceRemove::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int MessageSequenceRemove::index() const
     {
-      return parse_json<int>::parse(m_values["Index"]);
+      return parse_json<int>::parse(field(IndexField));
     }
 
     void MessageSequenceRemove::setIndex(int index)
     {
-      m_values.AddMember("Index", parse_json<int>::format(index, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexField, parse_json<int>::format(index, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(MessageSequenceSwap);
     REGISTER_COMMAND_TO_FACTORY_IMPL(MessageSequenceSwap);
 
+    namespace
+    {
+      // Fields of MessageSequenceSwap, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t IndexIField = 1;
+      constexpr std::size_t IndexJField = 2;
+    }
+
 
     MessageSequenceSwap::MessageSequenceSwap()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["IndexI"])
-          && parse_json<int>::is_valid(m_values["IndexJ"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(IndexIField))
+          && parse_json<int>::is_valid(field(IndexJField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string MessageSequenceSwap::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void MessageSequenceSwap::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int MessageSequenceSwap::indexI() const
     {
-      return parse_json<int>::parse(m_values["IndexI"]);
+      return parse_json<int>::parse(field(IndexIField));
     }
 
     void MessageSequenceSwap::setIndexI(int indexI)
     {
-      m_values.AddMember("IndexI", parse_json<int>::format(indexI, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexIField, parse_json<int>::format(indexI, m_values.GetAllocator()));
     }
 
 
 
     int MessageSequenceSwap::indexJ() const
     {
-      return parse_json<int>::parse(m_values["IndexJ"]);
+      return parse_json<int>::parse(field(IndexJField));
     }
 
     void MessageSequenceSwap::setIndexJ(int indexJ)
     {
-      m_values.AddMember("IndexJ", parse_json<int>::format(indexJ, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexJField, parse_json<int>::format(indexJ, m_values.GetAllocator()));
     }
 
 
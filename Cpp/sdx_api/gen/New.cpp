@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(New);
     REGISTER_COMMAND_TO_FACTORY_IMPL(New);
 
+    namespace
+    {
+      // Fields of New, indices in fieldNames()
+      constexpr std::size_t DiscardCurrentConfigField = 0;
+      constexpr std::size_t LoadDefaultConfigField = 1;
+    }
+
 
     New::New()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["DiscardCurrentConfig"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["LoadDefaultConfig"])
+          && parse_json<bool>::is_valid(field(DiscardCurrentConfigField))
+          && parse_json<std::optional<bool>>::is_valid(field(LoadDefaultConfigField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     bool New::discardCurrentConfig() const
     {
-      return parse_json<bool>::parse(m_values["DiscardCurrentConfig"]);
+      return parse_json<bool>::parse(field(DiscardCurrentConfigField));
     }
 
     void New::setDiscardCurrentConfig(bool discardCurrentConfig)
     {
-      m_values.AddMember("DiscardCurrentConfig", parse_json<bool>::format(discardCurrentConfig, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DiscardCurrentConfigField, parse_json<bool>::format(discardCurrentConfig, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> New::loadDefaultConfig() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["LoadDefaultConfig"]);
+      return parse_json<std::optional<bool>>::parse(field(LoadDefaultConfigField));
     }
 
     void New::setLoadDefaultConfig(const std::optional<bool>& loadDefaultConfig)
     {
-      m_values.AddMember("LoadDefaultConfig", parse_json<std::optional<bool>>::format(loadDefaultConfig, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LoadDefaultConfigField, parse_json<std::optional<bool>>::format(loadDefaultConfig, m_values.GetAllocator()));
     }
 
 
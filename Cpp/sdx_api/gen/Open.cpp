@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(Open);
     REGISTER_COMMAND_TO_FACTORY_IMPL(Open);
 
+    namespace
+    {
+      // Fields of Open, indices in fieldNames()
+      constexpr std::size_t PathField = 0;
+      constexpr std::size_t DiscardCurrentConfigField = 1;
+    }
+
 
     Open::Open()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<bool>::is_valid(m_values["DiscardCurrentConfig"])
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<bool>::is_valid(field(DiscardCurrentConfigField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string Open::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void Open::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     bool Open::discardCurrentConfig() const
     {
-      return parse_json<bool>::parse(m_values["DiscardCurrentConfig"]);
+      return parse_json<bool>::parse(field(DiscardCurrentConfigField));
     }
 
     void Open::setDiscardCurrentConfig(bool discardCurrentConfig)
     {
-      m_values.AddMember("DiscardCurrentConfig", parse_json<bool>::format(discardCurrentConfig, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DiscardCurrentConfigField, parse_json<bool>::format(discardCurrentConfig, m_values.GetAllocator()));
     }
 
 
@@ -41,6 +41,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(PushDynamicAlmanacData);
     REGISTER_COMMAND_TO_FACTORY_IMPL(PushDynamicAlmanacData);
 
+    namespace
+    {
+      // Fields of PushDynamicAlmanacData, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ToaField = 1;
+      constexpr std::size_t AlmanacField = 2;
+    }
+
 
     PushDynamicAlmanacData::PushDynamicAlmanacData()
       : CommandBase(CmdName, TargetId)
@@ -69,9 +77,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Toa"])
-          && parse_json<std::vector<Sdx::AlmanacSVData>>::is_valid(m_values["Almanac"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<Sdx::DateTime>::is_valid(field(ToaField))
+          && parse_json<std::vector<Sdx::AlmanacSVData>>::is_valid(field(AlmanacField))
         ;
 
     }
@@ -93,36 +101,41 @@ namespace Sdx
 
     std::string PushDynamicAlmanacData::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void PushDynamicAlmanacData::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     Sdx::DateTime PushDynamicAlmanacData::toa() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Toa"]);
+      return parse_json<Sdx::DateTime>::parse(field(ToaField));
     }
 
     void PushDynamicAlmanacData::setToa(const Sdx::DateTime& toa)
     {
-      m_values.AddMember("Toa", parse_json<Sdx::DateTime>::format(toa, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ToaField, parse_json<Sdx::DateTime>::format(toa, m_values.GetAllocator()));
     }
 
 
 
     std::vector<Sdx::AlmanacSVData> PushDynamicAlmanacData::almanac() const
     {
-      return parse_json<std::vector<Sdx::AlmanacSVData>>::parse(m_values["Almanac"]);
+      return fieldValue<std::vector<Sdx::AlmanacSVData>>(AlmanacField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::AlmanacSVData>> PushDynamicAlmanacData::almanacPtr() const
+    {
+      return sharedValue<std::vector<Sdx::AlmanacSVData>>(AlmanacField);
     }
 
     void PushDynamicAlmanacData::setAlmanac(const std::vector<Sdx::AlmanacSVData>& almanac)
     {
-      m_values.AddMember("Almanac", parse_json<std::vector<Sdx::AlmanacSVData>>::format(almanac, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AlmanacField, parse_json<std::vector<Sdx::AlmanacSVData>>::format(almanac, m_values.GetAllocator()));
     }
 
 
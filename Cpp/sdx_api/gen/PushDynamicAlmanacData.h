@@ -75,6 +75,7 @@ namespace Sdx
 
       // **** almanac ****
       std::vector<Sdx::AlmanacSVData> almanac() const;
+      std::shared_ptr<const std::vector<Sdx::AlmanacSVData>> almanacPtr() const;
       void setAlmanac(const std::vector<Sdx::AlmanacSVData>& almanac);
     };
     
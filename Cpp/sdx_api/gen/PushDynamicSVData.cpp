@@ -70,6 +70,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(PushDynamicSVData);
     REGISTER_COMMAND_TO_FACTORY_IMPL(PushDynamicSVData);
 
+    namespace
+    {
+      // Fields of PushDynamicSVData, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t TocField = 2;
+      constexpr std::size_t ParametersDictField = 3;
+      constexpr std::size_t DataSetTypesField = 4;
+    }
+
 
     PushDynamicSVData::PushDynamicSVData()
       : CommandBase(CmdName, TargetId)
@@ -100,11 +110,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Toc"])
-          && parse_json<std::map<std::string, double>>::is_valid(m_values["ParametersDict"])
-          && parse_json<std::optional<std::vector<std::string>>>::is_valid(m_values["DataSetTypes"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<Sdx::DateTime>::is_valid(field(TocField))
+          && parse_json<std::map<std::string, double>>::is_valid(field(ParametersDictField))
+          && parse_json<std::optional<std::vector<std::string>>>::is_valid(field(DataSetTypesField))
         ;
 
     }
@@ -126,60 +136,70 @@ namespace Sdx
 
     std::string PushDynamicSVData::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void PushDynamicSVData::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int PushDynamicSVData::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void PushDynamicSVData::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     Sdx::DateTime PushDynamicSVData::toc() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Toc"]);
+      return parse_json<Sdx::DateTime>::parse(field(TocField));
     }
 
     void PushDynamicSVData::setToc(const Sdx::DateTime& toc)
     {
-      m_values.AddMember("Toc", parse_json<Sdx::DateTime>::format(toc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TocField, parse_json<Sdx::DateTime>::format(toc, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, double> PushDynamicSVData::parametersDict() const
     {
-      return parse_json<std::map<std::string, double>>::parse(m_values["ParametersDict"]);
+      return fieldValue<std::map<std::string, double>>(ParametersDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, double>> PushDynamicSVData::parametersDictPtr() const
+    {
+      return sharedValue<std::map<std::string, double>>(ParametersDictField);
     }
 
     void PushDynamicSVData::setParametersDict(const std::map<std::string, double>& parametersDict)
     {
-      m_values.AddMember("ParametersDict", parse_json<std::map<std::string, double>>::format(parametersDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ParametersDictField, parse_json<std::map<std::string, double>>::format(parametersDict, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::vector<std::string>> PushDynamicSVData::dataSetTypes() const
     {
-      return parse_json<std::optional<std::vector<std::string>>>::parse(m_values["DataSetTypes"]);
+      return fieldValue<std::optional<std::vector<std::string>>>(DataSetTypesField);
+    }
+
+    std::shared_ptr<const std::optional<std::vector<std::string>>> PushDynamicSVData::dataSetTypesPtr() const
+    {
+      return sharedValue<std::optional<std::vector<std::string>>>(DataSetTypesField);
     }
 
     void PushDynamicSVData::setDataSetTypes(const std::optional<std::vector<std::string>>& dataSetTypes)
     {
-      m_values.AddMember("DataSetTypes", parse_json<std::optional<std::vector<std::string>>>::format(dataSetTypes, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetTypesField, parse_json<std::optional<std::vector<std::string>>>::format(dataSetTypes, m_values.GetAllocator()));
     }
 
 
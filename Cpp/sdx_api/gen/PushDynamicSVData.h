@@ -110,11 +110,13 @@ namespace Sdx
 
       // **** parametersDict ****
       std::map<std::string, double> parametersDict() const;
+      std::shared_ptr<const std::map<std::string, double>> parametersDictPtr() const;
       void setParametersDict(const std::map<std::string, double>& parametersDict);
 
 
       // **** dataSetTypes ****
       std::optional<std::vector<std::string>> dataSetTypes() const;
+      std::shared_ptr<const std::optional<std::vector<std::string>>> dataSetTypesPtr() const;
       void setDataSetTypes(const std::optional<std::vector<std::string>>& dataSetTypes);
     };
     
@@ -26,6 +26,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(PushRouteEcef);
     REGISTER_COMMAND_TO_FACTORY_IMPL(PushRouteEcef);
 
+    namespace
+    {
+      // Fields of PushRouteEcef, indices in fieldNames()
+      constexpr std::size_t SpeedField = 0;
+      constexpr std::size_t XField = 1;
+      constexpr std::size_t YField = 2;
+      constexpr std::size_t ZField = 3;
+    }
+
 
     PushRouteEcef::PushRouteEcef()
       : CommandBase(CmdName, TargetId)
@@ -55,10 +64,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Speed"])
-          && parse_json<double>::is_valid(m_values["X"])
-          && parse_json<double>::is_valid(m_values["Y"])
-          && parse_json<double>::is_valid(m_values["Z"])
+          && parse_json<double>::is_valid(field(SpeedField))
+          && parse_json<double>::is_valid(field(XField))
+          && parse_json<double>::is_valid(field(YField))
+          && parse_json<double>::is_valid(field(ZField))
         ;
 
     }
@@ -80,48 +89,48 @@ namespace Sdx
 
     double PushRouteEcef::speed() const
     {
-      return parse_json<double>::parse(m_values["Speed"]);
+      return parse_json<double>::parse(field(SpeedField));
     }
 
     void PushRouteEcef::setSpeed(double speed)
     {
-      m_values.AddMember("Speed", parse_json<double>::format(speed, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SpeedField, parse_json<double>::format(speed, m_values.GetAllocator()));
     }
 
 
 
     double PushRouteEcef::x() const
     {
-      return parse_json<double>::parse(m_values["X"]);
+      return parse_json<double>::parse(field(XField));
     }
 
     void PushRouteEcef::setX(double x)
     {
-      m_values.AddMember("X", parse_json<double>::format(x, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(XField, parse_json<double>::format(x, m_values.GetAllocator()));
     }
 
 
 
     double PushRouteEcef::y() const
     {
-      return parse_json<double>::parse(m_values["Y"]);
+      return parse_json<double>::parse(field(YField));
     }
 
     void PushRouteEcef::setY(double y)
     {
-      m_values.AddMember("Y", parse_json<double>::format(y, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(YField, parse_json<double>::format(y, m_values.GetAllocator()));
     }
 
 
 
     double PushRouteEcef::z() const
     {
-      return parse_json<double>::parse(m_values["Z"]);
+      return parse_json<double>::parse(field(ZField));
     }
 
     void PushRouteEcef::setZ(double z)
     {
-      m_values.AddMember("Z", parse_json<double>::format(z, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ZField, parse_json<double>::format(z, m_values.GetAllocator()));
     }
 
 
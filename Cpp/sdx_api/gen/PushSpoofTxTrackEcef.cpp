@@ -27,6 +27,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(PushSpoofTxTrackEcef);
     REGISTER_COMMAND_TO_FACTORY_IMPL(PushSpoofTxTrackEcef);
 
+    namespace
+    {
+      // Fields of PushSpoofTxTrackEcef, indices in fieldNames()
+      constexpr std::size_t TimeField = 0;
+      constexpr std::size_t XField = 1;
+      constexpr std::size_t YField = 2;
+      constexpr std::size_t ZField = 3;
+      constexpr std::size_t IdField = 4;
+    }
+
 
     PushSpoofTxTrackEcef::PushSpoofTxTrackEcef()
       : CommandBase(CmdName, TargetId)
@@ -57,11 +67,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Time"])
-          && parse_json<double>::is_valid(m_values["X"])
-          && parse_json<double>::is_valid(m_values["Y"])
-          && parse_json<double>::is_valid(m_values["Z"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(TimeField))
+          && parse_json<double>::is_valid(field(XField))
+          && parse_json<double>::is_valid(field(YField))
+          && parse_json<double>::is_valid(field(ZField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -83,60 +93,60 @@ namespace Sdx
 
     int PushSpoofTxTrackEcef::time() const
     {
-      return parse_json<int>::parse(m_values["Time"]);
+      return parse_json<int>::parse(field(TimeField));
     }
 
     void PushSpoofTxTrackEcef::setTime(int time)
     {
-      m_values.AddMember("Time", parse_json<int>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<int>::format(time, m_values.GetAllocator()));
     }
 
 
 
     double PushSpoofTxTrackEcef::x() const
     {
-      return parse_json<double>::parse(m_values["X"]);
+      return parse_json<double>::parse(field(XField));
     }
 
     void PushSpoofTxTrackEcef::setX(double x)
     {
-      m_values.AddMember("X", parse_json<double>::format(x, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(XField, parse_json<double>::format(x, m_values.GetAllocator()));
     }
 
 
 
     double PushSpoofTxTrackEcef::y() const
     {
-      return parse_json<double>::parse(m_values["Y"]);
+      return parse_json<double>::parse(field(YField));
     }
 
     void PushSpoofTxTrackEcef::setY(double y)
     {
-      m_values.AddMember("Y", parse_json<double>::format(y, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(YField, parse_json<double>::format(y, m_values.GetAllocator()));
     }
 
 
 
     double PushSpoofTxTrackEcef::z() const
     {
-      return parse_json<double>::parse(m_values["Z"]);
+      return parse_json<double>::parse(field(ZField));
     }
 
     void PushSpoofTxTrackEcef::setZ(double z)
     {
-      m_values.AddMember("Z", parse_json<double>::format(z, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ZField, parse_json<double>::format(z, m_values.GetAllocator()));
     }
 
 
 
     std::string PushSpoofTxTrackEcef::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void PushSpoofTxTrackEcef::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
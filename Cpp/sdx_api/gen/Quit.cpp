@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(Quit);
     REGISTER_COMMAND_TO_FACTORY_IMPL(Quit);
 
+    namespace
+    {
+      // Fields of Quit, indices in fieldNames()
+      constexpr std::size_t ForceQuitField = 0;
+    }
+
 
     Quit::Quit()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["ForceQuit"])
+          && parse_json<bool>::is_valid(field(ForceQuitField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool Quit::forceQuit() const
     {
-      return parse_json<bool>::parse(m_values["ForceQuit"]);
+      return parse_json<bool>::parse(field(ForceQuitField));
     }
 
     void Quit::setForceQuit(bool forceQuit)
     {
-      m_values.AddMember("ForceQuit", parse_json<bool>::format(forceQuit, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ForceQuitField, parse_json<bool>::format(forceQuit, m_values.GetAllocator()));
     }
 
 
@@ -26,6 +26,16 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(RawDataLoggingIntervalResult);
 
+    namespace
+    {
+      // Fields of RawDataLoggingIntervalResult, indices in fieldNames()
+      constexpr std::size_t DaysField = 0;
+      constexpr std::size_t HoursField = 1;
+      constexpr std::size_t MinutesField = 2;
+      constexpr std::size_t SecondsField = 3;
+      constexpr std::size_t MillisecondsField = 4;
+    }
+
 
     RawDataLoggingIntervalResult::RawDataLoggingIntervalResult()
       : CommandResult(CmdName, TargetId)
@@ -73,11 +83,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Days"])
-          && parse_json<int>::is_valid(m_values["Hours"])
-          && parse_json<int>::is_valid(m_values["Minutes"])
-          && parse_json<int>::is_valid(m_values["Seconds"])
-          && parse_json<int>::is_valid(m_values["Milliseconds"])
+          && parse_json<int>::is_valid(field(DaysField))
+          && parse_json<int>::is_valid(field(HoursField))
+          && parse_json<int>::is_valid(field(MinutesField))
+          && parse_json<int>::is_valid(field(SecondsField))
+          && parse_json<int>::is_valid(field(MillisecondsField))
         ;
 
     }
@@ -93,60 +103,60 @@ namespace Sdx
 
     int RawDataLoggingIntervalResult::days() const
     {
-      return parse_json<int>::parse(m_values["Days"]);
+      return parse_json<int>::parse(field(DaysField));
     }
 
     void RawDataLoggingIntervalResult::setDays(int days)
     {
-      m_values.AddMember("Days", parse_json<int>::format(days, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DaysField, parse_json<int>::format(days, m_values.GetAllocator()));
     }
 
 
 
     int RawDataLoggingIntervalResult::hours() const
     {
-      return parse_json<int>::parse(m_values["Hours"]);
+      return parse_json<int>::parse(field(HoursField));
     }
 
     void RawDataLoggingIntervalResult::setHours(int hours)
     {
-      m_values.AddMember("Hours", parse_json<int>::format(hours, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HoursField, parse_json<int>::format(hours, m_values.GetAllocator()));
     }
 
 
 
     int RawDataLoggingIntervalResult::minutes() const
     {
-      return parse_json<int>::parse(m_values["Minutes"]);
+      return parse_json<int>::parse(field(MinutesField));
     }
 
     void RawDataLoggingIntervalResult::setMinutes(int minutes)
     {
-      m_values.AddMember("Minutes", parse_json<int>::format(minutes, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MinutesField, parse_json<int>::format(minutes, m_values.GetAllocator()));
     }
 
 
 
     int RawDataLoggingIntervalResult::seconds() const
     {
-      return parse_json<int>::parse(m_values["Seconds"]);
+      return parse_json<int>::parse(field(SecondsField));
     }
 
     void RawDataLoggingIntervalResult::setSeconds(int seconds)
     {
-      m_values.AddMember("Seconds", parse_json<int>::format(seconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SecondsField, parse_json<int>::format(seconds, m_values.GetAllocator()));
     }
 
 
 
     int RawDataLoggingIntervalResult::milliseconds() const
     {
-      return parse_json<int>::parse(m_values["Milliseconds"]);
+      return parse_json<int>::parse(field(MillisecondsField));
     }
 
     void RawDataLoggingIntervalResult::setMilliseconds(int milliseconds)
     {
-      m_values.AddMember("Milliseconds", parse_json<int>::format(milliseconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MillisecondsField, parse_json<int>::format(milliseconds, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveAllMultipathForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveAllMultipathForSV);
 
+    namespace
+    {
+      // Fields of RemoveAllMultipathForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t ResetField = 2;
+    }
+
 
     RemoveAllMultipathForSV::RemoveAllMultipathForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["Reset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(ResetField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string RemoveAllMultipathForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void RemoveAllMultipathForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int RemoveAllMultipathForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void RemoveAllMultipathForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool RemoveAllMultipathForSV::reset() const
     {
-      return parse_json<bool>::parse(m_values["Reset"]);
+      return parse_json<bool>::parse(field(ResetField));
     }
 
     void RemoveAllMultipathForSV::setReset(bool reset)
     {
-      m_values.AddMember("Reset", parse_json<bool>::format(reset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ResetField, parse_json<bool>::format(reset, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveAllMultipathForSignal);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveAllMultipathForSignal);
 
+    namespace
+    {
+      // Fields of RemoveAllMultipathForSignal, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t ResetField = 1;
+    }
+
 
     RemoveAllMultipathForSignal::RemoveAllMultipathForSignal()
       : CommandBase(CmdName, TargetId)
@@ -54,8 +61,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<bool>::is_valid(m_values["Reset"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<bool>::is_valid(field(ResetField))
         ;
 
     }
@@ -77,24 +84,24 @@ namespace Sdx
 
     std::string RemoveAllMultipathForSignal::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void RemoveAllMultipathForSignal::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     bool RemoveAllMultipathForSignal::reset() const
     {
-      return parse_json<bool>::parse(m_values["Reset"]);
+      return parse_json<bool>::parse(field(ResetField));
     }
 
     void RemoveAllMultipathForSignal::setReset(bool reset)
     {
-      m_values.AddMember("Reset", parse_json<bool>::format(reset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ResetField, parse_json<bool>::format(reset, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveAllMultipathForSystem);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveAllMultipathForSystem);
 
+    namespace
+    {
+      // Fields of RemoveAllMultipathForSystem, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t ResetField = 1;
+    }
+
 
     RemoveAllMultipathForSystem::RemoveAllMultipathForSystem()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<bool>::is_valid(m_values["Reset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<bool>::is_valid(field(ResetField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string RemoveAllMultipathForSystem::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void RemoveAllMultipathForSystem::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     bool RemoveAllMultipathForSystem::reset() const
     {
-      return parse_json<bool>::parse(m_values["Reset"]);
+      return parse_json<bool>::parse(field(ResetField));
     }
 
     void RemoveAllMultipathForSystem::setReset(bool reset)
     {
-      m_values.AddMember("Reset", parse_json<bool>::format(reset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ResetField, parse_json<bool>::format(reset, m_values.GetAllocator()));
     }
 
 
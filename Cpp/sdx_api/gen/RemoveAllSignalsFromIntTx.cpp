@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveAllSignalsFromIntTx);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveAllSignalsFromIntTx);
 
+    namespace
+    {
+      // Fields of RemoveAllSignalsFromIntTx, indices in fieldNames()
+      constexpr std::size_t TransmitterIdField = 0;
+    }
+
 
     RemoveAllSignalsFromIntTx::RemoveAllSignalsFromIntTx()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string RemoveAllSignalsFromIntTx::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void RemoveAllSignalsFromIntTx::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
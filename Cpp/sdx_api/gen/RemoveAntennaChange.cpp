@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveAntennaChange);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveAntennaChange);
 
+    namespace
+    {
+      // Fields of RemoveAntennaChange, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+    }
+
 
     RemoveAntennaChange::RemoveAntennaChange()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string RemoveAntennaChange::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RemoveAntennaChange::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
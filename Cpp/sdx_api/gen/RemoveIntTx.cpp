@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveIntTx);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveIntTx);
 
+    namespace
+    {
+      // Fields of RemoveIntTx, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+    }
+
 
     RemoveIntTx::RemoveIntTx()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     std::string RemoveIntTx::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RemoveIntTx::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
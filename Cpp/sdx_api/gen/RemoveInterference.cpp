@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveInterference);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveInterference);
 
+    namespace
+    {
+      // Fields of RemoveInterference, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+    }
+
 
     RemoveInterference::RemoveInterference()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     std::string RemoveInterference::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RemoveInterference::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
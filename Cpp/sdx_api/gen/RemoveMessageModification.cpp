@@ -29,6 +29,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveMessageModification);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveMessageModification);
 
+    namespace
+    {
+      // Fields of RemoveMessageModification, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     RemoveMessageModification::RemoveMessageModification()
       : CommandBase(CmdName, TargetId)
@@ -56,8 +63,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -79,24 +86,24 @@ namespace Sdx
 
     std::string RemoveMessageModification::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void RemoveMessageModification::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::string RemoveMessageModification::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RemoveMessageModification::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveMessageModificationForNavMsgFamily);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveMessageModificationForNavMsgFamily);
 
+    namespace
+    {
+      // Fields of RemoveMessageModificationForNavMsgFamily, indices in fieldNames()
+      constexpr std::size_t NavMsgFamilyField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     RemoveMessageModificationForNavMsgFamily::RemoveMessageModificationForNavMsgFamily()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["NavMsgFamily"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(NavMsgFamilyField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string RemoveMessageModificationForNavMsgFamily::navMsgFamily() const
     {
-      return parse_json<std::string>::parse(m_values["NavMsgFamily"]);
+      return fieldValue<std::string>(NavMsgFamilyField);
     }
 
     void RemoveMessageModificationForNavMsgFamily::setNavMsgFamily(const std::string& navMsgFamily)
     {
-      m_values.AddMember("NavMsgFamily", parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NavMsgFamilyField, parse_json<std::string>::format(navMsgFamily, m_values.GetAllocator()));
     }
 
 
 
     std::string RemoveMessageModificationForNavMsgFamily::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RemoveMessageModificationForNavMsgFamily::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
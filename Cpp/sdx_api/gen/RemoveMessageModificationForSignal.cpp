@@ -27,6 +27,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemoveMessageModificationForSignal);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemoveMessageModificationForSignal);
 
+    namespace
+    {
+      // Fields of RemoveMessageModificationForSignal, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     RemoveMessageModificationForSignal::RemoveMessageModificationForSignal()
       : CommandBase(CmdName, TargetId)
@@ -54,8 +61,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -77,24 +84,24 @@ namespace Sdx
 
     std::string RemoveMessageModificationForSignal::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void RemoveMessageModificationForSignal::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::string RemoveMessageModificationForSignal::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RemoveMessageModificationForSignal::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
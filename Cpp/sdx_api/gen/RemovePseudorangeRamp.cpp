@@ -25,6 +25,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RemovePseudorangeRamp);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RemovePseudorangeRamp);
 
+    namespace
+    {
+      // Fields of RemovePseudorangeRamp, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     RemovePseudorangeRamp::RemovePseudorangeRamp()
       : CommandBase(CmdName, TargetId)
@@ -52,8 +59,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -75,24 +82,24 @@ namespace Sdx
 
     std::string RemovePseudorangeRamp::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void RemovePseudorangeRamp::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string RemovePseudorangeRamp::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RemovePseudorangeRamp::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
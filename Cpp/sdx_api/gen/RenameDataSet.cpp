@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RenameDataSet);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RenameDataSet);
 
+    namespace
+    {
+      // Fields of RenameDataSet, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t DataSetNameField = 1;
+      constexpr std::size_t NewDataSetNameField = 2;
+    }
+
 
     RenameDataSet::RenameDataSet()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["DataSetName"])
-          && parse_json<std::string>::is_valid(m_values["NewDataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(DataSetNameField))
+          && parse_json<std::string>::is_valid(field(NewDataSetNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string RenameDataSet::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void RenameDataSet::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string RenameDataSet::dataSetName() const
     {
-      return parse_json<std::string>::parse(m_values["DataSetName"]);
+      return fieldValue<std::string>(DataSetNameField);
     }
 
     void RenameDataSet::setDataSetName(const std::string& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::string>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
 
     std::string RenameDataSet::newDataSetName() const
     {
-      return parse_json<std::string>::parse(m_values["NewDataSetName"]);
+      return fieldValue<std::string>(NewDataSetNameField);
     }
 
     void RenameDataSet::setNewDataSetName(const std::string& newDataSetName)
     {
-      m_values.AddMember("NewDataSetName", parse_json<std::string>::format(newDataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NewDataSetNameField, parse_json<std::string>::format(newDataSetName, m_values.GetAllocator()));
     }
 
 
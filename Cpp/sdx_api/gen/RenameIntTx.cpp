@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RenameIntTx);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RenameIntTx);
 
+    namespace
+    {
+      // Fields of RenameIntTx, indices in fieldNames()
+      constexpr std::size_t UsualNameField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     RenameIntTx::RenameIntTx()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["UsualName"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(UsualNameField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string RenameIntTx::usualName() const
     {
-      return parse_json<std::string>::parse(m_values["UsualName"]);
+      return fieldValue<std::string>(UsualNameField);
     }
 
     void RenameIntTx::setUsualName(const std::string& usualName)
     {
-      m_values.AddMember("UsualName", parse_json<std::string>::format(usualName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UsualNameField, parse_json<std::string>::format(usualName, m_values.GetAllocator()));
     }
 
 
 
     std::string RenameIntTx::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void RenameIntTx::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RenameSVAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RenameSVAntennaModel);
 
+    namespace
+    {
+      // Fields of RenameSVAntennaModel, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+      constexpr std::size_t NewNameField = 1;
+      constexpr std::size_t SystemField = 2;
+    }
+
 
     RenameSVAntennaModel::RenameSVAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
-          && parse_json<std::string>::is_valid(m_values["NewName"])
-          && parse_json<std::string>::is_valid(m_values["System"])
+          && parse_json<std::string>::is_valid(field(NameField))
+          && parse_json<std::string>::is_valid(field(NewNameField))
+          && parse_json<std::string>::is_valid(field(SystemField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string RenameSVAntennaModel::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void RenameSVAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
 
     std::string RenameSVAntennaModel::newName() const
     {
-      return parse_json<std::string>::parse(m_values["NewName"]);
+      return fieldValue<std::string>(NewNameField);
     }
 
     void RenameSVAntennaModel::setNewName(const std::string& newName)
     {
-      m_values.AddMember("NewName", parse_json<std::string>::format(newName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NewNameField, parse_json<std::string>::format(newName, m_values.GetAllocator()));
     }
 
 
 
     std::string RenameSVAntennaModel::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void RenameSVAntennaModel::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
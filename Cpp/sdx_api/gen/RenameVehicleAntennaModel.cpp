@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(RenameVehicleAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(RenameVehicleAntennaModel);
 
+    namespace
+    {
+      // Fields of RenameVehicleAntennaModel, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+      constexpr std::size_t NewNameField = 1;
+    }
+
 
     RenameVehicleAntennaModel::RenameVehicleAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
-          && parse_json<std::string>::is_valid(m_values["NewName"])
+          && parse_json<std::string>::is_valid(field(NameField))
+          && parse_json<std::string>::is_valid(field(NewNameField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string RenameVehicleAntennaModel::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void RenameVehicleAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
 
     std::string RenameVehicleAntennaModel::newName() const
     {
-      return parse_json<std::string>::parse(m_values["NewName"]);
+      return fieldValue<std::string>(NewNameField);
     }
 
     void RenameVehicleAntennaModel::setNewName(const std::string& newName)
     {
-      m_values.AddMember("NewName", parse_json<std::string>::format(newName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NewNameField, parse_json<std::string>::format(newName, m_values.GetAllocator()));
     }
 
 
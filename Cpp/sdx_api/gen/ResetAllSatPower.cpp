@@ -25,6 +25,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ResetAllSatPower);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ResetAllSatPower);
 
+    namespace
+    {
+      // Fields of ResetAllSatPower, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+    }
+
 
     ResetAllSatPower::ResetAllSatPower()
       : CommandBase(CmdName, TargetId)
@@ -51,7 +57,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
+          && parse_json<std::string>::is_valid(field(SystemField))
         ;
 
     }
@@ -73,12 +79,12 @@ namespace Sdx
 
     std::string ResetAllSatPower::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void ResetAllSatPower::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
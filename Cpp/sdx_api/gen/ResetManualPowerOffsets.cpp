@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ResetManualPowerOffsets);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ResetManualPowerOffsets);
 
+    namespace
+    {
+      // Fields of ResetManualPowerOffsets, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+    }
+
 
     ResetManualPowerOffsets::ResetManualPowerOffsets()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
+          && parse_json<std::string>::is_valid(field(SystemField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string ResetManualPowerOffsets::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void ResetManualPowerOffsets::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SaveAs);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SaveAs);
 
+    namespace
+    {
+      // Fields of SaveAs, indices in fieldNames()
+      constexpr std::size_t PathField = 0;
+      constexpr std::size_t OverwriteField = 1;
+    }
+
 
     SaveAs::SaveAs()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<bool>::is_valid(m_values["Overwrite"])
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<bool>::is_valid(field(OverwriteField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string SaveAs::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void SaveAs::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     bool SaveAs::overwrite() const
     {
-      return parse_json<bool>::parse(m_values["Overwrite"]);
+      return parse_json<bool>::parse(field(OverwriteField));
     }
 
     void SaveAs::setOverwrite(bool overwrite)
     {
-      m_values.AddMember("Overwrite", parse_json<bool>::format(overwrite, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverwriteField, parse_json<bool>::format(overwrite, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetAgeOfDataBeiDou);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetAgeOfDataBeiDou);
 
+    namespace
+    {
+      // Fields of SetAgeOfDataBeiDou, indices in fieldNames()
+      constexpr std::size_t ClockField = 0;
+      constexpr std::size_t EphemerisField = 1;
+      constexpr std::size_t OverrideRinexField = 2;
+    }
+
 
     SetAgeOfDataBeiDou::SetAgeOfDataBeiDou()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Clock"])
-          && parse_json<int>::is_valid(m_values["Ephemeris"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["OverrideRinex"])
+          && parse_json<int>::is_valid(field(ClockField))
+          && parse_json<int>::is_valid(field(EphemerisField))
+          && parse_json<std::optional<bool>>::is_valid(field(OverrideRinexField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetAgeOfDataBeiDou::clock() const
     {
-      return parse_json<int>::parse(m_values["Clock"]);
+      return parse_json<int>::parse(field(ClockField));
     }
 
     void SetAgeOfDataBeiDou::setClock(int clock)
     {
-      m_values.AddMember("Clock", parse_json<int>::format(clock, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ClockField, parse_json<int>::format(clock, m_values.GetAllocator()));
     }
 
 
 
     int SetAgeOfDataBeiDou::ephemeris() const
     {
-      return parse_json<int>::parse(m_values["Ephemeris"]);
+      return parse_json<int>::parse(field(EphemerisField));
     }
 
     void SetAgeOfDataBeiDou::setEphemeris(int ephemeris)
     {
-      m_values.AddMember("Ephemeris", parse_json<int>::format(ephemeris, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EphemerisField, parse_json<int>::format(ephemeris, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> SetAgeOfDataBeiDou::overrideRinex() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["OverrideRinex"]);
+      return parse_json<std::optional<bool>>::parse(field(OverrideRinexField));
     }
 
     void SetAgeOfDataBeiDou::setOverrideRinex(const std::optional<bool>& overrideRinex)
     {
-      m_values.AddMember("OverrideRinex", parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverrideRinexField, parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetAllSatellitesPseudorangeNoiseOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetAllSatellitesPseudorangeNoiseOffset);
 
+    namespace
+    {
+      // Fields of SetAllSatellitesPseudorangeNoiseOffset, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t EnabledField = 1;
+      constexpr std::size_t OffsetField = 2;
+    }
+
 
     SetAllSatellitesPseudorangeNoiseOffset::SetAllSatellitesPseudorangeNoiseOffset()
       : CommandBase(CmdName, TargetId)
@@ -55,9 +63,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
+          && parse_json<std::vector<double>>::is_valid(field(OffsetField))
         ;
 
     }
@@ -79,36 +87,46 @@ namespace Sdx
 
     std::string SetAllSatellitesPseudorangeNoiseOffset::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetAllSatellitesPseudorangeNoiseOffset::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> SetAllSatellitesPseudorangeNoiseOffset::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> SetAllSatellitesPseudorangeNoiseOffset::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void SetAllSatellitesPseudorangeNoiseOffset::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetAllSatellitesPseudorangeNoiseOffset::offset() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Offset"]);
+      return fieldValue<std::vector<double>>(OffsetField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetAllSatellitesPseudorangeNoiseOffset::offsetPtr() const
+    {
+      return sharedValue<std::vector<double>>(OffsetField);
     }
 
     void SetAllSatellitesPseudorangeNoiseOffset::setOffset(const std::vector<double>& offset)
     {
-      m_values.AddMember("Offset", parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()));
     }
 
 
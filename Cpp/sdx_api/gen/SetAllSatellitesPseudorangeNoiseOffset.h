@@ -54,11 +54,13 @@ namespace Sdx
 
       // **** enabled ****
       std::vector<bool> enabled() const;
+      std::shared_ptr<const std::vector<bool>> enabledPtr() const;
       void setEnabled(const std::vector<bool>& enabled);
 
 
       // **** offset ****
       std::vector<double> offset() const;
+      std::shared_ptr<const std::vector<double>> offsetPtr() const;
       void setOffset(const std::vector<double>& offset);
     };
     
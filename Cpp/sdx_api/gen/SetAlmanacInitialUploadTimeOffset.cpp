@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetAlmanacInitialUploadTimeOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetAlmanacInitialUploadTimeOffset);
 
+    namespace
+    {
+      // Fields of SetAlmanacInitialUploadTimeOffset, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t OffsetField = 1;
+    }
+
 
     SetAlmanacInitialUploadTimeOffset::SetAlmanacInitialUploadTimeOffset()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(OffsetField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string SetAlmanacInitialUploadTimeOffset::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetAlmanacInitialUploadTimeOffset::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetAlmanacInitialUploadTimeOffset::offset() const
     {
-      return parse_json<int>::parse(m_values["Offset"]);
+      return parse_json<int>::parse(field(OffsetField));
     }
 
     void SetAlmanacInitialUploadTimeOffset::setOffset(int offset)
     {
-      m_values.AddMember("Offset", parse_json<int>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<int>::format(offset, m_values.GetAllocator()));
     }
 
 
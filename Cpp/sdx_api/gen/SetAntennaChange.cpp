@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetAntennaChange);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetAntennaChange);
 
+    namespace
+    {
+      // Fields of SetAntennaChange, indices in fieldNames()
+      constexpr std::size_t StartTimeField = 0;
+      constexpr std::size_t AntennaField = 1;
+      constexpr std::size_t IdField = 2;
+    }
+
 
     SetAntennaChange::SetAntennaChange()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["StartTime"])
-          && parse_json<std::string>::is_valid(m_values["Antenna"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<double>::is_valid(field(StartTimeField))
+          && parse_json<std::string>::is_valid(field(AntennaField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     double SetAntennaChange::startTime() const
     {
-      return parse_json<double>::parse(m_values["StartTime"]);
+      return parse_json<double>::parse(field(StartTimeField));
     }
 
     void SetAntennaChange::setStartTime(double startTime)
     {
-      m_values.AddMember("StartTime", parse_json<double>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<double>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     std::string SetAntennaChange::antenna() const
     {
-      return parse_json<std::string>::parse(m_values["Antenna"]);
+      return fieldValue<std::string>(AntennaField);
     }
 
     void SetAntennaChange::setAntenna(const std::string& antenna)
     {
-      m_values.AddMember("Antenna", parse_json<std::string>::format(antenna, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaField, parse_json<std::string>::format(antenna, m_values.GetAllocator()));
     }
 
 
 
     std::string SetAntennaChange::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetAntennaChange::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
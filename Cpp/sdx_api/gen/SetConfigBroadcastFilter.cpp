@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetConfigBroadcastFilter);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetConfigBroadcastFilter);
 
+    namespace
+    {
+      // Fields of SetConfigBroadcastFilter, indices in fieldNames()
+      constexpr std::size_t FilterField = 0;
+    }
+
 
     SetConfigBroadcastFilter::SetConfigBroadcastFilter()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<Sdx::ConfigFilter>>::is_valid(m_values["Filter"])
+          && parse_json<std::vector<Sdx::ConfigFilter>>::is_valid(field(FilterField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<Sdx::ConfigFilter> SetConfigBroadcastFilter::filter() const
     {
-      return parse_json<std::vector<Sdx::ConfigFilter>>::parse(m_values["Filter"]);
+      return fieldValue<std::vector<Sdx::ConfigFilter>>(FilterField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::ConfigFilter>> SetConfigBroadcastFilter::filterPtr() const
+    {
+      return sharedValue<std::vector<Sdx::ConfigFilter>>(FilterField);
     }
 
     void SetConfigBroadcastFilter::setFilter(const std::vector<Sdx::ConfigFilter>& filter)
     {
-      m_values.AddMember("Filter", parse_json<std::vector<Sdx::ConfigFilter>>::format(filter, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilterField, parse_json<std::vector<Sdx::ConfigFilter>>::format(filter, m_values.GetAllocator()));
     }
 
 
@@ -45,6 +45,7 @@ namespace Sdx
 
       // **** filter ****
       std::vector<Sdx::ConfigFilter> filter() const;
+      std::shared_ptr<const std::vector<Sdx::ConfigFilter>> filterPtr() const;
       void setFilter(const std::vector<Sdx::ConfigFilter>& filter);
     };
     
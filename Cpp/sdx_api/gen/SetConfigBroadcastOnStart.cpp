@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetConfigBroadcastOnStart);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetConfigBroadcastOnStart);
 
+    namespace
+    {
+      // Fields of SetConfigBroadcastOnStart, indices in fieldNames()
+      constexpr std::size_t BroadcastOnStartField = 0;
+    }
+
 
     SetConfigBroadcastOnStart::SetConfigBroadcastOnStart()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["BroadcastOnStart"])
+          && parse_json<bool>::is_valid(field(BroadcastOnStartField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool SetConfigBroadcastOnStart::broadcastOnStart() const
     {
-      return parse_json<bool>::parse(m_values["BroadcastOnStart"]);
+      return parse_json<bool>::parse(field(BroadcastOnStartField));
     }
 
     void SetConfigBroadcastOnStart::setBroadcastOnStart(bool broadcastOnStart)
     {
-      m_values.AddMember("BroadcastOnStart", parse_json<bool>::format(broadcastOnStart, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BroadcastOnStartField, parse_json<bool>::format(broadcastOnStart, m_values.GetAllocator()));
     }
 
 
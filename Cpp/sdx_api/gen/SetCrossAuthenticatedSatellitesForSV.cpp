@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetCrossAuthenticatedSatellitesForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetCrossAuthenticatedSatellitesForSV);
 
+    namespace
+    {
+      // Fields of SetCrossAuthenticatedSatellitesForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t SvIdListField = 1;
+    }
+
 
     SetCrossAuthenticatedSatellitesForSV::SetCrossAuthenticatedSatellitesForSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::vector<int>>::is_valid(m_values["SvIdList"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::vector<int>>::is_valid(field(SvIdListField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     int SetCrossAuthenticatedSatellitesForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetCrossAuthenticatedSatellitesForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> SetCrossAuthenticatedSatellitesForSV::svIdList() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["SvIdList"]);
+      return fieldValue<std::vector<int>>(SvIdListField);
+    }
+
+    std::shared_ptr<const std::vector<int>> SetCrossAuthenticatedSatellitesForSV::svIdListPtr() const
+    {
+      return sharedValue<std::vector<int>>(SvIdListField);
     }
 
     void SetCrossAuthenticatedSatellitesForSV::setSvIdList(const std::vector<int>& svIdList)
     {
-      m_values.AddMember("SvIdList", parse_json<std::vector<int>>::format(svIdList, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdListField, parse_json<std::vector<int>>::format(svIdList, m_values.GetAllocator()));
     }
 
 
@@ -50,6 +50,7 @@ namespace Sdx
 
       // **** svIdList ****
       std::vector<int> svIdList() const;
+      std::shared_ptr<const std::vector<int>> svIdListPtr() const;
       void setSvIdList(const std::vector<int>& svIdList);
     };
     
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetCurrentPropagationModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetCurrentPropagationModel);
 
+    namespace
+    {
+      // Fields of SetCurrentPropagationModel, indices in fieldNames()
+      constexpr std::size_t ModelField = 0;
+    }
+
 
     SetCurrentPropagationModel::SetCurrentPropagationModel()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::PropagationModelType>::is_valid(m_values["Model"])
+          && parse_json<Sdx::PropagationModelType>::is_valid(field(ModelField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     Sdx::PropagationModelType SetCurrentPropagationModel::model() const
     {
-      return parse_json<Sdx::PropagationModelType>::parse(m_values["Model"]);
+      return parse_json<Sdx::PropagationModelType>::parse(field(ModelField));
     }
 
     void SetCurrentPropagationModel::setModel(const Sdx::PropagationModelType& model)
     {
-      m_values.AddMember("Model", parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModelField, parse_json<Sdx::PropagationModelType>::format(model, m_values.GetAllocator()));
     }
 
 
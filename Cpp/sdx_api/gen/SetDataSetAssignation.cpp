@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetDataSetAssignation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetDataSetAssignation);
 
+    namespace
+    {
+      // Fields of SetDataSetAssignation, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t DataSetTypeField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     SetDataSetAssignation::SetDataSetAssignation()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::string>::is_valid(m_values["DataSetType"])
-          && parse_json<std::string>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::string>::is_valid(field(DataSetTypeField))
+          && parse_json<std::string>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string SetDataSetAssignation::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetDataSetAssignation::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::string SetDataSetAssignation::dataSetType() const
     {
-      return parse_json<std::string>::parse(m_values["DataSetType"]);
+      return fieldValue<std::string>(DataSetTypeField);
     }
 
     void SetDataSetAssignation::setDataSetType(const std::string& dataSetType)
     {
-      m_values.AddMember("DataSetType", parse_json<std::string>::format(dataSetType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetTypeField, parse_json<std::string>::format(dataSetType, m_values.GetAllocator()));
     }
 
 
 
     std::string SetDataSetAssignation::dataSetName() const
     {
-      return parse_json<std::string>::parse(m_values["DataSetName"]);
+      return fieldValue<std::string>(DataSetNameField);
     }
 
     void SetDataSetAssignation::setDataSetName(const std::string& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::string>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::string>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetDefaultIntTxPersistence);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetDefaultIntTxPersistence);
 
+    namespace
+    {
+      // Fields of SetDefaultIntTxPersistence, indices in fieldNames()
+      constexpr std::size_t DefaultValueField = 0;
+    }
+
 
     SetDefaultIntTxPersistence::SetDefaultIntTxPersistence()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["DefaultValue"])
+          && parse_json<bool>::is_valid(field(DefaultValueField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool SetDefaultIntTxPersistence::defaultValue() const
     {
-      return parse_json<bool>::parse(m_values["DefaultValue"]);
+      return parse_json<bool>::parse(field(DefaultValueField));
     }
 
     void SetDefaultIntTxPersistence::setDefaultValue(bool defaultValue)
     {
-      m_values.AddMember("DefaultValue", parse_json<bool>::format(defaultValue, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DefaultValueField, parse_json<bool>::format(defaultValue, m_values.GetAllocator()));
     }
 
 
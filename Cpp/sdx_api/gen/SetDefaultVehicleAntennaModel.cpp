@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetDefaultVehicleAntennaModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetDefaultVehicleAntennaModel);
 
+    namespace
+    {
+      // Fields of SetDefaultVehicleAntennaModel, indices in fieldNames()
+      constexpr std::size_t NameField = 0;
+    }
+
 
     SetDefaultVehicleAntennaModel::SetDefaultVehicleAntennaModel()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Name"])
+          && parse_json<std::string>::is_valid(field(NameField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string SetDefaultVehicleAntennaModel::name() const
     {
-      return parse_json<std::string>::parse(m_values["Name"]);
+      return fieldValue<std::string>(NameField);
     }
 
     void SetDefaultVehicleAntennaModel::setName(const std::string& name)
     {
-      m_values.AddMember("Name", parse_json<std::string>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::string>::format(name, m_values.GetAllocator()));
     }
 
 
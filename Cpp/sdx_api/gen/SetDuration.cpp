@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetDuration);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetDuration);
 
+    namespace
+    {
+      // Fields of SetDuration, indices in fieldNames()
+      constexpr std::size_t SecondField = 0;
+    }
+
 
     SetDuration::SetDuration()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Second"])
+          && parse_json<int>::is_valid(field(SecondField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetDuration::second() const
     {
-      return parse_json<int>::parse(m_values["Second"]);
+      return parse_json<int>::parse(field(SecondField));
     }
 
     void SetDuration::setSecond(int second)
     {
-      m_values.AddMember("Second", parse_json<int>::format(second, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SecondField, parse_json<int>::format(second, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetDynamicRangeOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetDynamicRangeOffset);
 
+    namespace
+    {
+      // Fields of SetDynamicRangeOffset, indices in fieldNames()
+      constexpr std::size_t OffsetField = 0;
+    }
+
 
     SetDynamicRangeOffset::SetDynamicRangeOffset()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Offset"])
+          && parse_json<double>::is_valid(field(OffsetField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     double SetDynamicRangeOffset::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void SetDynamicRangeOffset::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetEffectiveIonisationLevelCoefficient);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetEffectiveIonisationLevelCoefficient);
 
+    namespace
+    {
+      // Fields of SetEffectiveIonisationLevelCoefficient, indices in fieldNames()
+      constexpr std::size_t IndexField = 0;
+      constexpr std::size_t ValField = 1;
+    }
+
 
     SetEffectiveIonisationLevelCoefficient::SetEffectiveIonisationLevelCoefficient()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Index"])
-          && parse_json<double>::is_valid(m_values["Val"])
+          && parse_json<int>::is_valid(field(IndexField))
+          && parse_json<double>::is_valid(field(ValField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int SetEffectiveIonisationLevelCoefficient::index() const
     {
-      return parse_json<int>::parse(m_values["Index"]);
+      return parse_json<int>::parse(field(IndexField));
     }
 
     void SetEffectiveIonisationLevelCoefficient::setIndex(int index)
     {
-      m_values.AddMember("Index", parse_json<int>::format(index, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IndexField, parse_json<int>::format(index, m_values.GetAllocator()));
     }
 
 
 
     double SetEffectiveIonisationLevelCoefficient::val() const
     {
-      return parse_json<double>::parse(m_values["Val"]);
+      return parse_json<double>::parse(field(ValField));
     }
 
     void SetEffectiveIonisationLevelCoefficient::setVal(double val)
     {
-      m_values.AddMember("Val", parse_json<double>::format(val, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ValField, parse_json<double>::format(val, m_values.GetAllocator()));
     }
 
 
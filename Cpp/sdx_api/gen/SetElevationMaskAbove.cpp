@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetElevationMaskAbove);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetElevationMaskAbove);
 
+    namespace
+    {
+      // Fields of SetElevationMaskAbove, indices in fieldNames()
+      constexpr std::size_t AngleField = 0;
+    }
+
 
     SetElevationMaskAbove::SetElevationMaskAbove()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Angle"])
+          && parse_json<double>::is_valid(field(AngleField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     double SetElevationMaskAbove::angle() const
     {
-      return parse_json<double>::parse(m_values["Angle"]);
+      return parse_json<double>::parse(field(AngleField));
     }
 
     void SetElevationMaskAbove::setAngle(double angle)
     {
-      m_values.AddMember("Angle", parse_json<double>::format(angle, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AngleField, parse_json<double>::format(angle, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetElevationMaskBelow);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetElevationMaskBelow);
 
+    namespace
+    {
+      // Fields of SetElevationMaskBelow, indices in fieldNames()
+      constexpr std::size_t AngleField = 0;
+    }
+
 
     SetElevationMaskBelow::SetElevationMaskBelow()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Angle"])
+          && parse_json<double>::is_valid(field(AngleField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     double SetElevationMaskBelow::angle() const
     {
-      return parse_json<double>::parse(m_values["Angle"]);
+      return parse_json<double>::parse(field(AngleField));
     }
 
     void SetElevationMaskBelow::setAngle(double angle)
     {
-      m_values.AddMember("Angle", parse_json<double>::format(angle, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AngleField, parse_json<double>::format(angle, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetEngineLatency);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetEngineLatency);
 
+    namespace
+    {
+      // Fields of SetEngineLatency, indices in fieldNames()
+      constexpr std::size_t LatencyField = 0;
+    }
+
 
     SetEngineLatency::SetEngineLatency()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Latency"])
+          && parse_json<int>::is_valid(field(LatencyField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetEngineLatency::latency() const
     {
-      return parse_json<int>::parse(m_values["Latency"]);
+      return parse_json<int>::parse(field(LatencyField));
     }
 
     void SetEngineLatency::setLatency(int latency)
     {
-      m_values.AddMember("Latency", parse_json<int>::format(latency, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LatencyField, parse_json<int>::format(latency, m_values.GetAllocator()));
     }
 
 
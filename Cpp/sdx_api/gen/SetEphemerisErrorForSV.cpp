@@ -27,6 +27,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetEphemerisErrorForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetEphemerisErrorForSV);
 
+    namespace
+    {
+      // Fields of SetEphemerisErrorForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t OrbitField = 2;
+      constexpr std::size_t DeltaAf0Field = 3;
+      constexpr std::size_t DeltaAf1Field = 4;
+    }
+
 
     SetEphemerisErrorForSV::SetEphemerisErrorForSV()
       : CommandBase(CmdName, TargetId)
@@ -57,11 +67,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<Sdx::RIC>::is_valid(m_values["Orbit"])
-          && parse_json<double>::is_valid(m_values["DeltaAf0"])
-          && parse_json<double>::is_valid(m_values["DeltaAf1"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<Sdx::RIC>::is_valid(field(OrbitField))
+          && parse_json<double>::is_valid(field(DeltaAf0Field))
+          && parse_json<double>::is_valid(field(DeltaAf1Field))
         ;
 
     }
@@ -83,60 +93,60 @@ namespace Sdx
 
     std::string SetEphemerisErrorForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetEphemerisErrorForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetEphemerisErrorForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetEphemerisErrorForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     Sdx::RIC SetEphemerisErrorForSV::orbit() const
     {
-      return parse_json<Sdx::RIC>::parse(m_values["Orbit"]);
+      return parse_json<Sdx::RIC>::parse(field(OrbitField));
     }
 
     void SetEphemerisErrorForSV::setOrbit(const Sdx::RIC& orbit)
     {
-      m_values.AddMember("Orbit", parse_json<Sdx::RIC>::format(orbit, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OrbitField, parse_json<Sdx::RIC>::format(orbit, m_values.GetAllocator()));
     }
 
 
 
     double SetEphemerisErrorForSV::deltaAf0() const
     {
-      return parse_json<double>::parse(m_values["DeltaAf0"]);
+      return parse_json<double>::parse(field(DeltaAf0Field));
     }
 
     void SetEphemerisErrorForSV::setDeltaAf0(double deltaAf0)
     {
-      m_values.AddMember("DeltaAf0", parse_json<double>::format(deltaAf0, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DeltaAf0Field, parse_json<double>::format(deltaAf0, m_values.GetAllocator()));
     }
 
 
 
     double SetEphemerisErrorForSV::deltaAf1() const
     {
-      return parse_json<double>::parse(m_values["DeltaAf1"]);
+      return parse_json<double>::parse(field(DeltaAf1Field));
     }
 
     void SetEphemerisErrorForSV::setDeltaAf1(double deltaAf1)
     {
-      m_values.AddMember("DeltaAf1", parse_json<double>::format(deltaAf1, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DeltaAf1Field, parse_json<double>::format(deltaAf1, m_values.GetAllocator()));
     }
 
 
@@ -28,6 +28,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetEphemerisReferenceTime);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetEphemerisReferenceTime);
 
+    namespace
+    {
+      // Fields of SetEphemerisReferenceTime, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t TimeField = 2;
+      constexpr std::size_t DataSetNameField = 3;
+    }
+
 
     SetEphemerisReferenceTime::SetEphemerisReferenceTime()
       : CommandBase(CmdName, TargetId)
@@ -57,10 +66,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Time"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<Sdx::DateTime>::is_valid(field(TimeField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -82,48 +91,48 @@ namespace Sdx
 
     std::string SetEphemerisReferenceTime::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetEphemerisReferenceTime::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetEphemerisReferenceTime::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetEphemerisReferenceTime::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     Sdx::DateTime SetEphemerisReferenceTime::time() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Time"]);
+      return parse_json<Sdx::DateTime>::parse(field(TimeField));
     }
 
     void SetEphemerisReferenceTime::setTime(const Sdx::DateTime& time)
     {
-      m_values.AddMember("Time", parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetEphemerisReferenceTime::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetEphemerisReferenceTime::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
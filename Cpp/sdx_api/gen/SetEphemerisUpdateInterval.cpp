@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetEphemerisUpdateInterval);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetEphemerisUpdateInterval);
 
+    namespace
+    {
+      // Fields of SetEphemerisUpdateInterval, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t IntervalField = 1;
+    }
+
 
     SetEphemerisUpdateInterval::SetEphemerisUpdateInterval()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Interval"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(IntervalField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string SetEphemerisUpdateInterval::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetEphemerisUpdateInterval::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetEphemerisUpdateInterval::interval() const
     {
-      return parse_json<int>::parse(m_values["Interval"]);
+      return parse_json<int>::parse(field(IntervalField));
     }
 
     void SetEphemerisUpdateInterval::setInterval(int interval)
     {
-      m_values.AddMember("Interval", parse_json<int>::format(interval, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IntervalField, parse_json<int>::format(interval, m_values.GetAllocator()));
     }
 
 
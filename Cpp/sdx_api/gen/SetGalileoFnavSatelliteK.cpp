@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGalileoFnavSatelliteK);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGalileoFnavSatelliteK);
 
+    namespace
+    {
+      // Fields of SetGalileoFnavSatelliteK, indices in fieldNames()
+      constexpr std::size_t PrnField = 0;
+      constexpr std::size_t KField = 1;
+    }
+
 
     SetGalileoFnavSatelliteK::SetGalileoFnavSatelliteK()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Prn"])
-          && parse_json<int>::is_valid(m_values["K"])
+          && parse_json<int>::is_valid(field(PrnField))
+          && parse_json<int>::is_valid(field(KField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int SetGalileoFnavSatelliteK::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void SetGalileoFnavSatelliteK::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
 
     int SetGalileoFnavSatelliteK::k() const
     {
-      return parse_json<int>::parse(m_values["K"]);
+      return parse_json<int>::parse(field(KField));
     }
 
     void SetGalileoFnavSatelliteK::setK(int k)
     {
-      m_values.AddMember("K", parse_json<int>::format(k, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(KField, parse_json<int>::format(k, m_values.GetAllocator()));
     }
 
 
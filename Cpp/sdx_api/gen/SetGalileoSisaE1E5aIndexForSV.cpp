@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGalileoSisaE1E5aIndexForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGalileoSisaE1E5aIndexForSV);
 
+    namespace
+    {
+      // Fields of SetGalileoSisaE1E5aIndexForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t SisaiField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     SetGalileoSisaE1E5aIndexForSV::SetGalileoSisaE1E5aIndexForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["Sisai"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(SisaiField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetGalileoSisaE1E5aIndexForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetGalileoSisaE1E5aIndexForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int SetGalileoSisaE1E5aIndexForSV::sisai() const
     {
-      return parse_json<int>::parse(m_values["Sisai"]);
+      return parse_json<int>::parse(field(SisaiField));
     }
 
     void SetGalileoSisaE1E5aIndexForSV::setSisai(int sisai)
     {
-      m_values.AddMember("Sisai", parse_json<int>::format(sisai, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SisaiField, parse_json<int>::format(sisai, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetGalileoSisaE1E5aIndexForSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetGalileoSisaE1E5aIndexForSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGaussianNoisePowerDensityOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGaussianNoisePowerDensityOffset);
 
+    namespace
+    {
+      // Fields of SetGaussianNoisePowerDensityOffset, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t OutputIdxField = 1;
+      constexpr std::size_t PowerDensityOffsetField = 2;
+    }
+
 
     SetGaussianNoisePowerDensityOffset::SetGaussianNoisePowerDensityOffset()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<int>::is_valid(m_values["OutputIdx"])
-          && parse_json<double>::is_valid(m_values["PowerDensityOffset"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<int>::is_valid(field(OutputIdxField))
+          && parse_json<double>::is_valid(field(PowerDensityOffsetField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string SetGaussianNoisePowerDensityOffset::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetGaussianNoisePowerDensityOffset::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     int SetGaussianNoisePowerDensityOffset::outputIdx() const
     {
-      return parse_json<int>::parse(m_values["OutputIdx"]);
+      return parse_json<int>::parse(field(OutputIdxField));
     }
 
     void SetGaussianNoisePowerDensityOffset::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputIdxField, parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
 
     double SetGaussianNoisePowerDensityOffset::powerDensityOffset() const
     {
-      return parse_json<double>::parse(m_values["PowerDensityOffset"]);
+      return parse_json<double>::parse(field(PowerDensityOffsetField));
     }
 
     void SetGaussianNoisePowerDensityOffset::setPowerDensityOffset(double powerDensityOffset)
     {
-      m_values.AddMember("PowerDensityOffset", parse_json<double>::format(powerDensityOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerDensityOffsetField, parse_json<double>::format(powerDensityOffset, m_values.GetAllocator()));
     }
 
 
@@ -51,6 +51,7 @@ namespace Sdx
 
       // **** val ****
       std::vector<double> val() const;
+      std::shared_ptr<const std::vector<double>> valPtr() const;
       void setVal(const std::vector<double>& val);
     };
     
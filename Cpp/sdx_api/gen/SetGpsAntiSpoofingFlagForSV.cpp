@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGpsAntiSpoofingFlagForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGpsAntiSpoofingFlagForSV);
 
+    namespace
+    {
+      // Fields of SetGpsAntiSpoofingFlagForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t AntiSpoofingField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     SetGpsAntiSpoofingFlagForSV::SetGpsAntiSpoofingFlagForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<Sdx::GpsASFlag>::is_valid(m_values["AntiSpoofing"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<Sdx::GpsASFlag>::is_valid(field(AntiSpoofingField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetGpsAntiSpoofingFlagForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetGpsAntiSpoofingFlagForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     Sdx::GpsASFlag SetGpsAntiSpoofingFlagForSV::antiSpoofing() const
     {
-      return parse_json<Sdx::GpsASFlag>::parse(m_values["AntiSpoofing"]);
+      return parse_json<Sdx::GpsASFlag>::parse(field(AntiSpoofingField));
     }
 
     void SetGpsAntiSpoofingFlagForSV::setAntiSpoofing(const Sdx::GpsASFlag& antiSpoofing)
     {
-      m_values.AddMember("AntiSpoofing", parse_json<Sdx::GpsASFlag>::format(antiSpoofing, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntiSpoofingField, parse_json<Sdx::GpsASFlag>::format(antiSpoofing, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetGpsAntiSpoofingFlagForSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetGpsAntiSpoofingFlagForSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGpsCNavAlertFlagToSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGpsCNavAlertFlagToSV);
 
+    namespace
+    {
+      // Fields of SetGpsCNavAlertFlagToSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t AlertField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     SetGpsCNavAlertFlagToSV::SetGpsCNavAlertFlagToSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["Alert"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(AlertField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetGpsCNavAlertFlagToSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetGpsCNavAlertFlagToSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool SetGpsCNavAlertFlagToSV::alert() const
     {
-      return parse_json<bool>::parse(m_values["Alert"]);
+      return parse_json<bool>::parse(field(AlertField));
     }
 
     void SetGpsCNavAlertFlagToSV::setAlert(bool alert)
     {
-      m_values.AddMember("Alert", parse_json<bool>::format(alert, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AlertField, parse_json<bool>::format(alert, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetGpsCNavAlertFlagToSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetGpsCNavAlertFlagToSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
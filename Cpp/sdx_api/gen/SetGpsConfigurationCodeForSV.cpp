@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGpsConfigurationCodeForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGpsConfigurationCodeForSV);
 
+    namespace
+    {
+      // Fields of SetGpsConfigurationCodeForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t SvConfigField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     SetGpsConfigurationCodeForSV::SetGpsConfigurationCodeForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["SvConfig"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(SvConfigField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetGpsConfigurationCodeForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetGpsConfigurationCodeForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int SetGpsConfigurationCodeForSV::svConfig() const
     {
-      return parse_json<int>::parse(m_values["SvConfig"]);
+      return parse_json<int>::parse(field(SvConfigField));
     }
 
     void SetGpsConfigurationCodeForSV::setSvConfig(int svConfig)
     {
-      m_values.AddMember("SvConfig", parse_json<int>::format(svConfig, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvConfigField, parse_json<int>::format(svConfig, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetGpsConfigurationCodeForSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetGpsConfigurationCodeForSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGpsConfigurationForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGpsConfigurationForEachSV);
 
+    namespace
+    {
+      // Fields of SetGpsConfigurationForEachSV, indices in fieldNames()
+      constexpr std::size_t SvConfigsField = 0;
+      constexpr std::size_t DataSetNameField = 1;
+    }
+
 
     SetGpsConfigurationForEachSV::SetGpsConfigurationForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<int>>::is_valid(m_values["SvConfigs"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::vector<int>>::is_valid(field(SvConfigsField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::vector<int> SetGpsConfigurationForEachSV::svConfigs() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["SvConfigs"]);
+      return fieldValue<std::vector<int>>(SvConfigsField);
+    }
+
+    std::shared_ptr<const std::vector<int>> SetGpsConfigurationForEachSV::svConfigsPtr() const
+    {
+      return sharedValue<std::vector<int>>(SvConfigsField);
     }
 
     void SetGpsConfigurationForEachSV::setSvConfigs(const std::vector<int>& svConfigs)
     {
-      m_values.AddMember("SvConfigs", parse_json<std::vector<int>>::format(svConfigs, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvConfigsField, parse_json<std::vector<int>>::format(svConfigs, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetGpsConfigurationForEachSV::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetGpsConfigurationForEachSV::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
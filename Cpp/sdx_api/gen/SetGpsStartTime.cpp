@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGpsStartTime);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGpsStartTime);
 
+    namespace
+    {
+      // Fields of SetGpsStartTime, indices in fieldNames()
+      constexpr std::size_t StartField = 0;
+    }
+
 
     SetGpsStartTime::SetGpsStartTime()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Start"])
+          && parse_json<Sdx::DateTime>::is_valid(field(StartField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     Sdx::DateTime SetGpsStartTime::start() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Start"]);
+      return parse_json<Sdx::DateTime>::parse(field(StartField));
     }
 
     void SetGpsStartTime::setStart(const Sdx::DateTime& start)
     {
-      m_values.AddMember("Start", parse_json<Sdx::DateTime>::format(start, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartField, parse_json<Sdx::DateTime>::format(start, m_values.GetAllocator()));
     }
 
 
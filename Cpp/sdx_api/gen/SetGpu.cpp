@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetGpu);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetGpu);
 
+    namespace
+    {
+      // Fields of SetGpu, indices in fieldNames()
+      constexpr std::size_t GpuIdxField = 0;
+      constexpr std::size_t OutputField = 1;
+      constexpr std::size_t IdField = 2;
+    }
+
 
     SetGpu::SetGpu()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["GpuIdx"])
-          && parse_json<int>::is_valid(m_values["Output"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(GpuIdxField))
+          && parse_json<int>::is_valid(field(OutputField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetGpu::gpuIdx() const
     {
-      return parse_json<int>::parse(m_values["GpuIdx"]);
+      return parse_json<int>::parse(field(GpuIdxField));
     }
 
     void SetGpu::setGpuIdx(int gpuIdx)
     {
-      m_values.AddMember("GpuIdx", parse_json<int>::format(gpuIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GpuIdxField, parse_json<int>::format(gpuIdx, m_values.GetAllocator()));
     }
 
 
 
     int SetGpu::output() const
     {
-      return parse_json<int>::parse(m_values["Output"]);
+      return parse_json<int>::parse(field(OutputField));
     }
 
     void SetGpu::setOutput(int output)
     {
-      m_values.AddMember("Output", parse_json<int>::format(output, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputField, parse_json<int>::format(output, m_values.GetAllocator()));
     }
 
 
 
     std::string SetGpu::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetGpu::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetHilTjoin);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetHilTjoin);
 
+    namespace
+    {
+      // Fields of SetHilTjoin, indices in fieldNames()
+      constexpr std::size_t HilTjoinField = 0;
+    }
+
 
     SetHilTjoin::SetHilTjoin()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["HilTjoin"])
+          && parse_json<int>::is_valid(field(HilTjoinField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetHilTjoin::hilTjoin() const
     {
-      return parse_json<int>::parse(m_values["HilTjoin"]);
+      return parse_json<int>::parse(field(HilTjoinField));
     }
 
     void SetHilTjoin::setHilTjoin(int hilTjoin)
     {
-      m_values.AddMember("HilTjoin", parse_json<int>::format(hilTjoin, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HilTjoinField, parse_json<int>::format(hilTjoin, m_values.GetAllocator()));
     }
 
 
@@ -48,6 +48,7 @@ namespace Sdx
 
       // **** gain ****
       std::vector<std::vector<double>> gain() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gainPtr() const;
       void setGain(const std::vector<std::vector<double>>& gain);
 
 
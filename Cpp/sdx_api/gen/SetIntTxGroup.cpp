@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIntTxGroup);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIntTxGroup);
 
+    namespace
+    {
+      // Fields of SetIntTxGroup, indices in fieldNames()
+      constexpr std::size_t GroupField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     SetIntTxGroup::SetIntTxGroup()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Group"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(GroupField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int SetIntTxGroup::group() const
     {
-      return parse_json<int>::parse(m_values["Group"]);
+      return parse_json<int>::parse(field(GroupField));
     }
 
     void SetIntTxGroup::setGroup(int group)
     {
-      m_values.AddMember("Group", parse_json<int>::format(group, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GroupField, parse_json<int>::format(group, m_values.GetAllocator()));
     }
 
 
 
     std::string SetIntTxGroup::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetIntTxGroup::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
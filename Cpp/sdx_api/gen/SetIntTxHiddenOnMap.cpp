@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIntTxHiddenOnMap);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIntTxHiddenOnMap);
 
+    namespace
+    {
+      // Fields of SetIntTxHiddenOnMap, indices in fieldNames()
+      constexpr std::size_t HiddenOnMapField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     SetIntTxHiddenOnMap::SetIntTxHiddenOnMap()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["HiddenOnMap"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(HiddenOnMapField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     bool SetIntTxHiddenOnMap::hiddenOnMap() const
     {
-      return parse_json<bool>::parse(m_values["HiddenOnMap"]);
+      return parse_json<bool>::parse(field(HiddenOnMapField));
     }
 
     void SetIntTxHiddenOnMap::setHiddenOnMap(bool hiddenOnMap)
     {
-      m_values.AddMember("HiddenOnMap", parse_json<bool>::format(hiddenOnMap, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HiddenOnMapField, parse_json<bool>::format(hiddenOnMap, m_values.GetAllocator()));
     }
 
 
 
     std::string SetIntTxHiddenOnMap::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetIntTxHiddenOnMap::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIntTxUseManualPropagationLoss);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIntTxUseManualPropagationLoss);
 
+    namespace
+    {
+      // Fields of SetIntTxUseManualPropagationLoss, indices in fieldNames()
+      constexpr std::size_t ManualField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     SetIntTxUseManualPropagationLoss::SetIntTxUseManualPropagationLoss()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Manual"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(ManualField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     bool SetIntTxUseManualPropagationLoss::manual() const
     {
-      return parse_json<bool>::parse(m_values["Manual"]);
+      return parse_json<bool>::parse(field(ManualField));
     }
 
     void SetIntTxUseManualPropagationLoss::setManual(bool manual)
     {
-      m_values.AddMember("Manual", parse_json<bool>::format(manual, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ManualField, parse_json<bool>::format(manual, m_values.GetAllocator()));
     }
 
 
 
     std::string SetIntTxUseManualPropagationLoss::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetIntTxUseManualPropagationLoss::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
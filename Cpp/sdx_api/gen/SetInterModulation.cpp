@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetInterModulation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetInterModulation);
 
+    namespace
+    {
+      // Fields of SetInterModulation, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t CoefficientField = 1;
+    }
+
 
     SetInterModulation::SetInterModulation()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<Sdx::SignalWithComponent>>::is_valid(m_values["SignalArray"])
-          && parse_json<double>::is_valid(m_values["Coefficient"])
+          && parse_json<std::vector<Sdx::SignalWithComponent>>::is_valid(field(SignalArrayField))
+          && parse_json<double>::is_valid(field(CoefficientField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::vector<Sdx::SignalWithComponent> SetInterModulation::signalArray() const
     {
-      return parse_json<std::vector<Sdx::SignalWithComponent>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<Sdx::SignalWithComponent>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::SignalWithComponent>> SetInterModulation::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<Sdx::SignalWithComponent>>(SignalArrayField);
     }
 
     void SetInterModulation::setSignalArray(const std::vector<Sdx::SignalWithComponent>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<Sdx::SignalWithComponent>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     double SetInterModulation::coefficient() const
     {
-      return parse_json<double>::parse(m_values["Coefficient"]);
+      return parse_json<double>::parse(field(CoefficientField));
     }
 
     void SetInterModulation::setCoefficient(double coefficient)
     {
-      m_values.AddMember("Coefficient", parse_json<double>::format(coefficient, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CoefficientField, parse_json<double>::format(coefficient, m_values.GetAllocator()));
     }
 
 
@@ -46,6 +46,7 @@ namespace Sdx
 
       // **** signalArray ****
       std::vector<Sdx::SignalWithComponent> signalArray() const;
+      std::shared_ptr<const std::vector<Sdx::SignalWithComponent>> signalArrayPtr() const;
       void setSignalArray(const std::vector<Sdx::SignalWithComponent>& signalArray);
 
 
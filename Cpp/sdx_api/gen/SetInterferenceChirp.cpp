@@ -30,6 +30,19 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetInterferenceChirp);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetInterferenceChirp);
 
+    namespace
+    {
+      // Fields of SetInterferenceChirp, indices in fieldNames()
+      constexpr std::size_t StartTimeField = 0;
+      constexpr std::size_t StopTimeField = 1;
+      constexpr std::size_t CentralFreqField = 2;
+      constexpr std::size_t PowerField = 3;
+      constexpr std::size_t BandwidthField = 4;
+      constexpr std::size_t SweepTimeField = 5;
+      constexpr std::size_t EnabledField = 6;
+      constexpr std::size_t IdField = 7;
+    }
+
 
     SetInterferenceChirp::SetInterferenceChirp()
       : CommandBase(CmdName, TargetId)
@@ -63,14 +76,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<double>::is_valid(m_values["CentralFreq"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<double>::is_valid(m_values["Bandwidth"])
-          && parse_json<double>::is_valid(m_values["SweepTime"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<double>::is_valid(field(CentralFreqField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<double>::is_valid(field(BandwidthField))
+          && parse_json<double>::is_valid(field(SweepTimeField))
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -92,96 +105,96 @@ namespace Sdx
 
     int SetInterferenceChirp::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void SetInterferenceChirp::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int SetInterferenceChirp::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void SetInterferenceChirp::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     double SetInterferenceChirp::centralFreq() const
     {
-      return parse_json<double>::parse(m_values["CentralFreq"]);
+      return parse_json<double>::parse(field(CentralFreqField));
     }
 
     void SetInterferenceChirp::setCentralFreq(double centralFreq)
     {
-      m_values.AddMember("CentralFreq", parse_json<double>::format(centralFreq, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqField, parse_json<double>::format(centralFreq, m_values.GetAllocator()));
     }
 
 
 
     double SetInterferenceChirp::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void SetInterferenceChirp::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     double SetInterferenceChirp::bandwidth() const
     {
-      return parse_json<double>::parse(m_values["Bandwidth"]);
+      return parse_json<double>::parse(field(BandwidthField));
     }
 
     void SetInterferenceChirp::setBandwidth(double bandwidth)
     {
-      m_values.AddMember("Bandwidth", parse_json<double>::format(bandwidth, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandwidthField, parse_json<double>::format(bandwidth, m_values.GetAllocator()));
     }
 
 
 
     double SetInterferenceChirp::sweepTime() const
     {
-      return parse_json<double>::parse(m_values["SweepTime"]);
+      return parse_json<double>::parse(field(SweepTimeField));
     }
 
     void SetInterferenceChirp::setSweepTime(double sweepTime)
     {
-      m_values.AddMember("SweepTime", parse_json<double>::format(sweepTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SweepTimeField, parse_json<double>::format(sweepTime, m_values.GetAllocator()));
     }
 
 
 
     bool SetInterferenceChirp::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void SetInterferenceChirp::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::string SetInterferenceChirp::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetInterferenceChirp::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
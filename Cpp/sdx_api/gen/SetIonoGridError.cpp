@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIonoGridError);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIonoGridError);
 
+    namespace
+    {
+      // Fields of SetIonoGridError, indices in fieldNames()
+      constexpr std::size_t BandField = 0;
+      constexpr std::size_t PointField = 1;
+      constexpr std::size_t ErrorField = 2;
+    }
+
 
     SetIonoGridError::SetIonoGridError()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Band"])
-          && parse_json<int>::is_valid(m_values["Point"])
-          && parse_json<double>::is_valid(m_values["Error"])
+          && parse_json<int>::is_valid(field(BandField))
+          && parse_json<int>::is_valid(field(PointField))
+          && parse_json<double>::is_valid(field(ErrorField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetIonoGridError::band() const
     {
-      return parse_json<int>::parse(m_values["Band"]);
+      return parse_json<int>::parse(field(BandField));
     }
 
     void SetIonoGridError::setBand(int band)
     {
-      m_values.AddMember("Band", parse_json<int>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<int>::format(band, m_values.GetAllocator()));
     }
 
 
 
     int SetIonoGridError::point() const
     {
-      return parse_json<int>::parse(m_values["Point"]);
+      return parse_json<int>::parse(field(PointField));
     }
 
     void SetIonoGridError::setPoint(int point)
     {
-      m_values.AddMember("Point", parse_json<int>::format(point, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PointField, parse_json<int>::format(point, m_values.GetAllocator()));
     }
 
 
 
     double SetIonoGridError::error() const
     {
-      return parse_json<double>::parse(m_values["Error"]);
+      return parse_json<double>::parse(field(ErrorField));
     }
 
     void SetIonoGridError::setError(double error)
     {
-      m_values.AddMember("Error", parse_json<double>::format(error, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ErrorField, parse_json<double>::format(error, m_values.GetAllocator()));
     }
 
 
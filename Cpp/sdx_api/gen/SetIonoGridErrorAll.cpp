@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIonoGridErrorAll);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIonoGridErrorAll);
 
+    namespace
+    {
+      // Fields of SetIonoGridErrorAll, indices in fieldNames()
+      constexpr std::size_t GridField = 0;
+    }
+
 
     SetIonoGridErrorAll::SetIonoGridErrorAll()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::vector<double>>>::is_valid(m_values["Grid"])
+          && parse_json<std::vector<std::vector<double>>>::is_valid(field(GridField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<std::vector<double>> SetIonoGridErrorAll::grid() const
     {
-      return parse_json<std::vector<std::vector<double>>>::parse(m_values["Grid"]);
+      return fieldValue<std::vector<std::vector<double>>>(GridField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<double>>> SetIonoGridErrorAll::gridPtr() const
+    {
+      return sharedValue<std::vector<std::vector<double>>>(GridField);
     }
 
     void SetIonoGridErrorAll::setGrid(const std::vector<std::vector<double>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GridField, parse_json<std::vector<std::vector<double>>>::format(grid, m_values.GetAllocator()));
     }
 
 
@@ -44,6 +44,7 @@ namespace Sdx
 
       // **** grid ****
       std::vector<std::vector<double>> grid() const;
+      std::shared_ptr<const std::vector<std::vector<double>>> gridPtr() const;
       void setGrid(const std::vector<std::vector<double>>& grid);
     };
     
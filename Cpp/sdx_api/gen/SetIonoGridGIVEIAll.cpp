@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIonoGridGIVEIAll);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIonoGridGIVEIAll);
 
+    namespace
+    {
+      // Fields of SetIonoGridGIVEIAll, indices in fieldNames()
+      constexpr std::size_t GridField = 0;
+      constexpr std::size_t ServiceProviderField = 1;
+    }
+
 
     SetIonoGridGIVEIAll::SetIonoGridGIVEIAll()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::vector<int>>>::is_valid(m_values["Grid"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["ServiceProvider"])
+          && parse_json<std::vector<std::vector<int>>>::is_valid(field(GridField))
+          && parse_json<std::optional<std::string>>::is_valid(field(ServiceProviderField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::vector<std::vector<int>> SetIonoGridGIVEIAll::grid() const
     {
-      return parse_json<std::vector<std::vector<int>>>::parse(m_values["Grid"]);
+      return fieldValue<std::vector<std::vector<int>>>(GridField);
+    }
+
+    std::shared_ptr<const std::vector<std::vector<int>>> SetIonoGridGIVEIAll::gridPtr() const
+    {
+      return sharedValue<std::vector<std::vector<int>>>(GridField);
     }
 
     void SetIonoGridGIVEIAll::setGrid(const std::vector<std::vector<int>>& grid)
     {
-      m_values.AddMember("Grid", parse_json<std::vector<std::vector<int>>>::format(grid, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GridField, parse_json<std::vector<std::vector<int>>>::format(grid, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetIonoGridGIVEIAll::serviceProvider() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::optional<std::string>>(ServiceProviderField);
     }
 
     void SetIonoGridGIVEIAll::setServiceProvider(const std::optional<std::string>& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::optional<std::string>>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
@@ -51,6 +51,7 @@ namespace Sdx
 
       // **** grid ****
       std::vector<std::vector<bool>> grid() const;
+      std::shared_ptr<const std::vector<std::vector<bool>>> gridPtr() const;
       void setGrid(const std::vector<std::vector<bool>>& grid);
     };
     
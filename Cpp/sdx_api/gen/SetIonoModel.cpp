@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIonoModel);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIonoModel);
 
+    namespace
+    {
+      // Fields of SetIonoModel, indices in fieldNames()
+      constexpr std::size_t ModelField = 0;
+    }
+
 
     SetIonoModel::SetIonoModel()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Model"])
+          && parse_json<std::string>::is_valid(field(ModelField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string SetIonoModel::model() const
     {
-      return parse_json<std::string>::parse(m_values["Model"]);
+      return fieldValue<std::string>(ModelField);
     }
 
     void SetIonoModel::setModel(const std::string& model)
     {
-      m_values.AddMember("Model", parse_json<std::string>::format(model, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModelField, parse_json<std::string>::format(model, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetIssueOfDataNavIC);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetIssueOfDataNavIC);
 
+    namespace
+    {
+      // Fields of SetIssueOfDataNavIC, indices in fieldNames()
+      constexpr std::size_t EphemerisAndClockField = 0;
+      constexpr std::size_t OverrideRinexField = 1;
+    }
+
 
     SetIssueOfDataNavIC::SetIssueOfDataNavIC()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["EphemerisAndClock"])
-          && parse_json<std::optional<bool>>::is_valid(m_values["OverrideRinex"])
+          && parse_json<int>::is_valid(field(EphemerisAndClockField))
+          && parse_json<std::optional<bool>>::is_valid(field(OverrideRinexField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int SetIssueOfDataNavIC::ephemerisAndClock() const
     {
-      return parse_json<int>::parse(m_values["EphemerisAndClock"]);
+      return parse_json<int>::parse(field(EphemerisAndClockField));
     }
 
     void SetIssueOfDataNavIC::setEphemerisAndClock(int ephemerisAndClock)
     {
-      m_values.AddMember("EphemerisAndClock", parse_json<int>::format(ephemerisAndClock, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EphemerisAndClockField, parse_json<int>::format(ephemerisAndClock, m_values.GetAllocator()));
     }
 
 
 
     std::optional<bool> SetIssueOfDataNavIC::overrideRinex() const
     {
-      return parse_json<std::optional<bool>>::parse(m_values["OverrideRinex"]);
+      return parse_json<std::optional<bool>>::parse(field(OverrideRinexField));
     }
 
     void SetIssueOfDataNavIC::setOverrideRinex(const std::optional<bool>& overrideRinex)
     {
-      m_values.AddMember("OverrideRinex", parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OverrideRinexField, parse_json<std::optional<bool>>::format(overrideRinex, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetLeapSecond);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetLeapSecond);
 
+    namespace
+    {
+      // Fields of SetLeapSecond, indices in fieldNames()
+      constexpr std::size_t LeapSecondField = 0;
+    }
+
 
     SetLeapSecond::SetLeapSecond()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["LeapSecond"])
+          && parse_json<int>::is_valid(field(LeapSecondField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetLeapSecond::leapSecond() const
     {
-      return parse_json<int>::parse(m_values["LeapSecond"]);
+      return parse_json<int>::parse(field(LeapSecondField));
     }
 
     void SetLeapSecond::setLeapSecond(int leapSecond)
     {
-      m_values.AddMember("LeapSecond", parse_json<int>::format(leapSecond, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(LeapSecondField, parse_json<int>::format(leapSecond, m_values.GetAllocator()));
     }
 
 
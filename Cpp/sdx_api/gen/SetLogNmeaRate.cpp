@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetLogNmeaRate);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetLogNmeaRate);
 
+    namespace
+    {
+      // Fields of SetLogNmeaRate, indices in fieldNames()
+      constexpr std::size_t RateField = 0;
+    }
+
 
     SetLogNmeaRate::SetLogNmeaRate()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Rate"])
+          && parse_json<int>::is_valid(field(RateField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetLogNmeaRate::rate() const
     {
-      return parse_json<int>::parse(m_values["Rate"]);
+      return parse_json<int>::parse(field(RateField));
     }
 
     void SetLogNmeaRate::setRate(int rate)
     {
-      m_values.AddMember("Rate", parse_json<int>::format(rate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RateField, parse_json<int>::format(rate, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetLogRawRate);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetLogRawRate);
 
+    namespace
+    {
+      // Fields of SetLogRawRate, indices in fieldNames()
+      constexpr std::size_t RateField = 0;
+    }
+
 
     SetLogRawRate::SetLogRawRate()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Rate"])
+          && parse_json<int>::is_valid(field(RateField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetLogRawRate::rate() const
     {
-      return parse_json<int>::parse(m_values["Rate"]);
+      return parse_json<int>::parse(field(RateField));
     }
 
     void SetLogRawRate::setRate(int rate)
     {
-      m_values.AddMember("Rate", parse_json<int>::format(rate, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RateField, parse_json<int>::format(rate, m_values.GetAllocator()));
     }
 
 
@@ -32,6 +32,15 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetManualPowerOffsetForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetManualPowerOffsetForSV);
 
+    namespace
+    {
+      // Fields of SetManualPowerOffsetForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t SignalPowerOffsetDictField = 2;
+      constexpr std::size_t IsRelativePowerOffsetField = 3;
+    }
+
 
     SetManualPowerOffsetForSV::SetManualPowerOffsetForSV()
       : CommandBase(CmdName, TargetId)
@@ -61,10 +70,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::map<std::string, double>>::is_valid(m_values["SignalPowerOffsetDict"])
-          && parse_json<bool>::is_valid(m_values["IsRelativePowerOffset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::map<std::string, double>>::is_valid(field(SignalPowerOffsetDictField))
+          && parse_json<bool>::is_valid(field(IsRelativePowerOffsetField))
         ;
 
     }
@@ -86,48 +95,53 @@ namespace Sdx
 
     std::string SetManualPowerOffsetForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetManualPowerOffsetForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetManualPowerOffsetForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetManualPowerOffsetForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, double> SetManualPowerOffsetForSV::signalPowerOffsetDict() const
     {
-      return parse_json<std::map<std::string, double>>::parse(m_values["SignalPowerOffsetDict"]);
+      return fieldValue<std::map<std::string, double>>(SignalPowerOffsetDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, double>> SetManualPowerOffsetForSV::signalPowerOffsetDictPtr() const
+    {
+      return sharedValue<std::map<std::string, double>>(SignalPowerOffsetDictField);
     }
 
     void SetManualPowerOffsetForSV::setSignalPowerOffsetDict(const std::map<std::string, double>& signalPowerOffsetDict)
     {
-      m_values.AddMember("SignalPowerOffsetDict", parse_json<std::map<std::string, double>>::format(signalPowerOffsetDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalPowerOffsetDictField, parse_json<std::map<std::string, double>>::format(signalPowerOffsetDict, m_values.GetAllocator()));
     }
 
 
 
     bool SetManualPowerOffsetForSV::isRelativePowerOffset() const
     {
-      return parse_json<bool>::parse(m_values["IsRelativePowerOffset"]);
+      return parse_json<bool>::parse(field(IsRelativePowerOffsetField));
     }
 
     void SetManualPowerOffsetForSV::setIsRelativePowerOffset(bool isRelativePowerOffset)
     {
-      m_values.AddMember("IsRelativePowerOffset", parse_json<bool>::format(isRelativePowerOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsRelativePowerOffsetField, parse_json<bool>::format(isRelativePowerOffset, m_values.GetAllocator()));
     }
 
 
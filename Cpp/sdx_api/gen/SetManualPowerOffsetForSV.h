@@ -64,6 +64,7 @@ namespace Sdx
 
       // **** signalPowerOffsetDict ****
       std::map<std::string, double> signalPowerOffsetDict() const;
+      std::shared_ptr<const std::map<std::string, double>> signalPowerOffsetDictPtr() const;
       void setSignalPowerOffsetDict(const std::map<std::string, double>& signalPowerOffsetDict);
 
 
@@ -29,6 +29,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetMerkleTreeParameters);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetMerkleTreeParameters);
 
+    namespace
+    {
+      // Fields of SetMerkleTreeParameters, indices in fieldNames()
+      constexpr std::size_t IdField = 0;
+      constexpr std::size_t KeyTypeField = 1;
+      constexpr std::size_t HashFunctionField = 2;
+      constexpr std::size_t BeginApplicabilityField = 3;
+      constexpr std::size_t EndApplicabilityField = 4;
+    }
+
 
     SetMerkleTreeParameters::SetMerkleTreeParameters()
       : CommandBase(CmdName, TargetId)
@@ -59,11 +69,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Id"])
-          && parse_json<std::string>::is_valid(m_values["KeyType"])
-          && parse_json<std::string>::is_valid(m_values["HashFunction"])
-          && parse_json<Sdx::DateTime>::is_valid(m_values["BeginApplicability"])
-          && parse_json<std::optional<Sdx::DateTime>>::is_valid(m_values["EndApplicability"])
+          && parse_json<std::string>::is_valid(field(IdField))
+          && parse_json<std::string>::is_valid(field(KeyTypeField))
+          && parse_json<std::string>::is_valid(field(HashFunctionField))
+          && parse_json<Sdx::DateTime>::is_valid(field(BeginApplicabilityField))
+          && parse_json<std::optional<Sdx::DateTime>>::is_valid(field(EndApplicabilityField))
         ;
 
     }
@@ -85,60 +95,60 @@ namespace Sdx
 
     std::string SetMerkleTreeParameters::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetMerkleTreeParameters::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
 
     std::string SetMerkleTreeParameters::keyType() const
     {
-      return parse_json<std::string>::parse(m_values["KeyType"]);
+      return fieldValue<std::string>(KeyTypeField);
     }
 
     void SetMerkleTreeParameters::setKeyType(const std::string& keyType)
     {
-      m_values.AddMember("KeyType", parse_json<std::string>::format(keyType, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(KeyTypeField, parse_json<std::string>::format(keyType, m_values.GetAllocator()));
     }
 
 
 
     std::string SetMerkleTreeParameters::hashFunction() const
     {
-      return parse_json<std::string>::parse(m_values["HashFunction"]);
+      return fieldValue<std::string>(HashFunctionField);
     }
 
     void SetMerkleTreeParameters::setHashFunction(const std::string& hashFunction)
     {
-      m_values.AddMember("HashFunction", parse_json<std::string>::format(hashFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HashFunctionField, parse_json<std::string>::format(hashFunction, m_values.GetAllocator()));
     }
 
 
 
     Sdx::DateTime SetMerkleTreeParameters::beginApplicability() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["BeginApplicability"]);
+      return parse_json<Sdx::DateTime>::parse(field(BeginApplicabilityField));
     }
 
     void SetMerkleTreeParameters::setBeginApplicability(const Sdx::DateTime& beginApplicability)
     {
-      m_values.AddMember("BeginApplicability", parse_json<Sdx::DateTime>::format(beginApplicability, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BeginApplicabilityField, parse_json<Sdx::DateTime>::format(beginApplicability, m_values.GetAllocator()));
     }
 
 
 
     std::optional<Sdx::DateTime> SetMerkleTreeParameters::endApplicability() const
     {
-      return parse_json<std::optional<Sdx::DateTime>>::parse(m_values["EndApplicability"]);
+      return parse_json<std::optional<Sdx::DateTime>>::parse(field(EndApplicabilityField));
     }
 
     void SetMerkleTreeParameters::setEndApplicability(const std::optional<Sdx::DateTime>& endApplicability)
     {
-      m_values.AddMember("EndApplicability", parse_json<std::optional<Sdx::DateTime>>::format(endApplicability, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EndApplicabilityField, parse_json<std::optional<Sdx::DateTime>>::format(endApplicability, m_values.GetAllocator()));
     }
 
 
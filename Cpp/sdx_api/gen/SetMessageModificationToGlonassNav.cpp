@@ -56,6 +56,20 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetMessageModificationToGlonassNav);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetMessageModificationToGlonassNav);
 
+    namespace
+    {
+      // Fields of SetMessageModificationToGlonassNav, indices in fieldNames()
+      constexpr std::size_t SignalArrayField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t StartTimeField = 2;
+      constexpr std::size_t StopTimeField = 3;
+      constexpr std::size_t FrameField = 4;
+      constexpr std::size_t StringNumberField = 5;
+      constexpr std::size_t UpdateHammingCodeField = 6;
+      constexpr std::size_t StringModificationField = 7;
+      constexpr std::size_t IdField = 8;
+    }
+
 
     SetMessageModificationToGlonassNav::SetMessageModificationToGlonassNav()
       : CommandBase(CmdName, TargetId)
@@ -90,15 +104,15 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["SignalArray"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<int>::is_valid(m_values["Frame"])
-          && parse_json<int>::is_valid(m_values["StringNumber"])
-          && parse_json<bool>::is_valid(m_values["UpdateHammingCode"])
-          && parse_json<std::string>::is_valid(m_values["StringModification"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SignalArrayField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<int>::is_valid(field(FrameField))
+          && parse_json<int>::is_valid(field(StringNumberField))
+          && parse_json<bool>::is_valid(field(UpdateHammingCodeField))
+          && parse_json<std::string>::is_valid(field(StringModificationField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -120,108 +134,113 @@ namespace Sdx
 
     std::vector<std::string> SetMessageModificationToGlonassNav::signalArray() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["SignalArray"]);
+      return fieldValue<std::vector<std::string>>(SignalArrayField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> SetMessageModificationToGlonassNav::signalArrayPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SignalArrayField);
     }
 
     void SetMessageModificationToGlonassNav::setSignalArray(const std::vector<std::string>& signalArray)
     {
-      m_values.AddMember("SignalArray", parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalArrayField, parse_json<std::vector<std::string>>::format(signalArray, m_values.GetAllocator()));
     }
 
 
 
     int SetMessageModificationToGlonassNav::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetMessageModificationToGlonassNav::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int SetMessageModificationToGlonassNav::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void SetMessageModificationToGlonassNav::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int SetMessageModificationToGlonassNav::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void SetMessageModificationToGlonassNav::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     int SetMessageModificationToGlonassNav::frame() const
     {
-      return parse_json<int>::parse(m_values["Frame"]);
+      return parse_json<int>::parse(field(FrameField));
     }
 
     void SetMessageModificationToGlonassNav::setFrame(int frame)
     {
-      m_values.AddMember("Frame", parse_json<int>::format(frame, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FrameField, parse_json<int>::format(frame, m_values.GetAllocator()));
     }
 
 
 
     int SetMessageModificationToGlonassNav::stringNumber() const
     {
-      return parse_json<int>::parse(m_values["StringNumber"]);
+      return parse_json<int>::parse(field(StringNumberField));
     }
 
     void SetMessageModificationToGlonassNav::setStringNumber(int stringNumber)
     {
-      m_values.AddMember("StringNumber", parse_json<int>::format(stringNumber, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StringNumberField, parse_json<int>::format(stringNumber, m_values.GetAllocator()));
     }
 
 
 
     bool SetMessageModificationToGlonassNav::updateHammingCode() const
     {
-      return parse_json<bool>::parse(m_values["UpdateHammingCode"]);
+      return parse_json<bool>::parse(field(UpdateHammingCodeField));
     }
 
     void SetMessageModificationToGlonassNav::setUpdateHammingCode(bool updateHammingCode)
     {
-      m_values.AddMember("UpdateHammingCode", parse_json<bool>::format(updateHammingCode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UpdateHammingCodeField, parse_json<bool>::format(updateHammingCode, m_values.GetAllocator()));
     }
 
 
 
     std::string SetMessageModificationToGlonassNav::stringModification() const
     {
-      return parse_json<std::string>::parse(m_values["StringModification"]);
+      return fieldValue<std::string>(StringModificationField);
     }
 
     void SetMessageModificationToGlonassNav::setStringModification(const std::string& stringModification)
     {
-      m_values.AddMember("StringModification", parse_json<std::string>::format(stringModification, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StringModificationField, parse_json<std::string>::format(stringModification, m_values.GetAllocator()));
     }
 
 
 
     std::string SetMessageModificationToGlonassNav::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetMessageModificationToGlonassNav::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
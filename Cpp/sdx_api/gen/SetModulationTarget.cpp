@@ -29,6 +29,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetModulationTarget);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetModulationTarget);
 
+    namespace
+    {
+      // Fields of SetModulationTarget, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+      constexpr std::size_t PathField = 1;
+      constexpr std::size_t AddressField = 2;
+      constexpr std::size_t ClockIsExternalField = 3;
+      constexpr std::size_t IdField = 4;
+    }
+
 
     SetModulationTarget::SetModulationTarget()
       : CommandBase(CmdName, TargetId)
@@ -59,11 +69,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Type"])
-          && parse_json<std::string>::is_valid(m_values["Path"])
-          && parse_json<std::string>::is_valid(m_values["Address"])
-          && parse_json<bool>::is_valid(m_values["ClockIsExternal"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(TypeField))
+          && parse_json<std::string>::is_valid(field(PathField))
+          && parse_json<std::string>::is_valid(field(AddressField))
+          && parse_json<bool>::is_valid(field(ClockIsExternalField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -85,60 +95,60 @@ namespace Sdx
 
     std::string SetModulationTarget::type() const
     {
-      return parse_json<std::string>::parse(m_values["Type"]);
+      return fieldValue<std::string>(TypeField);
     }
 
     void SetModulationTarget::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
 
     std::string SetModulationTarget::path() const
     {
-      return parse_json<std::string>::parse(m_values["Path"]);
+      return fieldValue<std::string>(PathField);
     }
 
     void SetModulationTarget::setPath(const std::string& path)
     {
-      m_values.AddMember("Path", parse_json<std::string>::format(path, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PathField, parse_json<std::string>::format(path, m_values.GetAllocator()));
     }
 
 
 
     std::string SetModulationTarget::address() const
     {
-      return parse_json<std::string>::parse(m_values["Address"]);
+      return fieldValue<std::string>(AddressField);
     }
 
     void SetModulationTarget::setAddress(const std::string& address)
     {
-      m_values.AddMember("Address", parse_json<std::string>::format(address, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AddressField, parse_json<std::string>::format(address, m_values.GetAllocator()));
     }
 
 
 
     bool SetModulationTarget::clockIsExternal() const
     {
-      return parse_json<bool>::parse(m_values["ClockIsExternal"]);
+      return parse_json<bool>::parse(field(ClockIsExternalField));
     }
 
     void SetModulationTarget::setClockIsExternal(bool clockIsExternal)
     {
-      m_values.AddMember("ClockIsExternal", parse_json<bool>::format(clockIsExternal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ClockIsExternalField, parse_json<bool>::format(clockIsExternal, m_values.GetAllocator()));
     }
 
 
 
     std::string SetModulationTarget::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetModulationTarget::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -34,6 +34,19 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetMultipathForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetMultipathForSV);
 
+    namespace
+    {
+      // Fields of SetMultipathForSV, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t PowerLossField = 2;
+      constexpr std::size_t PseudorangeField = 3;
+      constexpr std::size_t DopplerField = 4;
+      constexpr std::size_t CarrierPhaseField = 5;
+      constexpr std::size_t EchoField = 6;
+      constexpr std::size_t IdField = 7;
+    }
+
 
     SetMultipathForSV::SetMultipathForSV()
       : CommandBase(CmdName, TargetId)
@@ -67,14 +80,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<double>::is_valid(m_values["PowerLoss"])
-          && parse_json<double>::is_valid(m_values["Pseudorange"])
-          && parse_json<double>::is_valid(m_values["Doppler"])
-          && parse_json<double>::is_valid(m_values["CarrierPhase"])
-          && parse_json<int>::is_valid(m_values["Echo"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<double>::is_valid(field(PowerLossField))
+          && parse_json<double>::is_valid(field(PseudorangeField))
+          && parse_json<double>::is_valid(field(DopplerField))
+          && parse_json<double>::is_valid(field(CarrierPhaseField))
+          && parse_json<int>::is_valid(field(EchoField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -96,96 +109,96 @@ namespace Sdx
 
     std::string SetMultipathForSV::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void SetMultipathForSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     int SetMultipathForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetMultipathForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     double SetMultipathForSV::powerLoss() const
     {
-      return parse_json<double>::parse(m_values["PowerLoss"]);
+      return parse_json<double>::parse(field(PowerLossField));
     }
 
     void SetMultipathForSV::setPowerLoss(double powerLoss)
     {
-      m_values.AddMember("PowerLoss", parse_json<double>::format(powerLoss, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerLossField, parse_json<double>::format(powerLoss, m_values.GetAllocator()));
     }
 
 
 
     double SetMultipathForSV::pseudorange() const
     {
-      return parse_json<double>::parse(m_values["Pseudorange"]);
+      return parse_json<double>::parse(field(PseudorangeField));
     }
 
     void SetMultipathForSV::setPseudorange(double pseudorange)
     {
-      m_values.AddMember("Pseudorange", parse_json<double>::format(pseudorange, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PseudorangeField, parse_json<double>::format(pseudorange, m_values.GetAllocator()));
     }
 
 
 
     double SetMultipathForSV::doppler() const
     {
-      return parse_json<double>::parse(m_values["Doppler"]);
+      return parse_json<double>::parse(field(DopplerField));
     }
 
     void SetMultipathForSV::setDoppler(double doppler)
     {
-      m_values.AddMember("Doppler", parse_json<double>::format(doppler, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DopplerField, parse_json<double>::format(doppler, m_values.GetAllocator()));
     }
 
 
 
     double SetMultipathForSV::carrierPhase() const
     {
-      return parse_json<double>::parse(m_values["CarrierPhase"]);
+      return parse_json<double>::parse(field(CarrierPhaseField));
     }
 
     void SetMultipathForSV::setCarrierPhase(double carrierPhase)
     {
-      m_values.AddMember("CarrierPhase", parse_json<double>::format(carrierPhase, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CarrierPhaseField, parse_json<double>::format(carrierPhase, m_values.GetAllocator()));
     }
 
 
 
     int SetMultipathForSV::echo() const
     {
-      return parse_json<int>::parse(m_values["Echo"]);
+      return parse_json<int>::parse(field(EchoField));
     }
 
     void SetMultipathForSV::setEcho(int echo)
     {
-      m_values.AddMember("Echo", parse_json<int>::format(echo, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EchoField, parse_json<int>::format(echo, m_values.GetAllocator()));
     }
 
 
 
     std::string SetMultipathForSV::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetMultipathForSV::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetN310LocalOscillatorSource);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetN310LocalOscillatorSource);
 
+    namespace
+    {
+      // Fields of SetN310LocalOscillatorSource, indices in fieldNames()
+      constexpr std::size_t IsExternalField = 0;
+      constexpr std::size_t IdField = 1;
+    }
+
 
     SetN310LocalOscillatorSource::SetN310LocalOscillatorSource()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["IsExternal"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<bool>::is_valid(field(IsExternalField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     bool SetN310LocalOscillatorSource::isExternal() const
     {
-      return parse_json<bool>::parse(m_values["IsExternal"]);
+      return parse_json<bool>::parse(field(IsExternalField));
     }
 
     void SetN310LocalOscillatorSource::setIsExternal(bool isExternal)
     {
-      m_values.AddMember("IsExternal", parse_json<bool>::format(isExternal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsExternalField, parse_json<bool>::format(isExternal, m_values.GetAllocator()));
     }
 
 
 
     std::string SetN310LocalOscillatorSource::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetN310LocalOscillatorSource::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetNavICUraIndex);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetNavICUraIndex);
 
+    namespace
+    {
+      // Fields of SetNavICUraIndex, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t UraiField = 1;
+      constexpr std::size_t DataSetNameField = 2;
+    }
+
 
     SetNavICUraIndex::SetNavICUraIndex()
       : CommandBase(CmdName, TargetId)
@@ -55,9 +63,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["Urai"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(UraiField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -79,36 +87,36 @@ namespace Sdx
 
     int SetNavICUraIndex::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetNavICUraIndex::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int SetNavICUraIndex::urai() const
     {
-      return parse_json<int>::parse(m_values["Urai"]);
+      return parse_json<int>::parse(field(UraiField));
     }
 
     void SetNavICUraIndex::setUrai(int urai)
     {
-      m_values.AddMember("Urai", parse_json<int>::format(urai, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UraiField, parse_json<int>::format(urai, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetNavICUraIndex::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetNavICUraIndex::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetNmeaLoggerSentences);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetNmeaLoggerSentences);
 
+    namespace
+    {
+      // Fields of SetNmeaLoggerSentences, indices in fieldNames()
+      constexpr std::size_t SentencesField = 0;
+    }
+
 
     SetNmeaLoggerSentences::SetNmeaLoggerSentences()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["Sentences"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SentencesField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<std::string> SetNmeaLoggerSentences::sentences() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["Sentences"]);
+      return fieldValue<std::vector<std::string>>(SentencesField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> SetNmeaLoggerSentences::sentencesPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SentencesField);
     }
 
     void SetNmeaLoggerSentences::setSentences(const std::vector<std::string>& sentences)
     {
-      m_values.AddMember("Sentences", parse_json<std::vector<std::string>>::format(sentences, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SentencesField, parse_json<std::vector<std::string>>::format(sentences, m_values.GetAllocator()));
     }
 
 
@@ -45,6 +45,7 @@ namespace Sdx
 
       // **** sentences ****
       std::vector<std::string> sentences() const;
+      std::shared_ptr<const std::vector<std::string>> sentencesPtr() const;
       void setSentences(const std::vector<std::string>& sentences);
     };
     
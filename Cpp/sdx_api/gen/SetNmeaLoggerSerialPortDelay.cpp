@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetNmeaLoggerSerialPortDelay);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetNmeaLoggerSerialPortDelay);
 
+    namespace
+    {
+      // Fields of SetNmeaLoggerSerialPortDelay, indices in fieldNames()
+      constexpr std::size_t DelayField = 0;
+    }
+
 
     SetNmeaLoggerSerialPortDelay::SetNmeaLoggerSerialPortDelay()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Delay"])
+          && parse_json<int>::is_valid(field(DelayField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetNmeaLoggerSerialPortDelay::delay() const
     {
-      return parse_json<int>::parse(m_values["Delay"]);
+      return parse_json<int>::parse(field(DelayField));
     }
 
     void SetNmeaLoggerSerialPortDelay::setDelay(int delay)
     {
-      m_values.AddMember("Delay", parse_json<int>::format(delay, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DelayField, parse_json<int>::format(delay, m_values.GetAllocator()));
     }
 
 
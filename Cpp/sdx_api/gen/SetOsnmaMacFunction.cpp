@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetOsnmaMacFunction);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetOsnmaMacFunction);
 
+    namespace
+    {
+      // Fields of SetOsnmaMacFunction, indices in fieldNames()
+      constexpr std::size_t MacFunctionField = 0;
+    }
+
 
     SetOsnmaMacFunction::SetOsnmaMacFunction()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["MacFunction"])
+          && parse_json<std::string>::is_valid(field(MacFunctionField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     std::string SetOsnmaMacFunction::macFunction() const
     {
-      return parse_json<std::string>::parse(m_values["MacFunction"]);
+      return fieldValue<std::string>(MacFunctionField);
     }
 
     void SetOsnmaMacFunction::setMacFunction(const std::string& macFunction)
     {
-      m_values.AddMember("MacFunction", parse_json<std::string>::format(macFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MacFunctionField, parse_json<std::string>::format(macFunction, m_values.GetAllocator()));
     }
 
 
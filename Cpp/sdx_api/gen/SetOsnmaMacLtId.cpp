@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetOsnmaMacLtId);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetOsnmaMacLtId);
 
+    namespace
+    {
+      // Fields of SetOsnmaMacLtId, indices in fieldNames()
+      constexpr std::size_t MacLtIdField = 0;
+    }
+
 
     SetOsnmaMacLtId::SetOsnmaMacLtId()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["MacLtId"])
+          && parse_json<int>::is_valid(field(MacLtIdField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     int SetOsnmaMacLtId::macLtId() const
     {
-      return parse_json<int>::parse(m_values["MacLtId"]);
+      return parse_json<int>::parse(field(MacLtIdField));
     }
 
     void SetOsnmaMacLtId::setMacLtId(int macLtId)
     {
-      m_values.AddMember("MacLtId", parse_json<int>::format(macLtId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MacLtIdField, parse_json<int>::format(macLtId, m_values.GetAllocator()));
     }
 
 
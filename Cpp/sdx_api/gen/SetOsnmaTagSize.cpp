@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetOsnmaTagSize);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetOsnmaTagSize);
 
+    namespace
+    {
+      // Fields of SetOsnmaTagSize, indices in fieldNames()
+      constexpr std::size_t TagSizeField = 0;
+    }
+
 
     SetOsnmaTagSize::SetOsnmaTagSize()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["TagSize"])
+          && parse_json<int>::is_valid(field(TagSizeField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetOsnmaTagSize::tagSize() const
     {
-      return parse_json<int>::parse(m_values["TagSize"]);
+      return parse_json<int>::parse(field(TagSizeField));
     }
 
     void SetOsnmaTagSize::setTagSize(int tagSize)
     {
-      m_values.AddMember("TagSize", parse_json<int>::format(tagSize, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TagSizeField, parse_json<int>::format(tagSize, m_values.GetAllocator()));
     }
 
 
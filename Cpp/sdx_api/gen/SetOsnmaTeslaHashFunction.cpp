@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetOsnmaTeslaHashFunction);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetOsnmaTeslaHashFunction);
 
+    namespace
+    {
+      // Fields of SetOsnmaTeslaHashFunction, indices in fieldNames()
+      constexpr std::size_t HashFunctionField = 0;
+    }
+
 
     SetOsnmaTeslaHashFunction::SetOsnmaTeslaHashFunction()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["HashFunction"])
+          && parse_json<std::string>::is_valid(field(HashFunctionField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string SetOsnmaTeslaHashFunction::hashFunction() const
     {
-      return parse_json<std::string>::parse(m_values["HashFunction"]);
+      return fieldValue<std::string>(HashFunctionField);
     }
 
     void SetOsnmaTeslaHashFunction::setHashFunction(const std::string& hashFunction)
     {
-      m_values.AddMember("HashFunction", parse_json<std::string>::format(hashFunction, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HashFunctionField, parse_json<std::string>::format(hashFunction, m_values.GetAllocator()));
     }
 
 
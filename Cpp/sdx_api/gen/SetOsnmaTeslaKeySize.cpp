@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetOsnmaTeslaKeySize);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetOsnmaTeslaKeySize);
 
+    namespace
+    {
+      // Fields of SetOsnmaTeslaKeySize, indices in fieldNames()
+      constexpr std::size_t KeySizeField = 0;
+    }
+
 
     SetOsnmaTeslaKeySize::SetOsnmaTeslaKeySize()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["KeySize"])
+          && parse_json<int>::is_valid(field(KeySizeField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     int SetOsnmaTeslaKeySize::keySize() const
     {
-      return parse_json<int>::parse(m_values["KeySize"]);
+      return parse_json<int>::parse(field(KeySizeField));
     }
 
     void SetOsnmaTeslaKeySize::setKeySize(int keySize)
     {
-      m_values.AddMember("KeySize", parse_json<int>::format(keySize, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(KeySizeField, parse_json<int>::format(keySize, m_values.GetAllocator()));
     }
 
 
@@ -31,6 +31,20 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPerturbations);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPerturbations);
 
+    namespace
+    {
+      // Fields of SetPerturbations, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t CrsField = 2;
+      constexpr std::size_t CrcField = 3;
+      constexpr std::size_t CisField = 4;
+      constexpr std::size_t CicField = 5;
+      constexpr std::size_t CusField = 6;
+      constexpr std::size_t CucField = 7;
+      constexpr std::size_t DataSetNameField = 8;
+    }
+
 
     SetPerturbations::SetPerturbations()
       : CommandBase(CmdName, TargetId)
@@ -65,15 +79,15 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<double>::is_valid(m_values["Crs"])
-          && parse_json<double>::is_valid(m_values["Crc"])
-          && parse_json<double>::is_valid(m_values["Cis"])
-          && parse_json<double>::is_valid(m_values["Cic"])
-          && parse_json<double>::is_valid(m_values["Cus"])
-          && parse_json<double>::is_valid(m_values["Cuc"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<double>::is_valid(field(CrsField))
+          && parse_json<double>::is_valid(field(CrcField))
+          && parse_json<double>::is_valid(field(CisField))
+          && parse_json<double>::is_valid(field(CicField))
+          && parse_json<double>::is_valid(field(CusField))
+          && parse_json<double>::is_valid(field(CucField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -95,108 +109,108 @@ namespace Sdx
 
     std::string SetPerturbations::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetPerturbations::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetPerturbations::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetPerturbations::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     double SetPerturbations::crs() const
     {
-      return parse_json<double>::parse(m_values["Crs"]);
+      return parse_json<double>::parse(field(CrsField));
     }
 
     void SetPerturbations::setCrs(double crs)
     {
-      m_values.AddMember("Crs", parse_json<double>::format(crs, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CrsField, parse_json<double>::format(crs, m_values.GetAllocator()));
     }
 
 
 
     double SetPerturbations::crc() const
     {
-      return parse_json<double>::parse(m_values["Crc"]);
+      return parse_json<double>::parse(field(CrcField));
     }
 
     void SetPerturbations::setCrc(double crc)
     {
-      m_values.AddMember("Crc", parse_json<double>::format(crc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CrcField, parse_json<double>::format(crc, m_values.GetAllocator()));
     }
 
 
 
     double SetPerturbations::cis() const
     {
-      return parse_json<double>::parse(m_values["Cis"]);
+      return parse_json<double>::parse(field(CisField));
     }
 
     void SetPerturbations::setCis(double cis)
     {
-      m_values.AddMember("Cis", parse_json<double>::format(cis, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CisField, parse_json<double>::format(cis, m_values.GetAllocator()));
     }
 
 
 
     double SetPerturbations::cic() const
     {
-      return parse_json<double>::parse(m_values["Cic"]);
+      return parse_json<double>::parse(field(CicField));
     }
 
     void SetPerturbations::setCic(double cic)
     {
-      m_values.AddMember("Cic", parse_json<double>::format(cic, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CicField, parse_json<double>::format(cic, m_values.GetAllocator()));
     }
 
 
 
     double SetPerturbations::cus() const
     {
-      return parse_json<double>::parse(m_values["Cus"]);
+      return parse_json<double>::parse(field(CusField));
     }
 
     void SetPerturbations::setCus(double cus)
     {
-      m_values.AddMember("Cus", parse_json<double>::format(cus, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CusField, parse_json<double>::format(cus, m_values.GetAllocator()));
     }
 
 
 
     double SetPerturbations::cuc() const
     {
-      return parse_json<double>::parse(m_values["Cuc"]);
+      return parse_json<double>::parse(field(CucField));
     }
 
     void SetPerturbations::setCuc(double cuc)
     {
-      m_values.AddMember("Cuc", parse_json<double>::format(cuc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CucField, parse_json<double>::format(cuc, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetPerturbations::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetPerturbations::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
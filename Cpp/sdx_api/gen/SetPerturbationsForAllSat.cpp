@@ -31,6 +31,19 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPerturbationsForAllSat);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPerturbationsForAllSat);
 
+    namespace
+    {
+      // Fields of SetPerturbationsForAllSat, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t CrsField = 1;
+      constexpr std::size_t CrcField = 2;
+      constexpr std::size_t CisField = 3;
+      constexpr std::size_t CicField = 4;
+      constexpr std::size_t CusField = 5;
+      constexpr std::size_t CucField = 6;
+      constexpr std::size_t DataSetNameField = 7;
+    }
+
 
     SetPerturbationsForAllSat::SetPerturbationsForAllSat()
       : CommandBase(CmdName, TargetId)
@@ -64,14 +77,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Crs"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Crc"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Cis"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Cic"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Cus"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Cuc"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["DataSetName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<double>>::is_valid(field(CrsField))
+          && parse_json<std::vector<double>>::is_valid(field(CrcField))
+          && parse_json<std::vector<double>>::is_valid(field(CisField))
+          && parse_json<std::vector<double>>::is_valid(field(CicField))
+          && parse_json<std::vector<double>>::is_valid(field(CusField))
+          && parse_json<std::vector<double>>::is_valid(field(CucField))
+          && parse_json<std::optional<std::string>>::is_valid(field(DataSetNameField))
         ;
 
     }
@@ -93,96 +106,126 @@ namespace Sdx
 
     std::string SetPerturbationsForAllSat::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetPerturbationsForAllSat::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPerturbationsForAllSat::crs() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Crs"]);
+      return fieldValue<std::vector<double>>(CrsField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPerturbationsForAllSat::crsPtr() const
+    {
+      return sharedValue<std::vector<double>>(CrsField);
     }
 
     void SetPerturbationsForAllSat::setCrs(const std::vector<double>& crs)
     {
-      m_values.AddMember("Crs", parse_json<std::vector<double>>::format(crs, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CrsField, parse_json<std::vector<double>>::format(crs, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPerturbationsForAllSat::crc() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Crc"]);
+      return fieldValue<std::vector<double>>(CrcField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPerturbationsForAllSat::crcPtr() const
+    {
+      return sharedValue<std::vector<double>>(CrcField);
     }
 
     void SetPerturbationsForAllSat::setCrc(const std::vector<double>& crc)
     {
-      m_values.AddMember("Crc", parse_json<std::vector<double>>::format(crc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CrcField, parse_json<std::vector<double>>::format(crc, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPerturbationsForAllSat::cis() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Cis"]);
+      return fieldValue<std::vector<double>>(CisField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPerturbationsForAllSat::cisPtr() const
+    {
+      return sharedValue<std::vector<double>>(CisField);
     }
 
     void SetPerturbationsForAllSat::setCis(const std::vector<double>& cis)
     {
-      m_values.AddMember("Cis", parse_json<std::vector<double>>::format(cis, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CisField, parse_json<std::vector<double>>::format(cis, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPerturbationsForAllSat::cic() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Cic"]);
+      return fieldValue<std::vector<double>>(CicField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPerturbationsForAllSat::cicPtr() const
+    {
+      return sharedValue<std::vector<double>>(CicField);
     }
 
     void SetPerturbationsForAllSat::setCic(const std::vector<double>& cic)
     {
-      m_values.AddMember("Cic", parse_json<std::vector<double>>::format(cic, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CicField, parse_json<std::vector<double>>::format(cic, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPerturbationsForAllSat::cus() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Cus"]);
+      return fieldValue<std::vector<double>>(CusField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPerturbationsForAllSat::cusPtr() const
+    {
+      return sharedValue<std::vector<double>>(CusField);
     }
 
     void SetPerturbationsForAllSat::setCus(const std::vector<double>& cus)
     {
-      m_values.AddMember("Cus", parse_json<std::vector<double>>::format(cus, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CusField, parse_json<std::vector<double>>::format(cus, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPerturbationsForAllSat::cuc() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Cuc"]);
+      return fieldValue<std::vector<double>>(CucField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPerturbationsForAllSat::cucPtr() const
+    {
+      return sharedValue<std::vector<double>>(CucField);
     }
 
     void SetPerturbationsForAllSat::setCuc(const std::vector<double>& cuc)
     {
-      m_values.AddMember("Cuc", parse_json<std::vector<double>>::format(cuc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CucField, parse_json<std::vector<double>>::format(cuc, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetPerturbationsForAllSat::dataSetName() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["DataSetName"]);
+      return fieldValue<std::optional<std::string>>(DataSetNameField);
     }
 
     void SetPerturbationsForAllSat::setDataSetName(const std::optional<std::string>& dataSetName)
     {
-      m_values.AddMember("DataSetName", parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DataSetNameField, parse_json<std::optional<std::string>>::format(dataSetName, m_values.GetAllocator()));
     }
 
 
@@ -59,31 +59,37 @@ namespace Sdx
 
       // **** crs ****
       std::vector<double> crs() const;
+      std::shared_ptr<const std::vector<double>> crsPtr() const;
       void setCrs(const std::vector<double>& crs);
 
 
       // **** crc ****
       std::vector<double> crc() const;
+      std::shared_ptr<const std::vector<double>> crcPtr() const;
       void setCrc(const std::vector<double>& crc);
 
 
       // **** cis ****
       std::vector<double> cis() const;
+      std::shared_ptr<const std::vector<double>> cisPtr() const;
       void setCis(const std::vector<double>& cis);
 
 
       // **** cic ****
       std::vector<double> cic() const;
+      std::shared_ptr<const std::vector<double>> cicPtr() const;
       void setCic(const std::vector<double>& cic);
 
 
       // **** cus ****
       std::vector<double> cus() const;
+      std::shared_ptr<const std::vector<double>> cusPtr() const;
       void setCus(const std::vector<double>& cus);
 
 
       // **** cuc ****
       std::vector<double> cuc() const;
+      std::shared_ptr<const std::vector<double>> cucPtr() const;
       void setCuc(const std::vector<double>& cuc);
 
 
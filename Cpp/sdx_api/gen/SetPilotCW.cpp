@@ -27,6 +27,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPilotCW);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPilotCW);
 
+    namespace
+    {
+      // Fields of SetPilotCW, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t OutputIdxField = 1;
+      constexpr std::size_t CentralFreqOffsetField = 2;
+      constexpr std::size_t PowerField = 3;
+      constexpr std::size_t PilotIdField = 4;
+    }
+
 
     SetPilotCW::SetPilotCW()
       : CommandBase(CmdName, TargetId)
@@ -57,11 +67,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<int>::is_valid(m_values["OutputIdx"])
-          && parse_json<double>::is_valid(m_values["CentralFreqOffset"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<std::string>::is_valid(m_values["PilotId"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<int>::is_valid(field(OutputIdxField))
+          && parse_json<double>::is_valid(field(CentralFreqOffsetField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<std::string>::is_valid(field(PilotIdField))
         ;
 
     }
@@ -83,60 +93,60 @@ namespace Sdx
 
     bool SetPilotCW::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void SetPilotCW::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     int SetPilotCW::outputIdx() const
     {
-      return parse_json<int>::parse(m_values["OutputIdx"]);
+      return parse_json<int>::parse(field(OutputIdxField));
     }
 
     void SetPilotCW::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputIdxField, parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
 
     double SetPilotCW::centralFreqOffset() const
     {
-      return parse_json<double>::parse(m_values["CentralFreqOffset"]);
+      return parse_json<double>::parse(field(CentralFreqOffsetField));
     }
 
     void SetPilotCW::setCentralFreqOffset(double centralFreqOffset)
     {
-      m_values.AddMember("CentralFreqOffset", parse_json<double>::format(centralFreqOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqOffsetField, parse_json<double>::format(centralFreqOffset, m_values.GetAllocator()));
     }
 
 
 
     double SetPilotCW::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void SetPilotCW::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     std::string SetPilotCW::pilotId() const
     {
-      return parse_json<std::string>::parse(m_values["PilotId"]);
+      return fieldValue<std::string>(PilotIdField);
     }
 
     void SetPilotCW::setPilotId(const std::string& pilotId)
     {
-      m_values.AddMember("PilotId", parse_json<std::string>::format(pilotId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PilotIdField, parse_json<std::string>::format(pilotId, m_values.GetAllocator()));
     }
 
 
@@ -29,6 +29,18 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPilotPRN);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPilotPRN);
 
+    namespace
+    {
+      // Fields of SetPilotPRN, indices in fieldNames()
+      constexpr std::size_t EnabledField = 0;
+      constexpr std::size_t OutputIdxField = 1;
+      constexpr std::size_t CentralFreqOffsetField = 2;
+      constexpr std::size_t PowerField = 3;
+      constexpr std::size_t PrnField = 4;
+      constexpr std::size_t TypeField = 5;
+      constexpr std::size_t PilotIdField = 6;
+    }
+
 
     SetPilotPRN::SetPilotPRN()
       : CommandBase(CmdName, TargetId)
@@ -61,13 +73,13 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<int>::is_valid(m_values["OutputIdx"])
-          && parse_json<double>::is_valid(m_values["CentralFreqOffset"])
-          && parse_json<double>::is_valid(m_values["Power"])
-          && parse_json<int>::is_valid(m_values["Prn"])
-          && parse_json<std::string>::is_valid(m_values["Type"])
-          && parse_json<std::string>::is_valid(m_values["PilotId"])
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<int>::is_valid(field(OutputIdxField))
+          && parse_json<double>::is_valid(field(CentralFreqOffsetField))
+          && parse_json<double>::is_valid(field(PowerField))
+          && parse_json<int>::is_valid(field(PrnField))
+          && parse_json<std::string>::is_valid(field(TypeField))
+          && parse_json<std::string>::is_valid(field(PilotIdField))
         ;
 
     }
@@ -89,84 +101,84 @@ namespace Sdx
 
     bool SetPilotPRN::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void SetPilotPRN::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     int SetPilotPRN::outputIdx() const
     {
-      return parse_json<int>::parse(m_values["OutputIdx"]);
+      return parse_json<int>::parse(field(OutputIdxField));
     }
 
     void SetPilotPRN::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputIdxField, parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
 
     double SetPilotPRN::centralFreqOffset() const
     {
-      return parse_json<double>::parse(m_values["CentralFreqOffset"]);
+      return parse_json<double>::parse(field(CentralFreqOffsetField));
     }
 
     void SetPilotPRN::setCentralFreqOffset(double centralFreqOffset)
     {
-      m_values.AddMember("CentralFreqOffset", parse_json<double>::format(centralFreqOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(CentralFreqOffsetField, parse_json<double>::format(centralFreqOffset, m_values.GetAllocator()));
     }
 
 
 
     double SetPilotPRN::power() const
     {
-      return parse_json<double>::parse(m_values["Power"]);
+      return parse_json<double>::parse(field(PowerField));
     }
 
     void SetPilotPRN::setPower(double power)
     {
-      m_values.AddMember("Power", parse_json<double>::format(power, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerField, parse_json<double>::format(power, m_values.GetAllocator()));
     }
 
 
 
     int SetPilotPRN::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void SetPilotPRN::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
 
     std::string SetPilotPRN::type() const
     {
-      return parse_json<std::string>::parse(m_values["Type"]);
+      return fieldValue<std::string>(TypeField);
     }
 
     void SetPilotPRN::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
 
     std::string SetPilotPRN::pilotId() const
     {
-      return parse_json<std::string>::parse(m_values["PilotId"]);
+      return fieldValue<std::string>(PilotIdField);
     }
 
     void SetPilotPRN::setPilotId(const std::string& pilotId)
     {
-      m_values.AddMember("PilotId", parse_json<std::string>::format(pilotId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PilotIdField, parse_json<std::string>::format(pilotId, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPowerGlobalOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPowerGlobalOffset);
 
+    namespace
+    {
+      // Fields of SetPowerGlobalOffset, indices in fieldNames()
+      constexpr std::size_t OffsetField = 0;
+    }
+
 
     SetPowerGlobalOffset::SetPowerGlobalOffset()
       : CommandBase(CmdName, TargetId)
@@ -51,7 +57,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Offset"])
+          && parse_json<double>::is_valid(field(OffsetField))
         ;
 
     }
@@ -73,12 +79,12 @@ namespace Sdx
 
     double SetPowerGlobalOffset::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void SetPowerGlobalOffset::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
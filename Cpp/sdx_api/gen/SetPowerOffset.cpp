@@ -30,6 +30,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPowerOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPowerOffset);
 
+    namespace
+    {
+      // Fields of SetPowerOffset, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t OffsetField = 1;
+    }
+
 
     SetPowerOffset::SetPowerOffset()
       : CommandBase(CmdName, TargetId)
@@ -57,8 +64,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<double>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<double>::is_valid(field(OffsetField))
         ;
 
     }
@@ -80,24 +87,24 @@ namespace Sdx
 
     std::string SetPowerOffset::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void SetPowerOffset::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     double SetPowerOffset::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void SetPowerOffset::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPps0GpsTime);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPps0GpsTime);
 
+    namespace
+    {
+      // Fields of SetPps0GpsTime, indices in fieldNames()
+      constexpr std::size_t GpsTimeField = 0;
+    }
+
 
     SetPps0GpsTime::SetPps0GpsTime()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::DateTime>::is_valid(m_values["GpsTime"])
+          && parse_json<Sdx::DateTime>::is_valid(field(GpsTimeField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     Sdx::DateTime SetPps0GpsTime::gpsTime() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["GpsTime"]);
+      return parse_json<Sdx::DateTime>::parse(field(GpsTimeField));
     }
 
     void SetPps0GpsTime::setGpsTime(const Sdx::DateTime& gpsTime)
     {
-      m_values.AddMember("GpsTime", parse_json<Sdx::DateTime>::format(gpsTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GpsTimeField, parse_json<Sdx::DateTime>::format(gpsTime, m_values.GetAllocator()));
     }
 
 
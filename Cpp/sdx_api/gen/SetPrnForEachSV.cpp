@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPrnForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPrnForEachSV);
 
+    namespace
+    {
+      // Fields of SetPrnForEachSV, indices in fieldNames()
+      constexpr std::size_t SignalField = 0;
+      constexpr std::size_t PrnField = 1;
+    }
+
 
     SetPrnForEachSV::SetPrnForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Signal"])
-          && parse_json<std::vector<int>>::is_valid(m_values["Prn"])
+          && parse_json<std::string>::is_valid(field(SignalField))
+          && parse_json<std::vector<int>>::is_valid(field(PrnField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::string SetPrnForEachSV::signal() const
     {
-      return parse_json<std::string>::parse(m_values["Signal"]);
+      return fieldValue<std::string>(SignalField);
     }
 
     void SetPrnForEachSV::setSignal(const std::string& signal)
     {
-      m_values.AddMember("Signal", parse_json<std::string>::format(signal, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalField, parse_json<std::string>::format(signal, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> SetPrnForEachSV::prn() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Prn"]);
+      return fieldValue<std::vector<int>>(PrnField);
+    }
+
+    std::shared_ptr<const std::vector<int>> SetPrnForEachSV::prnPtr() const
+    {
+      return sharedValue<std::vector<int>>(PrnField);
     }
 
     void SetPrnForEachSV::setPrn(const std::vector<int>& prn)
     {
-      m_values.AddMember("Prn", parse_json<std::vector<int>>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<std::vector<int>>::format(prn, m_values.GetAllocator()));
     }
 
 
@@ -51,6 +51,7 @@ namespace Sdx
 
       // **** prn ****
       std::vector<int> prn() const;
+      std::shared_ptr<const std::vector<int>> prnPtr() const;
       void setPrn(const std::vector<int>& prn);
     };
     
@@ -29,6 +29,18 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPseudorangeNoiseGaussMarkovForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPseudorangeNoiseGaussMarkovForSV);
 
+    namespace
+    {
+      // Fields of SetPseudorangeNoiseGaussMarkovForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t ProcessField = 2;
+      constexpr std::size_t EnabledField = 3;
+      constexpr std::size_t SigmaField = 4;
+      constexpr std::size_t TimeField = 5;
+      constexpr std::size_t SeedField = 6;
+    }
+
 
     SetPseudorangeNoiseGaussMarkovForSV::SetPseudorangeNoiseGaussMarkovForSV()
       : CommandBase(CmdName, TargetId)
@@ -61,13 +73,13 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["Process"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<double>::is_valid(m_values["Sigma"])
-          && parse_json<double>::is_valid(m_values["Time"])
-          && parse_json<int>::is_valid(m_values["Seed"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(ProcessField))
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<double>::is_valid(field(SigmaField))
+          && parse_json<double>::is_valid(field(TimeField))
+          && parse_json<int>::is_valid(field(SeedField))
         ;
 
     }
@@ -89,84 +101,84 @@ namespace Sdx
 
     std::string SetPseudorangeNoiseGaussMarkovForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetPseudorangeNoiseGaussMarkovForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeNoiseGaussMarkovForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetPseudorangeNoiseGaussMarkovForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeNoiseGaussMarkovForSV::process() const
     {
-      return parse_json<int>::parse(m_values["Process"]);
+      return parse_json<int>::parse(field(ProcessField));
     }
 
     void SetPseudorangeNoiseGaussMarkovForSV::setProcess(int process)
     {
-      m_values.AddMember("Process", parse_json<int>::format(process, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ProcessField, parse_json<int>::format(process, m_values.GetAllocator()));
     }
 
 
 
     bool SetPseudorangeNoiseGaussMarkovForSV::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void SetPseudorangeNoiseGaussMarkovForSV::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     double SetPseudorangeNoiseGaussMarkovForSV::sigma() const
     {
-      return parse_json<double>::parse(m_values["Sigma"]);
+      return parse_json<double>::parse(field(SigmaField));
     }
 
     void SetPseudorangeNoiseGaussMarkovForSV::setSigma(double sigma)
     {
-      m_values.AddMember("Sigma", parse_json<double>::format(sigma, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SigmaField, parse_json<double>::format(sigma, m_values.GetAllocator()));
     }
 
 
 
     double SetPseudorangeNoiseGaussMarkovForSV::time() const
     {
-      return parse_json<double>::parse(m_values["Time"]);
+      return parse_json<double>::parse(field(TimeField));
     }
 
     void SetPseudorangeNoiseGaussMarkovForSV::setTime(double time)
     {
-      m_values.AddMember("Time", parse_json<double>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<double>::format(time, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeNoiseGaussMarkovForSV::seed() const
     {
-      return parse_json<int>::parse(m_values["Seed"]);
+      return parse_json<int>::parse(field(SeedField));
     }
 
     void SetPseudorangeNoiseGaussMarkovForSV::setSeed(int seed)
     {
-      m_values.AddMember("Seed", parse_json<int>::format(seed, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SeedField, parse_json<int>::format(seed, m_values.GetAllocator()));
     }
 
 
@@ -28,6 +28,17 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPseudorangeNoiseSineWaveForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPseudorangeNoiseSineWaveForEachSV);
 
+    namespace
+    {
+      // Fields of SetPseudorangeNoiseSineWaveForEachSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SineWaveField = 1;
+      constexpr std::size_t EnabledField = 2;
+      constexpr std::size_t AmplitudeField = 3;
+      constexpr std::size_t PeriodField = 4;
+      constexpr std::size_t OffsetField = 5;
+    }
+
 
     SetPseudorangeNoiseSineWaveForEachSV::SetPseudorangeNoiseSineWaveForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -59,12 +70,12 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SineWave"])
-          && parse_json<std::vector<bool>>::is_valid(m_values["Enabled"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Amplitude"])
-          && parse_json<std::vector<int>>::is_valid(m_values["Period"])
-          && parse_json<std::vector<double>>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SineWaveField))
+          && parse_json<std::vector<bool>>::is_valid(field(EnabledField))
+          && parse_json<std::vector<double>>::is_valid(field(AmplitudeField))
+          && parse_json<std::vector<int>>::is_valid(field(PeriodField))
+          && parse_json<std::vector<double>>::is_valid(field(OffsetField))
         ;
 
     }
@@ -86,72 +97,92 @@ namespace Sdx
 
     std::string SetPseudorangeNoiseSineWaveForEachSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetPseudorangeNoiseSineWaveForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeNoiseSineWaveForEachSV::sineWave() const
     {
-      return parse_json<int>::parse(m_values["SineWave"]);
+      return parse_json<int>::parse(field(SineWaveField));
     }
 
     void SetPseudorangeNoiseSineWaveForEachSV::setSineWave(int sineWave)
     {
-      m_values.AddMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SineWaveField, parse_json<int>::format(sineWave, m_values.GetAllocator()));
     }
 
 
 
     std::vector<bool> SetPseudorangeNoiseSineWaveForEachSV::enabled() const
     {
-      return parse_json<std::vector<bool>>::parse(m_values["Enabled"]);
+      return fieldValue<std::vector<bool>>(EnabledField);
+    }
+
+    std::shared_ptr<const std::vector<bool>> SetPseudorangeNoiseSineWaveForEachSV::enabledPtr() const
+    {
+      return sharedValue<std::vector<bool>>(EnabledField);
     }
 
     void SetPseudorangeNoiseSineWaveForEachSV::setEnabled(const std::vector<bool>& enabled)
     {
-      m_values.AddMember("Enabled", parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<std::vector<bool>>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPseudorangeNoiseSineWaveForEachSV::amplitude() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Amplitude"]);
+      return fieldValue<std::vector<double>>(AmplitudeField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPseudorangeNoiseSineWaveForEachSV::amplitudePtr() const
+    {
+      return sharedValue<std::vector<double>>(AmplitudeField);
     }
 
     void SetPseudorangeNoiseSineWaveForEachSV::setAmplitude(const std::vector<double>& amplitude)
     {
-      m_values.AddMember("Amplitude", parse_json<std::vector<double>>::format(amplitude, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AmplitudeField, parse_json<std::vector<double>>::format(amplitude, m_values.GetAllocator()));
     }
 
 
 
     std::vector<int> SetPseudorangeNoiseSineWaveForEachSV::period() const
     {
-      return parse_json<std::vector<int>>::parse(m_values["Period"]);
+      return fieldValue<std::vector<int>>(PeriodField);
+    }
+
+    std::shared_ptr<const std::vector<int>> SetPseudorangeNoiseSineWaveForEachSV::periodPtr() const
+    {
+      return sharedValue<std::vector<int>>(PeriodField);
     }
 
     void SetPseudorangeNoiseSineWaveForEachSV::setPeriod(const std::vector<int>& period)
     {
-      m_values.AddMember("Period", parse_json<std::vector<int>>::format(period, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PeriodField, parse_json<std::vector<int>>::format(period, m_values.GetAllocator()));
     }
 
 
 
     std::vector<double> SetPseudorangeNoiseSineWaveForEachSV::offset() const
     {
-      return parse_json<std::vector<double>>::parse(m_values["Offset"]);
+      return fieldValue<std::vector<double>>(OffsetField);
+    }
+
+    std::shared_ptr<const std::vector<double>> SetPseudorangeNoiseSineWaveForEachSV::offsetPtr() const
+    {
+      return sharedValue<std::vector<double>>(OffsetField);
     }
 
     void SetPseudorangeNoiseSineWaveForEachSV::setOffset(const std::vector<double>& offset)
     {
-      m_values.AddMember("Offset", parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<std::vector<double>>::format(offset, m_values.GetAllocator()));
     }
 
 
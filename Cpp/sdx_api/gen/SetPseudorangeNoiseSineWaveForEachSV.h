@@ -60,21 +60,25 @@ namespace Sdx
 
       // **** enabled ****
       std::vector<bool> enabled() const;
+      std::shared_ptr<const std::vector<bool>> enabledPtr() const;
       void setEnabled(const std::vector<bool>& enabled);
 
 
       // **** amplitude ****
       std::vector<double> amplitude() const;
+      std::shared_ptr<const std::vector<double>> amplitudePtr() const;
       void setAmplitude(const std::vector<double>& amplitude);
 
 
       // **** period ****
       std::vector<int> period() const;
+      std::shared_ptr<const std::vector<int>> periodPtr() const;
       void setPeriod(const std::vector<int>& period);
 
 
       // **** offset ****
       std::vector<double> offset() const;
+      std::shared_ptr<const std::vector<double>> offsetPtr() const;
       void setOffset(const std::vector<double>& offset);
     };
     
@@ -29,6 +29,18 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPseudorangeNoiseSineWaveForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPseudorangeNoiseSineWaveForSV);
 
+    namespace
+    {
+      // Fields of SetPseudorangeNoiseSineWaveForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t SineWaveField = 2;
+      constexpr std::size_t EnabledField = 3;
+      constexpr std::size_t AmplitudeField = 4;
+      constexpr std::size_t PeriodField = 5;
+      constexpr std::size_t OffsetField = 6;
+    }
+
 
     SetPseudorangeNoiseSineWaveForSV::SetPseudorangeNoiseSineWaveForSV()
       : CommandBase(CmdName, TargetId)
@@ -61,13 +73,13 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<int>::is_valid(m_values["SineWave"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
-          && parse_json<double>::is_valid(m_values["Amplitude"])
-          && parse_json<int>::is_valid(m_values["Period"])
-          && parse_json<double>::is_valid(m_values["Offset"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<int>::is_valid(field(SineWaveField))
+          && parse_json<bool>::is_valid(field(EnabledField))
+          && parse_json<double>::is_valid(field(AmplitudeField))
+          && parse_json<int>::is_valid(field(PeriodField))
+          && parse_json<double>::is_valid(field(OffsetField))
         ;
 
     }
@@ -89,84 +101,84 @@ namespace Sdx
 
     std::string SetPseudorangeNoiseSineWaveForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetPseudorangeNoiseSineWaveForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeNoiseSineWaveForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetPseudorangeNoiseSineWaveForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeNoiseSineWaveForSV::sineWave() const
     {
-      return parse_json<int>::parse(m_values["SineWave"]);
+      return parse_json<int>::parse(field(SineWaveField));
     }
 
     void SetPseudorangeNoiseSineWaveForSV::setSineWave(int sineWave)
     {
-      m_values.AddMember("SineWave", parse_json<int>::format(sineWave, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SineWaveField, parse_json<int>::format(sineWave, m_values.GetAllocator()));
     }
 
 
 
     bool SetPseudorangeNoiseSineWaveForSV::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void SetPseudorangeNoiseSineWaveForSV::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
 
     double SetPseudorangeNoiseSineWaveForSV::amplitude() const
     {
-      return parse_json<double>::parse(m_values["Amplitude"]);
+      return parse_json<double>::parse(field(AmplitudeField));
     }
 
     void SetPseudorangeNoiseSineWaveForSV::setAmplitude(double amplitude)
     {
-      m_values.AddMember("Amplitude", parse_json<double>::format(amplitude, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AmplitudeField, parse_json<double>::format(amplitude, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeNoiseSineWaveForSV::period() const
     {
-      return parse_json<int>::parse(m_values["Period"]);
+      return parse_json<int>::parse(field(PeriodField));
     }
 
     void SetPseudorangeNoiseSineWaveForSV::setPeriod(int period)
     {
-      m_values.AddMember("Period", parse_json<int>::format(period, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PeriodField, parse_json<int>::format(period, m_values.GetAllocator()));
     }
 
 
 
     double SetPseudorangeNoiseSineWaveForSV::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void SetPseudorangeNoiseSineWaveForSV::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -43,6 +43,19 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetPseudorangeRampForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetPseudorangeRampForSV);
 
+    namespace
+    {
+      // Fields of SetPseudorangeRampForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t OffsetField = 2;
+      constexpr std::size_t StartTimeField = 3;
+      constexpr std::size_t HoldStartTimeField = 4;
+      constexpr std::size_t HoldStopTimeField = 5;
+      constexpr std::size_t StopTimeField = 6;
+      constexpr std::size_t IdField = 7;
+    }
+
 
     SetPseudorangeRampForSV::SetPseudorangeRampForSV()
       : CommandBase(CmdName, TargetId)
@@ -76,14 +89,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<double>::is_valid(m_values["Offset"])
-          && parse_json<int>::is_valid(m_values["StartTime"])
-          && parse_json<int>::is_valid(m_values["HoldStartTime"])
-          && parse_json<int>::is_valid(m_values["HoldStopTime"])
-          && parse_json<int>::is_valid(m_values["StopTime"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<double>::is_valid(field(OffsetField))
+          && parse_json<int>::is_valid(field(StartTimeField))
+          && parse_json<int>::is_valid(field(HoldStartTimeField))
+          && parse_json<int>::is_valid(field(HoldStopTimeField))
+          && parse_json<int>::is_valid(field(StopTimeField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -105,96 +118,96 @@ namespace Sdx
 
     std::string SetPseudorangeRampForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetPseudorangeRampForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeRampForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetPseudorangeRampForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     double SetPseudorangeRampForSV::offset() const
     {
-      return parse_json<double>::parse(m_values["Offset"]);
+      return parse_json<double>::parse(field(OffsetField));
     }
 
     void SetPseudorangeRampForSV::setOffset(double offset)
     {
-      m_values.AddMember("Offset", parse_json<double>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<double>::format(offset, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeRampForSV::startTime() const
     {
-      return parse_json<int>::parse(m_values["StartTime"]);
+      return parse_json<int>::parse(field(StartTimeField));
     }
 
     void SetPseudorangeRampForSV::setStartTime(int startTime)
     {
-      m_values.AddMember("StartTime", parse_json<int>::format(startTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StartTimeField, parse_json<int>::format(startTime, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeRampForSV::holdStartTime() const
     {
-      return parse_json<int>::parse(m_values["HoldStartTime"]);
+      return parse_json<int>::parse(field(HoldStartTimeField));
     }
 
     void SetPseudorangeRampForSV::setHoldStartTime(int holdStartTime)
     {
-      m_values.AddMember("HoldStartTime", parse_json<int>::format(holdStartTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HoldStartTimeField, parse_json<int>::format(holdStartTime, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeRampForSV::holdStopTime() const
     {
-      return parse_json<int>::parse(m_values["HoldStopTime"]);
+      return parse_json<int>::parse(field(HoldStopTimeField));
     }
 
     void SetPseudorangeRampForSV::setHoldStopTime(int holdStopTime)
     {
-      m_values.AddMember("HoldStopTime", parse_json<int>::format(holdStopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HoldStopTimeField, parse_json<int>::format(holdStopTime, m_values.GetAllocator()));
     }
 
 
 
     int SetPseudorangeRampForSV::stopTime() const
     {
-      return parse_json<int>::parse(m_values["StopTime"]);
+      return parse_json<int>::parse(field(StopTimeField));
     }
 
     void SetPseudorangeRampForSV::setStopTime(int stopTime)
     {
-      m_values.AddMember("StopTime", parse_json<int>::format(stopTime, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StopTimeField, parse_json<int>::format(stopTime, m_values.GetAllocator()));
     }
 
 
 
     std::string SetPseudorangeRampForSV::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetPseudorangeRampForSV::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
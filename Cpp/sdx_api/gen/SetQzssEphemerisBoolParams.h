@@ -61,6 +61,7 @@ namespace Sdx
 
       // **** val ****
       std::vector<bool> val() const;
+      std::shared_ptr<const std::vector<bool>> valPtr() const;
       void setVal(const std::vector<bool>& val);
 
 
@@ -28,6 +28,17 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetQzssL1SAugmentation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetQzssL1SAugmentation);
 
+    namespace
+    {
+      // Fields of SetQzssL1SAugmentation, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t PrnField = 1;
+      constexpr std::size_t AugmentIODField = 2;
+      constexpr std::size_t AugmentPRCField = 3;
+      constexpr std::size_t PrcField = 4;
+      constexpr std::size_t IdField = 5;
+    }
+
 
     SetQzssL1SAugmentation::SetQzssL1SAugmentation()
       : CommandBase(CmdName, TargetId)
@@ -59,12 +70,12 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["Prn"])
-          && parse_json<bool>::is_valid(m_values["AugmentIOD"])
-          && parse_json<bool>::is_valid(m_values["AugmentPRC"])
-          && parse_json<double>::is_valid(m_values["Prc"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(PrnField))
+          && parse_json<bool>::is_valid(field(AugmentIODField))
+          && parse_json<bool>::is_valid(field(AugmentPRCField))
+          && parse_json<double>::is_valid(field(PrcField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -86,72 +97,72 @@ namespace Sdx
 
     std::string SetQzssL1SAugmentation::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetQzssL1SAugmentation::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetQzssL1SAugmentation::prn() const
     {
-      return parse_json<int>::parse(m_values["Prn"]);
+      return parse_json<int>::parse(field(PrnField));
     }
 
     void SetQzssL1SAugmentation::setPrn(int prn)
     {
-      m_values.AddMember("Prn", parse_json<int>::format(prn, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrnField, parse_json<int>::format(prn, m_values.GetAllocator()));
     }
 
 
 
     bool SetQzssL1SAugmentation::augmentIOD() const
     {
-      return parse_json<bool>::parse(m_values["AugmentIOD"]);
+      return parse_json<bool>::parse(field(AugmentIODField));
     }
 
     void SetQzssL1SAugmentation::setAugmentIOD(bool augmentIOD)
     {
-      m_values.AddMember("AugmentIOD", parse_json<bool>::format(augmentIOD, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AugmentIODField, parse_json<bool>::format(augmentIOD, m_values.GetAllocator()));
     }
 
 
 
     bool SetQzssL1SAugmentation::augmentPRC() const
     {
-      return parse_json<bool>::parse(m_values["AugmentPRC"]);
+      return parse_json<bool>::parse(field(AugmentPRCField));
     }
 
     void SetQzssL1SAugmentation::setAugmentPRC(bool augmentPRC)
     {
-      m_values.AddMember("AugmentPRC", parse_json<bool>::format(augmentPRC, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AugmentPRCField, parse_json<bool>::format(augmentPRC, m_values.GetAllocator()));
     }
 
 
 
     double SetQzssL1SAugmentation::prc() const
     {
-      return parse_json<double>::parse(m_values["Prc"]);
+      return parse_json<double>::parse(field(PrcField));
     }
 
     void SetQzssL1SAugmentation::setPrc(double prc)
     {
-      m_values.AddMember("Prc", parse_json<double>::format(prc, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PrcField, parse_json<double>::format(prc, m_values.GetAllocator()));
     }
 
 
 
     std::string SetQzssL1SAugmentation::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetQzssL1SAugmentation::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetRFOutputOffsets);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetRFOutputOffsets);
 
+    namespace
+    {
+      // Fields of SetRFOutputOffsets, indices in fieldNames()
+      constexpr std::size_t OutputIdxField = 0;
+      constexpr std::size_t PowerOffsetField = 1;
+      constexpr std::size_t TimeOffsetField = 2;
+      constexpr std::size_t PhaseOffsetField = 3;
+      constexpr std::size_t PhaseStepField = 4;
+    }
+
 
     SetRFOutputOffsets::SetRFOutputOffsets()
       : CommandBase(CmdName, TargetId)
@@ -57,11 +67,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["OutputIdx"])
-          && parse_json<double>::is_valid(m_values["PowerOffset"])
-          && parse_json<double>::is_valid(m_values["TimeOffset"])
-          && parse_json<double>::is_valid(m_values["PhaseOffset"])
-          && parse_json<std::optional<double>>::is_valid(m_values["PhaseStep"])
+          && parse_json<int>::is_valid(field(OutputIdxField))
+          && parse_json<double>::is_valid(field(PowerOffsetField))
+          && parse_json<double>::is_valid(field(TimeOffsetField))
+          && parse_json<double>::is_valid(field(PhaseOffsetField))
+          && parse_json<std::optional<double>>::is_valid(field(PhaseStepField))
         ;
 
     }
@@ -83,60 +93,60 @@ namespace Sdx
 
     int SetRFOutputOffsets::outputIdx() const
     {
-      return parse_json<int>::parse(m_values["OutputIdx"]);
+      return parse_json<int>::parse(field(OutputIdxField));
     }
 
     void SetRFOutputOffsets::setOutputIdx(int outputIdx)
     {
-      m_values.AddMember("OutputIdx", parse_json<int>::format(outputIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputIdxField, parse_json<int>::format(outputIdx, m_values.GetAllocator()));
     }
 
 
 
     double SetRFOutputOffsets::powerOffset() const
     {
-      return parse_json<double>::parse(m_values["PowerOffset"]);
+      return parse_json<double>::parse(field(PowerOffsetField));
     }
 
     void SetRFOutputOffsets::setPowerOffset(double powerOffset)
     {
-      m_values.AddMember("PowerOffset", parse_json<double>::format(powerOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PowerOffsetField, parse_json<double>::format(powerOffset, m_values.GetAllocator()));
     }
 
 
 
     double SetRFOutputOffsets::timeOffset() const
     {
-      return parse_json<double>::parse(m_values["TimeOffset"]);
+      return parse_json<double>::parse(field(TimeOffsetField));
     }
 
     void SetRFOutputOffsets::setTimeOffset(double timeOffset)
     {
-      m_values.AddMember("TimeOffset", parse_json<double>::format(timeOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeOffsetField, parse_json<double>::format(timeOffset, m_values.GetAllocator()));
     }
 
 
 
     double SetRFOutputOffsets::phaseOffset() const
     {
-      return parse_json<double>::parse(m_values["PhaseOffset"]);
+      return parse_json<double>::parse(field(PhaseOffsetField));
     }
 
     void SetRFOutputOffsets::setPhaseOffset(double phaseOffset)
     {
-      m_values.AddMember("PhaseOffset", parse_json<double>::format(phaseOffset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseOffsetField, parse_json<double>::format(phaseOffset, m_values.GetAllocator()));
     }
 
 
 
     std::optional<double> SetRFOutputOffsets::phaseStep() const
     {
-      return parse_json<std::optional<double>>::parse(m_values["PhaseStep"]);
+      return parse_json<std::optional<double>>::parse(field(PhaseStepField));
     }
 
     void SetRFOutputOffsets::setPhaseStep(const std::optional<double>& phaseStep)
     {
-      m_values.AddMember("PhaseStep", parse_json<std::optional<double>>::format(phaseStep, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PhaseStepField, parse_json<std::optional<double>>::format(phaseStep, m_values.GetAllocator()));
     }
 
 
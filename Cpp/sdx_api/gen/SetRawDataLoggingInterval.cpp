@@ -27,6 +27,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetRawDataLoggingInterval);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetRawDataLoggingInterval);
 
+    namespace
+    {
+      // Fields of SetRawDataLoggingInterval, indices in fieldNames()
+      constexpr std::size_t DaysField = 0;
+      constexpr std::size_t HoursField = 1;
+      constexpr std::size_t MinutesField = 2;
+      constexpr std::size_t SecondsField = 3;
+      constexpr std::size_t MillisecondsField = 4;
+    }
+
 
     SetRawDataLoggingInterval::SetRawDataLoggingInterval()
       : CommandBase(CmdName, TargetId)
@@ -57,11 +67,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Days"])
-          && parse_json<int>::is_valid(m_values["Hours"])
-          && parse_json<int>::is_valid(m_values["Minutes"])
-          && parse_json<int>::is_valid(m_values["Seconds"])
-          && parse_json<int>::is_valid(m_values["Milliseconds"])
+          && parse_json<int>::is_valid(field(DaysField))
+          && parse_json<int>::is_valid(field(HoursField))
+          && parse_json<int>::is_valid(field(MinutesField))
+          && parse_json<int>::is_valid(field(SecondsField))
+          && parse_json<int>::is_valid(field(MillisecondsField))
         ;
 
     }
@@ -83,60 +93,60 @@ namespace Sdx
 
     int SetRawDataLoggingInterval::days() const
     {
-      return parse_json<int>::parse(m_values["Days"]);
+      return parse_json<int>::parse(field(DaysField));
     }
 
     void SetRawDataLoggingInterval::setDays(int days)
     {
-      m_values.AddMember("Days", parse_json<int>::format(days, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DaysField, parse_json<int>::format(days, m_values.GetAllocator()));
     }
 
 
 
     int SetRawDataLoggingInterval::hours() const
     {
-      return parse_json<int>::parse(m_values["Hours"]);
+      return parse_json<int>::parse(field(HoursField));
     }
 
     void SetRawDataLoggingInterval::setHours(int hours)
     {
-      m_values.AddMember("Hours", parse_json<int>::format(hours, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HoursField, parse_json<int>::format(hours, m_values.GetAllocator()));
     }
 
 
 
     int SetRawDataLoggingInterval::minutes() const
     {
-      return parse_json<int>::parse(m_values["Minutes"]);
+      return parse_json<int>::parse(field(MinutesField));
     }
 
     void SetRawDataLoggingInterval::setMinutes(int minutes)
     {
-      m_values.AddMember("Minutes", parse_json<int>::format(minutes, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MinutesField, parse_json<int>::format(minutes, m_values.GetAllocator()));
     }
 
 
 
     int SetRawDataLoggingInterval::seconds() const
     {
-      return parse_json<int>::parse(m_values["Seconds"]);
+      return parse_json<int>::parse(field(SecondsField));
     }
 
     void SetRawDataLoggingInterval::setSeconds(int seconds)
     {
-      m_values.AddMember("Seconds", parse_json<int>::format(seconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SecondsField, parse_json<int>::format(seconds, m_values.GetAllocator()));
     }
 
 
 
     int SetRawDataLoggingInterval::milliseconds() const
     {
-      return parse_json<int>::parse(m_values["Milliseconds"]);
+      return parse_json<int>::parse(field(MillisecondsField));
     }
 
     void SetRawDataLoggingInterval::setMilliseconds(int milliseconds)
     {
-      m_values.AddMember("Milliseconds", parse_json<int>::format(milliseconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MillisecondsField, parse_json<int>::format(milliseconds, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetRfGain);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetRfGain);
 
+    namespace
+    {
+      // Fields of SetRfGain, indices in fieldNames()
+      constexpr std::size_t OutputField = 0;
+      constexpr std::size_t GainField = 1;
+    }
+
 
     SetRfGain::SetRfGain()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Output"])
-          && parse_json<double>::is_valid(m_values["Gain"])
+          && parse_json<int>::is_valid(field(OutputField))
+          && parse_json<double>::is_valid(field(GainField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int SetRfGain::output() const
     {
-      return parse_json<int>::parse(m_values["Output"]);
+      return parse_json<int>::parse(field(OutputField));
     }
 
     void SetRfGain::setOutput(int output)
     {
-      m_values.AddMember("Output", parse_json<int>::format(output, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OutputField, parse_json<int>::format(output, m_values.GetAllocator()));
     }
 
 
 
     double SetRfGain::gain() const
     {
-      return parse_json<double>::parse(m_values["Gain"]);
+      return parse_json<double>::parse(field(GainField));
     }
 
     void SetRfGain::setGain(double gain)
     {
-      m_values.AddMember("Gain", parse_json<double>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainField, parse_json<double>::format(gain, m_values.GetAllocator()));
     }
 
 
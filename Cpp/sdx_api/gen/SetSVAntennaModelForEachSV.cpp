@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSVAntennaModelForEachSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSVAntennaModelForEachSV);
 
+    namespace
+    {
+      // Fields of SetSVAntennaModelForEachSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t AntennaModelNamesField = 1;
+    }
+
 
     SetSVAntennaModelForEachSV::SetSVAntennaModelForEachSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<std::vector<std::string>>::is_valid(m_values["AntennaModelNames"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<std::vector<std::string>>::is_valid(field(AntennaModelNamesField))
         ;
 
     }
@@ -74,24 +81,29 @@ namespace Sdx
 
     std::string SetSVAntennaModelForEachSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetSVAntennaModelForEachSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     std::vector<std::string> SetSVAntennaModelForEachSV::antennaModelNames() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["AntennaModelNames"]);
+      return fieldValue<std::vector<std::string>>(AntennaModelNamesField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> SetSVAntennaModelForEachSV::antennaModelNamesPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(AntennaModelNamesField);
     }
 
     void SetSVAntennaModelForEachSV::setAntennaModelNames(const std::vector<std::string>& antennaModelNames)
     {
-      m_values.AddMember("AntennaModelNames", parse_json<std::vector<std::string>>::format(antennaModelNames, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaModelNamesField, parse_json<std::vector<std::string>>::format(antennaModelNames, m_values.GetAllocator()));
     }
 
 
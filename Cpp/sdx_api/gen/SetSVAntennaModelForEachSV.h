@@ -51,6 +51,7 @@ namespace Sdx
 
       // **** antennaModelNames ****
       std::vector<std::string> antennaModelNames() const;
+      std::shared_ptr<const std::vector<std::string>> antennaModelNamesPtr() const;
       void setAntennaModelNames(const std::vector<std::string>& antennaModelNames);
     };
     
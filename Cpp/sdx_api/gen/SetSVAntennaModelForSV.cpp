@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSVAntennaModelForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSVAntennaModelForSV);
 
+    namespace
+    {
+      // Fields of SetSVAntennaModelForSV, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t AntennaModelNameField = 2;
+    }
+
 
     SetSVAntennaModelForSV::SetSVAntennaModelForSV()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::string>::is_valid(m_values["AntennaModelName"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::string>::is_valid(field(AntennaModelNameField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string SetSVAntennaModelForSV::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetSVAntennaModelForSV::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetSVAntennaModelForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetSVAntennaModelForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::string SetSVAntennaModelForSV::antennaModelName() const
     {
-      return parse_json<std::string>::parse(m_values["AntennaModelName"]);
+      return fieldValue<std::string>(AntennaModelNameField);
     }
 
     void SetSVAntennaModelForSV::setAntennaModelName(const std::string& antennaModelName)
     {
-      m_values.AddMember("AntennaModelName", parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AntennaModelNameField, parse_json<std::string>::format(antennaModelName, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSVDataUpdateMode);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSVDataUpdateMode);
 
+    namespace
+    {
+      // Fields of SetSVDataUpdateMode, indices in fieldNames()
+      constexpr std::size_t ModeField = 0;
+    }
+
 
     SetSVDataUpdateMode::SetSVDataUpdateMode()
       : CommandBase(CmdName, TargetId)
@@ -51,7 +57,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::SVDataUpdateMode>::is_valid(m_values["Mode"])
+          && parse_json<Sdx::SVDataUpdateMode>::is_valid(field(ModeField))
         ;
 
     }
@@ -73,12 +79,12 @@ namespace Sdx
 
     Sdx::SVDataUpdateMode SetSVDataUpdateMode::mode() const
     {
-      return parse_json<Sdx::SVDataUpdateMode>::parse(m_values["Mode"]);
+      return parse_json<Sdx::SVDataUpdateMode>::parse(field(ModeField));
     }
 
     void SetSVDataUpdateMode::setMode(const Sdx::SVDataUpdateMode& mode)
     {
-      m_values.AddMember("Mode", parse_json<Sdx::SVDataUpdateMode>::format(mode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModeField, parse_json<Sdx::SVDataUpdateMode>::format(mode, m_values.GetAllocator()));
     }
 
 
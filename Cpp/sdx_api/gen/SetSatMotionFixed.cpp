@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSatMotionFixed);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSatMotionFixed);
 
+    namespace
+    {
+      // Fields of SetSatMotionFixed, indices in fieldNames()
+      constexpr std::size_t SystemField = 0;
+      constexpr std::size_t SvIdField = 1;
+      constexpr std::size_t IsFixedField = 2;
+    }
+
 
     SetSatMotionFixed::SetSatMotionFixed()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["System"])
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<bool>::is_valid(m_values["IsFixed"])
+          && parse_json<std::string>::is_valid(field(SystemField))
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<bool>::is_valid(field(IsFixedField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string SetSatMotionFixed::system() const
     {
-      return parse_json<std::string>::parse(m_values["System"]);
+      return fieldValue<std::string>(SystemField);
     }
 
     void SetSatMotionFixed::setSystem(const std::string& system)
     {
-      m_values.AddMember("System", parse_json<std::string>::format(system, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemField, parse_json<std::string>::format(system, m_values.GetAllocator()));
     }
 
 
 
     int SetSatMotionFixed::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetSatMotionFixed::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     bool SetSatMotionFixed::isFixed() const
     {
-      return parse_json<bool>::parse(m_values["IsFixed"]);
+      return parse_json<bool>::parse(field(IsFixedField));
     }
 
     void SetSatMotionFixed::setIsFixed(bool isFixed)
     {
-      m_values.AddMember("IsFixed", parse_json<bool>::format(isFixed, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IsFixedField, parse_json<bool>::format(isFixed, m_values.GetAllocator()));
     }
 
 
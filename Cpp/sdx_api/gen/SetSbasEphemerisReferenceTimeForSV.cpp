@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSbasEphemerisReferenceTimeForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSbasEphemerisReferenceTimeForSV);
 
+    namespace
+    {
+      // Fields of SetSbasEphemerisReferenceTimeForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t TimeField = 1;
+    }
+
 
     SetSbasEphemerisReferenceTimeForSV::SetSbasEphemerisReferenceTimeForSV()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Time"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<Sdx::DateTime>::is_valid(field(TimeField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     int SetSbasEphemerisReferenceTimeForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetSbasEphemerisReferenceTimeForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     Sdx::DateTime SetSbasEphemerisReferenceTimeForSV::time() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Time"]);
+      return parse_json<Sdx::DateTime>::parse(field(TimeField));
     }
 
     void SetSbasEphemerisReferenceTimeForSV::setTime(const Sdx::DateTime& time)
     {
-      m_values.AddMember("Time", parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<Sdx::DateTime>::format(time, m_values.GetAllocator()));
     }
 
 
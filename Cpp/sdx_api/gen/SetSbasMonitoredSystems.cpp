@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSbasMonitoredSystems);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSbasMonitoredSystems);
 
+    namespace
+    {
+      // Fields of SetSbasMonitoredSystems, indices in fieldNames()
+      constexpr std::size_t SystemsField = 0;
+    }
+
 
     SetSbasMonitoredSystems::SetSbasMonitoredSystems()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::vector<std::string>>::is_valid(m_values["Systems"])
+          && parse_json<std::vector<std::string>>::is_valid(field(SystemsField))
         ;
 
     }
@@ -71,12 +77,17 @@ namespace Sdx
 
     std::vector<std::string> SetSbasMonitoredSystems::systems() const
     {
-      return parse_json<std::vector<std::string>>::parse(m_values["Systems"]);
+      return fieldValue<std::vector<std::string>>(SystemsField);
+    }
+
+    std::shared_ptr<const std::vector<std::string>> SetSbasMonitoredSystems::systemsPtr() const
+    {
+      return sharedValue<std::vector<std::string>>(SystemsField);
     }
 
     void SetSbasMonitoredSystems::setSystems(const std::vector<std::string>& systems)
     {
-      m_values.AddMember("Systems", parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SystemsField, parse_json<std::vector<std::string>>::format(systems, m_values.GetAllocator()));
     }
 
 
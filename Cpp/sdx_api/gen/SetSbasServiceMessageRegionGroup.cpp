@@ -27,6 +27,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSbasServiceMessageRegionGroup);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSbasServiceMessageRegionGroup);
 
+    namespace
+    {
+      // Fields of SetSbasServiceMessageRegionGroup, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t DeltaUdreiField = 1;
+      constexpr std::size_t PriorityCodeField = 2;
+      constexpr std::size_t RegionsField = 3;
+      constexpr std::size_t IdField = 4;
+    }
+
 
     SetSbasServiceMessageRegionGroup::SetSbasServiceMessageRegionGroup()
       : CommandBase(CmdName, TargetId)
@@ -57,11 +67,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<int>::is_valid(m_values["DeltaUdrei"])
-          && parse_json<int>::is_valid(m_values["PriorityCode"])
-          && parse_json<std::vector<Sdx::SbasServiceMessageRegion>>::is_valid(m_values["Regions"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<int>::is_valid(field(DeltaUdreiField))
+          && parse_json<int>::is_valid(field(PriorityCodeField))
+          && parse_json<std::vector<Sdx::SbasServiceMessageRegion>>::is_valid(field(RegionsField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -83,60 +93,65 @@ namespace Sdx
 
     std::string SetSbasServiceMessageRegionGroup::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void SetSbasServiceMessageRegionGroup::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     int SetSbasServiceMessageRegionGroup::deltaUdrei() const
     {
-      return parse_json<int>::parse(m_values["DeltaUdrei"]);
+      return parse_json<int>::parse(field(DeltaUdreiField));
     }
 
     void SetSbasServiceMessageRegionGroup::setDeltaUdrei(int deltaUdrei)
     {
-      m_values.AddMember("DeltaUdrei", parse_json<int>::format(deltaUdrei, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(DeltaUdreiField, parse_json<int>::format(deltaUdrei, m_values.GetAllocator()));
     }
 
 
 
     int SetSbasServiceMessageRegionGroup::priorityCode() const
     {
-      return parse_json<int>::parse(m_values["PriorityCode"]);
+      return parse_json<int>::parse(field(PriorityCodeField));
     }
 
     void SetSbasServiceMessageRegionGroup::setPriorityCode(int priorityCode)
     {
-      m_values.AddMember("PriorityCode", parse_json<int>::format(priorityCode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PriorityCodeField, parse_json<int>::format(priorityCode, m_values.GetAllocator()));
     }
 
 
 
     std::vector<Sdx::SbasServiceMessageRegion> SetSbasServiceMessageRegionGroup::regions() const
     {
-      return parse_json<std::vector<Sdx::SbasServiceMessageRegion>>::parse(m_values["Regions"]);
+      return fieldValue<std::vector<Sdx::SbasServiceMessageRegion>>(RegionsField);
+    }
+
+    std::shared_ptr<const std::vector<Sdx::SbasServiceMessageRegion>> SetSbasServiceMessageRegionGroup::regionsPtr() const
+    {
+      return sharedValue<std::vector<Sdx::SbasServiceMessageRegion>>(RegionsField);
     }
 
     void SetSbasServiceMessageRegionGroup::setRegions(const std::vector<Sdx::SbasServiceMessageRegion>& regions)
     {
-      m_values.AddMember("Regions", parse_json<std::vector<Sdx::SbasServiceMessageRegion>>::format(regions, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RegionsField, parse_json<std::vector<Sdx::SbasServiceMessageRegion>>::format(regions, m_values.GetAllocator()));
     }
 
 
 
     std::string SetSbasServiceMessageRegionGroup::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetSbasServiceMessageRegionGroup::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
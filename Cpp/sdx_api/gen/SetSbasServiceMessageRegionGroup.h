@@ -65,6 +65,7 @@ namespace Sdx
 
       // **** regions ****
       std::vector<Sdx::SbasServiceMessageRegion> regions() const;
+      std::shared_ptr<const std::vector<Sdx::SbasServiceMessageRegion>> regionsPtr() const;
       void setRegions(const std::vector<Sdx::SbasServiceMessageRegion>& regions);
 
 
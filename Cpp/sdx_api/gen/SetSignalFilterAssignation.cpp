@@ -29,6 +29,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSignalFilterAssignation);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSignalFilterAssignation);
 
+    namespace
+    {
+      // Fields of SetSignalFilterAssignation, indices in fieldNames()
+      constexpr std::size_t SignalFilterDictField = 0;
+    }
+
 
     SetSignalFilterAssignation::SetSignalFilterAssignation()
       : CommandBase(CmdName, TargetId)
@@ -55,7 +61,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::map<std::string, std::string>>::is_valid(m_values["SignalFilterDict"])
+          && parse_json<std::map<std::string, std::string>>::is_valid(field(SignalFilterDictField))
         ;
 
     }
@@ -77,12 +83,17 @@ namespace Sdx
 
     std::map<std::string, std::string> SetSignalFilterAssignation::signalFilterDict() const
     {
-      return parse_json<std::map<std::string, std::string>>::parse(m_values["SignalFilterDict"]);
+      return fieldValue<std::map<std::string, std::string>>(SignalFilterDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, std::string>> SetSignalFilterAssignation::signalFilterDictPtr() const
+    {
+      return sharedValue<std::map<std::string, std::string>>(SignalFilterDictField);
     }
 
     void SetSignalFilterAssignation::setSignalFilterDict(const std::map<std::string, std::string>& signalFilterDict)
     {
-      m_values.AddMember("SignalFilterDict", parse_json<std::map<std::string, std::string>>::format(signalFilterDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalFilterDictField, parse_json<std::map<std::string, std::string>>::format(signalFilterDict, m_values.GetAllocator()));
     }
 
 
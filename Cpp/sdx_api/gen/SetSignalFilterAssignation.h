@@ -51,6 +51,7 @@ namespace Sdx
 
       // **** signalFilterDict ****
       std::map<std::string, std::string> signalFilterDict() const;
+      std::shared_ptr<const std::map<std::string, std::string>> signalFilterDictPtr() const;
       void setSignalFilterDict(const std::map<std::string, std::string>& signalFilterDict);
     };
     
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSpectrumVisible);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSpectrumVisible);
 
+    namespace
+    {
+      // Fields of SetSpectrumVisible, indices in fieldNames()
+      constexpr std::size_t VisibleField = 0;
+    }
+
 
     SetSpectrumVisible::SetSpectrumVisible()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Visible"])
+          && parse_json<bool>::is_valid(field(VisibleField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool SetSpectrumVisible::visible() const
     {
-      return parse_json<bool>::parse(m_values["Visible"]);
+      return parse_json<bool>::parse(field(VisibleField));
     }
 
     void SetSpectrumVisible::setVisible(bool visible)
     {
-      m_values.AddMember("Visible", parse_json<bool>::format(visible, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(VisibleField, parse_json<bool>::format(visible, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSpoofSignalManualPropagationLoss);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSpoofSignalManualPropagationLoss);
 
+    namespace
+    {
+      // Fields of SetSpoofSignalManualPropagationLoss, indices in fieldNames()
+      constexpr std::size_t PropagationLossField = 0;
+      constexpr std::size_t TransmitterIdField = 1;
+      constexpr std::size_t SignalIdField = 2;
+    }
+
 
     SetSpoofSignalManualPropagationLoss::SetSpoofSignalManualPropagationLoss()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["PropagationLoss"])
-          && parse_json<std::string>::is_valid(m_values["TransmitterId"])
-          && parse_json<std::string>::is_valid(m_values["SignalId"])
+          && parse_json<double>::is_valid(field(PropagationLossField))
+          && parse_json<std::string>::is_valid(field(TransmitterIdField))
+          && parse_json<std::string>::is_valid(field(SignalIdField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     double SetSpoofSignalManualPropagationLoss::propagationLoss() const
     {
-      return parse_json<double>::parse(m_values["PropagationLoss"]);
+      return parse_json<double>::parse(field(PropagationLossField));
     }
 
     void SetSpoofSignalManualPropagationLoss::setPropagationLoss(double propagationLoss)
     {
-      m_values.AddMember("PropagationLoss", parse_json<double>::format(propagationLoss, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PropagationLossField, parse_json<double>::format(propagationLoss, m_values.GetAllocator()));
     }
 
 
 
     std::string SetSpoofSignalManualPropagationLoss::transmitterId() const
     {
-      return parse_json<std::string>::parse(m_values["TransmitterId"]);
+      return fieldValue<std::string>(TransmitterIdField);
     }
 
     void SetSpoofSignalManualPropagationLoss::setTransmitterId(const std::string& transmitterId)
     {
-      m_values.AddMember("TransmitterId", parse_json<std::string>::format(transmitterId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitterIdField, parse_json<std::string>::format(transmitterId, m_values.GetAllocator()));
     }
 
 
 
     std::string SetSpoofSignalManualPropagationLoss::signalId() const
     {
-      return parse_json<std::string>::parse(m_values["SignalId"]);
+      return fieldValue<std::string>(SignalIdField);
     }
 
     void SetSpoofSignalManualPropagationLoss::setSignalId(const std::string& signalId)
     {
-      m_values.AddMember("SignalId", parse_json<std::string>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<std::string>::format(signalId, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSpoofTxGpuIdx);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSpoofTxGpuIdx);
 
+    namespace
+    {
+      // Fields of SetSpoofTxGpuIdx, indices in fieldNames()
+      constexpr std::size_t GpuIdxField = 0;
+      constexpr std::size_t SignalIdField = 1;
+      constexpr std::size_t IdField = 2;
+    }
+
 
     SetSpoofTxGpuIdx::SetSpoofTxGpuIdx()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["GpuIdx"])
-          && parse_json<int>::is_valid(m_values["SignalId"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<int>::is_valid(field(GpuIdxField))
+          && parse_json<int>::is_valid(field(SignalIdField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     int SetSpoofTxGpuIdx::gpuIdx() const
     {
-      return parse_json<int>::parse(m_values["GpuIdx"]);
+      return parse_json<int>::parse(field(GpuIdxField));
     }
 
     void SetSpoofTxGpuIdx::setGpuIdx(int gpuIdx)
     {
-      m_values.AddMember("GpuIdx", parse_json<int>::format(gpuIdx, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GpuIdxField, parse_json<int>::format(gpuIdx, m_values.GetAllocator()));
     }
 
 
 
     int SetSpoofTxGpuIdx::signalId() const
     {
-      return parse_json<int>::parse(m_values["SignalId"]);
+      return parse_json<int>::parse(field(SignalIdField));
     }
 
     void SetSpoofTxGpuIdx::setSignalId(int signalId)
     {
-      m_values.AddMember("SignalId", parse_json<int>::format(signalId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalIdField, parse_json<int>::format(signalId, m_values.GetAllocator()));
     }
 
 
 
     std::string SetSpoofTxGpuIdx::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetSpoofTxGpuIdx::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
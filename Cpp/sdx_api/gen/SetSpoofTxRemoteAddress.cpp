@@ -26,6 +26,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSpoofTxRemoteAddress);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSpoofTxRemoteAddress);
 
+    namespace
+    {
+      // Fields of SetSpoofTxRemoteAddress, indices in fieldNames()
+      constexpr std::size_t AddressField = 0;
+      constexpr std::size_t InstanceIdField = 1;
+      constexpr std::size_t IdField = 2;
+    }
+
 
     SetSpoofTxRemoteAddress::SetSpoofTxRemoteAddress()
       : CommandBase(CmdName, TargetId)
@@ -54,9 +62,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Address"])
-          && parse_json<int>::is_valid(m_values["InstanceId"])
-          && parse_json<std::string>::is_valid(m_values["Id"])
+          && parse_json<std::string>::is_valid(field(AddressField))
+          && parse_json<int>::is_valid(field(InstanceIdField))
+          && parse_json<std::string>::is_valid(field(IdField))
         ;
 
     }
@@ -78,36 +86,36 @@ namespace Sdx
 
     std::string SetSpoofTxRemoteAddress::address() const
     {
-      return parse_json<std::string>::parse(m_values["Address"]);
+      return fieldValue<std::string>(AddressField);
     }
 
     void SetSpoofTxRemoteAddress::setAddress(const std::string& address)
     {
-      m_values.AddMember("Address", parse_json<std::string>::format(address, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(AddressField, parse_json<std::string>::format(address, m_values.GetAllocator()));
     }
 
 
 
     int SetSpoofTxRemoteAddress::instanceId() const
     {
-      return parse_json<int>::parse(m_values["InstanceId"]);
+      return parse_json<int>::parse(field(InstanceIdField));
     }
 
     void SetSpoofTxRemoteAddress::setInstanceId(int instanceId)
     {
-      m_values.AddMember("InstanceId", parse_json<int>::format(instanceId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(InstanceIdField, parse_json<int>::format(instanceId, m_values.GetAllocator()));
     }
 
 
 
     std::string SetSpoofTxRemoteAddress::id() const
     {
-      return parse_json<std::string>::parse(m_values["Id"]);
+      return fieldValue<std::string>(IdField);
     }
 
     void SetSpoofTxRemoteAddress::setId(const std::string& id)
     {
-      m_values.AddMember("Id", parse_json<std::string>::format(id, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(IdField, parse_json<std::string>::format(id, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetStartTimeMode);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetStartTimeMode);
 
+    namespace
+    {
+      // Fields of SetStartTimeMode, indices in fieldNames()
+      constexpr std::size_t ModeField = 0;
+    }
+
 
     SetStartTimeMode::SetStartTimeMode()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Mode"])
+          && parse_json<std::string>::is_valid(field(ModeField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string SetStartTimeMode::mode() const
     {
-      return parse_json<std::string>::parse(m_values["Mode"]);
+      return fieldValue<std::string>(ModeField);
     }
 
     void SetStartTimeMode::setMode(const std::string& mode)
     {
-      m_values.AddMember("Mode", parse_json<std::string>::format(mode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModeField, parse_json<std::string>::format(mode, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetStartTimeOffset);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetStartTimeOffset);
 
+    namespace
+    {
+      // Fields of SetStartTimeOffset, indices in fieldNames()
+      constexpr std::size_t OffsetField = 0;
+    }
+
 
     SetStartTimeOffset::SetStartTimeOffset()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Offset"])
+          && parse_json<int>::is_valid(field(OffsetField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     int SetStartTimeOffset::offset() const
     {
-      return parse_json<int>::parse(m_values["Offset"]);
+      return parse_json<int>::parse(field(OffsetField));
     }
 
     void SetStartTimeOffset::setOffset(int offset)
     {
-      m_values.AddMember("Offset", parse_json<int>::format(offset, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(OffsetField, parse_json<int>::format(offset, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetStatusLogMaxEntriesCount);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetStatusLogMaxEntriesCount);
 
+    namespace
+    {
+      // Fields of SetStatusLogMaxEntriesCount, indices in fieldNames()
+      constexpr std::size_t MaxCountField = 0;
+    }
+
 
     SetStatusLogMaxEntriesCount::SetStatusLogMaxEntriesCount()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["MaxCount"])
+          && parse_json<int>::is_valid(field(MaxCountField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetStatusLogMaxEntriesCount::maxCount() const
     {
-      return parse_json<int>::parse(m_values["MaxCount"]);
+      return parse_json<int>::parse(field(MaxCountField));
     }
 
     void SetStatusLogMaxEntriesCount::setMaxCount(int maxCount)
     {
-      m_values.AddMember("MaxCount", parse_json<int>::format(maxCount, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MaxCountField, parse_json<int>::format(maxCount, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetStatusLogMaxEntriesCountMode);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetStatusLogMaxEntriesCountMode);
 
+    namespace
+    {
+      // Fields of SetStatusLogMaxEntriesCountMode, indices in fieldNames()
+      constexpr std::size_t ModeField = 0;
+    }
+
 
     SetStatusLogMaxEntriesCountMode::SetStatusLogMaxEntriesCountMode()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Mode"])
+          && parse_json<std::string>::is_valid(field(ModeField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string SetStatusLogMaxEntriesCountMode::mode() const
     {
-      return parse_json<std::string>::parse(m_values["Mode"]);
+      return fieldValue<std::string>(ModeField);
     }
 
     void SetStatusLogMaxEntriesCountMode::setMode(const std::string& mode)
     {
-      m_values.AddMember("Mode", parse_json<std::string>::format(mode, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ModeField, parse_json<std::string>::format(mode, m_values.GetAllocator()));
     }
 
 
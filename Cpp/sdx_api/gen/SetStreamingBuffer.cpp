@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetStreamingBuffer);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetStreamingBuffer);
 
+    namespace
+    {
+      // Fields of SetStreamingBuffer, indices in fieldNames()
+      constexpr std::size_t SizeField = 0;
+    }
+
 
     SetStreamingBuffer::SetStreamingBuffer()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Size"])
+          && parse_json<int>::is_valid(field(SizeField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetStreamingBuffer::size() const
     {
-      return parse_json<int>::parse(m_values["Size"]);
+      return parse_json<int>::parse(field(SizeField));
     }
 
     void SetStreamingBuffer::setSize(int size)
     {
-      m_values.AddMember("Size", parse_json<int>::format(size, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SizeField, parse_json<int>::format(size, m_values.GetAllocator()));
     }
 
 
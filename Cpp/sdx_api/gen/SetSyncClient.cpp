@@ -24,6 +24,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSyncClient);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSyncClient);
 
+    namespace
+    {
+      // Fields of SetSyncClient, indices in fieldNames()
+      constexpr std::size_t HostField = 0;
+      constexpr std::size_t PortField = 1;
+    }
+
 
     SetSyncClient::SetSyncClient()
       : CommandBase(CmdName, TargetId)
@@ -51,8 +58,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Host"])
-          && parse_json<int>::is_valid(m_values["Port"])
+          && parse_json<std::string>::is_valid(field(HostField))
+          && parse_json<int>::is_valid(field(PortField))
         ;
 
     }
@@ -74,24 +81,24 @@ namespace Sdx
 
     std::string SetSyncClient::host() const
     {
-      return parse_json<std::string>::parse(m_values["Host"]);
+      return fieldValue<std::string>(HostField);
     }
 
     void SetSyncClient::setHost(const std::string& host)
     {
-      m_values.AddMember("Host", parse_json<std::string>::format(host, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(HostField, parse_json<std::string>::format(host, m_values.GetAllocator()));
     }
 
 
 
     int SetSyncClient::port() const
     {
-      return parse_json<int>::parse(m_values["Port"]);
+      return parse_json<int>::parse(field(PortField));
     }
 
     void SetSyncClient::setPort(int port)
     {
-      m_values.AddMember("Port", parse_json<int>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PortField, parse_json<int>::format(port, m_values.GetAllocator()));
     }
 
 
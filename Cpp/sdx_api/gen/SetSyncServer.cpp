@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSyncServer);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSyncServer);
 
+    namespace
+    {
+      // Fields of SetSyncServer, indices in fieldNames()
+      constexpr std::size_t PortField = 0;
+    }
+
 
     SetSyncServer::SetSyncServer()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Port"])
+          && parse_json<int>::is_valid(field(PortField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetSyncServer::port() const
     {
-      return parse_json<int>::parse(m_values["Port"]);
+      return parse_json<int>::parse(field(PortField));
     }
 
     void SetSyncServer::setPort(int port)
     {
-      m_values.AddMember("Port", parse_json<int>::format(port, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(PortField, parse_json<int>::format(port, m_values.GetAllocator()));
     }
 
 
@@ -24,6 +24,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSyncTime);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSyncTime);
 
+    namespace
+    {
+      // Fields of SetSyncTime, indices in fieldNames()
+      constexpr std::size_t TimeField = 0;
+    }
+
 
     SetSyncTime::SetSyncTime()
       : CommandBase(CmdName, TargetId)
@@ -50,7 +56,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Time"])
+          && parse_json<double>::is_valid(field(TimeField))
         ;
 
     }
@@ -72,12 +78,12 @@ namespace Sdx
 
     double SetSyncTime::time() const
     {
-      return parse_json<double>::parse(m_values["Time"]);
+      return parse_json<double>::parse(field(TimeField));
     }
 
     void SetSyncTime::setTime(double time)
     {
-      m_values.AddMember("Time", parse_json<double>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<double>::format(time, m_values.GetAllocator()));
     }
 
 
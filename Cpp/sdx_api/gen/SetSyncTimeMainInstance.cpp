@@ -25,6 +25,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSyncTimeMainInstance);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSyncTimeMainInstance);
 
+    namespace
+    {
+      // Fields of SetSyncTimeMainInstance, indices in fieldNames()
+      constexpr std::size_t TimeField = 0;
+    }
+
 
     SetSyncTimeMainInstance::SetSyncTimeMainInstance()
       : CommandBase(CmdName, TargetId)
@@ -51,7 +57,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Time"])
+          && parse_json<double>::is_valid(field(TimeField))
         ;
 
     }
@@ -73,12 +79,12 @@ namespace Sdx
 
     double SetSyncTimeMainInstance::time() const
     {
-      return parse_json<double>::parse(m_values["Time"]);
+      return parse_json<double>::parse(field(TimeField));
     }
 
     void SetSyncTimeMainInstance::setTime(double time)
     {
-      m_values.AddMember("Time", parse_json<double>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<double>::format(time, m_values.GetAllocator()));
     }
 
 
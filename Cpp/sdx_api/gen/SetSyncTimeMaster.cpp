@@ -27,6 +27,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetSyncTimeMaster);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetSyncTimeMaster);
 
+    namespace
+    {
+      // Fields of SetSyncTimeMaster, indices in fieldNames()
+      constexpr std::size_t TimeField = 0;
+    }
+
 
     SetSyncTimeMaster::SetSyncTimeMaster()
       : CommandBase(CmdName, TargetId)
@@ -53,7 +59,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<double>::is_valid(m_values["Time"])
+          && parse_json<double>::is_valid(field(TimeField))
         ;
 
     }
@@ -75,12 +81,12 @@ namespace Sdx
 
     double SetSyncTimeMaster::time() const
     {
-      return parse_json<double>::parse(m_values["Time"]);
+      return parse_json<double>::parse(field(TimeField));
     }
 
     void SetSyncTimeMaster::setTime(double time)
     {
-      m_values.AddMember("Time", parse_json<double>::format(time, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TimeField, parse_json<double>::format(time, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetTransmitMessage2InSbasMessage0);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetTransmitMessage2InSbasMessage0);
 
+    namespace
+    {
+      // Fields of SetTransmitMessage2InSbasMessage0, indices in fieldNames()
+      constexpr std::size_t TransmitMessage2Field = 0;
+    }
+
 
     SetTransmitMessage2InSbasMessage0::SetTransmitMessage2InSbasMessage0()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["TransmitMessage2"])
+          && parse_json<bool>::is_valid(field(TransmitMessage2Field))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool SetTransmitMessage2InSbasMessage0::transmitMessage2() const
     {
-      return parse_json<bool>::parse(m_values["TransmitMessage2"]);
+      return parse_json<bool>::parse(field(TransmitMessage2Field));
     }
 
     void SetTransmitMessage2InSbasMessage0::setTransmitMessage2(bool transmitMessage2)
     {
-      m_values.AddMember("TransmitMessage2", parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TransmitMessage2Field, parse_json<bool>::format(transmitMessage2, m_values.GetAllocator()));
     }
 
 
@@ -29,6 +29,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetTransmittedPrnForSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetTransmittedPrnForSV);
 
+    namespace
+    {
+      // Fields of SetTransmittedPrnForSV, indices in fieldNames()
+      constexpr std::size_t SvIdField = 0;
+      constexpr std::size_t SignalPrnDictField = 1;
+    }
+
 
     SetTransmittedPrnForSV::SetTransmittedPrnForSV()
       : CommandBase(CmdName, TargetId)
@@ -56,8 +63,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["SvId"])
-          && parse_json<std::map<std::string, int>>::is_valid(m_values["SignalPrnDict"])
+          && parse_json<int>::is_valid(field(SvIdField))
+          && parse_json<std::map<std::string, int>>::is_valid(field(SignalPrnDictField))
         ;
 
     }
@@ -79,24 +86,29 @@ namespace Sdx
 
     int SetTransmittedPrnForSV::svId() const
     {
-      return parse_json<int>::parse(m_values["SvId"]);
+      return parse_json<int>::parse(field(SvIdField));
     }
 
     void SetTransmittedPrnForSV::setSvId(int svId)
     {
-      m_values.AddMember("SvId", parse_json<int>::format(svId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SvIdField, parse_json<int>::format(svId, m_values.GetAllocator()));
     }
 
 
 
     std::map<std::string, int> SetTransmittedPrnForSV::signalPrnDict() const
     {
-      return parse_json<std::map<std::string, int>>::parse(m_values["SignalPrnDict"]);
+      return fieldValue<std::map<std::string, int>>(SignalPrnDictField);
+    }
+
+    std::shared_ptr<const std::map<std::string, int>> SetTransmittedPrnForSV::signalPrnDictPtr() const
+    {
+      return sharedValue<std::map<std::string, int>>(SignalPrnDictField);
     }
 
     void SetTransmittedPrnForSV::setSignalPrnDict(const std::map<std::string, int>& signalPrnDict)
     {
-      m_values.AddMember("SignalPrnDict", parse_json<std::map<std::string, int>>::format(signalPrnDict, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SignalPrnDictField, parse_json<std::map<std::string, int>>::format(signalPrnDict, m_values.GetAllocator()));
     }
 
 
@@ -51,6 +51,7 @@ namespace Sdx
 
       // **** udreis ****
       std::vector<int> udreis() const;
+      std::shared_ptr<const std::vector<int>> udreisPtr() const;
       void setUdreis(const std::vector<int>& udreis);
     };
     
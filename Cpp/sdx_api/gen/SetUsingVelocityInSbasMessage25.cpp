@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetUsingVelocityInSbasMessage25);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetUsingVelocityInSbasMessage25);
 
+    namespace
+    {
+      // Fields of SetUsingVelocityInSbasMessage25, indices in fieldNames()
+      constexpr std::size_t UseVelocityField = 0;
+    }
+
 
     SetUsingVelocityInSbasMessage25::SetUsingVelocityInSbasMessage25()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["UseVelocity"])
+          && parse_json<bool>::is_valid(field(UseVelocityField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool SetUsingVelocityInSbasMessage25::useVelocity() const
     {
-      return parse_json<bool>::parse(m_values["UseVelocity"]);
+      return parse_json<bool>::parse(field(UseVelocityField));
     }
 
     void SetUsingVelocityInSbasMessage25::setUseVelocity(bool useVelocity)
     {
-      m_values.AddMember("UseVelocity", parse_json<bool>::format(useVelocity, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(UseVelocityField, parse_json<bool>::format(useVelocity, m_values.GetAllocator()));
     }
 
 
@@ -27,6 +27,16 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetVehicleAntennaPhaseOffsetCSV);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetVehicleAntennaPhaseOffsetCSV);
 
+    namespace
+    {
+      // Fields of SetVehicleAntennaPhaseOffsetCSV, indices in fieldNames()
+      constexpr std::size_t FilePathField = 0;
+      constexpr std::size_t FileFormatField = 1;
+      constexpr std::size_t TypeField = 2;
+      constexpr std::size_t BandField = 3;
+      constexpr std::size_t NameField = 4;
+    }
+
 
     SetVehicleAntennaPhaseOffsetCSV::SetVehicleAntennaPhaseOffsetCSV()
       : CommandBase(CmdName, TargetId)
@@ -57,11 +67,11 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["FilePath"])
-          && parse_json<Sdx::AntennaPatternFileType>::is_valid(m_values["FileFormat"])
-          && parse_json<Sdx::AntennaPatternType>::is_valid(m_values["Type"])
-          && parse_json<Sdx::GNSSBand>::is_valid(m_values["Band"])
-          && parse_json<std::optional<std::string>>::is_valid(m_values["Name"])
+          && parse_json<std::string>::is_valid(field(FilePathField))
+          && parse_json<Sdx::AntennaPatternFileType>::is_valid(field(FileFormatField))
+          && parse_json<Sdx::AntennaPatternType>::is_valid(field(TypeField))
+          && parse_json<Sdx::GNSSBand>::is_valid(field(BandField))
+          && parse_json<std::optional<std::string>>::is_valid(field(NameField))
         ;
 
     }
@@ -83,60 +93,60 @@ namespace Sdx
 
     std::string SetVehicleAntennaPhaseOffsetCSV::filePath() const
     {
-      return parse_json<std::string>::parse(m_values["FilePath"]);
+      return fieldValue<std::string>(FilePathField);
     }
 
     void SetVehicleAntennaPhaseOffsetCSV::setFilePath(const std::string& filePath)
     {
-      m_values.AddMember("FilePath", parse_json<std::string>::format(filePath, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FilePathField, parse_json<std::string>::format(filePath, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternFileType SetVehicleAntennaPhaseOffsetCSV::fileFormat() const
     {
-      return parse_json<Sdx::AntennaPatternFileType>::parse(m_values["FileFormat"]);
+      return parse_json<Sdx::AntennaPatternFileType>::parse(field(FileFormatField));
     }
 
     void SetVehicleAntennaPhaseOffsetCSV::setFileFormat(const Sdx::AntennaPatternFileType& fileFormat)
     {
-      m_values.AddMember("FileFormat", parse_json<Sdx::AntennaPatternFileType>::format(fileFormat, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FileFormatField, parse_json<Sdx::AntennaPatternFileType>::format(fileFormat, m_values.GetAllocator()));
     }
 
 
 
     Sdx::AntennaPatternType SetVehicleAntennaPhaseOffsetCSV::type() const
     {
-      return parse_json<Sdx::AntennaPatternType>::parse(m_values["Type"]);
+      return parse_json<Sdx::AntennaPatternType>::parse(field(TypeField));
     }
 
     void SetVehicleAntennaPhaseOffsetCSV::setType(const Sdx::AntennaPatternType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<Sdx::AntennaPatternType>::format(type, m_values.GetAllocator()));
     }
 
 
 
     Sdx::GNSSBand SetVehicleAntennaPhaseOffsetCSV::band() const
     {
-      return parse_json<Sdx::GNSSBand>::parse(m_values["Band"]);
+      return parse_json<Sdx::GNSSBand>::parse(field(BandField));
     }
 
     void SetVehicleAntennaPhaseOffsetCSV::setBand(const Sdx::GNSSBand& band)
     {
-      m_values.AddMember("Band", parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(BandField, parse_json<Sdx::GNSSBand>::format(band, m_values.GetAllocator()));
     }
 
 
 
     std::optional<std::string> SetVehicleAntennaPhaseOffsetCSV::name() const
     {
-      return parse_json<std::optional<std::string>>::parse(m_values["Name"]);
+      return fieldValue<std::optional<std::string>>(NameField);
     }
 
     void SetVehicleAntennaPhaseOffsetCSV::setName(const std::optional<std::string>& name)
     {
-      m_values.AddMember("Name", parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(NameField, parse_json<std::optional<std::string>>::format(name, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetVehicleTrajectory);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetVehicleTrajectory);
 
+    namespace
+    {
+      // Fields of SetVehicleTrajectory, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+    }
+
 
     SetVehicleTrajectory::SetVehicleTrajectory()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Type"])
+          && parse_json<std::string>::is_valid(field(TypeField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     std::string SetVehicleTrajectory::type() const
     {
-      return parse_json<std::string>::parse(m_values["Type"]);
+      return fieldValue<std::string>(TypeField);
     }
 
     void SetVehicleTrajectory::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
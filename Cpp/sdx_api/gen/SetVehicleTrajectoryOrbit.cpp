@@ -30,6 +30,19 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetVehicleTrajectoryOrbit);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetVehicleTrajectoryOrbit);
 
+    namespace
+    {
+      // Fields of SetVehicleTrajectoryOrbit, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+      constexpr std::size_t ReferenceField = 1;
+      constexpr std::size_t SemiMajorAxisField = 2;
+      constexpr std::size_t InclinationField = 3;
+      constexpr std::size_t RightAscensionField = 4;
+      constexpr std::size_t EccentricityField = 5;
+      constexpr std::size_t MeanAnomalyField = 6;
+      constexpr std::size_t ArgumentOfPerigeeField = 7;
+    }
+
 
     SetVehicleTrajectoryOrbit::SetVehicleTrajectoryOrbit()
       : CommandBase(CmdName, TargetId)
@@ -63,14 +76,14 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Type"])
-          && parse_json<Sdx::DateTime>::is_valid(m_values["Reference"])
-          && parse_json<double>::is_valid(m_values["SemiMajorAxis"])
-          && parse_json<double>::is_valid(m_values["Inclination"])
-          && parse_json<double>::is_valid(m_values["RightAscension"])
-          && parse_json<double>::is_valid(m_values["Eccentricity"])
-          && parse_json<double>::is_valid(m_values["MeanAnomaly"])
-          && parse_json<double>::is_valid(m_values["ArgumentOfPerigee"])
+          && parse_json<std::string>::is_valid(field(TypeField))
+          && parse_json<Sdx::DateTime>::is_valid(field(ReferenceField))
+          && parse_json<double>::is_valid(field(SemiMajorAxisField))
+          && parse_json<double>::is_valid(field(InclinationField))
+          && parse_json<double>::is_valid(field(RightAscensionField))
+          && parse_json<double>::is_valid(field(EccentricityField))
+          && parse_json<double>::is_valid(field(MeanAnomalyField))
+          && parse_json<double>::is_valid(field(ArgumentOfPerigeeField))
         ;
 
     }
@@ -92,96 +105,96 @@ namespace Sdx
 
     std::string SetVehicleTrajectoryOrbit::type() const
     {
-      return parse_json<std::string>::parse(m_values["Type"]);
+      return fieldValue<std::string>(TypeField);
     }
 
     void SetVehicleTrajectoryOrbit::setType(const std::string& type)
     {
-      m_values.AddMember("Type", parse_json<std::string>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<std::string>::format(type, m_values.GetAllocator()));
     }
 
 
 
     Sdx::DateTime SetVehicleTrajectoryOrbit::reference() const
     {
-      return parse_json<Sdx::DateTime>::parse(m_values["Reference"]);
+      return parse_json<Sdx::DateTime>::parse(field(ReferenceField));
     }
 
     void SetVehicleTrajectoryOrbit::setReference(const Sdx::DateTime& reference)
     {
-      m_values.AddMember("Reference", parse_json<Sdx::DateTime>::format(reference, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ReferenceField, parse_json<Sdx::DateTime>::format(reference, m_values.GetAllocator()));
     }
 
 
 
     double SetVehicleTrajectoryOrbit::semiMajorAxis() const
     {
-      return parse_json<double>::parse(m_values["SemiMajorAxis"]);
+      return parse_json<double>::parse(field(SemiMajorAxisField));
     }
 
     void SetVehicleTrajectoryOrbit::setSemiMajorAxis(double semiMajorAxis)
     {
-      m_values.AddMember("SemiMajorAxis", parse_json<double>::format(semiMajorAxis, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SemiMajorAxisField, parse_json<double>::format(semiMajorAxis, m_values.GetAllocator()));
     }
 
 
 
     double SetVehicleTrajectoryOrbit::inclination() const
     {
-      return parse_json<double>::parse(m_values["Inclination"]);
+      return parse_json<double>::parse(field(InclinationField));
     }
 
     void SetVehicleTrajectoryOrbit::setInclination(double inclination)
     {
-      m_values.AddMember("Inclination", parse_json<double>::format(inclination, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(InclinationField, parse_json<double>::format(inclination, m_values.GetAllocator()));
     }
 
 
 
     double SetVehicleTrajectoryOrbit::rightAscension() const
     {
-      return parse_json<double>::parse(m_values["RightAscension"]);
+      return parse_json<double>::parse(field(RightAscensionField));
     }
 
     void SetVehicleTrajectoryOrbit::setRightAscension(double rightAscension)
     {
-      m_values.AddMember("RightAscension", parse_json<double>::format(rightAscension, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(RightAscensionField, parse_json<double>::format(rightAscension, m_values.GetAllocator()));
     }
 
 
 
     double SetVehicleTrajectoryOrbit::eccentricity() const
     {
-      return parse_json<double>::parse(m_values["Eccentricity"]);
+      return parse_json<double>::parse(field(EccentricityField));
     }
 
     void SetVehicleTrajectoryOrbit::setEccentricity(double eccentricity)
     {
-      m_values.AddMember("Eccentricity", parse_json<double>::format(eccentricity, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EccentricityField, parse_json<double>::format(eccentricity, m_values.GetAllocator()));
     }
 
 
 
     double SetVehicleTrajectoryOrbit::meanAnomaly() const
     {
-      return parse_json<double>::parse(m_values["MeanAnomaly"]);
+      return parse_json<double>::parse(field(MeanAnomalyField));
     }
 
     void SetVehicleTrajectoryOrbit::setMeanAnomaly(double meanAnomaly)
     {
-      m_values.AddMember("MeanAnomaly", parse_json<double>::format(meanAnomaly, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MeanAnomalyField, parse_json<double>::format(meanAnomaly, m_values.GetAllocator()));
     }
 
 
 
     double SetVehicleTrajectoryOrbit::argumentOfPerigee() const
     {
-      return parse_json<double>::parse(m_values["ArgumentOfPerigee"]);
+      return parse_json<double>::parse(field(ArgumentOfPerigeeField));
     }
 
     void SetVehicleTrajectoryOrbit::setArgumentOfPerigee(double argumentOfPerigee)
     {
-      m_values.AddMember("ArgumentOfPerigee", parse_json<double>::format(argumentOfPerigee, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ArgumentOfPerigeeField, parse_json<double>::format(argumentOfPerigee, m_values.GetAllocator()));
     }
 
 
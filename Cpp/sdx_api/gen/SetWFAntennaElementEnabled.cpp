@@ -28,6 +28,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetWFAntennaElementEnabled);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetWFAntennaElementEnabled);
 
+    namespace
+    {
+      // Fields of SetWFAntennaElementEnabled, indices in fieldNames()
+      constexpr std::size_t ElementField = 0;
+      constexpr std::size_t EnabledField = 1;
+    }
+
 
     SetWFAntennaElementEnabled::SetWFAntennaElementEnabled()
       : CommandBase(CmdName, TargetId)
@@ -55,8 +62,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Element"])
-          && parse_json<bool>::is_valid(m_values["Enabled"])
+          && parse_json<int>::is_valid(field(ElementField))
+          && parse_json<bool>::is_valid(field(EnabledField))
         ;
 
     }
@@ -80,24 +87,24 @@ namespace Sdx
 
     int SetWFAntennaElementEnabled::element() const
     {
-      return parse_json<int>::parse(m_values["Element"]);
+      return parse_json<int>::parse(field(ElementField));
     }
 
     void SetWFAntennaElementEnabled::setElement(int element)
     {
-      m_values.AddMember("Element", parse_json<int>::format(element, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ElementField, parse_json<int>::format(element, m_values.GetAllocator()));
     }
 
 
 
     bool SetWFAntennaElementEnabled::enabled() const
     {
-      return parse_json<bool>::parse(m_values["Enabled"]);
+      return parse_json<bool>::parse(field(EnabledField));
     }
 
     void SetWFAntennaElementEnabled::setEnabled(bool enabled)
     {
-      m_values.AddMember("Enabled", parse_json<bool>::format(enabled, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(EnabledField, parse_json<bool>::format(enabled, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetWFAntennaGain);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetWFAntennaGain);
 
+    namespace
+    {
+      // Fields of SetWFAntennaGain, indices in fieldNames()
+      constexpr std::size_t GainField = 0;
+    }
+
 
     SetWFAntennaGain::SetWFAntennaGain()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Gain"])
+          && parse_json<int>::is_valid(field(GainField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int SetWFAntennaGain::gain() const
     {
-      return parse_json<int>::parse(m_values["Gain"]);
+      return parse_json<int>::parse(field(GainField));
     }
 
     void SetWFAntennaGain::setGain(int gain)
     {
-      m_values.AddMember("Gain", parse_json<int>::format(gain, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(GainField, parse_json<int>::format(gain, m_values.GetAllocator()));
     }
 
 
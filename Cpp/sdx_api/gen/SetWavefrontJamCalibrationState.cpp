@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SetWavefrontJamCalibrationState);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SetWavefrontJamCalibrationState);
 
+    namespace
+    {
+      // Fields of SetWavefrontJamCalibrationState, indices in fieldNames()
+      constexpr std::size_t StateField = 0;
+    }
+
 
     SetWavefrontJamCalibrationState::SetWavefrontJamCalibrationState()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["State"])
+          && parse_json<bool>::is_valid(field(StateField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool SetWavefrontJamCalibrationState::state() const
     {
-      return parse_json<bool>::parse(m_values["State"]);
+      return parse_json<bool>::parse(field(StateField));
     }
 
     void SetWavefrontJamCalibrationState::setState(bool state)
     {
-      m_values.AddMember("State", parse_json<bool>::format(state, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StateField, parse_json<bool>::format(state, m_values.GetAllocator()));
     }
 
 
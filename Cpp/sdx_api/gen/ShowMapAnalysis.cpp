@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(ShowMapAnalysis);
     REGISTER_COMMAND_TO_FACTORY_IMPL(ShowMapAnalysis);
 
+    namespace
+    {
+      // Fields of ShowMapAnalysis, indices in fieldNames()
+      constexpr std::size_t ShowField = 0;
+    }
+
 
     ShowMapAnalysis::ShowMapAnalysis()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<bool>::is_valid(m_values["Show"])
+          && parse_json<bool>::is_valid(field(ShowField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     bool ShowMapAnalysis::show() const
     {
-      return parse_json<bool>::parse(m_values["Show"]);
+      return parse_json<bool>::parse(field(ShowField));
     }
 
     void ShowMapAnalysis::setShow(bool show)
     {
-      m_values.AddMember("Show", parse_json<bool>::format(show, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ShowField, parse_json<bool>::format(show, m_values.GetAllocator()));
     }
 
 
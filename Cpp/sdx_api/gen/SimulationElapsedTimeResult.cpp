@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(SimulationElapsedTimeResult);
 
+    namespace
+    {
+      // Fields of SimulationElapsedTimeResult, indices in fieldNames()
+      constexpr std::size_t MillisecondsField = 0;
+    }
+
 
     SimulationElapsedTimeResult::SimulationElapsedTimeResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Milliseconds"])
+          && parse_json<int>::is_valid(field(MillisecondsField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     int SimulationElapsedTimeResult::milliseconds() const
     {
-      return parse_json<int>::parse(m_values["Milliseconds"]);
+      return parse_json<int>::parse(field(MillisecondsField));
     }
 
     void SimulationElapsedTimeResult::setMilliseconds(int milliseconds)
     {
-      m_values.AddMember("Milliseconds", parse_json<int>::format(milliseconds, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MillisecondsField, parse_json<int>::format(milliseconds, m_values.GetAllocator()));
     }
 
 
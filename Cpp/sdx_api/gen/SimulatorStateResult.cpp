@@ -41,6 +41,15 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(SimulatorStateResult);
 
+    namespace
+    {
+      // Fields of SimulatorStateResult, indices in fieldNames()
+      constexpr std::size_t StateField = 0;
+      constexpr std::size_t ErrorField = 1;
+      constexpr std::size_t StateIdField = 2;
+      constexpr std::size_t SubStateIdField = 3;
+    }
+
 
     SimulatorStateResult::SimulatorStateResult()
       : CommandResult(CmdName, TargetId)
@@ -86,10 +95,10 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["State"])
-          && parse_json<std::string>::is_valid(m_values["Error"])
-          && parse_json<Sdx::SimulatorState>::is_valid(m_values["StateId"])
-          && parse_json<Sdx::SimulatorSubState>::is_valid(m_values["SubStateId"])
+          && parse_json<std::string>::is_valid(field(StateField))
+          && parse_json<std::string>::is_valid(field(ErrorField))
+          && parse_json<Sdx::SimulatorState>::is_valid(field(StateIdField))
+          && parse_json<Sdx::SimulatorSubState>::is_valid(field(SubStateIdField))
         ;
 
     }
@@ -105,48 +114,48 @@ namespace Sdx
 
     std::string SimulatorStateResult::state() const
     {
-      return parse_json<std::string>::parse(m_values["State"]);
+      return fieldValue<std::string>(StateField);
     }
 
     void SimulatorStateResult::setState(const std::string& state)
     {
-      m_values.AddMember("State", parse_json<std::string>::format(state, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StateField, parse_json<std::string>::format(state, m_values.GetAllocator()));
     }
 
 
 
     std::string SimulatorStateResult::error() const
     {
-      return parse_json<std::string>::parse(m_values["Error"]);
+      return fieldValue<std::string>(ErrorField);
     }
 
     void SimulatorStateResult::setError(const std::string& error)
     {
-      m_values.AddMember("Error", parse_json<std::string>::format(error, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ErrorField, parse_json<std::string>::format(error, m_values.GetAllocator()));
     }
 
 
 
     Sdx::SimulatorState SimulatorStateResult::stateId() const
     {
-      return parse_json<Sdx::SimulatorState>::parse(m_values["StateId"]);
+      return parse_json<Sdx::SimulatorState>::parse(field(StateIdField));
     }
 
     void SimulatorStateResult::setStateId(const Sdx::SimulatorState& stateId)
     {
-      m_values.AddMember("StateId", parse_json<Sdx::SimulatorState>::format(stateId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StateIdField, parse_json<Sdx::SimulatorState>::format(stateId, m_values.GetAllocator()));
     }
 
 
 
     Sdx::SimulatorSubState SimulatorStateResult::subStateId() const
     {
-      return parse_json<Sdx::SimulatorSubState>::parse(m_values["SubStateId"]);
+      return parse_json<Sdx::SimulatorSubState>::parse(field(SubStateIdField));
     }
 
     void SimulatorStateResult::setSubStateId(const Sdx::SimulatorSubState& subStateId)
     {
-      m_values.AddMember("SubStateId", parse_json<Sdx::SimulatorSubState>::format(subStateId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SubStateIdField, parse_json<Sdx::SimulatorSubState>::format(subStateId, m_values.GetAllocator()));
     }
 
 
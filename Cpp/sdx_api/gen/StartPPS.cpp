@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(StartPPS);
     REGISTER_COMMAND_TO_FACTORY_IMPL(StartPPS);
 
+    namespace
+    {
+      // Fields of StartPPS, indices in fieldNames()
+      constexpr std::size_t MsecField = 0;
+    }
+
 
     StartPPS::StartPPS()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<int>::is_valid(m_values["Msec"])
+          && parse_json<int>::is_valid(field(MsecField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     int StartPPS::msec() const
     {
-      return parse_json<int>::parse(m_values["Msec"]);
+      return parse_json<int>::parse(field(MsecField));
     }
 
     void StartPPS::setMsec(int msec)
     {
-      m_values.AddMember("Msec", parse_json<int>::format(msec, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(MsecField, parse_json<int>::format(msec, m_values.GetAllocator()));
     }
 
 
@@ -25,6 +25,14 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(SwapSbasServiceMessageRegionGroup);
     REGISTER_COMMAND_TO_FACTORY_IMPL(SwapSbasServiceMessageRegionGroup);
 
+    namespace
+    {
+      // Fields of SwapSbasServiceMessageRegionGroup, indices in fieldNames()
+      constexpr std::size_t ServiceProviderField = 0;
+      constexpr std::size_t FirstIdField = 1;
+      constexpr std::size_t SecondIdField = 2;
+    }
+
 
     SwapSbasServiceMessageRegionGroup::SwapSbasServiceMessageRegionGroup()
       : CommandBase(CmdName, TargetId)
@@ -53,9 +61,9 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["ServiceProvider"])
-          && parse_json<std::string>::is_valid(m_values["FirstId"])
-          && parse_json<std::string>::is_valid(m_values["SecondId"])
+          && parse_json<std::string>::is_valid(field(ServiceProviderField))
+          && parse_json<std::string>::is_valid(field(FirstIdField))
+          && parse_json<std::string>::is_valid(field(SecondIdField))
         ;
 
     }
@@ -77,36 +85,36 @@ namespace Sdx
 
     std::string SwapSbasServiceMessageRegionGroup::serviceProvider() const
     {
-      return parse_json<std::string>::parse(m_values["ServiceProvider"]);
+      return fieldValue<std::string>(ServiceProviderField);
     }
 
     void SwapSbasServiceMessageRegionGroup::setServiceProvider(const std::string& serviceProvider)
     {
-      m_values.AddMember("ServiceProvider", parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(ServiceProviderField, parse_json<std::string>::format(serviceProvider, m_values.GetAllocator()));
     }
 
 
 
     std::string SwapSbasServiceMessageRegionGroup::firstId() const
     {
-      return parse_json<std::string>::parse(m_values["FirstId"]);
+      return fieldValue<std::string>(FirstIdField);
     }
 
     void SwapSbasServiceMessageRegionGroup::setFirstId(const std::string& firstId)
     {
-      m_values.AddMember("FirstId", parse_json<std::string>::format(firstId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FirstIdField, parse_json<std::string>::format(firstId, m_values.GetAllocator()));
     }
 
 
 
     std::string SwapSbasServiceMessageRegionGroup::secondId() const
     {
-      return parse_json<std::string>::parse(m_values["SecondId"]);
+      return fieldValue<std::string>(SecondIdField);
     }
 
     void SwapSbasServiceMessageRegionGroup::setSecondId(const std::string& secondId)
     {
-      m_values.AddMember("SecondId", parse_json<std::string>::format(secondId, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(SecondIdField, parse_json<std::string>::format(secondId, m_values.GetAllocator()));
     }
 
 
@@ -23,6 +23,12 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(TestEncryptionLibrary);
     REGISTER_COMMAND_TO_FACTORY_IMPL(TestEncryptionLibrary);
 
+    namespace
+    {
+      // Fields of TestEncryptionLibrary, indices in fieldNames()
+      constexpr std::size_t TypeField = 0;
+    }
+
 
     TestEncryptionLibrary::TestEncryptionLibrary()
       : CommandBase(CmdName, TargetId)
@@ -49,7 +55,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<Sdx::EncryptionSignalType>::is_valid(m_values["Type"])
+          && parse_json<Sdx::EncryptionSignalType>::is_valid(field(TypeField))
         ;
 
     }
@@ -71,12 +77,12 @@ namespace Sdx
 
     Sdx::EncryptionSignalType TestEncryptionLibrary::type() const
     {
-      return parse_json<Sdx::EncryptionSignalType>::parse(m_values["Type"]);
+      return parse_json<Sdx::EncryptionSignalType>::parse(field(TypeField));
     }
 
     void TestEncryptionLibrary::setType(const Sdx::EncryptionSignalType& type)
     {
-      m_values.AddMember("Type", parse_json<Sdx::EncryptionSignalType>::format(type, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(TypeField, parse_json<Sdx::EncryptionSignalType>::format(type, m_values.GetAllocator()));
     }
 
 
@@ -22,6 +22,12 @@ namespace Sdx
 
     REGISTER_COMMAND_TO_FACTORY_IMPL(VersionResult);
 
+    namespace
+    {
+      // Fields of VersionResult, indices in fieldNames()
+      constexpr std::size_t VersionField = 0;
+    }
+
 
     VersionResult::VersionResult()
       : CommandResult(CmdName, TargetId)
@@ -61,7 +67,7 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["Version"])
+          && parse_json<std::string>::is_valid(field(VersionField))
         ;
 
     }
@@ -77,12 +83,12 @@ namespace Sdx
 
     std::string VersionResult::version() const
     {
-      return parse_json<std::string>::parse(m_values["Version"]);
+      return fieldValue<std::string>(VersionField);
     }
 
     void VersionResult::setVersion(const std::string& version)
     {
-      m_values.AddMember("Version", parse_json<std::string>::format(version, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(VersionField, parse_json<std::string>::format(version, m_values.GetAllocator()));
     }
 
 
@@ -40,6 +40,13 @@ namespace Sdx
     REGISTER_COMMAND_TO_FACTORY_DECL(WaitSimulatorState);
     REGISTER_COMMAND_TO_FACTORY_IMPL(WaitSimulatorState);
 
+    namespace
+    {
+      // Fields of WaitSimulatorState, indices in fieldNames()
+      constexpr std::size_t StateField = 0;
+      constexpr std::size_t FailureStateField = 1;
+    }
+
 
     WaitSimulatorState::WaitSimulatorState()
       : CommandBase(CmdName, TargetId)
@@ -67,8 +74,8 @@ namespace Sdx
     {
       
         return m_values.IsObject()
-          && parse_json<std::string>::is_valid(m_values["State"])
-          && parse_json<std::string>::is_valid(m_values["FailureState"])
+          && parse_json<std::string>::is_valid(field(StateField))
+          && parse_json<std::string>::is_valid(field(FailureStateField))
         ;
 
     }
@@ -90,24 +97,24 @@ namespace Sdx
 
     std::string WaitSimulatorState::state() const
     {
-      return parse_json<std::string>::parse(m_values["State"]);
+      return fieldValue<std::string>(StateField);
     }
 
     void WaitSimulatorState::setState(const std::string& state)
     {
-      m_values.AddMember("State", parse_json<std::string>::format(state, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(StateField, parse_json<std::string>::format(state, m_values.GetAllocator()));
     }
 
 
 
     std::string WaitSimulatorState::failureState() const
     {
-      return parse_json<std::string>::parse(m_values["FailureState"]);
+      return fieldValue<std::string>(FailureStateField);
     }
 
     void WaitSimulatorState::setFailureState(const std::string& failureState)
     {
-      m_values.AddMember("FailureState", parse_json<std::string>::format(failureState, m_values.GetAllocator()), m_values.GetAllocator());
+      setField(FailureStateField, parse_json<std::string>::format(failureState, m_values.GetAllocator()));
     }
 
 
@@ -0,0 +1,50 @@
+#include "hil_batch.h"
+
+#include <algorithm>
+
+namespace Sdx
+{
+
+HilBatch::HilBatch() : m_offsets(1, 0), m_elapsedTime(0.0)
+{
+}
+
+bool HilBatch::add(const HilSample& sample, const std::string& name)
+{
+  char* buffer = reserve(static_cast<int>(name.size()));
+  return commit(sample, HilClient::encode(sample, name, buffer));
+}
+
+bool HilBatch::add(const HilSample& sample, const HilEncodedName& name)
+{
+  char* buffer = reserve(name.size());
+  return commit(sample, HilClient::encode(sample, name, buffer));
+}
+
+void HilBatch::clear()
+{
+  m_offsets.resize(1);
+  m_elapsedTimes.clear();
+  m_elapsedTime = 0.0;
+}
+
+char* HilBatch::reserve(int nameSize)
+{
+  const std::size_t size = static_cast<std::size_t>(m_offsets.back() + HilClient::MaxPushSize + nameSize);
+  if (m_buffer.size() < size)
+    m_buffer.resize(std::max(size, 2 * m_buffer.size()));
+  return m_buffer.data() + m_offsets.back();
+}
+
+bool HilBatch::commit(const HilSample& sample, int messageSize)
+{
+  if (messageSize == 0)
+    return false;
+
+  m_elapsedTime = empty() ? sample.elapsedTime : std::max(m_elapsedTime, sample.elapsedTime);
+  m_offsets.push_back(m_offsets.back() + messageSize);
+  m_elapsedTimes.push_back(sample.elapsedTime);
+  return true;
+}
+
+} // namespace Sdx
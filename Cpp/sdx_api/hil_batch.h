@@ -0,0 +1,49 @@
+#ifndef HIL_BATCH_H
+#define HIL_BATCH_H
+
+#include <string>
+#include <vector>
+
+#include "hil_client.h"
+
+namespace Sdx
+{
+
+//
+// Push messages of one tick, usually one per emitter, sent together by HilClient::push(const HilBatch&).
+//
+// The messages are encoded as they are added, in the wire format of the single pushes. Clearing the batch keeps its
+// memory, so a batch reused from tick to tick doesn't allocate.
+//
+class HilBatch
+{
+public:
+  HilBatch();
+
+  // Returns false if the dynamics order of the sample is invalid
+  bool add(const HilSample& sample, const std::string& name = "");
+  bool add(const HilSample& sample, const HilEncodedName& name);
+  void clear();
+
+  inline bool empty() const { return m_offsets.size() == 1; }
+  inline int size() const { return static_cast<int>(m_offsets.size()) - 1; }
+  inline const char* message(int i) const { return m_buffer.data() + m_offsets[i]; }
+  inline int messageSize(int i) const { return m_offsets[i + 1] - m_offsets[i]; }
+  inline double elapsedTime(int i) const { return m_elapsedTimes[i]; }
+
+  // Latest elapsed time of the samples, in milliseconds
+  inline double elapsedTime() const { return m_elapsedTime; }
+
+private:
+  char* reserve(int nameSize);
+  bool commit(const HilSample& sample, int messageSize);
+
+  std::vector<char> m_buffer;
+  std::vector<int> m_offsets;
+  std::vector<double> m_elapsedTimes;
+  double m_elapsedTime;
+};
+
+} // namespace Sdx
+
+#endif // HIL_BATCH_H
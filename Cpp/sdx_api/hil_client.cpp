@@ -18,11 +18,21 @@
 #include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
 #include <cstring>
 #include <iostream>
+#include <thread>
+#include <vector>
 
 #include "ecef.h"
+#include "hil_batch.h"
+#include "hil_dynamics_estimator.h"
+#include "hil_latency.h"
 #include "vehicle_info.h"
+#include "vehicle_info_feed.h"
 
 #define HIL_BLOCK_SIZE 255
 
@@ -38,9 +48,23 @@ struct HilClient::Pimpl
   struct sockaddr_in servAddr;
   bool connected;
   char message[HIL_BLOCK_SIZE];
+  int received = 0;
+  std::vector<char> sendBuffer; // only grows with the names, so the pushes don't allocate
   bool stopRequest;
   bool exceptionOnError;
   bool verbose;
+
+  std::unique_ptr<VehicleInfoFeed> feed;
+  std::thread receiver;
+  std::atomic<bool> stopReceiver {false};
+  std::atomic<bool> receiverFailed {false};
+  uint64_t nextInfo = 0; // index in the feed of the next vehicle info returned by recvNextVehicleInfo
+
+  int64_t receivedTimeNs = 0; // reception time of message
+  std::unique_ptr<HilLatency> latency; // created once, kept until destruction so other threads can use it
+  std::atomic<bool> latencyEnabled {false};
+
+  std::unique_ptr<HilDynamicsEstimator> estimator;
 };
 
 HilClient::HilClient(bool exceptionOnError) : m(new Pimpl)
@@ -50,6 +74,7 @@ HilClient::HilClient(bool exceptionOnError) : m(new Pimpl)
   m->connected = false;
   m->exceptionOnError = exceptionOnError;
   m->verbose = false;
+  m->sendBuffer.resize(MaxPushSize + HIL_BLOCK_SIZE);
 #if _WIN32
   WORD versionWanted = MAKEWORD(2, 0);
   WSADATA wsaData;
@@ -114,6 +139,12 @@ bool HilClient::connectToHost(const std::string& ip, int port)
   }
   m->connected = true;
 
+#ifdef __linux__
+  // Reception times from the kernel, the client falls back to its own time if this fails
+  int enabled = 1;
+  setsockopt(m->s, SOL_SOCKET, SO_TIMESTAMPNS, &enabled, sizeof(enabled));
+#endif
+
   // Send Hello
   char message = static_cast<char>(HilMsgId_Hello);
   return sendMessage(&message, 1);
@@ -133,6 +164,8 @@ bool HilClient::isConnected() const
   return m->connected;
 }
 
+namespace
+{
 template<typename T>
 void append(char*& ptr, const T& value)
 {
@@ -154,40 +187,278 @@ void append(char*& ptr, const Attitude& attitude)
   append(ptr, attitude.roll);
 }
 
-bool HilClient::pushEcef(double elapsedTime, const Ecef& position, const std::string& name)
+int64_t systemTimeNs()
+{
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+#ifdef __linux__
+// Space for the SO_TIMESTAMPNS control message
+const std::size_t ControlSize = CMSG_SPACE(sizeof(struct timespec));
+
+// Kernel reception time of a datagram, or the current time if it's missing
+int64_t receptionTimeNs(struct msghdr& header)
+{
+  for (struct cmsghdr* cmsg = CMSG_FIRSTHDR(&header); cmsg; cmsg = CMSG_NXTHDR(&header, cmsg))
+  {
+    if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_TIMESTAMPNS)
+    {
+      struct timespec ts;
+      memcpy(&ts, CMSG_DATA(cmsg), sizeof(ts));
+      return static_cast<int64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+    }
+  }
+  return systemTimeNs();
+}
+#endif
+
+// Waits until the socket is readable, returns -1 on error, 0 on timeout
+int waitReadable(int s, int timeout)
 {
-  auto size = 37 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
+#if _WIN32
+  fd_set fds;
+  struct timeval tv;
+
+  // Set up the file descriptor set.
+  FD_ZERO(&fds);
+  FD_SET(s, &fds);
+
+  // Set up the struct timeval for the timeout.
+  tv.tv_sec = 0;
+  tv.tv_usec = timeout * 1000;
+
+  // Wait until timeout or data received.
+  return select(s, &fds, NULL, NULL, &tv);
+#else
+  struct pollfd fd;
+
+  fd.fd = s;
+  fd.events = POLLIN;
+  return poll(&fd, 1, timeout);
+#endif
+}
+
+bool decodeVehicleInfo(const char* message, int size, VehicleInfo& simStats)
+{
+  if (size < 81 || message[0] != static_cast<char>(HilMsgId_VehicleInfo))
+    return false;
+
+  memcpy(&simStats.elapsedTime, &message[1], 8);
+  memcpy(&simStats.ecef, &message[9], 24);
+  memcpy(&simStats.attitude, &message[33], 24);
+  memcpy(&simStats.speed, &message[57], 8);
+  memcpy(&simStats.heading, &message[65], 8);
+  memcpy(&simStats.odometer, &message[73], 8);
+  return true;
+}
+
+// Everything but the name, returns nullptr if the dynamics order is invalid
+char* encodeBody(const HilSample& sample, char* buffer)
+{
+  if (sample.dynamicsOrder < 0 || sample.dynamicsOrder > 3)
+    return nullptr;
+
+  const Ecef* dynamics[] = {&sample.velocity, &sample.acceleration, &sample.jerk};
+  const Attitude* angularDynamics[] = {&sample.angularVelocity, &sample.angularAcceleration, &sample.angularJerk};
+
+  char* ptr = buffer;
+  if (sample.dynamicsOrder == 0)
+  {
+    append(ptr, static_cast<char>(sample.hasAttitude ? HilMsgId_PushEcefNed : HilMsgId_PushEcef)); // 1 bytes
+  }
+  else
+  {
+    append(ptr, static_cast<char>(sample.hasAttitude ? HilMsgId_PushEcefNedDynamics : HilMsgId_PushEcefDynamics));
+    append(ptr, static_cast<char>(sample.dynamicsOrder - 1)); // 1 bytes, HilDynamics
+  }
+  append(ptr, sample.elapsedTime); // 8 bytes
+  append(ptr, sample.position);    // 24 bytes
+  if (sample.hasAttitude)
+    append(ptr, sample.attitude); // 24 bytes
+
+  // 24 or 48 bytes per order
+  for (int i = 0; i < sample.dynamicsOrder; ++i)
+  {
+    append(ptr, *dynamics[i]);
+    if (sample.hasAttitude)
+      append(ptr, *angularDynamics[i]);
+  }
+  return ptr;
+}
+} // namespace
+
+HilEncodedName::HilEncodedName(const std::string& name) : m_name(name)
+{
+  const auto size = static_cast<unsigned int>(name.size());
+  m_encoded.resize(sizeof(size) + name.size());
+  memcpy(&m_encoded[0], &size, sizeof(size));
+  memcpy(&m_encoded[sizeof(size)], name.data(), name.size());
+}
+
+int HilClient::encode(const HilSample& sample, const HilEncodedName& name, char* buffer)
+{
+  char* ptr = encodeBody(sample, buffer);
+  if (!ptr)
+    return 0;
+
+  memcpy(ptr, name.data(), name.size());
+  return static_cast<int>(ptr - buffer) + name.size();
+}
+
+int HilClient::encode(const HilSample& sample, const std::string& name, char* buffer)
+{
+  char* ptr = encodeBody(sample, buffer);
+  if (!ptr)
+    return 0;
 
-  append(ptr, static_cast<char>(HilMsgId_PushEcef));   // 1 bytes
-  append(ptr, elapsedTime);                            // 8 bytes
-  append(ptr, position);                               // 24 bytes
   append(ptr, static_cast<unsigned int>(name.size())); // 4 bytes
+  memcpy(ptr, name.data(), name.size());
+  return static_cast<int>(ptr - buffer) + static_cast<int>(name.size());
+}
 
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+bool HilClient::push(const HilSample& sample, const std::string& name)
+{
+  if (m->estimator)
+    return pushEstimated(m->estimator->estimate(sample, name), name);
+  return pushEstimated(sample, name);
 }
 
-bool HilClient::pushEcef(double elapsedTime, const Ecef& position, const Ecef& velocity, const std::string& name)
+bool HilClient::pushEstimated(const HilSample& sample, const std::string& name)
+{
+  char* buffer = sendBuffer(static_cast<int>(name.size()));
+  const int size = encode(sample, name, buffer);
+  if (size == 0)
+  {
+    errorMessage("Invalid HIL dynamics order.");
+    return false;
+  }
+  if (!sendMessage(buffer, size))
+    return false;
+  recordPush(sample.elapsedTime);
+  return true;
+}
+
+bool HilClient::push(const HilSample& sample, const HilEncodedName& name)
+{
+  char* buffer = sendBuffer(name.size());
+  const int size = m->estimator ? encode(m->estimator->estimate(sample, name.name()), name, buffer)
+                                : encode(sample, name, buffer);
+  if (size == 0)
+  {
+    errorMessage("Invalid HIL dynamics order.");
+    return false;
+  }
+  if (!sendMessage(buffer, size))
+    return false;
+  recordPush(sample.elapsedTime);
+  return true;
+}
+
+bool HilClient::push(const HilBatch& batch)
+{
+  if (!m->connected)
+    return false;
+
+#ifdef __linux__
+  // Datagrams of one sendmmsg call, kept on the stack
+  const int MaxChunkSize = 64;
+  struct mmsghdr headers[MaxChunkSize];
+  struct iovec vectors[MaxChunkSize];
+
+  int sent = 0;
+  while (sent < batch.size())
+  {
+    const int chunkSize = std::min(MaxChunkSize, batch.size() - sent);
+    memset(headers, 0, sizeof(headers[0]) * chunkSize);
+    for (int i = 0; i < chunkSize; ++i)
+    {
+      vectors[i].iov_base = const_cast<char*>(batch.message(sent + i));
+      vectors[i].iov_len = static_cast<size_t>(batch.messageSize(sent + i));
+      headers[i].msg_hdr.msg_iov = &vectors[i];
+      headers[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    const int count = sendmmsg(m->s, headers, static_cast<unsigned int>(chunkSize), 0);
+    if (count <= 0)
+    {
+      errorMessage("Error sending message.");
+      return false;
+    }
+    for (int i = 0; i < count; ++i)
+      recordPush(batch.elapsedTime(sent + i));
+    sent += count;
+  }
+#else
+  for (int i = 0; i < batch.size(); ++i)
+  {
+    if (!sendMessage(batch.message(i), batch.messageSize(i)))
+      return false;
+    recordPush(batch.elapsedTime(i));
+  }
+#endif
+
+  return true;
+}
+
+void HilClient::setDynamicsEstimation(int maxOrder)
+{
+  if (maxOrder <= 0)
+    m->estimator.reset();
+  else
+    m->estimator = std::make_unique<HilDynamicsEstimator>(maxOrder);
+}
+
+int HilClient::dynamicsEstimation() const
+{
+  return m->estimator ? m->estimator->maxOrder() : 0;
+}
+
+void HilClient::setLatencyTrackingEnabled(bool enabled)
+{
+  if (enabled && !m->latency)
+    m->latency = std::make_unique<HilLatency>();
+  m->latencyEnabled.store(enabled, std::memory_order_release);
+}
+
+bool HilClient::isLatencyTrackingEnabled() const
+{
+  return m->latencyEnabled.load();
+}
+
+const HilLatency* HilClient::latency() const
+{
+  return m->latency.get();
+}
+
+void HilClient::recordPush(double elapsedTime)
 {
-  auto size = 62 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
+  if (m->latencyEnabled.load(std::memory_order_acquire))
+    m->latency->recordPush(elapsedTime, systemTimeNs());
+}
+
+void HilClient::recordVehicleInfo(const VehicleInfo& vehicleInfo)
+{
+  if (m->latencyEnabled.load(std::memory_order_acquire))
+    m->latency->recordVehicleInfo(vehicleInfo);
+}
 
-  append(ptr, static_cast<char>(HilMsgId_PushEcefDynamics)); // 1 bytes
-  append(ptr, static_cast<char>(HilDynamics::Velocity));     // 1 bytes
-  append(ptr, elapsedTime);                                  // 8 bytes
-  append(ptr, position);                                     // 24 bytes
-  append(ptr, velocity);                                     // 24 bytes
-  append(ptr, static_cast<unsigned int>(name.size()));       // 4 bytes
+bool HilClient::pushEcef(double elapsedTime, const Ecef& position, const std::string& name)
+{
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.position = position;
+  return push(sample, name);
+}
 
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+bool HilClient::pushEcef(double elapsedTime, const Ecef& position, const Ecef& velocity, const std::string& name)
+{
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.dynamicsOrder = 1;
+  sample.position = position;
+  sample.velocity = velocity;
+  return push(sample, name);
 }
 
 bool HilClient::pushEcef(double elapsedTime,
@@ -196,22 +467,13 @@ bool HilClient::pushEcef(double elapsedTime,
                          const Ecef& acceleration,
                          const std::string& name)
 {
-  auto size = 86 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
-
-  append(ptr, static_cast<char>(HilMsgId_PushEcefDynamics)); // 1 bytes
-  append(ptr, static_cast<char>(HilDynamics::Acceleration)); // 1 bytes
-  append(ptr, elapsedTime);                                  // 8 bytes
-  append(ptr, position);                                     // 24 bytes
-  append(ptr, velocity);                                     // 24 bytes
-  append(ptr, acceleration);                                 // 24 bytes
-  append(ptr, static_cast<unsigned int>(name.size()));       // 4 bytes
-
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.dynamicsOrder = 2;
+  sample.position = position;
+  sample.velocity = velocity;
+  sample.acceleration = acceleration;
+  return push(sample, name);
 }
 
 bool HilClient::pushEcef(double elapsedTime,
@@ -221,41 +483,24 @@ bool HilClient::pushEcef(double elapsedTime,
                          const Ecef& jerk,
                          const std::string& name)
 {
-  auto size = 110 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
-
-  append(ptr, static_cast<char>(HilMsgId_PushEcefDynamics)); // 1 bytes
-  append(ptr, static_cast<char>(HilDynamics::Jerk));         // 1 bytes
-  append(ptr, elapsedTime);                                  // 8 bytes
-  append(ptr, position);                                     // 24 bytes
-  append(ptr, velocity);                                     // 24 bytes
-  append(ptr, acceleration);                                 // 24 bytes
-  append(ptr, jerk);                                         // 24 bytes
-  append(ptr, static_cast<unsigned int>(name.size()));       // 4 bytes
-
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.dynamicsOrder = 3;
+  sample.position = position;
+  sample.velocity = velocity;
+  sample.acceleration = acceleration;
+  sample.jerk = jerk;
+  return push(sample, name);
 }
 
 bool HilClient::pushEcefNed(double elapsedTime, const Ecef& position, const Attitude& attitude, const std::string& name)
 {
-  auto size = 61 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
-
-  append(ptr, static_cast<char>(HilMsgId_PushEcefNed)); // 1 bytes
-  append(ptr, elapsedTime);                             // 8 bytes
-  append(ptr, position);                                // 24 bytes
-  append(ptr, attitude);                                // 24 bytes
-  append(ptr, static_cast<unsigned int>(name.size()));  // 4 bytes
-
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.hasAttitude = true;
+  sample.position = position;
+  sample.attitude = attitude;
+  return push(sample, name);
 }
 
 bool HilClient::pushEcefNed(double elapsedTime,
@@ -265,23 +510,15 @@ bool HilClient::pushEcefNed(double elapsedTime,
                             const Attitude& angularVelocity,
                             const std::string& name)
 {
-  auto size = 110 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
-
-  append(ptr, static_cast<char>(HilMsgId_PushEcefNedDynamics)); // 1 bytes
-  append(ptr, static_cast<char>(HilDynamics::Velocity));        // 1 bytes
-  append(ptr, elapsedTime);                                     // 8 bytes
-  append(ptr, position);                                        // 24 bytes
-  append(ptr, attitude);                                        // 24 bytes
-  append(ptr, velocity);                                        // 24 bytes
-  append(ptr, angularVelocity);                                 // 24 bytes
-  append(ptr, static_cast<unsigned int>(name.size()));          // 4 bytes
-
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.hasAttitude = true;
+  sample.dynamicsOrder = 1;
+  sample.position = position;
+  sample.attitude = attitude;
+  sample.velocity = velocity;
+  sample.angularVelocity = angularVelocity;
+  return push(sample, name);
 }
 
 bool HilClient::pushEcefNed(double elapsedTime,
@@ -293,25 +530,17 @@ bool HilClient::pushEcefNed(double elapsedTime,
                             const Attitude& angularAcceleration,
                             const std::string& name)
 {
-  auto size = 158 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
-
-  append(ptr, static_cast<char>(HilMsgId_PushEcefNedDynamics)); // 1 bytes
-  append(ptr, static_cast<char>(HilDynamics::Acceleration));    // 1 bytes
-  append(ptr, elapsedTime);                                     // 8 bytes
-  append(ptr, position);                                        // 24 bytes
-  append(ptr, attitude);                                        // 24 bytes
-  append(ptr, velocity);                                        // 24 bytes
-  append(ptr, angularVelocity);                                 // 24 bytes
-  append(ptr, acceleration);                                    // 24 bytes
-  append(ptr, angularAcceleration);                             // 24 bytes
-  append(ptr, static_cast<unsigned int>(name.size()));          // 4 bytes
-
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.hasAttitude = true;
+  sample.dynamicsOrder = 2;
+  sample.position = position;
+  sample.attitude = attitude;
+  sample.velocity = velocity;
+  sample.angularVelocity = angularVelocity;
+  sample.acceleration = acceleration;
+  sample.angularAcceleration = angularAcceleration;
+  return push(sample, name);
 }
 
 bool HilClient::pushEcefNed(double elapsedTime,
@@ -325,55 +554,27 @@ bool HilClient::pushEcefNed(double elapsedTime,
                             const Attitude& angularJerk,
                             const std::string& name)
 {
-  auto size = 206 + static_cast<int>(name.size());
-  char* message = new char[size];
-  char* ptr = message;
-
-  append(ptr, static_cast<char>(HilMsgId_PushEcefNedDynamics)); // 1 bytes
-  append(ptr, static_cast<char>(HilDynamics::Jerk));            // 1 bytes
-  append(ptr, elapsedTime);                                     // 8 bytes
-  append(ptr, position);                                        // 24 bytes
-  append(ptr, attitude);                                        // 24 bytes
-  append(ptr, velocity);                                        // 24 bytes
-  append(ptr, angularVelocity);                                 // 24 bytes
-  append(ptr, acceleration);                                    // 24 bytes
-  append(ptr, angularAcceleration);                             // 24 bytes
-  append(ptr, jerk);                                            // 24 bytes
-  append(ptr, angularJerk);                                     // 24 bytes
-  append(ptr, static_cast<unsigned int>(name.size()));          // 4 bytes
-
-  memcpy(ptr, name.c_str(), name.size());
-  bool result = sendMessage(message, size);
-  delete[] message;
-  return result;
+  HilSample sample;
+  sample.elapsedTime = elapsedTime;
+  sample.hasAttitude = true;
+  sample.dynamicsOrder = 3;
+  sample.position = position;
+  sample.attitude = attitude;
+  sample.velocity = velocity;
+  sample.angularVelocity = angularVelocity;
+  sample.acceleration = acceleration;
+  sample.angularAcceleration = angularAcceleration;
+  sample.jerk = jerk;
+  sample.angularJerk = angularJerk;
+  return push(sample, name);
 }
 
 bool HilClient::hasRecvVehicleInfo(int timeout, bool errorAtTimeout)
 {
-  int ret;
-#if _WIN32
-  fd_set fds;
-  struct timeval tv;
-
-  // Set up the file descriptor set.
-  FD_ZERO(&fds);
-  FD_SET(m->s, &fds);
-
-  // Set up the struct timeval for the timeout.
-  tv.tv_sec = 0;
-  tv.tv_usec = timeout * 1000;
+  if (m->feed)
+    return waitVehicleInfoFeed(timeout, errorAtTimeout);
 
-  // Wait until timeout or data received.
-  ret = select(m->s, &fds, NULL, NULL, &tv);
-#else
-  struct pollfd fd;
-
-  fd.fd = m->s;
-  fd.events = POLLIN;
-  ret = poll(&fd, 1, timeout);
-#endif
-
-  switch (ret)
+  switch (waitReadable(m->s, timeout))
   {
     case -1:
       errorMessage("Error while receiving vehicle info");
@@ -391,6 +592,12 @@ bool HilClient::hasRecvVehicleInfo(int timeout, bool errorAtTimeout)
 
 void HilClient::clearVehicleInfo()
 {
+  if (m->feed)
+  {
+    m->nextInfo = m->feed->count();
+    return;
+  }
+
   while (hasRecvVehicleInfo(0, false))
   {
     if (!receiveMessage())
@@ -401,6 +608,15 @@ void HilClient::clearVehicleInfo()
 bool HilClient::recvLastVehicleInfo(VehicleInfo& simStats)
 {
   // Client expects LastVehicleInfo to be blocking. We block for 10s max.
+  if (m->feed)
+  {
+    if (!waitVehicleInfoFeed(10000, true))
+      return false;
+
+    m->nextInfo = m->feed->count();
+    return m->feed->at(m->nextInfo - 1, simStats) || m->feed->latest(simStats);
+  }
+
   if (hasRecvVehicleInfo(10000))
   {
     do
@@ -416,6 +632,21 @@ bool HilClient::recvLastVehicleInfo(VehicleInfo& simStats)
 
 bool HilClient::recvNextVehicleInfo(VehicleInfo& simStats)
 {
+  if (m->feed)
+  {
+    if (!waitVehicleInfoFeed(200, true))
+      return false;
+
+    // Skips what was already overwritten in the history
+    while (!m->feed->at(m->nextInfo, simStats))
+    {
+      const uint64_t count = m->feed->count();
+      m->nextInfo = std::max(m->nextInfo, count - std::min<uint64_t>(count, m->feed->historySize()));
+    }
+    ++m->nextInfo;
+    return true;
+  }
+
   if (hasRecvVehicleInfo(200))
   {
     if (receiveMessage())
@@ -424,21 +655,132 @@ bool HilClient::recvNextVehicleInfo(VehicleInfo& simStats)
   return false;
 }
 
-bool HilClient::recvVehicleInfo(VehicleInfo& simStats)
+bool HilClient::waitVehicleInfoFeed(int timeout, bool errorAtTimeout)
 {
-  if (m->message[0] == static_cast<char>(HilMsgId_VehicleInfo))
+  const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+  while (m->feed->count() <= m->nextInfo)
   {
-    memcpy(&simStats.elapsedTime, &m->message[1], 8);
-    memcpy(&simStats.ecef, &m->message[9], 24);
-    memcpy(&simStats.attitude, &m->message[33], 24);
-    memcpy(&simStats.speed, &m->message[57], 8);
-    memcpy(&simStats.heading, &m->message[65], 8);
-    memcpy(&simStats.odometer, &m->message[73], 8);
+    if (m->receiverFailed.load())
+    {
+      errorMessage("Error while receiving vehicle info");
+      return false;
+    }
+    if (std::chrono::steady_clock::now() >= deadline)
+    {
+      if (errorAtTimeout)
+        errorMessage(
+          "Failed to receive vehicle info. Is simulation running and beginVehicleInfo() called before start?");
+      return false;
+    }
+    std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+  return true;
+}
 
-    return true;
+void HilClient::startVehicleInfoReceiver(std::size_t historySize)
+{
+  if (m->feed || !m->connected)
+    return;
+
+  m->feed = std::make_unique<VehicleInfoFeed>(historySize);
+  m->nextInfo = 0;
+  m->stopReceiver.store(false);
+  m->receiverFailed.store(false);
+  m->receiver = std::thread(&HilClient::runVehicleInfoReceiver, this);
+}
+
+void HilClient::stopVehicleInfoReceiver()
+{
+  if (!m->feed)
+    return;
+
+  m->stopReceiver.store(true);
+  m->receiver.join();
+  m->feed.reset();
+}
+
+const VehicleInfoFeed* HilClient::vehicleInfoFeed() const
+{
+  return m->feed.get();
+}
+
+void HilClient::runVehicleInfoReceiver()
+{
+  // The poll timeout bounds the time stopVehicleInfoReceiver waits for this thread
+  const int StopCheckTimeout = 50;
+
+#ifdef __linux__
+  const int BurstSize = 32;
+  char buffers[BurstSize][HIL_BLOCK_SIZE];
+  alignas(struct cmsghdr) char controls[BurstSize][ControlSize];
+  struct mmsghdr headers[BurstSize];
+  struct iovec vectors[BurstSize];
+  memset(headers, 0, sizeof(headers));
+  for (int i = 0; i < BurstSize; ++i)
+  {
+    vectors[i].iov_base = buffers[i];
+    vectors[i].iov_len = HIL_BLOCK_SIZE;
+    headers[i].msg_hdr.msg_iov = &vectors[i];
+    headers[i].msg_hdr.msg_iovlen = 1;
+    headers[i].msg_hdr.msg_control = controls[i];
   }
+#endif
 
-  return false;
+  VehicleInfo info;
+  while (!m->stopReceiver.load())
+  {
+    const int ready = waitReadable(m->s, StopCheckTimeout);
+    if (ready == 0 || (ready < 0 && errno == EINTR))
+      continue;
+    if (ready < 0)
+      break;
+
+#ifdef __linux__
+    // The kernel shrinks the control lengths to what it wrote
+    for (int i = 0; i < BurstSize; ++i)
+      headers[i].msg_hdr.msg_controllen = ControlSize;
+
+    const int count = recvmmsg(m->s, headers, BurstSize, MSG_DONTWAIT, nullptr);
+    if (count < 0 && (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR))
+      continue;
+    if (count <= 0)
+      break;
+
+    for (int i = 0; i < count; ++i)
+    {
+      if (decodeVehicleInfo(buffers[i], static_cast<int>(headers[i].msg_len), info))
+      {
+        info.receiveTimeNs = receptionTimeNs(headers[i].msg_hdr);
+        recordVehicleInfo(info);
+        m->feed->publish(info);
+      }
+    }
+#else
+    char buffer[HIL_BLOCK_SIZE];
+    const int rx = recv(m->s, buffer, HIL_BLOCK_SIZE, 0);
+    if (rx <= 0)
+      break;
+    if (decodeVehicleInfo(buffer, rx, info))
+    {
+      info.receiveTimeNs = systemTimeNs();
+      recordVehicleInfo(info);
+      m->feed->publish(info);
+    }
+#endif
+  }
+
+  if (!m->stopReceiver.load())
+    m->receiverFailed.store(true);
+}
+
+bool HilClient::recvVehicleInfo(VehicleInfo& simStats)
+{
+  if (!decodeVehicleInfo(m->message, m->received, simStats))
+    return false;
+
+  simStats.receiveTimeNs = m->receivedTimeNs;
+  recordVehicleInfo(simStats);
+  return true;
 }
 
 void HilClient::disconnect()
@@ -446,6 +788,8 @@ void HilClient::disconnect()
   if (m->s < 0)
     return;
 
+  stopVehicleInfoReceiver();
+
   // Send Bye
   char message = static_cast<char>(HilMsgId_Bye);
   sendMessage(&message, 1);
@@ -473,9 +817,35 @@ bool HilClient::sendMessage(const char* message, int length)
   return true;
 }
 
+char* HilClient::sendBuffer(int nameSize)
+{
+  const std::size_t size = static_cast<std::size_t>(MaxPushSize + nameSize);
+  if (m->sendBuffer.size() < size)
+    m->sendBuffer.resize(size);
+  return m->sendBuffer.data();
+}
+
 bool HilClient::receiveMessage()
 {
+#ifdef __linux__
+  alignas(struct cmsghdr) char control[ControlSize];
+  struct iovec vector;
+  vector.iov_base = m->message;
+  vector.iov_len = HIL_BLOCK_SIZE;
+  struct msghdr header;
+  memset(&header, 0, sizeof(header));
+  header.msg_iov = &vector;
+  header.msg_iovlen = 1;
+  header.msg_control = control;
+  header.msg_controllen = ControlSize;
+
+  int rx = static_cast<int>(recvmsg(m->s, &header, 0));
+  m->receivedTimeNs = rx > 0 ? receptionTimeNs(header) : 0;
+#else
   int rx = recv(m->s, m->message, HIL_BLOCK_SIZE, 0);
+  m->receivedTimeNs = systemTimeNs();
+#endif
+  m->received = rx;
   if (rx <= 0)
   {
     errorMessage("Error while receiving udp message");
@@ -1,11 +1,15 @@
 #ifndef HIL_CLIENT_H
 #define HIL_CLIENT_H
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
 
+#include "attitude.h"
+#include "ecef.h"
+
 namespace Sdx
 {
 
@@ -46,12 +50,54 @@ struct HilMessageEcefNed
   double roll;
 };
 
-class Ecef;
-class Attitude;
+// A timed sample of a trajectory, which holds any of the push messages. The dynamics are sent up to dynamicsOrder
+// (0 for the position only, 1 up to the velocity, 2 up to the acceleration and 3 up to the jerk), the angular
+// dynamics only when hasAttitude is set.
+struct HilSample
+{
+  double elapsedTime = 0.0; // ms
+  bool hasAttitude = false;
+  int dynamicsOrder = 0;
+  Ecef position;
+  Attitude attitude;
+  Ecef velocity;
+  Attitude angularVelocity;
+  Ecef acceleration;
+  Attitude angularAcceleration;
+  Ecef jerk;
+  Attitude angularJerk;
+};
+
+// Name of a vehicle, encoded once in the wire format of the push messages (size followed by the characters)
+class HilEncodedName
+{
+public:
+  HilEncodedName(const std::string& name = "");
+
+  inline const std::string& name() const { return m_name; }
+  inline const char* data() const { return m_encoded.data(); }
+  inline int size() const { return static_cast<int>(m_encoded.size()); }
+
+private:
+  std::string m_name;
+  std::string m_encoded;
+};
+
+class HilBatch;
+class HilDynamicsEstimator;
+class HilLatency;
+class VehicleInfoFeed;
 struct VehicleInfo;
 class HilClient
 {
 public:
+  // Size of the largest push message, without the characters of the name
+  static constexpr int MaxPushSize = 206;
+
+  // Encodes a push message in buffer, which must hold MaxPushSize + name.size() bytes. Returns the message size.
+  static int encode(const HilSample& sample, const HilEncodedName& name, char* buffer);
+  static int encode(const HilSample& sample, const std::string& name, char* buffer);
+
   HilClient(bool exceptionOnError = true);
   virtual ~HilClient(void);
 
@@ -217,6 +263,20 @@ public:
                            const Attitude& angularJerk,
                            const std::string& name = "");
 
+  // Send Skydel any of the push messages. The pushEcef and pushEcefNed functions are shorthands for this one.
+  virtual bool push(const HilSample& sample, const std::string& name = "");
+  virtual bool push(const HilSample& sample, const HilEncodedName& name);
+
+  // Estimates the dynamics of the pushes which don't carry any from the previous positions of the same vehicle (see
+  // HilDynamicsEstimator), so Skydel gets the dynamics variant of the messages and extrapolates better. maxOrder is 1
+  // (velocity) to 3 (jerk), 0 (default) disables the estimation. Batches aren't estimated, their samples are encoded
+  // when added.
+  void setDynamicsEstimation(int maxOrder);
+  int dynamicsEstimation() const;
+
+  // Send Skydel all the messages of a batch. On Linux, they go out with as few system calls as possible (sendmmsg).
+  virtual bool push(const HilBatch& batch);
+
   void disconnect();
 
   bool hasRecvVehicleInfo(int timeout, bool errorAtTimeout = true);
@@ -224,14 +284,33 @@ public:
   bool recvNextVehicleInfo(VehicleInfo& vehicleInfo);
   void clearVehicleInfo();
 
+  // Receives the vehicle infos from a background thread, draining bursts of datagrams at once (recvmmsg on Linux).
+  // The latest vehicle info and the last historySize ones are then read from vehicleInfoFeed() without system calls,
+  // and the functions above read from the feed instead of the socket.
+  void startVehicleInfoReceiver(std::size_t historySize = 1024);
+  void stopVehicleInfoReceiver();
+  const VehicleInfoFeed* vehicleInfoFeed() const; // nullptr while the receiver is stopped
+
+  // Records the send time of every push and matches it with the reception time of the vehicle info with the same
+  // elapsed time, to measure the HIL loop latency. Needs the vehicle infos (beginVehicleInfo), received either way.
+  void setLatencyTrackingEnabled(bool enabled);
+  bool isLatencyTrackingEnabled() const;
+  const HilLatency* latency() const; // nullptr until the tracking is enabled once
+
 private:
   struct Pimpl;
   Pimpl* m;
 
   bool recvVehicleInfo(VehicleInfo& vehicleInfo);
+  bool waitVehicleInfoFeed(int timeout, bool errorAtTimeout);
+  void runVehicleInfoReceiver();
+  void recordPush(double elapsedTime);
+  void recordVehicleInfo(const VehicleInfo& vehicleInfo);
   void errorMessage(const std::string& msg);
   bool receiveMessage();
   bool sendMessage(const char* message, int length);
+  bool pushEstimated(const HilSample& sample, const std::string& name);
+  char* sendBuffer(int nameSize);
 };
 
 } // namespace Sdx
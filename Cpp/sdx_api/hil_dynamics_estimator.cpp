@@ -0,0 +1,144 @@
+#include "hil_dynamics_estimator.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace Sdx
+{
+
+namespace
+{
+const double PI = 3.14159265358979323846;
+
+// Angle closest to previous which is equivalent to angle
+double unwrap(double angle, double previous)
+{
+  return previous + std::remainder(angle - previous, 2.0 * PI);
+}
+
+// Derivatives at t[0] of the polynomial going through the first count values, newest first
+void derivatives(const double* t, const double* values, int count, double* result)
+{
+  // Divided differences, f[i] ends up as f[t0, ..., ti]
+  double f[4];
+  std::copy(values, values + count, f);
+  for (int level = 1; level < count; ++level)
+  {
+    for (int i = count - 1; i >= level; --i)
+      f[i] = (f[i] - f[i - 1]) / (t[i] - t[i - level]);
+  }
+
+  const double d1 = count > 1 ? t[0] - t[1] : 0.0;
+  const double d2 = count > 2 ? t[0] - t[2] : 0.0;
+  result[0] = (count > 1 ? f[1] : 0.0) + (count > 2 ? f[2] * d1 : 0.0) + (count > 3 ? f[3] * d1 * d2 : 0.0);
+  result[1] = (count > 2 ? 2.0 * f[2] : 0.0) + (count > 3 ? 2.0 * f[3] * (d1 + d2) : 0.0);
+  result[2] = count > 3 ? 6.0 * f[3] : 0.0;
+}
+
+template<typename T>
+void estimateComponent(const double* t, const T* const* points, int count, double T::*member, T* dynamics[3])
+{
+  double values[4];
+  for (int i = 0; i < count; ++i)
+    values[i] = (*points[i]).*member;
+
+  double result[3];
+  derivatives(t, values, count, result);
+  for (int order = 0; order < 3; ++order)
+    dynamics[order]->*member = result[order];
+}
+} // namespace
+
+HilDynamicsEstimator::HilDynamicsEstimator(int maxOrder, double maxGapMs) :
+  m_maxOrder(std::clamp(maxOrder, 1, 3)),
+  m_maxGapMs(maxGapMs)
+{
+}
+
+HilSample HilDynamicsEstimator::estimate(const HilSample& sample, std::string_view name)
+{
+  History& history = historyOf(name);
+  Point point {sample.elapsedTime / 1000.0, sample.position, sample.attitude};
+
+  if (history.count > 0)
+  {
+    const double gapMs = (point.time - history.points[0].time) * 1000.0;
+    if (gapMs < 0.0 || gapMs > m_maxGapMs || history.hasAttitude != sample.hasAttitude)
+    {
+      history.count = 0;
+    }
+    else if (gapMs == 0.0)
+    {
+      // Same time, replaces the newest point
+      std::copy(history.points + 1, history.points + history.count, history.points);
+      --history.count;
+    }
+  }
+
+  if (history.count > 0 && sample.hasAttitude)
+  {
+    const Attitude& previous = history.points[0].attitude;
+    point.attitude = Attitude(unwrap(sample.attitude.yaw, previous.yaw),
+                              unwrap(sample.attitude.pitch, previous.pitch),
+                              unwrap(sample.attitude.roll, previous.roll));
+  }
+
+  const int kept = std::min(history.count, 3);
+  std::copy_backward(history.points, history.points + kept, history.points + kept + 1);
+  history.points[0] = point;
+  history.count = std::min(history.count + 1, m_maxOrder + 1);
+  history.hasAttitude = sample.hasAttitude;
+
+  if (sample.dynamicsOrder > 0 || history.count < 2)
+    return sample;
+
+  double t[4];
+  const Ecef* positions[4];
+  const Attitude* attitudes[4];
+  for (int i = 0; i < history.count; ++i)
+  {
+    t[i] = history.points[i].time;
+    positions[i] = &history.points[i].position;
+    attitudes[i] = &history.points[i].attitude;
+  }
+
+  HilSample estimated = sample;
+  estimated.dynamicsOrder = history.count - 1;
+
+  Ecef* dynamics[3] = {&estimated.velocity, &estimated.acceleration, &estimated.jerk};
+  estimateComponent(t, positions, history.count, &Ecef::x, dynamics);
+  estimateComponent(t, positions, history.count, &Ecef::y, dynamics);
+  estimateComponent(t, positions, history.count, &Ecef::z, dynamics);
+
+  if (sample.hasAttitude)
+  {
+    Attitude* angularDynamics[3] = {&estimated.angularVelocity,
+                                    &estimated.angularAcceleration,
+                                    &estimated.angularJerk};
+    estimateComponent(t, attitudes, history.count, &Attitude::yaw, angularDynamics);
+    estimateComponent(t, attitudes, history.count, &Attitude::pitch, angularDynamics);
+    estimateComponent(t, attitudes, history.count, &Attitude::roll, angularDynamics);
+  }
+  return estimated;
+}
+
+void HilDynamicsEstimator::reset()
+{
+  m_histories.clear();
+}
+
+void HilDynamicsEstimator::reset(std::string_view name)
+{
+  if (auto it = m_histories.find(name); it != m_histories.end())
+    m_histories.erase(it);
+}
+
+HilDynamicsEstimator::History& HilDynamicsEstimator::historyOf(std::string_view name)
+{
+  // The key is only built for a new vehicle
+  if (auto it = m_histories.find(name); it != m_histories.end())
+    return it->second;
+  return m_histories.emplace(name, History()).first->second;
+}
+
+} // namespace Sdx
@@ -0,0 +1,69 @@
+#ifndef HIL_DYNAMICS_ESTIMATOR_H
+#define HIL_DYNAMICS_ESTIMATOR_H
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "hil_client.h"
+
+namespace Sdx
+{
+
+//
+// Estimates the dynamics of HIL samples from the previous positions of the same vehicle.
+//
+// A polynomial goes through the last maxOrder + 1 samples of each vehicle (Newton divided differences, the samples
+// don't need to be evenly spaced) and its derivatives at the newest sample give the velocity, acceleration and jerk.
+// The attitude is unwrapped first, so the angular dynamics stay continuous across ±pi.
+//
+// HilClient uses it for its pushes with setDynamicsEstimation, it can also fill samples added to a HilBatch.
+//
+class HilDynamicsEstimator
+{
+public:
+  // maxOrder is 1 (velocity) to 3 (jerk). History older than maxGapMs before a sample is forgotten.
+  explicit HilDynamicsEstimator(int maxOrder = 2, double maxGapMs = 1000.0);
+
+  inline int maxOrder() const { return m_maxOrder; }
+
+  // Returns the sample with its dynamics filled up to the order the history allows. Samples which already carry
+  // dynamics are only recorded.
+  HilSample estimate(const HilSample& sample, std::string_view name = {});
+
+  void reset();
+  void reset(std::string_view name);
+
+private:
+  struct Point
+  {
+    double time; // s
+    Ecef position;
+    Attitude attitude; // unwrapped
+  };
+
+  struct History
+  {
+    Point points[4]; // newest first
+    int count = 0;
+    bool hasAttitude = false;
+  };
+
+  // Hashes names and views alike, so looking up a known vehicle doesn't build a key
+  struct NameHash
+  {
+    using is_transparent = void;
+    inline std::size_t operator()(std::string_view name) const { return std::hash<std::string_view>()(name); }
+  };
+
+  History& historyOf(std::string_view name);
+
+  int m_maxOrder;
+  double m_maxGapMs;
+  std::unordered_map<std::string, History, NameHash, std::equal_to<>> m_histories;
+};
+
+} // namespace Sdx
+
+#endif // HIL_DYNAMICS_ESTIMATOR_H
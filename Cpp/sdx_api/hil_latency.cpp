@@ -0,0 +1,93 @@
+#include "hil_latency.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include "vehicle_info.h"
+
+namespace Sdx
+{
+
+HilLatency::HilLatency(std::size_t pushHistory) :
+  m_pushes(std::bit_ceil(pushHistory < 1 ? std::size_t(1) : pushHistory)),
+  m_mask(m_pushes.size() - 1)
+{
+}
+
+void HilLatency::recordPush(double elapsedTime, int64_t sendTimeNs)
+{
+  if (elapsedTime < 0.0)
+    return;
+
+  // Vehicle infos carry whole milliseconds
+  const auto key = static_cast<uint64_t>(std::llround(elapsedTime));
+  m_pushes[key & m_mask].store({key, sendTimeNs});
+}
+
+void HilLatency::recordVehicleInfo(const VehicleInfo& info)
+{
+  Push push;
+  if (info.receiveTimeNs == 0 || !m_pushes[info.elapsedTime & m_mask].load(push) ||
+      push.elapsedTime != info.elapsedTime)
+    return;
+
+  const int64_t latencyNs = info.receiveTimeNs - push.sendTimeNs;
+  const double latencyMs = static_cast<double>(latencyNs) / 1e6;
+  const int bucket = std::clamp(static_cast<int>(latencyMs / BucketWidthMs), 0, BucketCount - 1);
+
+  m_buckets[bucket].fetch_add(1, std::memory_order_relaxed);
+  if (latencyNs < m_minNs.load(std::memory_order_relaxed))
+    m_minNs.store(latencyNs, std::memory_order_relaxed);
+  if (latencyNs > m_maxNs.load(std::memory_order_relaxed))
+    m_maxNs.store(latencyNs, std::memory_order_relaxed);
+  m_sumMs.fetch_add(latencyMs, std::memory_order_relaxed);
+  m_sumSquaresMs.fetch_add(latencyMs * latencyMs, std::memory_order_relaxed);
+  m_count.fetch_add(1, std::memory_order_release);
+}
+
+HilLatencyStats HilLatency::stats() const
+{
+  HilLatencyStats stats;
+  stats.count = m_count.load(std::memory_order_acquire);
+  if (stats.count == 0)
+    return stats;
+
+  const double count = static_cast<double>(stats.count);
+  stats.minMs = static_cast<double>(m_minNs.load(std::memory_order_relaxed)) / 1e6;
+  stats.maxMs = static_cast<double>(m_maxNs.load(std::memory_order_relaxed)) / 1e6;
+  stats.meanMs = m_sumMs.load(std::memory_order_relaxed) / count;
+  const double variance = m_sumSquaresMs.load(std::memory_order_relaxed) / count - stats.meanMs * stats.meanMs;
+  stats.jitterMs = std::sqrt(std::max(variance, 0.0));
+  return stats;
+}
+
+double HilLatency::percentileMs(double percentile) const
+{
+  const std::vector<uint64_t> buckets = histogram();
+  uint64_t total = 0;
+  for (uint64_t count : buckets)
+    total += count;
+  if (total == 0)
+    return 0.0;
+
+  const double rank = std::clamp(percentile, 0.0, 100.0) / 100.0 * static_cast<double>(total);
+  uint64_t seen = 0;
+  for (int i = 0; i < BucketCount; ++i)
+  {
+    seen += buckets[i];
+    if (static_cast<double>(seen) >= rank && seen > 0)
+      return (i + 1) * BucketWidthMs;
+  }
+  return BucketCount * BucketWidthMs;
+}
+
+std::vector<uint64_t> HilLatency::histogram() const
+{
+  std::vector<uint64_t> buckets(BucketCount);
+  for (int i = 0; i < BucketCount; ++i)
+    buckets[i] = m_buckets[i].load(std::memory_order_relaxed);
+  return buckets;
+}
+
+} // namespace Sdx
@@ -0,0 +1,68 @@
+#ifndef HIL_LATENCY_H
+#define HIL_LATENCY_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "seqlock.h"
+
+namespace Sdx
+{
+
+struct VehicleInfo;
+
+struct HilLatencyStats
+{
+  uint64_t count = 0; // vehicle infos matched with a push
+  double minMs = 0.0;
+  double maxMs = 0.0;
+  double meanMs = 0.0;
+  double jitterMs = 0.0; // standard deviation
+};
+
+//
+// HIL loop latency: time from the push of a position to the reception of the vehicle info with the same elapsed
+// time. Both times are system times, the reception one comes from the kernel when available (SO_TIMESTAMPNS).
+//
+// Pushes are recorded by the pushing thread and vehicle infos by the receiving thread, the statistics can be read from
+// any thread.
+//
+class HilLatency
+{
+public:
+  static constexpr int BucketCount = 1000;
+  static constexpr double BucketWidthMs = 0.1; // the last bucket holds everything above 99.9 ms
+
+  // pushHistory is the number of recent pushes a vehicle info can be matched with, rounded up to a power of two
+  explicit HilLatency(std::size_t pushHistory = 4096);
+
+  void recordPush(double elapsedTime, int64_t sendTimeNs);
+  void recordVehicleInfo(const VehicleInfo& info);
+
+  HilLatencyStats stats() const;
+  double percentileMs(double percentile) const; // from the histogram, with the bucket resolution
+  std::vector<uint64_t> histogram() const;
+
+private:
+  struct Push
+  {
+    uint64_t elapsedTime; // ms
+    int64_t sendTimeNs;
+  };
+
+  std::vector<SeqLock<Push>> m_pushes;
+  const std::size_t m_mask;
+
+  std::atomic<uint64_t> m_buckets[BucketCount] = {};
+  std::atomic<uint64_t> m_count {0};
+  std::atomic<int64_t> m_minNs {INT64_MAX};
+  std::atomic<int64_t> m_maxNs {INT64_MIN};
+  std::atomic<double> m_sumMs {0.0};
+  std::atomic<double> m_sumSquaresMs {0.0};
+};
+
+} // namespace Sdx
+
+#endif // HIL_LATENCY_H
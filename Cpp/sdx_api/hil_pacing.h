@@ -0,0 +1,80 @@
+#ifndef HIL_PACING_H
+#define HIL_PACING_H
+
+#ifndef _WIN32
+#include <time.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <thread>
+
+namespace Sdx
+{
+
+//
+// Absolute-time pacing of the HIL senders (HilStreamer, HilScheduler): a sleep on the monotonic clock until shortly
+// before the deadline, then a spin for the rest.
+//
+namespace HilPacing
+{
+// CLOCK_MONOTONIC on Linux, which is the clock given to clock_nanosleep
+using Clock = std::chrono::steady_clock;
+
+// Longest single sleep, so a stop request is noticed even when the deadline is far away
+const Clock::duration MaxSleep = std::chrono::milliseconds(10);
+
+inline Clock::duration toDuration(double ms)
+{
+  return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::milli>(ms));
+}
+
+// Converts a system time in milliseconds, like getCurrentTimeMs in hil_helper.h, once to the monotonic clock. Later
+// changes of the system time don't affect the pacing.
+inline Clock::time_point fromSystemTimeMs(double systemTimeMs)
+{
+  const double systemNowMs =
+    std::chrono::duration<double, std::milli>(std::chrono::system_clock::now().time_since_epoch()).count();
+  return Clock::now() + toDuration(systemTimeMs - systemNowMs);
+}
+
+inline void sleepUntil(Clock::time_point deadline)
+{
+#ifdef _WIN32
+  std::this_thread::sleep_until(deadline);
+#else
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+  timespec ts;
+  ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+  ts.tv_nsec = static_cast<long>(ns % 1000000000);
+  while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR)
+  {
+  }
+#endif
+}
+
+// Waits until deadline, spinning for its last spinDuration. Returns the time it returned at, or returns early if
+// running turns false.
+inline Clock::time_point waitUntil(Clock::time_point deadline,
+                                   Clock::duration spinDuration,
+                                   const std::atomic<bool>& running)
+{
+  Clock::time_point now = Clock::now();
+  const Clock::time_point wakeUp = deadline - spinDuration;
+  while (now < wakeUp && running.load(std::memory_order_relaxed))
+  {
+    sleepUntil(std::min(wakeUp, now + MaxSleep));
+    now = Clock::now();
+  }
+
+  while (now < deadline && running.load(std::memory_order_relaxed))
+    now = Clock::now();
+  return now;
+}
+} // namespace HilPacing
+
+} // namespace Sdx
+
+#endif // HIL_PACING_H
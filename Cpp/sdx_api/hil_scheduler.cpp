@@ -0,0 +1,194 @@
+#include "hil_scheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+#include "hil_batch.h"
+#include "hil_dynamics_estimator.h"
+#include "hil_pacing.h"
+
+namespace Sdx
+{
+
+namespace
+{
+using Clock = HilPacing::Clock;
+
+struct Emitter
+{
+  HilEncodedName name;
+  int64_t periodTicks;
+  HilScheduler::Trajectory trajectory;
+};
+
+// Next tick of an emitter, the heap keeps the earliest on top
+struct Due
+{
+  int64_t tick;
+  int emitter;
+
+  bool operator>(const Due& other) const
+  {
+    return tick != other.tick ? tick > other.tick : emitter > other.emitter;
+  }
+};
+} // namespace
+
+struct HilScheduler::Pimpl
+{
+  Pimpl(HilClient& client, double gridMs) : client(client), gridMs(gridMs) {}
+
+  HilClient& client;
+  const double gridMs;
+  std::vector<Emitter> emitters;
+  std::vector<Due> dues;
+  HilBatch batch;
+  std::unique_ptr<HilDynamicsEstimator> estimator;
+  Clock::duration spinDuration = std::chrono::microseconds(200);
+  Clock::duration leadTime = Clock::duration::zero();
+  std::atomic<bool> keepRunning {true}; // Cleared by stop(), rearmed when run() returns
+
+  std::atomic<uint64_t> ticks {0};
+  std::atomic<uint64_t> samples {0};
+  std::atomic<uint64_t> late {0};
+  std::atomic<uint64_t> errors {0};
+  std::atomic<int64_t> maxLatenessNs {0};
+};
+
+HilScheduler::HilScheduler(HilClient& client, double gridMs) : m(std::make_unique<Pimpl>(client, gridMs))
+{
+  if (!(gridMs > 0.0))
+    throw std::invalid_argument("The HIL scheduler grid must be positive.");
+}
+
+HilScheduler::~HilScheduler() = default;
+
+int HilScheduler::addEmitter(const std::string& name, double rateHz, Trajectory trajectory, double phaseMs)
+{
+  if (!(rateHz > 0.0))
+    throw std::invalid_argument("The rate of an HIL emitter must be positive.");
+  if (!trajectory)
+    throw std::invalid_argument("An HIL emitter needs a trajectory.");
+
+  const int index = static_cast<int>(m->emitters.size());
+  const int64_t periodTicks = std::max<int64_t>(1, std::llround(1000.0 / (rateHz * m->gridMs)));
+  const int64_t firstTick = std::max<int64_t>(0, std::llround(phaseMs / m->gridMs));
+  m->emitters.push_back({HilEncodedName(name), periodTicks, std::move(trajectory)});
+  m->dues.push_back({firstTick, index});
+  std::push_heap(m->dues.begin(), m->dues.end(), std::greater<Due>());
+  return index;
+}
+
+int HilScheduler::emitterCount() const
+{
+  return static_cast<int>(m->emitters.size());
+}
+
+void HilScheduler::setSpinDuration(std::chrono::nanoseconds spinDuration)
+{
+  m->spinDuration = std::chrono::duration_cast<Clock::duration>(spinDuration);
+}
+
+void HilScheduler::setLeadTime(double leadTimeMs)
+{
+  m->leadTime = HilPacing::toDuration(leadTimeMs);
+}
+
+void HilScheduler::setDynamicsEstimation(int maxOrder)
+{
+  if (maxOrder <= 0)
+    m->estimator.reset();
+  else
+    m->estimator = std::make_unique<HilDynamicsEstimator>(maxOrder);
+}
+
+bool HilScheduler::run(double simulationStartMs, double durationMs)
+{
+  const Clock::time_point simulationStart = HilPacing::fromSystemTimeMs(simulationStartMs);
+  const auto lastTick = static_cast<int64_t>(std::floor(durationMs / m->gridMs));
+
+  while (!m->dues.empty() && m->dues.front().tick <= lastTick)
+  {
+    const int64_t tick = m->dues.front().tick;
+    const Clock::time_point target = simulationStart + HilPacing::toDuration(tick * m->gridMs) - m->leadTime;
+    const Clock::time_point now = Clock::now();
+    if (now > target)
+    {
+      m->late.fetch_add(1, std::memory_order_relaxed);
+      const int64_t latenessNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - target).count();
+      if (latenessNs > m->maxLatenessNs.load(std::memory_order_relaxed))
+        m->maxLatenessNs.store(latenessNs, std::memory_order_relaxed);
+    }
+    else
+    {
+      HilPacing::waitUntil(target, m->spinDuration, m->keepRunning);
+    }
+
+    if (!m->keepRunning.load(std::memory_order_relaxed))
+      break;
+    sendTick(tick);
+  }
+
+  return m->keepRunning.exchange(true);
+}
+
+bool HilScheduler::sendDue(double elapsedTime)
+{
+  const auto tick = static_cast<int64_t>(std::floor(elapsedTime / m->gridMs + 1e-9));
+  if (m->dues.empty() || m->dues.front().tick > tick)
+    return true;
+  return sendTick(tick);
+}
+
+void HilScheduler::stop()
+{
+  m->keepRunning.store(false);
+}
+
+HilSchedulerStats HilScheduler::stats() const
+{
+  HilSchedulerStats stats;
+  stats.ticks = m->ticks.load(std::memory_order_relaxed);
+  stats.samples = m->samples.load(std::memory_order_relaxed);
+  stats.late = m->late.load(std::memory_order_relaxed);
+  stats.errors = m->errors.load(std::memory_order_relaxed);
+  stats.maxLatenessMs = static_cast<double>(m->maxLatenessNs.load(std::memory_order_relaxed)) / 1e6;
+  return stats;
+}
+
+bool HilScheduler::sendTick(int64_t tick)
+{
+  m->batch.clear();
+  while (!m->dues.empty() && m->dues.front().tick <= tick)
+  {
+    std::pop_heap(m->dues.begin(), m->dues.end(), std::greater<Due>());
+    Due& due = m->dues.back();
+    Emitter& emitter = m->emitters[due.emitter];
+
+    // An emitter left behind only sends its latest sample
+    due.tick += (tick - due.tick) / emitter.periodTicks * emitter.periodTicks;
+
+    HilSample sample = emitter.trajectory(due.tick * m->gridMs);
+    sample.elapsedTime = due.tick * m->gridMs;
+    if (m->estimator)
+      sample = m->estimator->estimate(sample, emitter.name.name());
+    m->batch.add(sample, emitter.name);
+
+    due.tick += emitter.periodTicks;
+    std::push_heap(m->dues.begin(), m->dues.end(), std::greater<Due>());
+  }
+
+  m->ticks.fetch_add(1, std::memory_order_relaxed);
+  if (!m->client.push(m->batch))
+  {
+    m->errors.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+  m->samples.fetch_add(static_cast<uint64_t>(m->batch.size()), std::memory_order_relaxed);
+  return true;
+}
+
+} // namespace Sdx
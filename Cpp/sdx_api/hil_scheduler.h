@@ -0,0 +1,81 @@
+#ifndef HIL_SCHEDULER_H
+#define HIL_SCHEDULER_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "hil_client.h"
+
+namespace Sdx
+{
+
+struct HilSchedulerStats
+{
+  uint64_t ticks = 0;   // grid ticks with at least one emitter due
+  uint64_t samples = 0; // samples sent
+  uint64_t late = 0;    // ticks started after their time
+  uint64_t errors = 0;  // ticks whose batch failed to be sent
+  double maxLatenessMs = 0.0;
+};
+
+//
+// Pushes the trajectories of many emitters (the vehicle, and the jammers' and spoofers' vehicles in HIL mode) through
+// one HilClient.
+//
+// Every emitter has its own rate, rounded to a multiple of the shared time grid. At each tick of the grid, the samples
+// of the emitters due are generated, encoded in a HilBatch and sent with one system call. Ticks without any emitter due
+// are skipped, and nothing is allocated once running.
+//
+//  HilScheduler scheduler(hilClient);
+//  scheduler.addEmitter("", 100.0, [&](double elapsedTime) { return vehicleSample(elapsedTime); });
+//  scheduler.addEmitter("jammer1", 10.0, [&](double elapsedTime) { return jammerSample(elapsedTime); });
+//  scheduler.run(simStartTimestampMs, 60000.0);
+//
+class HilScheduler
+{
+public:
+  // Returns the sample of an emitter at elapsedTime (ms), the scheduler sets its elapsed time
+  using Trajectory = std::function<HilSample(double elapsedTime)>;
+
+  explicit HilScheduler(HilClient& client, double gridMs = 1.0);
+  ~HilScheduler();
+
+  HilScheduler(const HilScheduler&) = delete;
+  HilScheduler& operator=(const HilScheduler&) = delete;
+
+  // The emitters and the options are set before run(). The name is empty for the vehicle, or the ID of the jammer or
+  // spoofer. phaseMs delays the first sample of the emitter, to spread the emitters sharing a rate over the grid.
+  int addEmitter(const std::string& name, double rateHz, Trajectory trajectory, double phaseMs = 0.0);
+  int emitterCount() const;
+
+  void setSpinDuration(std::chrono::nanoseconds spinDuration);
+  void setLeadTime(double leadTimeMs); // sends the samples ahead of their elapsed time
+  void setDynamicsEstimation(int maxOrder); // see HilDynamicsEstimator, 0 (default) disables it
+
+  // Sends the samples on the calling thread, paced on the monotonic clock, from elapsed time 0 until durationMs or
+  // stop(). simulationStartMs is the system time at the beginning of the simulation, as with preciseSleepUntilMs in
+  // hil_helper.h. Returns false if it was stopped.
+  bool run(double simulationStartMs, double durationMs);
+
+  // Sends the samples of every emitter due at or before elapsedTime right away, for applications with their own loop.
+  // Returns false if the batch couldn't be sent.
+  bool sendDue(double elapsedTime);
+
+  // Thread safe, makes run() return. If run() isn't running yet, the next run() returns false without sending.
+  void stop();
+
+  HilSchedulerStats stats() const;
+
+private:
+  struct Pimpl;
+  std::unique_ptr<Pimpl> m;
+
+  bool sendTick(int64_t tick);
+};
+
+} // namespace Sdx
+
+#endif // HIL_SCHEDULER_H
@@ -0,0 +1,224 @@
+#include "hil_streamer.h"
+
+#ifndef _WIN32
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "hil_pacing.h"
+#include "spsc_ring.h"
+
+namespace Sdx
+{
+
+namespace
+{
+using Clock = HilPacing::Clock;
+using HilPacing::toDuration;
+
+struct QueuedSample
+{
+  HilSample sample;
+  int emitter = 0;
+};
+} // namespace
+
+struct HilStreamer::Pimpl
+{
+  Pimpl(HilClient& client, std::size_t capacity) : client(client), ring(capacity) {}
+
+  HilClient& client;
+  SpscRing<QueuedSample> ring;
+  std::vector<HilEncodedName> emitters;
+  int cpu = -1;
+  Clock::duration spinDuration = std::chrono::microseconds(200);
+  Clock::duration leadTime = Clock::duration::zero();
+  Clock::time_point simulationStart;
+  std::thread thread;
+  std::atomic<bool> running {false};
+
+  // The sender thread sets waiting before it sleeps on wakeups, the producer only wakes it up then
+  std::atomic<bool> waiting {false};
+  std::atomic<uint32_t> wakeups {0};
+
+  std::atomic<uint64_t> sent {0};
+  std::atomic<uint64_t> dropped {0};
+  std::atomic<uint64_t> late {0};
+  std::atomic<uint64_t> errors {0};
+  std::atomic<int64_t> totalJitterNs {0};
+  std::atomic<int64_t> maxJitterNs {0};
+};
+
+HilStreamer::HilStreamer(HilClient& client, std::size_t capacity) : m(std::make_unique<Pimpl>(client, capacity))
+{
+  m->emitters.emplace_back("");
+}
+
+HilStreamer::~HilStreamer()
+{
+  stop();
+}
+
+int HilStreamer::addEmitter(const std::string& name)
+{
+  if (isRunning())
+    throw std::runtime_error("Cannot add an emitter while the HIL streamer is running.");
+
+  m->emitters.emplace_back(name);
+  return static_cast<int>(m->emitters.size()) - 1;
+}
+
+void HilStreamer::setCpu(int cpu)
+{
+  m->cpu = cpu;
+}
+
+void HilStreamer::setSpinDuration(std::chrono::nanoseconds spinDuration)
+{
+  m->spinDuration = std::chrono::duration_cast<Clock::duration>(spinDuration);
+}
+
+void HilStreamer::setLeadTime(double leadTimeMs)
+{
+  m->leadTime = toDuration(leadTimeMs);
+}
+
+void HilStreamer::start(double simulationStartMs)
+{
+  if (isRunning())
+    throw std::runtime_error("The HIL streamer is already running.");
+
+  m->simulationStart = HilPacing::fromSystemTimeMs(simulationStartMs);
+
+  m->running.store(true);
+  m->thread = std::thread(&HilStreamer::run, this);
+
+#ifdef __linux__
+  if (m->cpu >= 0)
+  {
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(m->cpu, &cpus);
+    if (pthread_setaffinity_np(m->thread.native_handle(), sizeof(cpus), &cpus) != 0)
+    {
+      stop();
+      throw std::runtime_error("Unable to pin the HIL streamer thread to CPU " + std::to_string(m->cpu) + ".");
+    }
+  }
+#endif
+}
+
+void HilStreamer::stop()
+{
+  if (!m->thread.joinable())
+    return;
+
+  m->running.store(false);
+  m->wakeups.fetch_add(1);
+  m->wakeups.notify_one();
+  m->thread.join();
+
+  // The sender thread is gone, this thread can consume what's left
+  while (m->ring.front())
+    m->ring.pop();
+}
+
+bool HilStreamer::isRunning() const
+{
+  return m->running.load();
+}
+
+bool HilStreamer::push(const HilSample& sample, int emitter)
+{
+  if (emitter < 0 || emitter >= static_cast<int>(m->emitters.size()))
+    throw std::invalid_argument("Unknown HIL streamer emitter.");
+
+  if (!m->ring.tryPush({sample, emitter}))
+  {
+    m->dropped.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  // Pairs with the fence of the sender thread: either it sees the sample, or this thread sees it's waiting
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m->waiting.load(std::memory_order_relaxed))
+  {
+    m->wakeups.fetch_add(1);
+    m->wakeups.notify_one();
+  }
+  return true;
+}
+
+std::size_t HilStreamer::queued() const
+{
+  return m->ring.size();
+}
+
+HilStreamerStats HilStreamer::stats() const
+{
+  HilStreamerStats stats;
+  stats.sent = m->sent.load(std::memory_order_relaxed);
+  stats.dropped = m->dropped.load(std::memory_order_relaxed);
+  stats.late = m->late.load(std::memory_order_relaxed);
+  stats.errors = m->errors.load(std::memory_order_relaxed);
+
+  const uint64_t attempts = stats.sent + stats.errors;
+  if (attempts > 0)
+    stats.meanJitterUs = static_cast<double>(m->totalJitterNs.load(std::memory_order_relaxed)) / attempts / 1000.0;
+  stats.maxJitterUs = static_cast<double>(m->maxJitterNs.load(std::memory_order_relaxed)) / 1000.0;
+  return stats;
+}
+
+void HilStreamer::run()
+{
+  while (m->running.load(std::memory_order_relaxed))
+  {
+    QueuedSample* queued = m->ring.front();
+    if (!queued)
+    {
+      m->waiting.store(true, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      const uint32_t wakeups = m->wakeups.load(std::memory_order_relaxed);
+      if (!m->ring.front() && m->running.load(std::memory_order_relaxed))
+        m->wakeups.wait(wakeups);
+      m->waiting.store(false, std::memory_order_relaxed);
+      continue;
+    }
+
+    const Clock::time_point target = m->simulationStart + toDuration(queued->sample.elapsedTime) - m->leadTime;
+    Clock::time_point now = Clock::now();
+    if (now > target)
+    {
+      m->late.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+      now = HilPacing::waitUntil(target, m->spinDuration, m->running);
+      if (!m->running.load(std::memory_order_relaxed))
+        break;
+    }
+
+    const int64_t jitterNs = std::chrono::duration_cast<std::chrono::nanoseconds>(now - target).count();
+    m->totalJitterNs.fetch_add(jitterNs, std::memory_order_relaxed);
+    if (jitterNs > m->maxJitterNs.load(std::memory_order_relaxed))
+      m->maxJitterNs.store(jitterNs, std::memory_order_relaxed);
+
+    bool sent = false;
+    try
+    {
+      sent = m->client.push(queued->sample, m->emitters[queued->emitter]);
+    }
+    catch (const std::exception&)
+    {
+    }
+    (sent ? m->sent : m->errors).fetch_add(1, std::memory_order_relaxed);
+    m->ring.pop();
+  }
+}
+
+} // namespace Sdx
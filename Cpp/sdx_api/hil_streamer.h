@@ -0,0 +1,77 @@
+#ifndef HIL_STREAMER_H
+#define HIL_STREAMER_H
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "hil_client.h"
+
+namespace Sdx
+{
+
+struct HilStreamerStats
+{
+  uint64_t sent = 0;
+  uint64_t dropped = 0; // the ring was full
+  uint64_t late = 0;    // dequeued after their send time
+  uint64_t errors = 0;
+  double meanJitterUs = 0.0; // send time minus target time
+  double maxJitterUs = 0.0;
+};
+
+//
+// Sends HIL samples at their time from a dedicated thread.
+//
+// The producer thread queues timestamped samples in a lock-free ring and never blocks. The sender thread sleeps with
+// an absolute deadline on the monotonic clock until shortly before the time of each sample, spins for the rest, then
+// pushes it. Samples are sent in the order they are queued, which should be the order of their elapsed time.
+//
+//  HilStreamer streamer(hilClient);
+//  streamer.start(simStartTimestampMs);
+//  while (...)
+//    streamer.push(sample);
+//
+// While the streamer runs, nothing else should push through its HilClient.
+//
+class HilStreamer
+{
+public:
+  explicit HilStreamer(HilClient& client, std::size_t capacity = 1024);
+  ~HilStreamer();
+
+  HilStreamer(const HilStreamer&) = delete;
+  HilStreamer& operator=(const HilStreamer&) = delete;
+
+  // The emitters, the CPU, the spin duration and the lead time are set before start(). Emitter 0 is the vehicle, the
+  // others are the jammers' vehicles, by name.
+  int addEmitter(const std::string& name);
+  void setCpu(int cpu); // pins the sender thread, -1 (default) doesn't pin it
+  void setSpinDuration(std::chrono::nanoseconds spinDuration);
+  void setLeadTime(double leadTimeMs); // sends the samples ahead of their elapsed time
+
+  // simulationStartMs is the system time at the beginning of the simulation, as with preciseSleepUntilMs in
+  // hil_helper.h. It's converted once to the monotonic clock, so later changes of the system time don't affect pacing.
+  void start(double simulationStartMs);
+  // Stops the sender thread, the queued samples are discarded
+  void stop();
+  bool isRunning() const;
+
+  // Producer thread only. Returns false if the ring is full, the sample is then counted as dropped.
+  bool push(const HilSample& sample, int emitter = 0);
+  std::size_t queued() const;
+
+  HilStreamerStats stats() const;
+
+private:
+  struct Pimpl;
+  std::unique_ptr<Pimpl> m;
+
+  void run();
+};
+
+} // namespace Sdx
+
+#endif // HIL_STREAMER_H
@@ -0,0 +1,126 @@
+#include "json_arena.h"
+
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#define JSON_ARENA_BLOCK_SIZE 8192
+#define JSON_ARENA_MAX_POOLED_BLOCKS 256
+
+namespace Sdx
+{
+
+namespace
+{
+// The allocator object sits at the beginning of its block, followed by the buffer it allocates from
+const size_t AllocatorSize = (sizeof(JsonArena::Allocator) + alignof(std::max_align_t) - 1) &
+                             ~(alignof(std::max_align_t) - 1);
+const size_t BufferSize = JSON_ARENA_BLOCK_SIZE - AllocatorSize;
+} // namespace
+
+// Shared with the allocators drawn from it, which may be destroyed on other threads or after this thread has exited
+struct JsonArena::BlockPool
+{
+  ~BlockPool()
+  {
+    for (void* block : blocks)
+      std::free(block);
+  }
+
+  std::mutex mutex; // Guards blocks and stats, which other threads update when giving back a block
+  std::vector<void*> blocks;
+  JsonArenaStats stats {};
+  bool enabled = false;
+};
+
+namespace
+{
+const std::shared_ptr<JsonArena::BlockPool>& threadPool()
+{
+  thread_local std::shared_ptr<JsonArena::BlockPool> pool = std::make_shared<JsonArena::BlockPool>();
+  return pool;
+}
+
+JsonArena::BlockPool& pool()
+{
+  return *threadPool();
+}
+} // namespace
+
+void JsonArena::AllocatorDeleter::operator()(Allocator* allocator) const
+{
+  const bool overflowed = allocator->Capacity() > BufferSize;
+
+  // Extra chunks are freed here, the block itself goes back to the pool it was drawn from
+  allocator->~Allocator();
+  void* block = allocator;
+  if (std::shared_ptr<BlockPool> blockPool = pool.lock())
+  {
+    std::lock_guard<std::mutex> lock(blockPool->mutex);
+    if (overflowed)
+      ++blockPool->stats.overflows;
+    if (blockPool->blocks.size() < JSON_ARENA_MAX_POOLED_BLOCKS)
+    {
+      blockPool->blocks.push_back(block);
+      return;
+    }
+  }
+  std::free(block);
+}
+
+void JsonArena::setEnabled(bool enabled)
+{
+  pool().enabled = enabled;
+}
+
+bool JsonArena::isEnabled()
+{
+  return pool().enabled;
+}
+
+JsonArenaStats JsonArena::stats()
+{
+  BlockPool& blockPool = pool();
+  std::lock_guard<std::mutex> lock(blockPool.mutex);
+  return blockPool.stats;
+}
+
+void JsonArena::resetStats()
+{
+  BlockPool& blockPool = pool();
+  std::lock_guard<std::mutex> lock(blockPool.mutex);
+  blockPool.stats = JsonArenaStats {};
+}
+
+JsonArena::AllocatorPtr JsonArena::acquire()
+{
+  const std::shared_ptr<BlockPool>& blockPool = threadPool();
+  if (!blockPool->enabled)
+    return nullptr;
+
+  void* block = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(blockPool->mutex);
+    if (!blockPool->blocks.empty())
+    {
+      block = blockPool->blocks.back();
+      blockPool->blocks.pop_back();
+      ++blockPool->stats.reusedBlocks;
+    }
+    else
+      ++blockPool->stats.allocatedBlocks;
+  }
+
+  if (!block)
+  {
+    block = std::malloc(JSON_ARENA_BLOCK_SIZE);
+    if (!block)
+      throw std::bad_alloc();
+  }
+
+  char* buffer = static_cast<char*>(block) + AllocatorSize;
+  return AllocatorPtr(new (block) Allocator(buffer, BufferSize), AllocatorDeleter {blockPool});
+}
+
+} // namespace Sdx
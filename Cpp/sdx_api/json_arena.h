@@ -0,0 +1,54 @@
+#ifndef JSON_ARENA_H
+#define JSON_ARENA_H
+
+#include <rapidjson/document.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace Sdx
+{
+
+struct JsonArenaStats
+{
+  uint64_t allocatedBlocks; // Blocks taken from the heap
+  uint64_t reusedBlocks;    // Blocks recycled from the pool
+  uint64_t overflows;       // Documents which outgrew their block and allocated extra chunks
+};
+
+//
+// Opt-in, per-thread pool of memory blocks backing the JSON documents of commands and results.
+//
+// When enabled on a thread, every command or result created on this thread draws the first chunk of its document
+// allocator from the pool, and gives it back to this same pool when destroyed, on any thread. Once the pool is warm,
+// creating and destroying commands whose JSON fits in a block doesn't allocate chunks anymore, which the stats can
+// confirm.
+//
+class JsonArena
+{
+public:
+  using Allocator = rapidjson::MemoryPoolAllocator<>;
+  struct BlockPool;
+
+  struct AllocatorDeleter
+  {
+    void operator()(Allocator* allocator) const;
+
+    std::weak_ptr<BlockPool> pool; // Owning pool, the block is freed instead if its thread is gone
+  };
+  using AllocatorPtr = std::unique_ptr<Allocator, AllocatorDeleter>;
+
+  static void setEnabled(bool enabled);
+  static bool isEnabled();
+
+  // Counters of the calling thread
+  static JsonArenaStats stats();
+  static void resetStats();
+
+  // Returns an allocator backed by a pooled block, or nullptr if the arena is not enabled on this thread
+  static AllocatorPtr acquire();
+};
+
+} // namespace Sdx
+
+#endif // JSON_ARENA_H
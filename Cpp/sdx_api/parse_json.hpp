@@ -4,7 +4,11 @@
 
 #include <map>
 #include <optional>
+#include <cstddef>
+#include <iterator>
 #include <stdexcept>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 template<typename T>
@@ -94,14 +98,16 @@ struct parse_json<std::vector<T>>
     return true;
   }
 
+  // Elements validate themselves while they are parsed, the array is traversed once
   static std::vector<T> parse(const rapidjson::Value& value)
   {
-    std::vector<T> sent;
-
-    if (!is_valid(value))
+    if (!value.IsArray())
       throw std::runtime_error("Unexpected value");
+
+    std::vector<T> sent;
+    sent.reserve(value.Size());
     for (rapidjson::Value::ConstValueIterator itr = value.Begin(); itr != value.End(); ++itr)
-      sent.push_back(std::move(parse_json<T>::parse(*itr)));
+      sent.push_back(parse_json<T>::parse(*itr));
     return sent;
   }
 
@@ -141,14 +147,17 @@ struct parse_json<std::map<std::string, TValue>>
 
   static std::map<std::string, TValue> parse(const rapidjson::Value& value)
   {
-    if (!is_valid(value))
+    if (!value.IsObject())
       throw std::runtime_error("Unexpected value");
 
     std::map<std::string, TValue> sent;
 
     for (rapidjson::Value::ConstMemberIterator itr = value.MemberBegin(); itr != value.MemberEnd(); ++itr)
     {
-      sent.emplace(itr->name.GetString(), parse_json<TValue>::parse(itr->value));
+      sent.emplace_hint(sent.end(),
+                        std::piecewise_construct,
+                        std::forward_as_tuple(itr->name.GetString(), itr->name.GetStringLength()),
+                        std::forward_as_tuple(parse_json<TValue>::parse(itr->value)));
     }
 
     return sent;
@@ -192,3 +201,99 @@ struct parse_json<std::optional<T>>
     return sent;
   }
 };
+
+//
+// Read-only view over a JSON array. Elements are converted when they are accessed, nothing is copied or allocated.
+// Nested views read matrices in place:
+//
+//  json_array_view<json_array_view<double>> gains(cmd->value("Gain"));
+//  double gain = gains[row][column];
+//
+// The view refers to the document, it is only valid while the command holding it is alive and left unchanged.
+//
+template<typename T>
+class json_array_view
+{
+public:
+  class iterator
+  {
+  public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = T;
+
+    iterator() = default;
+    explicit iterator(const rapidjson::Value* element) : m_element(element) {}
+
+    T operator*() const { return parse_json<T>::parse(*m_element); }
+    T operator[](difference_type n) const { return parse_json<T>::parse(m_element[n]); }
+    iterator& operator++()
+    {
+      ++m_element;
+      return *this;
+    }
+    iterator operator++(int) { return iterator(m_element++); }
+    iterator& operator--()
+    {
+      --m_element;
+      return *this;
+    }
+    iterator operator--(int) { return iterator(m_element--); }
+    iterator& operator+=(difference_type n)
+    {
+      m_element += n;
+      return *this;
+    }
+    iterator& operator-=(difference_type n)
+    {
+      m_element -= n;
+      return *this;
+    }
+    friend iterator operator+(iterator it, difference_type n) { return it += n; }
+    friend iterator operator+(difference_type n, iterator it) { return it += n; }
+    friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+    friend difference_type operator-(const iterator& a, const iterator& b) { return a.m_element - b.m_element; }
+    friend auto operator<=>(const iterator& a, const iterator& b) = default;
+
+  private:
+    const rapidjson::Value* m_element = nullptr;
+  };
+
+  json_array_view() = default;
+
+  explicit json_array_view(const rapidjson::Value& value)
+  {
+    if (!value.IsArray())
+      throw std::runtime_error("Unexpected value");
+    m_begin = value.Begin();
+    m_size = value.Size();
+  }
+
+  std::size_t size() const { return m_size; }
+  bool empty() const { return m_size == 0; }
+  T operator[](std::size_t index) const { return parse_json<T>::parse(m_begin[index]); }
+  T at(std::size_t index) const
+  {
+    if (index >= m_size)
+      throw std::out_of_range("json_array_view index out of range");
+    return (*this)[index];
+  }
+
+  iterator begin() const { return iterator(m_begin); }
+  iterator end() const { return iterator(m_begin + m_size); }
+
+private:
+  const rapidjson::Value* m_begin = nullptr;
+  std::size_t m_size = 0;
+};
+
+// Arrays nested in a view are read as views
+template<typename T>
+struct parse_json<json_array_view<T>>
+{
+  static bool is_valid(const rapidjson::Value& value) { return parse_json<std::vector<T>>::is_valid(value); }
+
+  static json_array_view<T> parse(const rapidjson::Value& value) { return json_array_view<T>(value); }
+};
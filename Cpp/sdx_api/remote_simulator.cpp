@@ -9,8 +9,10 @@
 #include "cmd_client.h"
 #include "command_exception.h"
 #include "ecef.h"
+#include "hil_batch.h"
 #include "hil_client.h"
 #include "lla.h"
+#include "simulator_monitor.h"
 
 using namespace Sdx;
 
@@ -18,10 +20,13 @@ RemoteSimulator::RemoteSimulator(bool exceptionOnError) :
   m_exceptionOnError(exceptionOnError),
   m_client(0),
   m_hil(0),
+  m_monitor(0),
   m_verbose(false),
   m_hilStreamingCheckEnabled(true),
+  m_hilDynamicsEstimation(0),
   m_beginTrack(false),
   m_beginRoute(false),
+  m_batching(false),
   m_serverApiVersion(0)
 {
   resetTime();
@@ -33,11 +38,15 @@ RemoteSimulator::~RemoteSimulator()
   {
     disconnect();
   }
+  delete m_monitor;
 }
 
 void RemoteSimulator::resetTime()
 {
+  // The monitor is started again by the first push of the next simulation
   m_checkRunningTime = -999999999;
+  if (m_monitor)
+    m_monitor->stop();
 }
 
 bool RemoteSimulator::connect(const std::string& ip, int id, bool failIfApiVersionMismatch)
@@ -84,6 +93,7 @@ bool RemoteSimulator::connect(const std::string& ip, int id, bool failIfApiVersi
   delete m_hil;
   m_hil = new HilClient(m_exceptionOnError);
   m_hil->setVerbose(m_verbose);
+  m_hil->setDynamicsEstimation(m_hilDynamicsEstimation);
   if (!m_hil->connectToHost(m_client->address(), hilPort))
   {
     delete m_client;
@@ -100,6 +110,8 @@ void RemoteSimulator::disconnect()
 {
   if (isVerbose())
     std::cout << "Commands Client Disconnecting" << std::endl;
+  delete m_monitor;
+  m_monitor = 0;
   delete m_client;
   m_client = 0;
   delete m_hil;
@@ -170,6 +182,9 @@ bool RemoteSimulator::isVerbose() const
 
 void RemoteSimulator::setHilStreamingCheckEnabled(bool hilStreamingCheckEnabled)
 {
+  // Checks start over from the next push, which restarts the monitor if the check is enabled
+  if (hilStreamingCheckEnabled != m_hilStreamingCheckEnabled)
+    resetTime();
   m_hilStreamingCheckEnabled = hilStreamingCheckEnabled;
 }
 
@@ -178,6 +193,18 @@ bool RemoteSimulator::isHilStreamingCheckEnabled()
   return m_hilStreamingCheckEnabled;
 }
 
+void RemoteSimulator::setHilDynamicsEstimation(int maxOrder)
+{
+  m_hilDynamicsEstimation = maxOrder;
+  if (m_hil)
+    m_hil->setDynamicsEstimation(maxOrder);
+}
+
+int RemoteSimulator::hilDynamicsEstimation() const
+{
+  return m_hilDynamicsEstimation;
+}
+
 bool RemoteSimulator::arm()
 {
   if (isVerbose())
@@ -236,6 +263,7 @@ void RemoteSimulator::stop()
 void RemoteSimulator::stop(double timestamp)
 {
   resetTime();
+  checkNotBatching();
 
   CommandBasePtr stopCmd = postCommand(Cmd::Stop::create(), timestamp);
 
@@ -332,16 +360,27 @@ bool RemoteSimulator::waitState(const std::string& state, const std::string& fai
 bool RemoteSimulator::hilCheck(double elapsedTime)
 {
   if (m_checkRunningTime < 0.0)
+  {
     m_checkRunningTime = elapsedTime;
+    m_lastHilCheck = std::chrono::steady_clock::now();
+    if (m_hilStreamingCheckEnabled)
+    {
+      // Only starts a thread, the monitor connects from there
+      if (!m_monitor)
+        m_monitor = new SimulatorMonitor(m_client->address(), m_client->port());
+      m_monitor->start();
+    }
+  }
 
   if (elapsedTime - m_checkRunningTime >= 1000)
   {
     m_checkRunningTime = elapsedTime;
-    if (m_hilStreamingCheckEnabled && !checkIfStreaming())
+    if (m_hilStreamingCheckEnabled && !checkMonitoredState())
     {
       resetTime();
       return false;
     }
+    m_lastHilCheck = std::chrono::steady_clock::now();
     if (m_verbose)
       std::cout << "Position sent at " << elapsedTime << " ms" << std::endl;
   }
@@ -349,11 +388,50 @@ bool RemoteSimulator::hilCheck(double elapsedTime)
   return true;
 }
 
+bool RemoteSimulator::checkMonitoredState()
+{
+  if (!m_monitor)
+    return true;
+
+  // States polled before the previous check may predate the simulation start
+  const SimulatorMonitor::Status status = m_monitor->status();
+  if (status.polled < m_lastHilCheck || status.health == SimulatorMonitor::Health::Unknown ||
+      status.health == SimulatorMonitor::Health::Streaming)
+    return true;
+
+  const std::string errorMsg = m_monitor->errorMessage();
+  if (m_exceptionOnError)
+    throw std::runtime_error(errorMsg);
+
+  if (isVerbose())
+    std::cout << errorMsg << std::endl;
+  return false;
+}
+
 bool RemoteSimulator::hasVehicleInfo()
 {
   return m_hil->hasRecvVehicleInfo(0, false);
 }
 
+void RemoteSimulator::startVehicleInfoReceiver(std::size_t historySize)
+{
+  if (!m_hil)
+    throw std::runtime_error("Cannot receive vehicle info because you are not connected.");
+
+  m_hil->startVehicleInfoReceiver(historySize);
+}
+
+void RemoteSimulator::stopVehicleInfoReceiver()
+{
+  if (m_hil)
+    m_hil->stopVehicleInfoReceiver();
+}
+
+const VehicleInfoFeed* RemoteSimulator::vehicleInfoFeed() const
+{
+  return m_hil ? m_hil->vehicleInfoFeed() : nullptr;
+}
+
 CommandResultPtr RemoteSimulator::beginVehicleInfo()
 {
   return callCommand(Cmd::BeginVehicleInfo::create());
@@ -503,6 +581,81 @@ bool RemoteSimulator::pushLlaNed(double elapsedTime, const Lla& lla, const Attit
   return pushEcefNed(elapsedTime, ecef, attitude, name);
 }
 
+HilClient* RemoteSimulator::hilClient()
+{
+  return m_hil;
+}
+
+bool RemoteSimulator::push(const HilBatch& batch)
+{
+  if (!m_hil)
+    throw std::runtime_error("Cannot send position to simulator because you are not connected.");
+
+  if (batch.empty())
+    return true;
+
+  m_hil->push(batch);
+  return hilCheck(batch.elapsedTime());
+}
+
+void RemoteSimulator::beginBatch()
+{
+  if (m_batching)
+    throw std::runtime_error("A batch is already started. Call commitBatch first.");
+
+  m_batching = true;
+}
+
+CommandBatchResult RemoteSimulator::commitBatch()
+{
+  if (!m_batching)
+    throw std::runtime_error("You must call beginBatch first.");
+
+  m_batching = false;
+  std::vector<CommandBasePtr> batch;
+  batch.swap(m_batch);
+
+  if (isVerbose())
+    std::cout << "Commit batch of " << batch.size() << " commands" << std::endl;
+
+  CommandBatchResult batchResult;
+  if (!m_client || !m_client->sendCommands(batch))
+  {
+    batchResult.errorSummary = "Failed to send the batch of " + std::to_string(batch.size()) + " commands.";
+    return batchResult;
+  }
+
+  batchResult.results.reserve(batch.size());
+  for (const CommandBasePtr& cmd : batch)
+  {
+    // Every command is waited for, even after one of them couldn't be received
+    CommandResultPtr result;
+    try
+    {
+      result = m_client->waitCommand(cmd);
+    }
+    catch (const std::exception& e)
+    {
+      batchResult.errorSummary += cmd->name() + " failed: " + e.what() + "\n";
+      batchResult.results.push_back(nullptr);
+      continue;
+    }
+
+    if (!result->isSuccess())
+      batchResult.errorSummary += cmd->name() + " failed: " + result->message() + "\n";
+    batchResult.results.push_back(result);
+  }
+
+  if (isVerbose() && !batchResult.isSuccess())
+    std::cout << batchResult.errorSummary << std::flush;
+  return batchResult;
+}
+
+bool RemoteSimulator::isBatching() const
+{
+  return m_batching;
+}
+
 CommandResultPtr RemoteSimulator::beginTrackDefinition()
 {
   CommandResultPtr result = callCommand(Cmd::BeginTrackDefinition::create());
@@ -695,7 +848,10 @@ void RemoteSimulator::handleException(CommandResultPtr result)
     throw CommandException(result, errorMsg);
   }
   if (isVerbose() && !result->isSuccess())
-    std::cout << result->relatedCommand()->name() << " failed: " << result->message() << std::endl;
+  {
+    CommandBasePtr relatedCmd = result->relatedCommand();
+    std::cout << (relatedCmd ? relatedCmd->name() : "Unknown command") << " failed: " << result->message() << std::endl;
+  }
 }
 
 CommandBasePtr RemoteSimulator::post(CommandBasePtr cmd, double timestamp)
@@ -740,6 +896,7 @@ CommandResultPtr RemoteSimulator::wait(CommandBasePtr cmd)
 CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd, double timestamp)
 {
   checkForbiddenCall(cmd);
+  checkNotBatching();
   postCommand(cmd, timestamp);
   if (isVerbose())
     std::cout << "Call " << cmd->toReadableCommand() << " at " << timestamp << " secs" << std::flush;
@@ -752,6 +909,7 @@ CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd, double timestamp)
 CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp)
 {
   checkForbiddenCall(cmd);
+  checkNotBatching();
   postCommand(cmd, gpsTimestamp);
   if (isVerbose())
     std::cout << "Post " << cmd->toReadableCommand() << " at " << gpsTimestamp.year << "-" << gpsTimestamp.month << "-"
@@ -766,6 +924,7 @@ CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd, const Sdx::DateTime&
 CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd)
 {
   checkForbiddenCall(cmd);
+  checkNotBatching();
   postCommand(cmd);
   if (isVerbose())
     std::cout << "Call " << cmd->toReadableCommand() << std::flush;
@@ -775,11 +934,90 @@ CommandResultPtr RemoteSimulator::call(CommandBasePtr cmd)
   return result;
 }
 
+std::future<CommandResultPtr> RemoteSimulator::callAsync(CommandBasePtr cmd)
+{
+  auto promise = std::make_shared<std::promise<CommandResultPtr>>();
+  std::future<CommandResultPtr> future = promise->get_future();
+
+  bool exceptionOnError = m_exceptionOnError;
+  auto callback = [promise, exceptionOnError](CommandResultPtr result) {
+    if (!result)
+      promise->set_exception(std::make_exception_ptr(
+        std::runtime_error("Failed to receive command result. Is server still running?")));
+    else if (exceptionOnError && !result->isSuccess())
+      promise->set_exception(std::make_exception_ptr(CommandException(result, "")));
+    else
+      promise->set_value(result);
+  };
+
+  if (!callAsync(cmd, callback))
+    promise->set_exception(std::make_exception_ptr(std::runtime_error("Failed to send " + cmd->name())));
+
+  return future;
+}
+
+bool RemoteSimulator::callAsync(CommandBasePtr cmd, std::function<void(CommandResultPtr)> callback)
+{
+  if (!m_client)
+    throw std::runtime_error("Cannot send command to simulator because you are not connected.");
+
+  checkNotBatching();
+  checkForbiddenCall(cmd);
+  deprecatedMessage(cmd);
+  if (isVerbose())
+    std::cout << "Call async " << cmd->toReadableCommand() << std::endl;
+  return m_client->sendCommandAsync(cmd, std::move(callback));
+}
+
+CommandAwaitable RemoteSimulator::callCo(CommandBasePtr cmd)
+{
+  return CommandAwaitable(*this, cmd);
+}
+
+CommandAwaitable::CommandAwaitable(RemoteSimulator& sim, CommandBasePtr cmd) :
+  m_sim(sim),
+  m_cmd(cmd),
+  m_sendFailed(false)
+{
+}
+
+bool CommandAwaitable::suspend(std::coroutine_handle<> handle, CmdScheduler* scheduler)
+{
+  // Only the callback resumes the coroutine once it is registered, possibly before callAsync returns: members must
+  // not be touched then. callAsync returns false, or throws, only when the callback won't be called.
+  const bool sent = m_sim.callAsync(m_cmd, [this, handle, scheduler](CommandResultPtr result) {
+    m_result = result;
+    if (scheduler)
+      scheduler->schedule(handle);
+    else
+      handle.resume();
+  });
+
+  if (sent)
+    return true;
+
+  m_sendFailed = true;
+  return false;
+}
+
+CommandResultPtr CommandAwaitable::await_resume()
+{
+  if (m_sendFailed)
+    throw std::runtime_error("Failed to send " + m_cmd->name());
+  if (!m_result)
+    throw std::runtime_error("Failed to receive command result. Is server still running?");
+  if (m_sim.m_exceptionOnError && !m_result->isSuccess())
+    throw CommandException(m_result, "");
+  if (m_sim.isVerbose() && !m_result->isSuccess())
+    std::cout << m_cmd->name() << " failed: " << m_result->message() << std::endl;
+  return m_result;
+}
+
 CommandBasePtr RemoteSimulator::postCommand(CommandBasePtr cmd, double timestamp)
 {
   deprecatedMessage(cmd);
   cmd->setTimestamp(timestamp);
-  m_client->sendCommand(cmd);
+  sendCommand(cmd);
   return cmd;
 }
 
@@ -787,19 +1025,37 @@ CommandBasePtr RemoteSimulator::postCommand(CommandBasePtr cmd, const Sdx::DateT
 {
   deprecatedMessage(cmd);
   cmd->setGpsTimestamp(gpsTimestamp);
-  m_client->sendCommand(cmd);
+  sendCommand(cmd);
   return cmd;
 }
 
 CommandBasePtr RemoteSimulator::postCommand(CommandBasePtr cmd)
 {
   deprecatedMessage(cmd);
-  m_client->sendCommand(cmd);
+  sendCommand(cmd);
   return cmd;
 }
 
+void RemoteSimulator::sendCommand(CommandBasePtr cmd)
+{
+  if (m_batching)
+    m_batch.push_back(cmd);
+  else
+    m_client->sendCommand(cmd);
+}
+
+// Commands waited on are rejected before being queued in the batch, so the batch never keeps a command whose caller
+// got an error. Asynchronous calls are rejected too, they would be sent ahead of the batch.
+void RemoteSimulator::checkNotBatching() const
+{
+  if (m_batching)
+    throw std::runtime_error("You cannot wait for a command during a batch. Call commitBatch first.");
+}
+
 CommandResultPtr RemoteSimulator::waitCommand(CommandBasePtr cmd)
 {
+  checkNotBatching();
+
   CommandResultPtr result = m_client->waitCommand(cmd);
   handleException(result);
   return result;
@@ -807,18 +1063,21 @@ CommandResultPtr RemoteSimulator::waitCommand(CommandBasePtr cmd)
 
 CommandResultPtr RemoteSimulator::callCommand(CommandBasePtr cmd, double timestamp)
 {
+  checkNotBatching();
   postCommand(cmd, timestamp);
   return waitCommand(cmd);
 }
 
 CommandResultPtr RemoteSimulator::callCommand(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp)
 {
+  checkNotBatching();
   postCommand(cmd, gpsTimestamp);
   return waitCommand(cmd);
 }
 
 CommandResultPtr RemoteSimulator::callCommand(CommandBasePtr cmd)
 {
+  checkNotBatching();
   postCommand(cmd);
   return waitCommand(cmd);
 }
@@ -1,24 +1,73 @@
 #ifndef REMOTE_SIMULATOR_H__
 #define REMOTE_SIMULATOR_H__
 
+#include <chrono>
+#include <coroutine>
+#include <functional>
+#include <future>
 #include <queue>
 
 #include <set>
 
+#include "cmd_scheduler.h"
 #include "command_result.h"
 
 namespace Sdx
 {
 class CmdClient;
 class HilClient;
+class HilBatch;
+class SimulatorMonitor;
 class Ecef;
 class Lla;
 class Attitude;
 struct DateTime;
 struct VehicleInfo;
+class VehicleInfoFeed;
 
 int spooferInstance(int id);
 
+class RemoteSimulator;
+
+// Results of the commands of a batch, in the order they were posted. A command whose result couldn't be received has a
+// null result. The error summary lists every failed command and is empty if all of them succeeded.
+struct CommandBatchResult
+{
+  std::vector<CommandResultPtr> results;
+  std::string errorSummary;
+
+  inline bool isSuccess() const { return errorSummary.empty(); }
+};
+
+// Awaitable returned by RemoteSimulator::callCo. When awaited from a CmdTask, the coroutine is resumed by its
+// CmdScheduler, otherwise it is resumed on the simulator's reactor thread.
+class CommandAwaitable
+{
+public:
+  CommandAwaitable(RemoteSimulator& sim, CommandBasePtr cmd);
+
+  bool await_ready() const noexcept { return false; }
+
+  template<typename Promise>
+  bool await_suspend(std::coroutine_handle<Promise> handle)
+  {
+    CmdScheduler* scheduler = nullptr;
+    if constexpr (requires { handle.promise().scheduler; })
+      scheduler = handle.promise().scheduler;
+    return suspend(handle, scheduler);
+  }
+
+  CommandResultPtr await_resume();
+
+private:
+  bool suspend(std::coroutine_handle<> handle, CmdScheduler* scheduler);
+
+  RemoteSimulator& m_sim;
+  CommandBasePtr m_cmd;
+  CommandResultPtr m_result;
+  bool m_sendFailed;
+};
+
 class RemoteSimulator
 {
 public:
@@ -35,14 +84,22 @@ public:
   void setVerbose(bool verbose);
   bool isVerbose() const;
 
+  // The streaming check of the HIL pushes reads the state published by a SimulatorMonitor, which polls the simulator
+  // on its own connection from the first push on. A failure is reported at most once per simulated second.
   void setHilStreamingCheckEnabled(bool hilStreamingCheckEnabled);
   bool isHilStreamingCheckEnabled();
 
+  // Fills the dynamics of the HIL pushes which don't carry any, see HilClient::setDynamicsEstimation
+  void setHilDynamicsEstimation(int maxOrder);
+  int hilDynamicsEstimation() const;
+
   bool arm();
   bool start();
   void stop(double timestamp);
   void stop();
 
+  // Posted commands don't wait for their result. Many commands can be posted back to back and their results collected
+  // later with wait(), in any order.
   CommandBasePtr post(CommandBasePtr cmd, double timestamp);
   CommandBasePtr post(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp);
   CommandBasePtr post(CommandBasePtr cmd);
@@ -53,6 +110,27 @@ public:
   CommandResultPtr call(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp);
   CommandResultPtr call(CommandBasePtr cmd);
 
+  // Send a command without blocking the calling thread. Results are received by a reactor thread started on the first
+  // asynchronous call. The future holds the result, or a CommandException if the command failed and exceptions on
+  // error are enabled.
+  std::future<CommandResultPtr> callAsync(CommandBasePtr cmd);
+
+  // Same as above, but the callback is invoked on the reactor thread with the result, or with nullptr if the
+  // connection is lost. The callback must not wait for another command. Returns false, or throws, only when the
+  // callback won't be called.
+  bool callAsync(CommandBasePtr cmd, std::function<void(CommandResultPtr)> callback);
+
+  // Awaitable form of call, for coroutines: auto result = co_await sim.callCo(Cmd::GetSimulatorState::create());
+  // Throws like call() when resumed, except the simulator state is not queried on failure.
+  CommandAwaitable callCo(CommandBasePtr cmd);
+
+  // Commands posted between beginBatch and commitBatch are kept and sent together with a single write. commitBatch
+  // waits for all the results and reports the failures instead of throwing on the first one. Commands can't be waited
+  // on during a batch, nor called asynchronously, which would send them ahead of the batch.
+  void beginBatch();
+  CommandBatchResult commitBatch();
+  bool isBatching() const;
+
   CommandResultPtr beginTrackDefinition();
   void pushTrackEcef(int elapsedTime, const Ecef& ecef);
   void pushTrackEcefNed(int elapsedTime, const Ecef& ecef, const Attitude& attitude);
@@ -249,6 +327,14 @@ public:
   //
   bool pushLlaNed(double elapsedTime, const Lla& lla, const Attitude& attitude, const std::string& name = "");
 
+  // HIL connection, to read its latency or to drive it from a HilStreamer or a HilScheduler. nullptr while
+  // disconnected.
+  HilClient* hilClient();
+
+  // Send Skydel the HIL messages of a batch, usually one tick of the vehicle and of the jammers' vehicles. The batch
+  // isn't cleared.
+  bool push(const HilBatch& batch);
+
   CommandResultPtr beginVehicleInfo();
   CommandResultPtr endVehicleInfo();
 
@@ -262,6 +348,12 @@ public:
 
   bool hasVehicleInfo();
 
+  // Receives the vehicle infos from a background thread, see HilClient::startVehicleInfoReceiver. nextVehicleInfo and
+  // lastVehicleInfo keep working, and vehicleInfoFeed() gives the latest one without system calls.
+  void startVehicleInfoReceiver(std::size_t historySize = 1024);
+  void stopVehicleInfoReceiver();
+  const VehicleInfoFeed* vehicleInfoFeed() const;
+
   bool checkIfStreaming();
 
   bool waitState(const std::string& state, const std::string& failureState = "");
@@ -285,10 +377,13 @@ private:
   CommandResultPtr callCommand(CommandBasePtr cmd, const Sdx::DateTime& gpsTimestamp);
   CommandResultPtr callCommand(CommandBasePtr cmd);
 
+  void sendCommand(CommandBasePtr cmd);
   void resetTime();
   void checkForbiddenPost(CommandBasePtr cmd);
   void checkForbiddenCall(CommandBasePtr cmd);
+  void checkNotBatching() const;
   bool hilCheck(double elapsedTime);
+  bool checkMonitoredState();
   void handleException(CommandResultPtr result);
   void errorMessage(const std::string& msg);
   void deprecatedMessage(CommandBasePtr cmd);
@@ -296,17 +391,23 @@ private:
   bool m_exceptionOnError;
   CmdClient* m_client;
   HilClient* m_hil;
+  SimulatorMonitor* m_monitor;
   double m_checkRunningTime;
+  std::chrono::steady_clock::time_point m_lastHilCheck;
   bool m_verbose;
   bool m_hilStreamingCheckEnabled;
+  int m_hilDynamicsEstimation;
   bool m_beginTrack;
   bool m_beginRoute;
+  bool m_batching;
+  std::vector<CommandBasePtr> m_batch;
 
   std::set<std::string> m_beginIntTxTrack;
   std::set<std::string> m_latchDeprecated;
   DeprecatedMessageMode m_deprecatedMessageMode {DeprecatedMessageMode::LATCH};
 
   int m_serverApiVersion;
+  friend class CommandAwaitable;
 };
 } // namespace Sdx
 
@@ -0,0 +1,196 @@
+#include "result_decoder.h"
+
+#include <rapidjson/reader.h>
+
+#include <algorithm>
+#include <sstream>
+#include <string_view>
+
+#include "command_base.h"
+
+namespace Sdx
+{
+
+namespace
+{
+struct DecodedResult
+{
+  const char* cmdName;
+  std::vector<std::string_view> fields;
+};
+
+// Results whose matrices are decoded without the document, every other command goes through the document only
+const std::vector<DecodedResult>& decodedResults()
+{
+  static const std::vector<DecodedResult> results {
+    {"GetIntTxAntennaResult", {"Gain"}},
+    {"GetIonoGridErrorAllResult", {"Grid"}},
+    {"GetSVAntennaGainResult", {"Gain"}},
+    {"GetSVAntennaPhaseOffsetResult", {"PhaseOffset"}},
+    {"GetSpoofTxAntennaResult", {"Gain"}},
+    {"GetVehicleAntennaGainResult", {"Gain"}},
+    {"GetVehicleAntennaModelResult",
+     {"GainL1",
+      "GainL2",
+      "GainL5",
+      "GainE6",
+      "GainS",
+      "PhaseOffsetL1",
+      "PhaseOffsetL2",
+      "PhaseOffsetL5",
+      "PhaseOffsetE6",
+      "PhaseOffsetS"}},
+    {"GetVehicleAntennaPhaseOffsetResult", {"PhaseOffset"}}};
+  return results;
+}
+
+// Forwards the SAX events to the document, except for the selected matrices which are decoded on the side
+class DecodingHandler
+{
+public:
+  DecodingHandler(rapidjson::Document& doc, std::vector<ResultDecoder::DecodedField>& decodedFields) :
+    m_doc(doc),
+    m_decodedFields(decodedFields)
+  {
+  }
+
+  bool Null() { return !m_matrix && m_doc.Null(); }
+  bool Bool(bool b) { return !m_matrix && m_doc.Bool(b); }
+  bool Int(int i) { return m_matrix ? addNumber(i) : m_doc.Int(i); }
+  bool Uint(unsigned u) { return m_matrix ? addNumber(u) : m_doc.Uint(u); }
+  bool Int64(int64_t i) { return m_matrix ? addNumber(static_cast<double>(i)) : m_doc.Int64(i); }
+  bool Uint64(uint64_t u) { return m_matrix ? addNumber(static_cast<double>(u)) : m_doc.Uint64(u); }
+  bool Double(double d) { return m_matrix ? addNumber(d) : m_doc.Double(d); }
+  bool RawNumber(const char* str, rapidjson::SizeType length, bool copy)
+  {
+    return !m_matrix && m_doc.RawNumber(str, length, copy);
+  }
+
+  bool String(const char* str, rapidjson::SizeType length, bool copy)
+  {
+    if (m_matrix)
+      return false;
+
+    if (m_isCmdName)
+    {
+      const std::string_view cmdName(str, length);
+      for (const DecodedResult& result : decodedResults())
+      {
+        if (cmdName == result.cmdName)
+          m_result = &result;
+      }
+      m_isCmdName = false;
+    }
+    return m_doc.String(str, length, copy);
+  }
+
+  bool StartObject()
+  {
+    if (m_matrix)
+      return false;
+    ++m_depth;
+    return m_doc.StartObject();
+  }
+
+  bool Key(const char* str, rapidjson::SizeType length, bool copy)
+  {
+    if (m_depth == 1)
+    {
+      const std::string_view key(str, length);
+      m_isCmdName = key == CommandBase::CmdNameKey;
+      if (m_result && std::find(m_result->fields.begin(), m_result->fields.end(), key) != m_result->fields.end())
+      {
+        m_decodedFields.push_back({std::string(key), {}});
+        m_matrix = &m_decodedFields.back().value;
+        m_matrixDepth = 0;
+      }
+    }
+    return m_doc.Key(str, length, copy);
+  }
+
+  bool EndObject(rapidjson::SizeType memberCount)
+  {
+    --m_depth;
+    return m_doc.EndObject(memberCount);
+  }
+
+  bool StartArray()
+  {
+    if (!m_matrix)
+      return m_doc.StartArray();
+
+    if (++m_matrixDepth > 2)
+      return false;
+
+    if (m_matrixDepth == 2)
+    {
+      // Rows of a pattern usually have the same length
+      const std::size_t width = m_matrix->empty() ? 0 : m_matrix->back().size();
+      m_matrix->emplace_back().reserve(width);
+    }
+    return true;
+  }
+
+  bool EndArray(rapidjson::SizeType elementCount)
+  {
+    if (!m_matrix)
+      return m_doc.EndArray(elementCount);
+
+    if (--m_matrixDepth == 0)
+    {
+      m_matrix = nullptr;
+      return m_doc.Null();
+    }
+    return true;
+  }
+
+private:
+  bool addNumber(double value)
+  {
+    if (m_matrixDepth != 2)
+      return false;
+    m_matrix->back().push_back(value);
+    return true;
+  }
+
+  rapidjson::Document& m_doc;
+  std::vector<ResultDecoder::DecodedField>& m_decodedFields;
+  const DecodedResult* m_result = nullptr;
+  std::vector<std::vector<double>>* m_matrix = nullptr;
+  int m_depth = 0;
+  int m_matrixDepth = 0;
+  bool m_isCmdName = false;
+};
+} // namespace
+
+bool ResultDecoder::parse(const std::string& serializedCommand,
+                          rapidjson::Document& doc,
+                          std::vector<DecodedField>& decodedFields,
+                          std::string* errorMsg)
+{
+  decodedFields.clear();
+  rapidjson::StringStream stream(serializedCommand.c_str());
+  rapidjson::Reader reader;
+  rapidjson::ParseResult result;
+  auto generator = [&](rapidjson::Document& handler) {
+    DecodingHandler decodingHandler(handler, decodedFields);
+    result = reader.Parse(stream, decodingHandler);
+    return !result.IsError();
+  };
+  doc.Populate(generator);
+
+  if (result.IsError())
+  {
+    if (errorMsg)
+    {
+      std::stringstream ss;
+      ss << "JSON parse error: " << result.Code() << " at offset " << result.Offset();
+      *errorMsg = ss.str();
+    }
+    return false;
+  }
+
+  return true;
+}
+
+} // namespace Sdx
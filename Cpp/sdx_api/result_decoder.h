@@ -0,0 +1,35 @@
+#ifndef RESULT_DECODER_H
+#define RESULT_DECODER_H
+
+#include <rapidjson/document.h>
+
+#include <string>
+#include <vector>
+
+namespace Sdx
+{
+
+//
+// Parses serialized commands with a SAX reader. The document is built as usual, except for the antenna pattern and
+// iono grid matrices of the results which carry them: those are decoded straight into their typed value and the
+// document only gets a null placeholder, so a large result never exists both as JSON values and as vectors.
+//
+class ResultDecoder
+{
+public:
+  struct DecodedField
+  {
+    std::string name;
+    std::vector<std::vector<double>> value;
+  };
+
+  // Same contract as CommandBase::parse, decodedFields receives the matrices decoded outside of the document
+  static bool parse(const std::string& serializedCommand,
+                    rapidjson::Document& doc,
+                    std::vector<DecodedField>& decodedFields,
+                    std::string* errorMsg = nullptr);
+};
+
+} // namespace Sdx
+
+#endif // RESULT_DECODER_H
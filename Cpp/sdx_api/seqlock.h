@@ -0,0 +1,72 @@
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace Sdx
+{
+
+//
+// Latest value written by a single thread and read by any number of threads without locks.
+//
+// The writer never waits. Readers copy the value and retry if a write happened meanwhile. The value is kept in atomic
+// words, so a torn read is detected instead of being undefined behaviour.
+//
+template<typename T>
+class SeqLock
+{
+  static_assert(std::is_trivially_copyable_v<T>, "SeqLock values are copied word by word");
+
+public:
+  // Writer thread only
+  void store(const T& value)
+  {
+    uint64_t words[WordCount] = {};
+    std::memcpy(words, &value, sizeof(T));
+
+    const uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+    m_sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    for (std::size_t i = 0; i < WordCount; ++i)
+      m_words[i].store(words[i], std::memory_order_relaxed);
+    m_sequence.store(sequence + 2, std::memory_order_release);
+  }
+
+  // Returns false if nothing was stored yet
+  bool load(T& value) const
+  {
+    uint64_t words[WordCount];
+    uint64_t before;
+    uint64_t after;
+    do
+    {
+      before = m_sequence.load(std::memory_order_acquire);
+      for (std::size_t i = 0; i < WordCount; ++i)
+        words[i] = m_words[i].load(std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_acquire);
+      after = m_sequence.load(std::memory_order_relaxed);
+    } while ((before & 1) || before != after);
+
+    if (before == 0)
+      return false;
+    std::memcpy(&value, words, sizeof(T));
+    return true;
+  }
+
+  // Number of stores so far, lets a reader check the value it loaded wasn't replaced since
+  inline uint64_t version() const { return m_sequence.load(std::memory_order_acquire) / 2; }
+
+private:
+  static constexpr std::size_t WordCount = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+  std::atomic<uint64_t> m_sequence {0};
+  std::atomic<uint64_t> m_words[WordCount] = {};
+};
+
+} // namespace Sdx
+
+#endif // SEQLOCK_H
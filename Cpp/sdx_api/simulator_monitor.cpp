@@ -0,0 +1,213 @@
+#include "simulator_monitor.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "cmd_client.h"
+#include "gen/GetSimulatorState.h"
+#include "gen/SimulatorStateResult.h"
+
+namespace Sdx
+{
+
+namespace
+{
+// A poll gets at least this long to be answered, even with a shorter period
+const std::chrono::milliseconds MinResultTimeout(1000);
+
+// The state goes in the low byte, the poll time in microseconds in the others
+uint64_t packStatus(SimulatorMonitor::Health health, SimulatorMonitor::Clock::time_point polled)
+{
+  const auto us = std::chrono::duration_cast<std::chrono::microseconds>(polled.time_since_epoch()).count();
+  return (static_cast<uint64_t>(us) << 8) | static_cast<uint64_t>(health);
+}
+
+SimulatorMonitor::Status unpackStatus(uint64_t status)
+{
+  const auto polled = std::chrono::microseconds(static_cast<int64_t>(status >> 8));
+  return {static_cast<SimulatorMonitor::Health>(status & 0xff),
+          SimulatorMonitor::Clock::time_point(std::chrono::duration_cast<SimulatorMonitor::Clock::duration>(polled))};
+}
+} // namespace
+
+struct SimulatorMonitor::Pimpl
+{
+  std::string ip;
+  int port;
+  std::chrono::milliseconds period;
+  std::atomic<uint64_t> status {0};
+
+  std::thread thread;
+  mutable std::mutex mutex;
+  std::condition_variable stopRequested;
+  bool running = false;
+  std::string errorMessage;
+
+  // Poll in flight, answered from the thread receiving the results of the client
+  std::string pollUuid;
+  bool answered = false;
+  CommandResultPtr answer;
+};
+
+SimulatorMonitor::SimulatorMonitor(const std::string& ip, int port, std::chrono::milliseconds period) :
+  m(std::make_unique<Pimpl>())
+{
+  m->ip = ip;
+  m->port = port;
+  m->period = period;
+}
+
+SimulatorMonitor::~SimulatorMonitor()
+{
+  stop();
+}
+
+void SimulatorMonitor::start()
+{
+  std::lock_guard<std::mutex> lock(m->mutex);
+  if (m->running)
+    return;
+
+  if (m->thread.joinable())
+    m->thread.join();
+  m->status.store(0);
+  m->running = true;
+  m->thread = std::thread(&SimulatorMonitor::run, this);
+}
+
+void SimulatorMonitor::stop()
+{
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    m->running = false;
+  }
+  m->stopRequested.notify_all();
+  if (m->thread.joinable())
+    m->thread.join();
+}
+
+bool SimulatorMonitor::isRunning() const
+{
+  std::lock_guard<std::mutex> lock(m->mutex);
+  return m->running;
+}
+
+SimulatorMonitor::Status SimulatorMonitor::status() const
+{
+  return unpackStatus(m->status.load(std::memory_order_acquire));
+}
+
+std::string SimulatorMonitor::errorMessage() const
+{
+  std::lock_guard<std::mutex> lock(m->mutex);
+  return m->errorMessage;
+}
+
+void SimulatorMonitor::publish(Health health, Clock::time_point polled, const std::string& errorMessage)
+{
+  if (health != Health::Streaming)
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    m->errorMessage = errorMessage;
+  }
+  m->status.store(packStatus(health, polled), std::memory_order_release);
+}
+
+void SimulatorMonitor::run()
+{
+  std::unique_ptr<CmdClient> client;
+  while (isRunning())
+  {
+    const Clock::time_point polled = Clock::now();
+    Cmd::SimulatorStateResultPtr result;
+    std::string error = "Lost the connection to the simulator while checking its state.";
+    try
+    {
+      if (!client)
+      {
+        client = std::make_unique<CmdClient>(false);
+        if (!client->connectToHost(m->ip, m->port))
+          client.reset();
+      }
+
+      if (client)
+      {
+        result = Cmd::SimulatorStateResult::dynamicCast(poll(*client, polled + std::max(m->period, MinResultTimeout)));
+        if (!result && client->isConnected())
+          error = "The simulator didn't report its state in time.";
+      }
+    }
+    catch (const std::exception& e)
+    {
+      error = "Failed to check the simulator state: " + std::string(e.what());
+    }
+
+    // Stopped while polling, the poll was abandoned
+    if (!isRunning())
+      break;
+
+    if (!result)
+    {
+      // Reconnects on the next poll. Closing the connection may wait for the simulator, publish first.
+      publish(Health::Disconnected, polled, error);
+      client.reset();
+    }
+    else if (result->state() == "Streaming RF")
+    {
+      publish(Health::Streaming, polled, "");
+    }
+    else if (result->state() == "Error")
+    {
+      publish(Health::Error, polled, "An error occured during simulation. Error message:\n" + result->error());
+    }
+    else
+    {
+      publish(Health::NotStreaming,
+              polled,
+              "Simulator is no more streaming. Current state is " + result->state() + ".");
+    }
+
+    std::unique_lock<std::mutex> lock(m->mutex);
+    m->stopRequested.wait_until(lock, polled + m->period, [this] { return !m->running; });
+  }
+}
+
+CommandResultPtr SimulatorMonitor::poll(CmdClient& client, Clock::time_point deadline)
+{
+  // Sent asynchronously, so stop() doesn't wait for a simulator which doesn't answer
+  auto cmd = Cmd::GetSimulatorState::create();
+  const std::string uuid = cmd->uuid();
+  {
+    std::lock_guard<std::mutex> lock(m->mutex);
+    m->pollUuid = uuid;
+    m->answered = false;
+    m->answer.reset();
+  }
+
+  const bool sent = client.sendCommandAsync(cmd, [this, uuid](CommandResultPtr result) {
+    {
+      std::lock_guard<std::mutex> lock(m->mutex);
+      if (uuid != m->pollUuid)
+        return;
+      m->answer = result;
+      m->answered = true;
+    }
+    m->stopRequested.notify_all();
+  });
+  if (!sent)
+    return nullptr;
+
+  // Times out with no answer, a late answer is ignored
+  std::unique_lock<std::mutex> lock(m->mutex);
+  m->stopRequested.wait_until(lock, deadline, [this] { return m->answered || !m->running; });
+  m->pollUuid.clear();
+  CommandResultPtr answer = std::move(m->answer);
+  m->answer.reset();
+  return answer;
+}
+
+} // namespace Sdx
@@ -0,0 +1,68 @@
+#ifndef SIMULATOR_MONITOR_H
+#define SIMULATOR_MONITOR_H
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace Sdx
+{
+class CmdClient;
+class CommandResult;
+
+//
+// Polls the simulator state from a background thread, on its own command connection.
+//
+// The latest state is published in a single atomic, so the HIL push path of RemoteSimulator reads it without locks or
+// system calls instead of waiting for a GetSimulatorState round trip.
+//
+class SimulatorMonitor
+{
+public:
+  using Clock = std::chrono::steady_clock;
+
+  enum class Health : uint8_t
+  {
+    Unknown = 0, // not polled yet
+    Streaming = 1,
+    NotStreaming = 2,
+    Error = 3,
+    Disconnected = 4 // the monitor couldn't reach the simulator
+  };
+
+  struct Status
+  {
+    Health health;
+    Clock::time_point polled; // when the request of this state was sent
+  };
+
+  SimulatorMonitor(const std::string& ip, int port, std::chrono::milliseconds period = std::chrono::milliseconds(200));
+  ~SimulatorMonitor();
+
+  SimulatorMonitor(const SimulatorMonitor&) = delete;
+  SimulatorMonitor& operator=(const SimulatorMonitor&) = delete;
+
+  void start();
+  // Abandons the poll in flight instead of waiting for its answer
+  void stop();
+  bool isRunning() const;
+
+  // Lock-free
+  Status status() const;
+
+  // Message describing the latest state when it isn't Streaming, takes a lock
+  std::string errorMessage() const;
+
+private:
+  struct Pimpl;
+  std::unique_ptr<Pimpl> m;
+
+  void run();
+  std::shared_ptr<CommandResult> poll(CmdClient& client, Clock::time_point deadline);
+  void publish(Health health, Clock::time_point polled, const std::string& errorMessage);
+};
+
+} // namespace Sdx
+
+#endif // SIMULATOR_MONITOR_H
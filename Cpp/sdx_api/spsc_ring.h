@@ -0,0 +1,84 @@
+#ifndef SPSC_RING_H
+#define SPSC_RING_H
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+namespace Sdx
+{
+
+//
+// Bounded lock-free queue for exactly one producer thread and one consumer thread.
+//
+// The capacity is rounded up to a power of two. Each side keeps a copy of the other side's position, so the shared
+// positions are only read again when the ring looks full or empty.
+//
+template<typename T>
+class SpscRing
+{
+public:
+  explicit SpscRing(std::size_t capacity) :
+    m_items(std::bit_ceil(capacity < 2 ? std::size_t(2) : capacity)),
+    m_mask(m_items.size() - 1)
+  {
+  }
+
+  SpscRing(const SpscRing&) = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  inline std::size_t capacity() const { return m_items.size(); }
+
+  // Producer side, returns false if the ring is full
+  bool tryPush(const T& value)
+  {
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    if (tail - m_producerHead == m_items.size())
+    {
+      m_producerHead = m_head.load(std::memory_order_acquire);
+      if (tail - m_producerHead == m_items.size())
+        return false;
+    }
+
+    m_items[tail & m_mask] = value;
+    m_tail.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side, returns nullptr if the ring is empty. The item stays valid until pop().
+  T* front()
+  {
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_consumerTail)
+    {
+      m_consumerTail = m_tail.load(std::memory_order_acquire);
+      if (head == m_consumerTail)
+        return nullptr;
+    }
+    return &m_items[head & m_mask];
+  }
+
+  // Consumer side, must follow a successful front()
+  void pop() { m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+
+  // Either side, exact only when the other side is idle
+  std::size_t size() const
+  {
+    return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+  }
+
+private:
+  std::vector<T> m_items;
+  const std::size_t m_mask;
+
+  // The two sides are written by different threads, keep them on different cache lines
+  alignas(64) std::atomic<std::size_t> m_head {0};
+  std::size_t m_consumerTail {0};
+  alignas(64) std::atomic<std::size_t> m_tail {0};
+  std::size_t m_producerHead {0};
+};
+
+} // namespace Sdx
+
+#endif // SPSC_RING_H
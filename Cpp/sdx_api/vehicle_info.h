@@ -17,6 +17,8 @@ struct VehicleInfo
   double speed;    // km/h
   double heading;  // rad
   double odometer; // meters since start
+
+  int64_t receiveTimeNs = 0; // system time at reception, from the kernel when available (ns since epoch)
 };
 
 } // namespace Sdx
@@ -0,0 +1,37 @@
+#include "vehicle_info_feed.h"
+
+#include <bit>
+
+namespace Sdx
+{
+
+VehicleInfoFeed::VehicleInfoFeed(std::size_t historySize) :
+  m_history(std::bit_ceil(historySize < 1 ? std::size_t(1) : historySize)),
+  m_mask(m_history.size() - 1)
+{
+}
+
+void VehicleInfoFeed::publish(const VehicleInfo& info)
+{
+  const uint64_t index = m_count.load(std::memory_order_relaxed);
+  m_history[index & m_mask].store({index, info});
+  m_latest.store(info);
+  m_count.store(index + 1, std::memory_order_release);
+}
+
+bool VehicleInfoFeed::latest(VehicleInfo& info) const
+{
+  return m_latest.load(info);
+}
+
+bool VehicleInfoFeed::at(uint64_t index, VehicleInfo& info) const
+{
+  Entry entry;
+  if (index >= count() || !m_history[index & m_mask].load(entry) || entry.index != index)
+    return false;
+
+  info = entry.info;
+  return true;
+}
+
+} // namespace Sdx
@@ -0,0 +1,53 @@
+#ifndef VEHICLE_INFO_FEED_H
+#define VEHICLE_INFO_FEED_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "seqlock.h"
+#include "vehicle_info.h"
+
+namespace Sdx
+{
+
+//
+// Vehicle infos published by the receiver thread of a HilClient: the latest one, and a bounded history of the last
+// ones. Reading doesn't take locks nor do system calls, from any number of threads.
+//
+class VehicleInfoFeed
+{
+public:
+  // The history size is rounded up to a power of two
+  explicit VehicleInfoFeed(std::size_t historySize);
+
+  // Receiver thread only
+  void publish(const VehicleInfo& info);
+
+  // Returns false until the first vehicle info
+  bool latest(VehicleInfo& info) const;
+
+  // Number of vehicle infos published so far, the next one gets this index
+  inline uint64_t count() const { return m_count.load(std::memory_order_acquire); }
+  inline std::size_t historySize() const { return m_history.size(); }
+
+  // Copies the vehicle info with the given index, returns false if it's not published yet or no longer in the history
+  bool at(uint64_t index, VehicleInfo& info) const;
+
+private:
+  struct Entry
+  {
+    uint64_t index;
+    VehicleInfo info;
+  };
+
+  SeqLock<VehicleInfo> m_latest;
+  std::vector<SeqLock<Entry>> m_history;
+  const std::size_t m_mask;
+  std::atomic<uint64_t> m_count {0};
+};
+
+} // namespace Sdx
+
+#endif // VEHICLE_INFO_FEED_H
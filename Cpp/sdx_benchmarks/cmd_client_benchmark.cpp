@@ -0,0 +1,89 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_commands.h"
+#include "cmd_client.h"
+#include "fake_server.h"
+
+using namespace Sdx;
+
+namespace
+{
+void report(const char* name, int count, std::chrono::steady_clock::duration elapsed)
+{
+  const double seconds = std::chrono::duration<double>(elapsed).count();
+  std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << std::fixed
+            << std::setprecision(0) << count / seconds << " commands/s" << std::setw(10) << std::setprecision(2)
+            << seconds * 1e6 / count << " us/command" << std::endl;
+}
+
+// Sends the commands by windows and waits for them in order, or in reverse order to go through the pending table
+void runPipelined(CmdClient& client, int count, int window, bool reversed)
+{
+  std::vector<CommandBasePtr> cmds;
+  for (int sent = 0; sent < count; sent += window)
+  {
+    cmds.clear();
+    for (int i = sent; i < std::min(sent + window, count); ++i)
+    {
+      cmds.push_back(Cmd::GetVersion::create());
+      client.sendCommand(cmds.back());
+    }
+
+    const int size = static_cast<int>(cmds.size());
+    for (int i = 0; i < size; ++i)
+      client.waitCommand(cmds[reversed ? size - 1 - i : i]);
+  }
+}
+} // namespace
+
+//
+// Command round trips against a loopback server answering every command at once: what the client costs per command,
+// synchronously and pipelined. Usage: cmd_client_benchmark [count]
+//
+int main(int argc, char* argv[])
+{
+  const int count = argc > 1 ? std::atoi(argv[1]) : 20000;
+  const int window = 256;
+
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::string json;
+    while (server.receiveFrame(json))
+      server.send(FakeServer::frame(FakeServer::result("SuccessResult", json)));
+    server.closeClient();
+  });
+
+  {
+    CmdClient client(true);
+    if (!client.connectToHost("127.0.0.1", server.port()))
+      return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < count; ++i)
+    {
+      CommandBasePtr cmd = Cmd::GetVersion::create();
+      client.sendCommand(cmd);
+      client.waitCommand(cmd);
+    }
+    report("Round trips", count, std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    runPipelined(client, count, window, false);
+    report("Pipelined", count, std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    runPipelined(client, count, window, true);
+    report("Pipelined, reverse waits", count, std::chrono::steady_clock::now() - start);
+  }
+
+  thread.join();
+  return 0;
+}
@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+#include "all_commands.h"
+
+using namespace Sdx;
+
+namespace
+{
+// Creates the commands with the given generator, returns the elapsed time per command in nanoseconds
+double measure(CommandBase::UuidGenerator generator, int count)
+{
+  CommandBase::setUuidGenerator(generator);
+  size_t checksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < count; ++i)
+    checksum += Cmd::GetVersion::create()->uuid()[0];
+  const double elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+  if (checksum == 0)
+    std::cout << "Unexpected empty uuids" << std::endl;
+  return elapsed / count;
+}
+
+void report(const char* name, double nanoseconds)
+{
+  std::cout << std::left << std::setw(28) << name << std::right << std::setw(10) << std::fixed << std::setprecision(0)
+            << nanoseconds << " ns/command" << std::endl;
+}
+} // namespace
+
+//
+// Command creation with each UUID generator, the UUID being most of the cost of an empty command.
+// Usage: uuid_benchmark [count]
+//
+int main(int argc, char* argv[])
+{
+  const int count = argc > 1 ? std::atoi(argv[1]) : 200000;
+  const CommandBase::UuidGenerator initial = CommandBase::uuidGenerator();
+
+  // Warm up the arena and the per-thread generator before measuring
+  measure(CommandBase::UUID_FAST, count / 10);
+  const double system = measure(CommandBase::UUID_SYSTEM, count);
+  const double fast = measure(CommandBase::UUID_FAST, count);
+  CommandBase::setUuidGenerator(initial);
+
+  report("System UUIDs (GuidGenerator)", system);
+  report("Fast UUIDs", fast);
+  std::cout << std::left << std::setw(28) << "Speedup" << std::right << std::setw(10) << std::setprecision(1)
+            << system / fast << "x" << std::endl;
+  return 0;
+}
@@ -686,8 +686,8 @@ void runExampleHilRealtime(const std::string& host, const std::string& targetTyp
   // HIL Tjoin is a volatile parameter that must be set before every HIL simulation
   sim.call(SetHilTjoin::create(HIL_TJOIN));
 
-  // The streaming check is performed at the end of pushEcefNed. It's recommended to disable this check
-  // and do it asynchronously outside of the while loop when sending positions at high frequencies.
+  // The streaming check is performed at the end of pushEcefNed. It only reads the state polled by a background
+  // monitor on its own connection, so it doesn't slow down the sending of positions at high frequencies.
   sim.setHilStreamingCheckEnabled(true);
 
   std::cout << "==> Setup synchronisation with PPS" << std::endl;
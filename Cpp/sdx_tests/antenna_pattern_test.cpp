@@ -0,0 +1,122 @@
+#include <rapidjson/document.h>
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "antenna_pattern.h"
+#include "check.h"
+
+using namespace Sdx;
+
+namespace
+{
+const double PI = 3.14159265358979323846;
+const double Tolerance = 1e-9;
+
+double radians(double degrees)
+{
+  return degrees * PI / 180.0;
+}
+
+bool isNear(double value, double expected)
+{
+  return std::abs(value - expected) < Tolerance;
+}
+
+// Rows every 10 degrees of elevation and columns every 10 degrees of azimuth, linear in both directions so the
+// interpolation is exact between two rows or two columns
+AntennaPattern grid()
+{
+  AntennaPattern pattern(19, 36);
+  for (std::size_t row = 0; row < pattern.rows(); ++row)
+  {
+    for (std::size_t column = 0; column < pattern.columns(); ++column)
+      pattern(row, column) = 100.0 * static_cast<double>(row) + static_cast<double>(column);
+  }
+  return pattern;
+}
+
+// Elevations past the poles read the first and last rows
+void testElevationClamp()
+{
+  const AntennaPattern pattern = grid();
+  CHECK(isNear(pattern.gainAt(radians(90.0), 0.0), 1800.0));
+  CHECK(isNear(pattern.gainAt(radians(-90.0), 0.0), 0.0));
+  CHECK(isNear(pattern.gainAt(radians(120.0), radians(20.0)), 1802.0));
+  CHECK(isNear(pattern.gainAt(radians(-120.0), radians(20.0)), 2.0));
+  CHECK(isNear(pattern.gainAt(radians(85.0), 0.0), 1750.0));
+}
+
+// Azimuths wrap around, the last column is interpolated with the first one
+void testAzimuthWrap()
+{
+  const AntennaPattern pattern = grid();
+  CHECK(isNear(pattern.gainAt(0.0, radians(360.0)), pattern.gainAt(0.0, 0.0)));
+  CHECK(isNear(pattern.gainAt(0.0, radians(720.0 + 20.0)), 902.0));
+  CHECK(isNear(pattern.gainAt(0.0, radians(-10.0)), 935.0));
+  CHECK(isNear(pattern.gainAt(0.0, radians(355.0)), 900.0 + 17.5));
+}
+
+// A single row covers every elevation
+void testSingleRow()
+{
+  const AntennaPattern pattern(std::vector<std::vector<double>> {{1.0, 2.0, 3.0, 4.0}});
+  CHECK(isNear(pattern.gainAt(radians(-90.0), 0.0), 1.0));
+  CHECK(isNear(pattern.gainAt(radians(90.0), 0.0), 1.0));
+  CHECK(isNear(pattern.gainAt(radians(30.0), radians(45.0)), 1.5));
+  CHECK(isNear(pattern.gainAt(0.0, radians(315.0)), 2.5));
+}
+
+// Non-finite angles give a NaN gain, the other lookups of a batch aren't affected
+void testNonFinite()
+{
+  const AntennaPattern pattern = grid();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const double infinity = std::numeric_limits<double>::infinity();
+  CHECK(std::isnan(pattern.gainAt(nan, 0.0)));
+  CHECK(std::isnan(pattern.gainAt(0.0, nan)));
+  CHECK(std::isnan(pattern.gainAt(infinity, 0.0)));
+  CHECK(std::isnan(pattern.gainAt(0.0, -infinity)));
+
+  const std::vector<double> elevations {0.0, nan, radians(90.0)};
+  const std::vector<double> azimuths {radians(20.0), 0.0, infinity};
+  std::vector<double> gains(3);
+  pattern.gainAt(elevations, azimuths, gains);
+  CHECK(isNear(gains[0], 902.0));
+  CHECK(std::isnan(gains[1]));
+  CHECK(std::isnan(gains[2]));
+
+  const std::vector<ElevationAzimuth> directions {{radians(90.0), 0.0}, {nan, nan}};
+  pattern.gainAt(directions, gains);
+  CHECK(isNear(gains[0], 1800.0));
+  CHECK(std::isnan(gains[1]));
+}
+
+// The nested vectors and the JSON matrix read back the same pattern
+void testRoundTrip()
+{
+  const AntennaPattern pattern = grid();
+  const std::vector<std::vector<double>> matrix = pattern.toMatrix();
+  CHECK(matrix.size() == 19 && matrix.front().size() == 36);
+  CHECK(matrix[3][7] == 307.0);
+  CHECK(AntennaPattern(matrix) == pattern);
+  CHECK(AntennaPattern(matrix).toMatrix() == matrix);
+
+  rapidjson::Document doc;
+  const rapidjson::Value json = parse_json<AntennaPattern>::format(pattern, doc.GetAllocator());
+  CHECK(parse_json<AntennaPattern>::is_valid(json));
+  CHECK(parse_json<AntennaPattern>::parse(json) == pattern);
+  CHECK(parse_json<std::vector<std::vector<double>>>::parse(json) == matrix);
+}
+} // namespace
+
+int main()
+{
+  testElevationClamp();
+  testAzimuthWrap();
+  testSingleRow();
+  testNonFinite();
+  testRoundTrip();
+  return Check::failures();
+}
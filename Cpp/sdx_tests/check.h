@@ -0,0 +1,26 @@
+#ifndef CHECK_H
+#define CHECK_H
+
+#include <iostream>
+
+// Minimal checks for the test programs: failures are printed and counted, main returns the count
+namespace Check
+{
+inline int& failures()
+{
+  static int count = 0;
+  return count;
+}
+
+inline void check(bool condition, const char* expression, const char* file, int line)
+{
+  if (condition)
+    return;
+  std::cout << file << ":" << line << ": CHECK(" << expression << ") failed" << std::endl;
+  ++failures();
+}
+} // namespace Check
+
+#define CHECK(condition) Check::check(static_cast<bool>(condition), #condition, __FILE__, __LINE__)
+
+#endif // CHECK_H
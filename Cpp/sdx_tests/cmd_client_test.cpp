@@ -0,0 +1,312 @@
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_commands.h"
+#include "check.h"
+#include "cmd_client.h"
+#include "fake_server.h"
+
+using namespace Sdx;
+
+namespace
+{
+std::vector<CommandBasePtr> postVersions(CmdClient& client, int count)
+{
+  std::vector<CommandBasePtr> cmds;
+  for (int i = 0; i < count; ++i)
+  {
+    cmds.push_back(Cmd::GetVersion::create());
+    client.sendCommand(cmds.back());
+  }
+  return cmds;
+}
+
+std::vector<CommandBasePtr> receiveCommands(FakeServer& server, int count)
+{
+  std::vector<CommandBasePtr> cmds;
+  for (int i = 0; i < count; ++i)
+    cmds.push_back(server.receiveCommand());
+  return cmds;
+}
+
+bool isResultOf(CommandResultPtr result, CommandBasePtr cmd)
+{
+  return result && result->relatedCommandUuid() == cmd->uuid();
+}
+
+// Many results in one write are all found by the buffered reader
+void testCoalescedResults()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::string bytes;
+    for (CommandBasePtr cmd : receiveCommands(server, 50))
+      bytes += FakeServer::frame(Cmd::SuccessResult::create(cmd));
+    server.send(bytes);
+    server.closeClient();
+  });
+
+  CmdClient client(true);
+  CHECK(client.connectToHost("127.0.0.1", server.port()));
+  std::vector<CommandBasePtr> cmds = postVersions(client, 50);
+  for (CommandBasePtr cmd : cmds)
+    CHECK(isResultOf(client.waitCommand(cmd), cmd));
+  CHECK(client.pendingResultCount() == 0);
+  thread.join();
+}
+
+// Results cut at every byte are reassembled
+void testFragmentedResults()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::string bytes;
+    for (CommandBasePtr cmd : receiveCommands(server, 3))
+      bytes += FakeServer::frame(Cmd::SuccessResult::create(cmd));
+    server.send(bytes, 1);
+    server.closeClient();
+  });
+
+  CmdClient client(true);
+  CHECK(client.connectToHost("127.0.0.1", server.port()));
+  std::vector<CommandBasePtr> cmds = postVersions(client, 3);
+  for (CommandBasePtr cmd : cmds)
+    CHECK(isResultOf(client.waitCommand(cmd), cmd));
+  thread.join();
+}
+
+// A result larger than the read buffer and than a 16 bits frame
+void testLargeResult()
+{
+  const std::string version(300000, 'v');
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    CommandBasePtr cmd = server.receiveCommand();
+    server.send(FakeServer::frame(Cmd::VersionResult::create(cmd, version)), 4096);
+    server.closeClient();
+  });
+
+  CmdClient client(true);
+  CHECK(client.connectToHost("127.0.0.1", server.port()));
+  CommandBasePtr cmd = postVersions(client, 1).front();
+  CommandResultPtr result = client.waitCommand(cmd);
+  CHECK(isResultOf(result, cmd));
+  CHECK(Cmd::VersionResult::dynamicCast(result) && Cmd::VersionResult::dynamicCast(result)->version() == version);
+  thread.join();
+}
+
+// Results received while waiting for another one are parked and can be waited in any order
+void testOutOfOrderResults()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::vector<CommandBasePtr> cmds = receiveCommands(server, 3);
+    server.send(FakeServer::frame(Cmd::SuccessResult::create(cmds[2])) +
+                FakeServer::frame(Cmd::SuccessResult::create(cmds[0])) +
+                FakeServer::frame(Cmd::SuccessResult::create(cmds[1])));
+    server.closeClient();
+  });
+
+  CmdClient client(true);
+  CHECK(client.connectToHost("127.0.0.1", server.port()));
+  std::vector<CommandBasePtr> cmds = postVersions(client, 3);
+  CHECK(isResultOf(client.waitCommand(cmds[1]), cmds[1]));
+  CHECK(client.pendingResultCount() == 2);
+  CHECK(isResultOf(client.waitCommand(cmds[0]), cmds[0]));
+  CHECK(isResultOf(client.waitCommand(cmds[2]), cmds[2]));
+  CHECK(client.pendingResultCount() == 0);
+  thread.join();
+}
+
+// A full table discards its oldest result
+void testPendingTableEviction()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::string bytes;
+    for (CommandBasePtr cmd : receiveCommands(server, 4))
+      bytes += FakeServer::frame(Cmd::SuccessResult::create(cmd));
+    server.send(bytes);
+    server.closeClient();
+  });
+
+  CmdClient client(true);
+  client.setMaxPendingResults(2);
+  CHECK(client.connectToHost("127.0.0.1", server.port()));
+  std::vector<CommandBasePtr> cmds = postVersions(client, 4);
+  CHECK(isResultOf(client.waitCommand(cmds[3]), cmds[3]));
+  CHECK(client.pendingResultCount() == 2);
+  CHECK(isResultOf(client.waitCommand(cmds[1]), cmds[1]));
+  CHECK(isResultOf(client.waitCommand(cmds[2]), cmds[2]));
+
+  bool thrown = false;
+  try
+  {
+    client.waitCommand(cmds[0]);
+  }
+  catch (const std::runtime_error&)
+  {
+    thrown = true;
+  }
+  CHECK(thrown);
+  thread.join();
+}
+
+// A result received twice replaces its parked copy, even in a full table
+void testPendingTableDuplicate()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::vector<CommandBasePtr> cmds = receiveCommands(server, 3);
+    server.send(FakeServer::frame(Cmd::SuccessResult::create(cmds[1])) +
+                FakeServer::frame(Cmd::SuccessResult::create(cmds[0])) +
+                FakeServer::frame(Cmd::SuccessResult::create(cmds[0])) +
+                FakeServer::frame(Cmd::SuccessResult::create(cmds[2])));
+    server.closeClient();
+  });
+
+  CmdClient client(true);
+  client.setMaxPendingResults(2);
+  CHECK(client.connectToHost("127.0.0.1", server.port()));
+  std::vector<CommandBasePtr> cmds = postVersions(client, 3);
+  CHECK(isResultOf(client.waitCommand(cmds[2]), cmds[2]));
+  CHECK(client.pendingResultCount() == 2);
+  CHECK(isResultOf(client.waitCommand(cmds[1]), cmds[1]));
+  CHECK(isResultOf(client.waitCommand(cmds[0]), cmds[0]));
+  thread.join();
+}
+
+// A result that can't be parsed fails its own command only
+void testUnparsableResult()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::vector<CommandBasePtr> cmds = receiveCommands(server, 2);
+    server.send(FakeServer::frame(FakeServer::result("NoSuchResult", cmds[0]->toString())) +
+                FakeServer::frame(Cmd::SuccessResult::create(cmds[1])));
+    server.closeClient();
+  });
+
+  CmdClient client(true);
+  CHECK(client.connectToHost("127.0.0.1", server.port()));
+  std::vector<CommandBasePtr> cmds = postVersions(client, 2);
+  CHECK(isResultOf(client.waitCommand(cmds[1]), cmds[1]));
+
+  // The parse error is reported, not the disconnection which follows
+  std::string error;
+  try
+  {
+    client.waitCommand(cmds[0]);
+  }
+  catch (const std::runtime_error& e)
+  {
+    error = e.what();
+  }
+  CHECK(!error.empty() && error.find("Connection lost") == std::string::npos);
+  thread.join();
+}
+
+// The callback of an asynchronous command is completed with nullptr when its result can't be parsed. The connection
+// stays open until the client is destroyed, so the callback isn't completed by the disconnection.
+void testUnparsableAsyncResult()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::vector<CommandBasePtr> cmds = receiveCommands(server, 2);
+    server.send(FakeServer::frame(FakeServer::result("NoSuchResult", cmds[0]->toString())) +
+                FakeServer::frame(Cmd::SuccessResult::create(cmds[1])));
+    server.receiveCommand();
+    server.closeClient();
+  });
+
+  // Declared before the client, which completes the callbacks still registered when destroyed
+  std::promise<CommandResultPtr> failed;
+  std::promise<CommandResultPtr> succeeded;
+  std::future<CommandResultPtr> failedResult = failed.get_future();
+  std::future<CommandResultPtr> succeededResult = succeeded.get_future();
+  {
+    CmdClient client(true);
+    CHECK(client.connectToHost("127.0.0.1", server.port()));
+    CommandBasePtr failing = Cmd::GetVersion::create();
+    CommandBasePtr succeeding = Cmd::GetVersion::create();
+    CHECK(client.sendCommandAsync(failing, [&](CommandResultPtr result) { failed.set_value(result); }));
+    CHECK(client.sendCommandAsync(succeeding, [&](CommandResultPtr result) { succeeded.set_value(result); }));
+
+    CHECK(succeededResult.wait_for(std::chrono::seconds(5)) == std::future_status::ready &&
+          isResultOf(succeededResult.get(), succeeding));
+    CHECK(failedResult.wait_for(std::chrono::seconds(0)) == std::future_status::ready && !failedResult.get());
+  }
+  thread.join();
+}
+
+// A thread waiting synchronously reads for everybody until the reactor takes over, completing the asynchronous
+// commands on the way
+void testMixedSyncAndAsync()
+{
+  FakeServer server;
+  std::thread thread([&] {
+    server.acceptClient();
+    std::vector<CommandBasePtr> cmds = receiveCommands(server, 2);
+    server.send(FakeServer::frame(Cmd::SuccessResult::create(cmds[1])));
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    server.send(FakeServer::frame(Cmd::SuccessResult::create(cmds[0])));
+    CommandBasePtr last = server.receiveCommand();
+    server.send(FakeServer::frame(Cmd::SuccessResult::create(last)));
+    server.receiveCommand();
+    server.closeClient();
+  });
+
+  std::promise<CommandResultPtr> first;
+  std::promise<CommandResultPtr> second;
+  std::future<CommandResultPtr> firstResult = first.get_future();
+  std::future<CommandResultPtr> secondResult = second.get_future();
+  {
+    CmdClient client(true);
+    CHECK(client.connectToHost("127.0.0.1", server.port()));
+    CommandBasePtr waited = postVersions(client, 1).front();
+    std::future<CommandResultPtr> waitedResult = std::async(std::launch::async, [&] {
+      return client.waitCommand(waited);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    CommandBasePtr async = Cmd::GetVersion::create();
+    CHECK(client.sendCommandAsync(async, [&](CommandResultPtr result) { first.set_value(result); }));
+    CHECK(firstResult.wait_for(std::chrono::seconds(5)) == std::future_status::ready &&
+          isResultOf(firstResult.get(), async));
+    CHECK(waitedResult.wait_for(std::chrono::seconds(5)) == std::future_status::ready &&
+          isResultOf(waitedResult.get(), waited));
+
+    CommandBasePtr last = Cmd::GetVersion::create();
+    CHECK(client.sendCommandAsync(last, [&](CommandResultPtr result) { second.set_value(result); }));
+    CHECK(secondResult.wait_for(std::chrono::seconds(5)) == std::future_status::ready &&
+          isResultOf(secondResult.get(), last));
+  }
+  thread.join();
+}
+} // namespace
+
+int main()
+{
+  testCoalescedResults();
+  testFragmentedResults();
+  testLargeResult();
+  testOutOfOrderResults();
+  testPendingTableEviction();
+  testPendingTableDuplicate();
+  testUnparsableResult();
+  testUnparsableAsyncResult();
+  testMixedSyncAndAsync();
+  return Check::failures();
+}
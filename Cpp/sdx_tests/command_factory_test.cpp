@@ -0,0 +1,81 @@
+#include <rapidjson/document.h>
+#include <rapidjson/stringbuffer.h>
+#include <rapidjson/writer.h>
+
+#include <string>
+
+#include "all_commands.h"
+#include "check.h"
+#include "command_factory.h"
+
+using namespace Sdx;
+
+namespace
+{
+// Serialized SuccessResult whose RelatedCommand member is replaced, or removed if relatedCommand is null
+std::string resultWithRelatedCommand(const char* relatedCommand)
+{
+  rapidjson::Document doc;
+  doc.Parse(Cmd::SuccessResult::create(Cmd::GetVersion::create())->toString().c_str());
+  doc.RemoveMember(CommandResult::RelatedCommand.c_str());
+  if (relatedCommand)
+  {
+    rapidjson::Value value(relatedCommand, doc.GetAllocator());
+    doc.AddMember(rapidjson::StringRef(CommandResult::RelatedCommand.c_str()), value, doc.GetAllocator());
+  }
+
+  rapidjson::StringBuffer buffer;
+  rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+  doc.Accept(writer);
+  return buffer.GetString();
+}
+
+// A result can't be matched to its command without the uuid of its related command
+void testResultWithoutRelatedCommand()
+{
+  std::string errorMsg;
+  CHECK(!CommandFactory::instance()->createCommandResult(resultWithRelatedCommand(nullptr), &errorMsg));
+  CHECK(!errorMsg.empty());
+
+  errorMsg.clear();
+  CHECK(!CommandFactory::instance()->createCommandResult(resultWithRelatedCommand("not a command"), &errorMsg));
+  CHECK(!errorMsg.empty());
+
+  errorMsg.clear();
+  CHECK(!CommandFactory::instance()->createCommandResult(resultWithRelatedCommand("{\"CmdName\":\"GetVersion\"}"),
+                                                         &errorMsg));
+  CHECK(!errorMsg.empty());
+}
+
+// The related command is only parsed when it is requested, an unknown one reads as null
+void testResultWithUnknownRelatedCommand()
+{
+  const std::string related = "{\"CmdName\":\"NotACommand\",\"CmdUuid\":\"{1234}\"}";
+  CommandResultPtr result = CommandFactory::instance()->createCommandResult(resultWithRelatedCommand(related.c_str()));
+  CHECK(result);
+  if (!result)
+    return;
+
+  CHECK(result->relatedCommandUuid() == "{1234}");
+  CHECK(!result->relatedCommand());
+  CHECK(result->timestamp() == 0.0);
+}
+
+// A valid related command is parsed on first use
+void testResultWithRelatedCommand()
+{
+  CommandBasePtr cmd = Cmd::GetVersion::create();
+  CommandResultPtr result =
+    CommandFactory::instance()->createCommandResult(Cmd::SuccessResult::create(cmd)->toString());
+  CHECK(result && result->relatedCommandUuid() == cmd->uuid());
+  CHECK(result && result->relatedCommand() && result->relatedCommand()->uuid() == cmd->uuid());
+}
+} // namespace
+
+int main()
+{
+  testResultWithoutRelatedCommand();
+  testResultWithUnknownRelatedCommand();
+  testResultWithRelatedCommand();
+  return Check::failures();
+}
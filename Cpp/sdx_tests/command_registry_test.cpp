@@ -0,0 +1,108 @@
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "check.h"
+#include "command_base.h"
+#include "command_registry.h"
+
+using namespace Sdx;
+
+namespace
+{
+struct GeneratedCommand
+{
+  std::string targetId;
+  std::string cmdName;
+};
+
+// Value of the string constant "ClassName::Constant = "value"" in a generated source
+bool findConstant(const std::string& source, const std::string& className, const char* constant, std::string& value)
+{
+  const std::string prefix = className + "::" + constant + " = \"";
+  const std::size_t begin = source.find(prefix);
+  if (begin == std::string::npos)
+    return false;
+  const std::size_t valueBegin = begin + prefix.size();
+  const std::size_t valueEnd = source.find('"', valueBegin);
+  if (valueEnd == std::string::npos)
+    return false;
+  value = source.substr(valueBegin, valueEnd - valueBegin);
+  return true;
+}
+
+// The commands registered to the factory by the generated sources, with the constants they are created from
+std::vector<GeneratedCommand> generatedCommands()
+{
+  const std::string macro = "REGISTER_COMMAND_TO_FACTORY_IMPL(";
+  std::vector<GeneratedCommand> commands;
+  for (const std::filesystem::directory_entry& entry : std::filesystem::directory_iterator(SDX_GENERATED_DIR))
+  {
+    if (entry.path().extension() != ".cpp")
+      continue;
+
+    std::ifstream file(entry.path());
+    std::stringstream stream;
+    stream << file.rdbuf();
+    const std::string source = stream.str();
+
+    const std::size_t begin = source.find(macro);
+    if (begin == std::string::npos)
+      continue;
+    const std::size_t end = source.find(')', begin);
+    const std::string className = source.substr(begin + macro.size(), end - begin - macro.size());
+
+    GeneratedCommand command;
+    const bool hasConstants = findConstant(source, className, "CmdName", command.cmdName) &&
+                              findConstant(source, className, "TargetId", command.targetId);
+    CHECK(hasConstants);
+    if (hasConstants)
+      commands.push_back(std::move(command));
+  }
+  return commands;
+}
+
+// Every generated command can be created, and the registry holds nothing else
+void testRegistryMatchesGeneratedCommands()
+{
+  const std::vector<GeneratedCommand> commands = generatedCommands();
+  CHECK(!commands.empty());
+  CHECK(registeredCommands().size() == commands.size());
+
+  for (const GeneratedCommand& command : commands)
+  {
+    const CommandRegistryEntry* entry = findRegisteredCommand(command.targetId, command.cmdName);
+    if (!entry)
+      std::cout << command.cmdName << " is missing from the command registry" << std::endl;
+    CHECK(entry);
+  }
+}
+
+// Each name creates the command of that name
+void testRegisteredCommandsCreateTheirCommand()
+{
+  std::set<std::pair<std::string_view, std::string_view>> keys;
+  for (const CommandRegistryEntry& entry : registeredCommands())
+  {
+    CommandBasePtr cmd = entry.create();
+    const bool isCreated = cmd && cmd->name() == entry.cmdName;
+    if (!isCreated)
+      std::cout << entry.cmdName << " creates another command" << std::endl;
+    CHECK(isCreated);
+    CHECK(findRegisteredCommand(entry.targetId, entry.cmdName) == &entry);
+    CHECK(keys.emplace(entry.targetId, entry.cmdName).second);
+  }
+}
+} // namespace
+
+int main()
+{
+  testRegistryMatchesGeneratedCommands();
+  testRegisteredCommandsCreateTheirCommand();
+  return Check::failures();
+}
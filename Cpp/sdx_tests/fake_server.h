@@ -0,0 +1,153 @@
+#ifndef FAKE_SERVER_H
+#define FAKE_SERVER_H
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "cmd_client.h"
+#include "command_factory.h"
+#include "command_result.h"
+
+//
+// Loopback stand-in for the simulator's command server, scripted by the test: it reads the command frames and
+// writes back whatever result frames the test builds, in any order and cut at any byte.
+//
+class FakeServer
+{
+public:
+  // Listens on port, or on a free port if 0
+  explicit FakeServer(int port = 0)
+  {
+    m_listener = socket(AF_INET, SOCK_STREAM, 0);
+    int reuseAddress = 1;
+    setsockopt(m_listener, SOL_SOCKET, SO_REUSEADDR, &reuseAddress, sizeof(reuseAddress));
+    sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(static_cast<uint16_t>(port));
+    socklen_t size = sizeof(addr);
+    if (m_listener < 0 || bind(m_listener, reinterpret_cast<sockaddr*>(&addr), size) < 0 ||
+        listen(m_listener, 1) < 0 || getsockname(m_listener, reinterpret_cast<sockaddr*>(&addr), &size) < 0)
+      throw std::runtime_error("Unable to listen on the loopback");
+    m_port = ntohs(addr.sin_port);
+  }
+
+  ~FakeServer()
+  {
+    closeClient();
+    close(m_listener);
+  }
+
+  inline int port() const { return m_port; }
+
+  void acceptClient()
+  {
+    m_client = accept(m_listener, nullptr, nullptr);
+    int noDelay = 1;
+    setsockopt(m_client, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof(noDelay));
+  }
+
+  void closeClient()
+  {
+    if (m_client >= 0)
+      close(m_client);
+    m_client = -1;
+  }
+
+  // JSON of the next command frame, false once the client is gone
+  bool receiveFrame(std::string& json)
+  {
+    char header[3];
+    if (!read(header, sizeof(header)))
+      return false;
+
+    uint16_t length;
+    memcpy(&length, header, sizeof(length));
+    json.resize(length - 1);
+    if (!read(json.data(), json.size()))
+      return false;
+    if (!json.empty() && json.back() == '\0')
+      json.pop_back();
+    return true;
+  }
+
+  // Next command, nullptr once the client is gone
+  Sdx::CommandBasePtr receiveCommand()
+  {
+    std::string json;
+    if (!receiveFrame(json))
+      return nullptr;
+    return Sdx::CommandFactory::instance()->createCommand(json);
+  }
+
+  // JSON of a result of the command, built without the command factory so any result name can be sent
+  static std::string result(const std::string& resultName, const std::string& cmdJson)
+  {
+    std::string json = "{\"CmdName\":\"" + resultName +
+                       "\",\"CmdUuid\":\"00000000-0000-0000-0000-000000000000\",\"RelatedCommand\":\"";
+    for (char c : cmdJson)
+    {
+      if (c == '"' || c == '\\')
+        json.push_back('\\');
+      json.push_back(c);
+    }
+    json += "\"}";
+    return json;
+  }
+
+  // Frame of a result, as the simulator sends it
+  static std::string frame(const std::string& json)
+  {
+    const uint32_t jsonLength = static_cast<uint32_t>(json.size() + 1);
+    const uint16_t length = static_cast<uint16_t>((1 + 4 + jsonLength) & 0xffff);
+    std::string bytes(7, '\0');
+    memcpy(&bytes[0], &length, sizeof(length));
+    bytes[2] = static_cast<char>(Sdx::CmdMsgId_Result);
+    memcpy(&bytes[3], &jsonLength, sizeof(jsonLength));
+    bytes += json;
+    bytes.push_back('\0');
+    return bytes;
+  }
+
+  static std::string frame(Sdx::CommandResultPtr result) { return frame(result->toString()); }
+
+  // Writes the bytes in chunks of chunkSize bytes, 0 for a single write
+  void send(const std::string& bytes, std::size_t chunkSize = 0)
+  {
+    const std::size_t step = chunkSize == 0 ? bytes.size() : chunkSize;
+    for (std::size_t i = 0; i < bytes.size(); i += step)
+    {
+      const std::size_t size = std::min(step, bytes.size() - i);
+      if (::send(m_client, bytes.data() + i, size, MSG_NOSIGNAL) != static_cast<ssize_t>(size))
+        throw std::runtime_error("Unable to send to the client");
+    }
+  }
+
+private:
+  bool read(char* data, std::size_t size)
+  {
+    while (size > 0)
+    {
+      const ssize_t rx = recv(m_client, data, size, 0);
+      if (rx <= 0)
+        return false;
+      data += rx;
+      size -= static_cast<std::size_t>(rx);
+    }
+    return true;
+  }
+
+  int m_listener = -1;
+  int m_client = -1;
+  int m_port = 0;
+};
+
+#endif // FAKE_SERVER_H
@@ -0,0 +1,207 @@
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "all_commands.h"
+#include "api_version.h"
+#include "check.h"
+#include "cmd_scheduler.h"
+#include "fake_server.h"
+#include "remote_simulator.h"
+
+using namespace Sdx;
+
+namespace
+{
+// RemoteSimulator connects to 4820 + id
+const int SimulatorId = 37;
+const int HilPort = 4900;
+
+// Receives the HIL datagrams, a HIL port nobody listens on makes the next datagram fail
+class HilSink
+{
+public:
+  HilSink()
+  {
+    m_socket = socket(AF_INET, SOCK_DGRAM, 0);
+    sockaddr_in addr {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(HilPort);
+    if (m_socket < 0 || bind(m_socket, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) < 0)
+      throw std::runtime_error("Unable to bind the HIL port");
+  }
+
+  ~HilSink() { close(m_socket); }
+
+private:
+  int m_socket;
+};
+
+// Answers the API version and the GetHilPort command sent by RemoteSimulator::connect
+bool acceptSimulator(FakeServer& server)
+{
+  server.acceptClient();
+  std::string version;
+  if (!server.receiveFrame(version))
+    return false;
+
+  std::string bytes(7, '\0');
+  const uint16_t length = 5;
+  const uint32_t apiVersion = Cmd::COMMANDS_API_VERSION;
+  memcpy(&bytes[0], &length, sizeof(length));
+  bytes[2] = static_cast<char>(CmdMsgId_ApiVersion);
+  memcpy(&bytes[3], &apiVersion, sizeof(apiVersion));
+  server.send(bytes);
+
+  CommandBasePtr getHilPort = server.receiveCommand();
+  if (!getHilPort)
+    return false;
+  server.send(FakeServer::frame(Cmd::HilPortResult::create(getHilPort, HilPort)));
+  return true;
+}
+
+// Answers every command until the client is gone, and keeps the uuids in the order the commands were received
+std::thread answerAll(FakeServer& server, std::vector<std::string>& received)
+{
+  return std::thread([&server, &received] {
+    if (acceptSimulator(server))
+    {
+      while (CommandBasePtr cmd = server.receiveCommand())
+      {
+        received.push_back(cmd->uuid());
+        server.send(FakeServer::frame(Cmd::SuccessResult::create(cmd)));
+      }
+    }
+    server.closeClient();
+  });
+}
+
+// The results received before the connection is lost are kept, the others are reported as failures
+void testCommitBatchAfterConnectionLoss()
+{
+  HilSink hilSink;
+  FakeServer server(4820 + SimulatorId);
+  std::thread thread([&] {
+    if (acceptSimulator(server))
+    {
+      CommandBasePtr first = server.receiveCommand();
+      server.receiveCommand();
+      server.receiveCommand();
+      if (first)
+        server.send(FakeServer::frame(Cmd::SuccessResult::create(first)));
+    }
+    server.closeClient();
+  });
+
+  RemoteSimulator sim;
+  CHECK(sim.connect("127.0.0.1", SimulatorId));
+  sim.beginBatch();
+  CommandBasePtr first = sim.post(Cmd::GetVersion::create());
+  sim.post(Cmd::GetVersion::create());
+  sim.post(Cmd::GetVersion::create());
+
+  CommandBatchResult batchResult;
+  bool thrown = false;
+  try
+  {
+    batchResult = sim.commitBatch();
+  }
+  catch (const std::exception&)
+  {
+    thrown = true;
+  }
+
+  CHECK(!thrown);
+  CHECK(batchResult.results.size() == 3);
+  if (batchResult.results.size() == 3)
+  {
+    CHECK(batchResult.results[0] && batchResult.results[0]->relatedCommandUuid() == first->uuid());
+    CHECK(!batchResult.results[1] && !batchResult.results[2]);
+  }
+  CHECK(!batchResult.isSuccess());
+  thread.join();
+}
+
+// An asynchronous call during a batch is rejected instead of being sent ahead of the batch
+void testCallAsyncDuringBatch()
+{
+  HilSink hilSink;
+  FakeServer server(4820 + SimulatorId);
+  std::vector<std::string> received;
+  std::thread thread = answerAll(server, received);
+
+  CommandBasePtr batched = Cmd::GetVersion::create();
+  {
+    RemoteSimulator sim;
+    CHECK(sim.connect("127.0.0.1", SimulatorId));
+    sim.beginBatch();
+    sim.post(batched);
+
+    bool thrown = false;
+    try
+    {
+      sim.callAsync(Cmd::GetVersion::create(), [](CommandResultPtr) {});
+    }
+    catch (const std::runtime_error&)
+    {
+      thrown = true;
+    }
+    CHECK(thrown);
+    CHECK(sim.commitBatch().isSuccess());
+    sim.disconnect();
+  }
+
+  thread.join();
+  CHECK(received.size() == 1 && received.front() == batched->uuid());
+}
+
+CmdTask callDuringBatch(RemoteSimulator& sim, bool& thrown)
+{
+  try
+  {
+    co_await sim.callCo(Cmd::GetVersion::create());
+  }
+  catch (const std::runtime_error&)
+  {
+    thrown = true;
+  }
+}
+
+// Same for a coroutine call, the exception is thrown where the call is awaited
+void testCallCoDuringBatch()
+{
+  HilSink hilSink;
+  FakeServer server(4820 + SimulatorId);
+  std::vector<std::string> received;
+  std::thread thread = answerAll(server, received);
+
+  CommandBasePtr batched = Cmd::GetVersion::create();
+  {
+    RemoteSimulator sim;
+    CHECK(sim.connect("127.0.0.1", SimulatorId));
+    sim.beginBatch();
+    sim.post(batched);
+
+    bool thrown = false;
+    CmdScheduler scheduler;
+    scheduler.spawn(callDuringBatch(sim, thrown));
+    scheduler.run();
+    CHECK(thrown);
+    CHECK(sim.commitBatch().isSuccess());
+    sim.disconnect();
+  }
+
+  thread.join();
+  CHECK(received.size() == 1 && received.front() == batched->uuid());
+}
+} // namespace
+
+int main()
+{
+  testCommitBatchAfterConnectionLoss();
+  testCallAsyncDuringBatch();
+  testCallCoDuringBatch();
+  return Check::failures();
+}
@@ -0,0 +1,141 @@
+#include <rapidjson/document.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "all_commands.h"
+#include "check.h"
+#include "command_factory.h"
+
+using namespace Sdx;
+
+namespace
+{
+std::vector<std::vector<double>> pattern(double scale)
+{
+  std::vector<std::vector<double>> gain(19, std::vector<double>(37));
+  for (std::size_t row = 0; row < gain.size(); ++row)
+  {
+    for (std::size_t col = 0; col < gain[row].size(); ++col)
+      gain[row][col] = scale * (static_cast<double>(row) - 0.25 * static_cast<double>(col));
+  }
+  return gain;
+}
+
+std::string serializedGainResult(const std::vector<std::vector<double>>& gain)
+{
+  CommandBasePtr cmd = Cmd::GetVehicleAntennaGain::create(GNSSBand::L2, std::string("Antenna"));
+  return Cmd::GetVehicleAntennaGainResult::create(cmd, gain, AntennaPatternType::Custom, GNSSBand::L2, "Antenna")
+    ->toString();
+}
+
+Cmd::GetVehicleAntennaGainResultPtr decode(const std::string& json)
+{
+  return Cmd::GetVehicleAntennaGainResult::dynamicCast(CommandFactory::instance()->createCommand(json));
+}
+
+bool isSameDocument(const std::string& json, const std::string& expectedJson)
+{
+  rapidjson::Document doc;
+  rapidjson::Document expected;
+  doc.Parse(json.c_str());
+  expected.Parse(expectedJson.c_str());
+  return !doc.HasParseError() && !expected.HasParseError() && doc == expected;
+}
+
+// A decoded result reads and serializes as if it had been parsed by the document
+void testRoundTrip()
+{
+  const std::vector<std::vector<double>> gain = pattern(0.5);
+  const std::string json = serializedGainResult(gain);
+
+  Cmd::GetVehicleAntennaGainResultPtr result = decode(json);
+  CHECK(result);
+  if (!result)
+    return;
+
+  CHECK(result->gain() == gain);
+  CHECK(result->type() == AntennaPatternType::Custom);
+  CHECK(result->band() == GNSSBand::L2);
+
+  rapidjson::Document expected;
+  expected.Parse(json.c_str());
+  CHECK(result->values() == expected);
+  CHECK(isSameDocument(result->toString(), json));
+  CHECK(result->gain() == gain);
+}
+
+// Decoded fields stay readable once the document has been completed and the command is set again
+void testSetAfterSerialization()
+{
+  const std::vector<std::vector<double>> gain = pattern(0.5);
+  const std::string json = serializedGainResult(gain);
+  rapidjson::Document owner; // Allocates the values set through setValue, outlives the result
+
+  Cmd::GetVehicleAntennaGainResultPtr result = decode(json);
+  CHECK(result);
+  if (!result)
+    return;
+
+  result->toString();
+  result->setBand(GNSSBand::L5);
+  CHECK(result->gain() == gain);
+
+  result->toString();
+  result->setRelatedCommand(Cmd::GetVehicleAntennaGain::create(GNSSBand::L5, std::string("Antenna")));
+  CHECK(result->gain() == gain);
+
+  const std::vector<std::vector<double>> newGain = pattern(2.0);
+  result->setGain(newGain);
+  CHECK(result->gain() == newGain);
+
+  // Set through the document instead of the generated setter
+  rapidjson::Value value = parse_json<std::vector<std::vector<double>>>::format(newGain, owner.GetAllocator());
+  result = decode(json);
+  result->toString();
+  result->setValue("Gain", value);
+  CHECK(result->gain() == newGain);
+  CHECK(result->isValid());
+}
+
+// A snapshot is shared by the reads until the field is set, and stays valid after it is set
+void testSnapshot()
+{
+  const std::vector<std::vector<double>> gain = pattern(0.5);
+  const std::vector<std::vector<double>> newGain = pattern(2.0);
+  const std::string json = serializedGainResult(gain);
+
+  Cmd::GetVehicleAntennaGainResultPtr decoded = decode(json);
+  CHECK(decoded);
+  if (!decoded)
+    return;
+
+  Cmd::GetVehicleAntennaGainResultPtr created = Cmd::GetVehicleAntennaGainResult::create(
+    Cmd::GetVehicleAntennaGain::create(GNSSBand::L2, std::string("Antenna")),
+    gain,
+    AntennaPatternType::Custom,
+    GNSSBand::L2,
+    "Antenna");
+
+  for (const Cmd::GetVehicleAntennaGainResultPtr& result : {decoded, created})
+  {
+    std::shared_ptr<const std::vector<std::vector<double>>> snapshot = result->gainPtr();
+    CHECK(snapshot && *snapshot == gain);
+    CHECK(result->gainPtr() == snapshot);
+
+    result->setGain(newGain);
+    CHECK(*snapshot == gain);
+    CHECK(*result->gainPtr() == newGain);
+    CHECK(result->gain() == newGain);
+  }
+}
+} // namespace
+
+int main()
+{
+  testRoundTrip();
+  testSetAfterSerialization();
+  testSnapshot();
+  return Check::failures();
+}